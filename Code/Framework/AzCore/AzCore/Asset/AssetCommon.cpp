@@ -159,9 +159,9 @@ namespace AZ::Data
         {
             if (AssetManager::IsReady())
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(AssetManager::Instance().m_assetMutex);
-                auto it = AssetManager::Instance().m_assets.find(id);
-                if (it != AssetManager::Instance().m_assets.end())
+                auto assets = AssetManager::Instance().m_assets.LockShard(id);
+                auto it = assets->find(id);
+                if (it != assets->end())
                 {
                     return { it->second, assetReferenceLoadBehavior };
                 }
@@ -224,7 +224,11 @@ namespace AZ::Data
         AZ_Assert(m_useCount >= 0, "AssetData has been deleted");
 
         AcquireWeak();
-        ++m_useCount;
+        if (m_useCount.fetch_add(1) == 0 && m_isSoftReleased.load() && m_isSoftReleased.exchange(false))
+        {
+            // The asset was kept resident after its last release and is now used again.
+            AssetManager::Instance().OnSoftReleasedAssetReused(this);
+        }
     }
 
     void AssetData::Release()
@@ -202,6 +202,8 @@ namespace AZ
             AssetData(const AssetData&) = delete;
             AZStd::atomic_int m_useCount{ 0 };
             AZStd::atomic_int m_weakUseCount{ 0 };
+            //! Set while the AssetManager keeps the asset resident after its last reference was released.
+            AZStd::atomic_bool m_isSoftReleased{ false };
             AZStd::atomic<AssetStatus> m_status;
             AssetId m_assetId;
 
@@ -454,7 +456,9 @@ namespace AZ
 
         protected:
 
-            void SetData(AssetData* assetData);
+            //! Binds the asset data to this handle. The id and type are taken from the asset data and, if requested, the id
+            //! and hint are upgraded through the catalog afterwards.
+            void SetData(AssetData* assetData, bool upgradeAssetInfo = true);
 
             void swap(Asset& rhs);
 
@@ -831,7 +835,14 @@ namespace AZ
             , m_loadBehavior(rhs.m_loadBehavior)
             , m_assetHint(rhs.m_assetHint)
         {
-            SetData(rhs.m_assetData);
+            // The id and hint of the source were already upgraded when its data was bound, so a copy only needs to take a
+            // reference. This keeps handle copies lock free since they don't need to go through the catalog.
+            constexpr bool upgradeAssetInfo = false;
+            SetData(rhs.m_assetData, upgradeAssetInfo);
+            if (m_assetData)
+            {
+                m_assetId = rhs.m_assetId;
+            }
         }
 
         //=========================================================================
@@ -843,7 +854,14 @@ namespace AZ
             , m_loadBehavior(rhs.m_loadBehavior)
             , m_assetHint(rhs.m_assetHint)
         {
-            SetData(rhs.m_assetData);
+            // The id and hint of the source were already upgraded when its data was bound, so a copy only needs to take a
+            // reference. This keeps handle copies lock free since they don't need to go through the catalog.
+            constexpr bool upgradeAssetInfo = false;
+            SetData(rhs.m_assetData, upgradeAssetInfo);
+            if (m_assetData)
+            {
+                m_assetId = rhs.m_assetId;
+            }
         }
 
         //=========================================================================
@@ -1040,7 +1058,7 @@ namespace AZ
 
         //=========================================================================
         template<class T>
-        void Asset<T>::SetData(AssetData* assetData)
+        void Asset<T>::SetData(AssetData* assetData, bool upgradeAssetInfo)
         {
             // Validate the data type matches or derives from T, or bail
             if (assetData && !assetData->RTTI_IsTypeOf(AzTypeInfo<T>::Uuid()))
@@ -1064,7 +1082,10 @@ namespace AZ
                 assetData->Acquire();
                 m_assetId = assetData->GetId();
                 m_assetType = assetData->RTTI_GetType();
-                UpgradeAssetInfo();
+                if (upgradeAssetInfo)
+                {
+                    UpgradeAssetInfo();
+                }
             }
             if (m_assetData)
             {
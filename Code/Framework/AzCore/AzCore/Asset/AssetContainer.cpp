@@ -10,6 +10,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ::Data
 {
@@ -59,10 +60,23 @@ namespace AZ::Data
         for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
         {
             // Queue each asset to load.
-            auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
-                dependentAsset.GetId(), dependentAsset.GetType(),
-                AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
-                dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
+            Asset<AssetData> queuedDependentAsset;
+            if (auto deadline = m_dependencyDeadlines.find(dependentAsset.GetId()); deadline != m_dependencyDeadlines.end())
+            {
+                AssetLoadParameters dependencyLoadParams = loadParamsCopyWithNoLoadingFilter;
+                dependencyLoadParams.m_deadline = deadline->second;
+                queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
+                    dependentAsset.GetId(), dependentAsset.GetType(),
+                    AZ::Data::AssetLoadBehavior::Default, dependencyLoadParams,
+                    dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
+            }
+            else
+            {
+                queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
+                    dependentAsset.GetId(), dependentAsset.GetType(),
+                    AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                    dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
+            }
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
             AZ_Assert(dependentAsset == queuedDependentAsset, "GetAssetInternal returned an unexpected asset reference for Asset %s",
@@ -167,6 +181,7 @@ namespace AZ::Data
         // Add waiting assets ahead of time to hear signals for any which may already be loading
         AddWaitingAssets(waitingList);
         SetupPreloadLists(move(preloadDependencies), rootAssetId);
+        ScheduleDependentAssets(dependencyInfoList, rootAssetId, loadParams);
 
         auto loadParamsCopyWithNoLoadingFilter = loadParams;
 
@@ -223,6 +238,7 @@ namespace AZ::Data
         // so the dependencies can be hooked up as soon as each asset gets serialized in, even if they start getting serialized
         // while we're still in the middle of triggering all of the asset loads below.
         dependencyAssets = CreateAndQueueDependentAssets(dependencyInfoList, loadParamsCopyWithNoLoadingFilter);
+        m_dependencyDeadlines.clear();
 
         // Add all of the queued dependent assets as dependencies
         {
@@ -674,6 +690,89 @@ namespace AZ::Data
         }
     }
 
+    AZ::u32 AssetContainer::GetPreloadDepth(const AssetId& assetId, AZStd::unordered_map<AssetId, AZ::u32>& depths) const
+    {
+        if (auto depth = depths.find(assetId); depth != depths.end())
+        {
+            return depth->second;
+        }
+        // Mark the asset as visited before recursing. Circular preloads have been removed by SetupPreloadLists, but this makes
+        // sure a cycle can't recurse forever.
+        depths[assetId] = 0;
+
+        AZ::u32 result = 0;
+        if (auto preloads = m_preloadList.find(assetId); preloads != m_preloadList.end())
+        {
+            for (const AssetId& preloadId : preloads->second)
+            {
+                // Every asset with preloads also waits on itself.
+                if (preloadId != assetId)
+                {
+                    result = AZStd::max(result, GetPreloadDepth(preloadId, depths) + 1);
+                }
+            }
+        }
+        depths[assetId] = result;
+        return result;
+    }
+
+    void AssetContainer::ScheduleDependentAssets(
+        AZStd::vector<AssetInfo>& dependencyInfoList, const AssetId& rootAssetId, const AssetLoadParameters& loadParams)
+    {
+        AZStd::unordered_map<AssetId, AZ::u32> depths;
+        AZ::u32 maxDepth = 0;
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+            if (m_preloadList.empty())
+            {
+                // Without preloads every asset can be deserialized as soon as its data arrives, so the order doesn't matter.
+                return;
+            }
+            maxDepth = GetPreloadDepth(rootAssetId, depths);
+            for (const AssetInfo& info : dependencyInfoList)
+            {
+                maxDepth = AZStd::max(maxDepth, GetPreloadDepth(info.m_assetId, depths));
+            }
+
+            // Assets no other asset preloads only hold up the root, so they're placed in the last level, after all preloads.
+            AZStd::unordered_set<AssetId> preloadedAssets;
+            for (const auto& [assetId, preloadIds] : m_preloadList)
+            {
+                for (const AssetId& preloadId : preloadIds)
+                {
+                    if (preloadId != assetId)
+                    {
+                        preloadedAssets.insert(preloadId);
+                    }
+                }
+            }
+            for (const AssetInfo& info : dependencyInfoList)
+            {
+                if (preloadedAssets.find(info.m_assetId) == preloadedAssets.end())
+                {
+                    depths[info.m_assetId] = maxDepth;
+                }
+            }
+        }
+
+        // Queue the deepest preloads first. The catalog returns the dependencies breadth first, so without this the assets at
+        // the end of a long preload chain would be read last, while all assets above them can't finish until they're ready.
+        AZStd::stable_sort(dependencyInfoList.begin(), dependencyInfoList.end(),
+            [&depths](const AssetInfo& lhs, const AssetInfo& rhs)
+            {
+                return depths[lhs.m_assetId] < depths[rhs.m_assetId];
+            });
+
+        if (loadParams.m_deadline)
+        {
+            // Split the deadline over the preload levels, so the streamer reads the assets in the order they're needed.
+            for (const AssetInfo& info : dependencyInfoList)
+            {
+                m_dependencyDeadlines[info.m_assetId] = (*loadParams.m_deadline * (depths[info.m_assetId] + 1)) / (maxDepth + 1);
+            }
+        }
+    }
+
     bool AssetContainer::HasPreloads(const AssetId& assetId) const
     {
         AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
@@ -108,6 +108,14 @@ namespace AZ
             // will be removed from the waiting list in the container
             void SetupPreloadLists(PreloadAssetListType&& preloadList, const AZ::Data::AssetId& rootAssetId);
             bool HasPreloads(const AZ::Data::AssetId& assetId) const;
+            // Returns the length of the longest chain of preload dependencies below an asset, so assets without preloads have a
+            // depth of zero. Needs to be called with m_preloadMutex locked.
+            AZ::u32 GetPreloadDepth(const AZ::Data::AssetId& assetId, AZStd::unordered_map<AZ::Data::AssetId, AZ::u32>& depths) const;
+            // Sorts the dependencies so every asset is queued after its preload dependencies, and if the load has a deadline,
+            // gives the deeper preload levels earlier deadlines so the reads they need complete first. Dependencies that aren't
+            // preloaded by any asset are queued last with the full deadline.
+            void ScheduleDependentAssets(AZStd::vector<AssetInfo>& dependencyInfoList, const AZ::Data::AssetId& rootAssetId,
+                const AssetLoadParameters& loadParams);
 
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
             void RemoveFromWaitingPreloads(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
@@ -139,6 +147,9 @@ namespace AZ
             AZStd::atomic_bool m_initComplete{ false };
             AZStd::atomic_bool m_finalNotificationSent{false};
 
+            // Deadlines for dependent assets that are derived from the deadline of the load. Only used while queuing the loads.
+            AZStd::unordered_map<AssetId, IO::IStreamerTypes::Deadline> m_dependencyDeadlines;
+
             mutable AZStd::recursive_mutex m_preloadMutex;
             // AssetId -> List of assets it is still waiting on
             PreloadAssetListType m_preloadList;
@@ -630,6 +630,9 @@ namespace AZ::Data
     {
         m_cancelAllActiveJobs = true;
 
+        // Destroy the assets that are only kept alive by the soft release pools, so their unload events are dispatched below.
+        FlushSoftReleasedAssets();
+
         // We want to ensure that no active load jobs are in flight and
         // therefore we need to wait till all jobs have completed. Please note that jobs get deleted automatically once they complete.
         WaitForActiveJobsAndStreamerRequestsToFinish();
@@ -697,20 +700,33 @@ namespace AZ::Data
                     // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
                     WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                    // Assets that are only kept alive by a soft release pool are destroyed while the handler is still available.
+                    AZStd::vector<AssetData*> softReleasedAssets;
+                    do
+                    {
+                        softReleasedAssets.clear();
+                        {
+                            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+                            RemoveSoftReleasedAssets(softReleasedAssets,
+                                [handler](const AssetData* asset) { return asset->m_registeredHandler == handler; });
+                        }
+                        ReleaseSoftReleasedAssets(softReleasedAssets);
+                    } while (!softReleasedAssets.empty());
+
                     {
                         // this scope is used to control the scope of the lock.
                         AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        m_assets.ForEach([handler](const AssetId&, AssetData* assetData)
                         {
                             // is the handler that handles this type, this handler we're removing?
-                            if (assetEntry.second->m_registeredHandler == handler)
+                            if (assetData->m_registeredHandler == handler)
                             {
                                 AZ_Error("AssetManager", false, "Asset handler for %s is being removed, when assetid %s is still loaded!\n",
-                                            assetEntry.second->GetType().ToString<AZ::OSString>().c_str(),
-                                            assetEntry.second->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
-                                assetEntry.second->UnregisterWithHandler();
+                                            assetData->GetType().ToString<AZ::OSString>().c_str(),
+                                            assetData->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
+                                assetData->UnregisterWithHandler();
                             }
-                        }
+                        });
                     }
                     it = m_handlers.erase(it);
                     handler->m_nHandledTypes--;
@@ -732,7 +748,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to register a null catalog!");
         if (catalog)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+            AZStd::scoped_lock<AZStd::shared_mutex> l(m_catalogMutex);
             if (m_catalogs.insert(AZStd::make_pair(assetType, catalog)).second == false)
             {
                 AZ_Error("AssetDatabase", false, "Asset type %s already has a catalog registered! New registration ignored!", assetType.ToString<AZStd::string>().c_str());
@@ -749,7 +765,7 @@ namespace AZ::Data
         AZ_Error("AssetDatabase", catalog != nullptr, "Attempting to unregister a null catalog!");
         if (catalog)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> l(m_catalogMutex);
+            AZStd::scoped_lock<AZStd::shared_mutex> l(m_catalogMutex);
             for (AssetCatalogMap::iterator iter = m_catalogs.begin(); iter != m_catalogs.end(); )
             {
                 if (iter->second == catalog)
@@ -792,43 +808,53 @@ namespace AZ::Data
             return;
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        // First, release any containers that were loading this asset
-        for (auto asset = m_assets.begin();asset != m_assets.end();)
-        {
-            if (asset->second->m_useCount == 0)
-            {
-                auto releaseAsset = asset->second;
-                ++asset;
-                ReleaseAssetContainersForAsset(releaseAsset);
-            }
-            else
-            {
-                ++asset;
-            }
-        }
+        // Assets that became unused while releases were suspended are kept resident first, so they aren't destroyed below.
+        SoftReleaseSuspendedAssets();
 
-        // Second, release the assets themselves
+        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
 
-        AZStd::vector<AssetData*> assetsToRelease;
+        // Other threads can release assets as soon as the suspend count is back to zero and releasing only locks the shard
+        // of the asset, so copy everything that's needed from the asset data while its shard is locked instead of holding
+        // on to the asset data itself.
+        struct ReleaseCandidate
+        {
+            AssetData* m_assetData;
+            AssetId m_assetId;
+            AssetType m_assetType;
+            int m_creationToken;
+            bool m_removeFromHash;
+        };
+        AZStd::vector<AZStd::pair<AssetId, int>> unusedAssets;
+        AZStd::vector<ReleaseCandidate> assetsToRelease;
 
-        for(auto&& asset : m_assets)
+        m_assets.ForEach([&unusedAssets, &assetsToRelease](const AssetId& assetId, AssetData* assetData)
         {
-            if(asset.second->m_weakUseCount == 0)
+            if (assetData->m_useCount == 0)
+            {
+                unusedAssets.emplace_back(assetId, assetData->m_creationToken);
+            }
+            if (assetData->m_weakUseCount == 0)
             {
                 // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
                 // currently looping on.
-                assetsToRelease.push_back(asset.second);
+                bool removeFromHash = assetData->IsRegisterReadonlyAndShareable();
+                // default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map.
+                removeFromHash = assetData->m_creationToken == s_defaultCreationToken ? false : removeFromHash;
+                assetsToRelease.push_back(
+                    { assetData, assetId, assetData->GetType(), assetData->m_creationToken, removeFromHash });
             }
-        }
+        });
 
-        for(auto&& asset : assetsToRelease)
+        // First, release any containers that were loading this asset
+        for (const auto& [assetId, creationToken] : unusedAssets)
         {
-            bool removeFromHash = asset->IsRegisterReadonlyAndShareable();
-            // default creation token implies that the asset was not created by the asset manager and therefore it cannot be in the asset map.
-            removeFromHash = asset->m_creationToken == s_defaultCreationToken ? false : removeFromHash;
+            ReleaseAssetContainersForAsset(assetId, creationToken);
+        }
 
-            ReleaseAsset(asset, asset->GetId(), asset->GetType(), removeFromHash, asset->m_creationToken);
+        // Second, release the assets themselves
+        for (const ReleaseCandidate& asset : assetsToRelease)
+        {
+            ReleaseAsset(asset.m_assetData, asset.m_assetId, asset.m_assetType, asset.m_removeFromHash, asset.m_creationToken);
         }
     }
 
@@ -872,16 +898,21 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
-        if (it != m_assets.end())
+        Asset<AssetData> asset(assetReferenceLoadBehavior);
         {
-            Asset<AssetData> asset(assetReferenceLoadBehavior);
-            asset.SetData(it->second);
-
-            return asset;
+            auto assets = m_assets.LockShard(assetToFind);
+            auto it = assets->find(assetToFind);
+            if (it == assets->end())
+            {
+                return asset;
+            }
+            // Take the reference while the shard is locked so the asset can't be released in between, but leave the catalog
+            // lookup until after the lock is released.
+            constexpr bool upgradeAssetInfo = false;
+            asset.SetData(it->second, upgradeAssetInfo);
         }
-        return Asset<AssetData>(assetReferenceLoadBehavior);
+        asset.UpgradeAssetInfo();
+        return asset;
     }
 
     AZStd::pair<AZ::IO::IStreamerTypes::Deadline, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
@@ -1009,22 +1040,26 @@ namespace AZ::Data
         bool wasUnloaded = false;
         AssetHandler* handler = nullptr;
         AssetData* assetData = nullptr;
-        Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the assetMutex lock.
+        Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the shard lock.
 
-        // Control the scope of the assetMutex lock
+        // Control the scope of the lock on the shard that holds this asset
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            auto assets = m_assets.LockShard(assetInfo.m_assetId);
             bool isNewEntry = false;
 
+            // References are taken while the shard is locked, but the catalog lookups to upgrade the asset info are left until
+            // after the lock has been released.
+            constexpr bool upgradeAssetInfo = false;
+
             // check if asset already exists
             {
                 AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAsset");
 
-                AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                if (it != m_assets.end())
+                auto it = assets->find(assetInfo.m_assetId);
+                if (it != assets->end())
                 {
                     assetData = it->second;
-                    asset.SetData(assetData);
+                    asset.SetData(assetData, upgradeAssetInfo);
                 }
                 else
                 {
@@ -1053,7 +1088,7 @@ namespace AZ::Data
                             assetData->m_assetId = assetInfo.m_assetId;
                             assetData->m_creationToken = ++m_creationTokenGenerator;
                             assetData->RegisterWithHandler(handler);
-                            asset.SetData(assetData);
+                            asset.SetData(assetData, upgradeAssetInfo);
                         }
                         else
                         {
@@ -1070,29 +1105,35 @@ namespace AZ::Data
                 if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                 {
                     AZ_PROFILE_SCOPE(AzCore, "GetAsset: RegisterAsset");
-                    m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
+                    assets->insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
                 }
-                if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
-                {
-                    assetData->m_status = AssetData::AssetStatus::Queued;
-                    UpdateDebugStatus(asset);
-                    loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
-                    wasUnloaded = true;
 
-                    if (loadInfo.IsValid())
-                    {
-                        // Create the AssetDataStream instance here so it can claim an asset reference inside the lock (for a total
-                        // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
-                        // before it is started, which creates state consistency issues.
+                // Claim the load of the asset. Other status changes aren't made under this lock, so only the thread that
+                // moves the asset out of the NotLoaded state starts the load.
+                AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::NotLoaded;
+                wasUnloaded = assetData->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::Queued);
+            }
+        }
 
-                        dataStream = AZStd::make_shared<AssetDataStream>(handler->GetAssetBufferAllocator());
-                    }
-                    else
-                    {
-                        // Asset creation was successful, but asset loading isn't, so trigger the OnAssetError notification
-                        triggerAssetErrorNotification = true;
-                    }
-                }
+        asset.UpgradeAssetInfo();
+
+        if (wasUnloaded)
+        {
+            UpdateDebugStatus(asset);
+            loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
+
+            if (loadInfo.IsValid())
+            {
+                // Create the AssetDataStream instance before the load is queued so it can claim an asset reference (for a total
+                // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
+                // before it is started, which creates state consistency issues.
+
+                dataStream = AZStd::make_shared<AssetDataStream>(handler->GetAssetBufferAllocator());
+            }
+            else
+            {
+                // Asset creation was successful, but asset loading isn't, so trigger the OnAssetError notification
+                triggerAssetErrorNotification = true;
             }
         }
 
@@ -1103,7 +1144,7 @@ namespace AZ::Data
 
         asset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
 
-        // We delay queueing the async file I/O until we release m_assetMutex
+        // We delay queueing the async file I/O until we release the shard lock
         if (dataStream)
         {
             AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
@@ -1230,15 +1271,19 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-
-        Asset<AssetData> asset = FindAsset(assetToFind, assetReferenceLoadBehavior);
-
-        if (!asset)
+        Asset<AssetData> asset(assetReferenceLoadBehavior);
         {
-            asset = CreateAsset(assetToFind, assetType, assetReferenceLoadBehavior);
+            // Keep the shard locked so no other thread can create the asset in between the lookup and the creation.
+            auto assets = m_assets.LockShard(assetToFind);
+            auto it = assets->find(assetToFind);
+            if (it == assets->end())
+            {
+                return CreateAsset(assetToFind, assetType, assetReferenceLoadBehavior);
+            }
+            constexpr bool upgradeAssetInfo = false;
+            asset.SetData(it->second, upgradeAssetInfo);
         }
-
+        asset.UpgradeAssetInfo();
         return asset;
     }
 
@@ -1257,11 +1302,11 @@ namespace AZ::Data
             nullAsset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
             return nullAsset;
         }
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        auto assets = m_assets.LockShard(assetId);
 
         // check if asset already exist
-        AssetMap::iterator it = m_assets.find(assetId);
-        if (it == m_assets.end())
+        auto it = assets->find(assetId);
+        if (it == assets->end())
         {
             // find the asset type handler
             AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
@@ -1279,7 +1324,7 @@ namespace AZ::Data
                     assetData->RegisterWithHandler(handler);
                     if (assetData->IsRegisterReadonlyAndShareable())
                     {
-                        m_assets.insert(AZStd::make_pair(assetId, assetData));
+                        assets->insert(AZStd::make_pair(assetId, assetData));
                     }
 
                     Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -1313,8 +1358,8 @@ namespace AZ::Data
 
         if (removeAssetFromHash)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetId);
+            auto assets = m_assets.LockShard(assetId);
+            auto it = assets->find(assetId);
             // need to check the count again in here in case
            // someone was trying to get the asset on another thread
            // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
@@ -1322,10 +1367,10 @@ namespace AZ::Data
             // if the assetId is not in the map or if the identifierId
             // do not match it implies that the asset has been already destroyed.
             // if the usecount is non zero it implies that we cannot destroy this asset.
-            if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+            if (it != assets->end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
             {
                 wasInAssetsHash = true;
-                m_assets.erase(it);
+                assets->erase(it);
                 destroyAsset = true;
             }
         }
@@ -1374,13 +1419,19 @@ namespace AZ::Data
         // If we're currently suspending asset releases, don't get rid of the asset containers either.
         if (m_suspendAssetRelease)
         {
+            if (m_numSoftReleaseBudgets > 0)
+            {
+                // The asset is offered to its soft release pool once releases are resumed.
+                QueueSuspendedSoftRelease(asset);
+            }
             return;
         }
 
-        ReleaseAssetContainersForAsset(asset);
+        ReleaseAssetContainersForAsset(asset->GetId(), asset->GetCreationToken());
+        SoftReleaseAsset(asset);
     }
 
-    void AssetManager::ReleaseAssetContainersForAsset(AssetData* asset)
+    void AssetManager::ReleaseAssetContainersForAsset(const AssetId& assetId, int creationToken)
     {
         // To be safe, we want to keep the assetMutex locked the whole time to avoid another thread trying to start a load while we're invalidating containers
         // The container mutex is also needed as we're modifying the container storage
@@ -1388,7 +1439,7 @@ namespace AZ::Data
         AZStd::scoped_lock assetLock(m_assetMutex, m_assetContainerMutex);
 
         // Make sure there are no pending reloads using a container before we attempt to release the containers
-        auto reloadsItr = m_reloads.find(asset->GetId());
+        auto reloadsItr = m_reloads.find(assetId);
 
         if (reloadsItr != m_reloads.end())
         {
@@ -1397,8 +1448,6 @@ namespace AZ::Data
 
         // Release any containers that were loading this asset
 
-        AssetId assetId = asset->GetId();
-
         auto rangeItr = m_ownedAssetContainerLookup.equal_range(assetId);
 
         for (auto itr = rangeItr.first; itr != rangeItr.second;)
@@ -1410,7 +1459,7 @@ namespace AZ::Data
             // Sometimes old references (from before a reload) are released which should not cancel newer loads
             const Asset<AssetData>& rootAsset = itr->second->GetRootAsset();
 
-            if (!rootAsset || (rootAsset && rootAsset->GetCreationToken() == asset->GetCreationToken()))
+            if (!rootAsset || (rootAsset && rootAsset->GetCreationToken() == creationToken))
             {
                 itr->second->ClearRootAsset();
 
@@ -1461,14 +1510,24 @@ namespace AZ::Data
 
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            auto assetIter = m_assets.find(assetId);
 
-            if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+            // when Asset<T>'s constructor is called (the one that takes an AssetData), it updates the AssetID
+            // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
+            // implicitly and repeatedly for anything we call.
+            // The reference is taken while the shard of the asset is locked, after that the reference keeps the asset alive.
+            Asset<AssetData> currentAsset;
             {
-                // Only existing assets can be reloaded.
-                ASSET_DEBUG_OUTPUT(AZStd::string::format("Asset does not exist or is already loading - reload abort - " AZ_STRING_FORMAT,
-                    AZ_STRING_ARG(assetId.ToFixedString())));
-                return;
+                auto assets = m_assets.LockShard(assetId);
+                auto assetIter = assets->find(assetId);
+
+                if (assetIter == assets->end() || assetIter->second->IsLoading())
+                {
+                    // Only existing assets can be reloaded.
+                    ASSET_DEBUG_OUTPUT(AZStd::string::format("Asset does not exist or is already loading - reload abort - " AZ_STRING_FORMAT,
+                        AZ_STRING_ARG(assetId.ToFixedString())));
+                    return;
+                }
+                currentAsset = Asset<AssetData>(assetIter->second, AZ::Data::AssetLoadBehavior::Default);
             }
 
             auto reloadIter = m_reloads.find(assetId);
@@ -1507,14 +1566,9 @@ namespace AZ::Data
             AssetData* newAssetData = nullptr;
             AssetHandler* handler = nullptr;
 
-            bool preventAutoReload = isAutoReload && assetIter->second && !assetIter->second->HandleAutoReload();
-
-            // when Asset<T>'s constructor is called (the one that takes an AssetData), it updates the AssetID
-            // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
-            // implicitly and repeatedly for anything we call.
-            Asset<AssetData> currentAsset(assetIter->second, AZ::Data::AssetLoadBehavior::Default);
+            bool preventAutoReload = isAutoReload && !currentAsset->HandleAutoReload();
 
-            if (!assetIter->second->IsRegisterReadonlyAndShareable() && !preventAutoReload)
+            if (!currentAsset->IsRegisterReadonlyAndShareable() && !preventAutoReload)
             {
                 // Reloading an "instance asset" is basically a no-op.
                 // We'll simply notify users to reload the asset.
@@ -1621,23 +1675,29 @@ namespace AZ::Data
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            AZ_Assert(
-                m_assets.find(asset.GetId()) != m_assets.end(),
-                "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
-            AZ_Assert(
-                m_assets.find(asset.GetId()) == m_assets.end() ||
-                    asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
-                "New and old data types are mismatched!");
+            AssetData* newData = asset.Get();
+            bool isNewData = false;
 
-            auto found = m_assets.find(asset.GetId());
-            if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+            // Only keep the shard locked for the lookup so the lock isn't held while listeners are notified.
             {
-                return; // this will just lead to crashes down the line and the above asserts cover this.
-            }
+                auto assets = m_assets.LockShard(asset.GetId());
+                auto found = assets->find(asset.GetId());
+                AZ_Assert(
+                    found != assets->end(),
+                    "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
+                AZ_Assert(
+                    found == assets->end() || asset->RTTI_GetType() == found->second->RTTI_GetType(),
+                    "New and old data types are mismatched!");
 
-            AssetData* newData = asset.Get();
+                if ((found == assets->end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+                {
+                    return; // this will just lead to crashes down the line and the above asserts cover this.
+                }
 
-            if (found->second != newData)
+                isNewData = found->second != newData;
+            }
+
+            if (isNewData)
             {
                 // Notify users that we are about to change asset
                 AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetPreReload, asset);
@@ -1675,6 +1735,318 @@ namespace AZ::Data
         return nullptr;
     }
 
+    //=========================================================================
+    // StartLoadRecording
+    //=========================================================================
+    void AssetManager::StartLoadRecording()
+    {
+        AZStd::scoped_lock<AZStd::mutex> recordingLock(m_loadRecordingMutex);
+        m_recordedLoads.clear();
+        m_recordedAssetIds.clear();
+        m_loadRecordingStart = AZStd::chrono::steady_clock::now();
+        m_isRecordingLoads = true;
+    }
+
+    //=========================================================================
+    // StopLoadRecording
+    //=========================================================================
+    AssetPrefetchManifest AssetManager::StopLoadRecording()
+    {
+        AssetPrefetchManifest manifest;
+        AZStd::scoped_lock<AZStd::mutex> recordingLock(m_loadRecordingMutex);
+        m_isRecordingLoads = false;
+        manifest.m_entries = AZStd::move(m_recordedLoads);
+        m_recordedLoads = {};
+        m_recordedAssetIds = {};
+        return manifest;
+    }
+
+    bool AssetManager::IsRecordingLoads() const
+    {
+        return m_isRecordingLoads;
+    }
+
+    //=========================================================================
+    // PrefetchAssets
+    //=========================================================================
+    AZStd::vector<Asset<AssetData>> AssetManager::PrefetchAssets(
+        const AssetPrefetchManifest& manifest, AZStd::chrono::microseconds deadlineOffset)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZStd::vector<Asset<AssetData>> result;
+        result.reserve(manifest.m_entries.size());
+        size_t numSkipped = 0;
+        for (const AssetPrefetchManifest::Entry& entry : manifest.m_entries)
+        {
+            // The manifest may have been recorded with an older version of the assets, so only prefetch assets that still
+            // exist with the same type.
+            AssetInfo assetInfo;
+            AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, entry.m_assetId);
+            if (!assetInfo.m_assetId.IsValid() || assetInfo.m_assetType != entry.m_assetType)
+            {
+                ++numSkipped;
+                continue;
+            }
+
+            AssetLoadParameters loadParams;
+            loadParams.m_deadline = AZStd::chrono::microseconds(entry.m_loadTimeUs) + deadlineOffset;
+            loadParams.m_priority = IO::IStreamerTypes::s_priorityLowest;
+            // Dependencies are in the manifest as well, so every asset is loaded individually instead of through a container.
+            Asset<AssetData> asset = GetAsset(entry.m_assetId, entry.m_assetType, AssetLoadBehavior::Default, loadParams);
+            if (asset.GetId().IsValid())
+            {
+                result.push_back(AZStd::move(asset));
+            }
+        }
+        AZ_Warning("AssetManager", numSkipped == 0, "%zu of the %zu assets in the prefetch manifest are no longer available.",
+            numSkipped, manifest.m_entries.size());
+        return result;
+    }
+
+    //=========================================================================
+    // SetSoftReleaseBudget
+    //=========================================================================
+    void AssetManager::SetSoftReleaseBudget(const AssetType& assetType, u64 budgetBytes)
+    {
+        AZStd::vector<AssetData*> evicted;
+        SoftReleaseStatistics statistics;
+        {
+            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+            SoftReleasePool& pool = m_softReleasePools[assetType];
+            const bool hadBudget = pool.m_statistics.m_budgetBytes > 0;
+            pool.m_statistics.m_budgetBytes = budgetBytes;
+            if (hadBudget != (budgetBytes > 0))
+            {
+                m_numSoftReleaseBudgets += budgetBytes > 0 ? 1 : -1;
+            }
+            EvictSoftReleasedAssets(pool, evicted);
+            statistics = pool.m_statistics;
+        }
+        ReleaseSoftReleasedAssets(evicted);
+        NotifySoftReleaseStatistics(assetType, statistics);
+    }
+
+    u64 AssetManager::GetSoftReleaseBudget(const AssetType& assetType) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+        auto pool = m_softReleasePools.find(assetType);
+        return pool != m_softReleasePools.end() ? pool->second.m_statistics.m_budgetBytes : 0;
+    }
+
+    SoftReleaseStatistics AssetManager::GetSoftReleaseStatistics(const AssetType& assetType) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+        auto pool = m_softReleasePools.find(assetType);
+        return pool != m_softReleasePools.end() ? pool->second.m_statistics : SoftReleaseStatistics{};
+    }
+
+    //=========================================================================
+    // FlushSoftReleasedAssets
+    //=========================================================================
+    void AssetManager::FlushSoftReleasedAssets()
+    {
+        // Destroying an asset releases its dependencies, which can end up in a pool again, so repeat until nothing was removed.
+        AZStd::vector<AssetData*> removed;
+        do
+        {
+            removed.clear();
+            {
+                AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+                RemoveSoftReleasedAssets(removed, [](const AssetData*) { return true; });
+                // Assets queued while releases are suspended are dropped too, they would otherwise be kept alive by the queue.
+                removed.insert(removed.end(), m_suspendedSoftReleases.begin(), m_suspendedSoftReleases.end());
+                m_suspendedSoftReleases.clear();
+            }
+            ReleaseSoftReleasedAssets(removed);
+        } while (!removed.empty());
+    }
+
+    void AssetManager::SoftReleaseAsset(AssetData* asset)
+    {
+        // Assets that aren't in the asset map can't be found again, so there's no point in keeping them around. Nothing is kept
+        // during shut down as the pools have already been flushed.
+        if (m_numSoftReleaseBudgets == 0 || m_cancelAllActiveJobs || asset->GetCreationToken() == s_defaultCreationToken ||
+            !asset->IsRegisterReadonlyAndShareable() || !asset->IsReady())
+        {
+            return;
+        }
+
+        const AssetType assetType = asset->GetType();
+        {
+            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+            auto pool = m_softReleasePools.find(assetType);
+            if (pool == m_softReleasePools.end() || pool->second.m_statistics.m_budgetBytes == 0)
+            {
+                return;
+            }
+        }
+
+        // Look up the size without holding the lock as the catalog has its own locks. The caller still holds a weak reference,
+        // so the asset can't be destroyed in the meantime.
+        AssetInfo assetInfo;
+        AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, asset->GetId());
+        // Assets the catalog doesn't know the size of still take up memory, so don't let them be free.
+        constexpr u64 UnknownAssetSize = 1024;
+        const u64 sizeBytes = assetInfo.m_sizeBytes > 0 ? assetInfo.m_sizeBytes : UnknownAssetSize;
+
+        AZStd::vector<AssetData*> evicted;
+        SoftReleaseStatistics statistics;
+        {
+            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+            auto poolIt = m_softReleasePools.find(assetType);
+            // An asset that's still in the lookup was claimed by a thread that's about to remove it from its pool.
+            if (poolIt == m_softReleasePools.end() || sizeBytes > poolIt->second.m_statistics.m_budgetBytes ||
+                asset->m_isSoftReleased || m_softReleasedAssets.find(asset) != m_softReleasedAssets.end())
+            {
+                return;
+            }
+
+            // The weak reference keeps the asset data alive and in the asset map, so it can be found by future requests.
+            asset->AcquireWeak();
+            asset->m_isSoftReleased = true;
+
+            // Another thread can acquire the asset at any point, and only claims it from the pool if it sees the flag set.
+            // The use count is checked after the flag is set, so exactly one of the two threads clears it.
+            if (asset->GetUseCount() > 0 && asset->m_isSoftReleased.exchange(false))
+            {
+                evicted.push_back(asset);
+            }
+            else
+            {
+                SoftReleasePool& pool = poolIt->second;
+                pool.m_assets.push_front({ asset, sizeBytes });
+                m_softReleasedAssets[asset] = pool.m_assets.begin();
+                pool.m_statistics.m_residentBytes += sizeBytes;
+                pool.m_statistics.m_residentAssets++;
+
+                EvictSoftReleasedAssets(pool, evicted);
+            }
+            statistics = poolIt->second.m_statistics;
+        }
+        ReleaseSoftReleasedAssets(evicted);
+        NotifySoftReleaseStatistics(assetType, statistics);
+    }
+
+    void AssetManager::QueueSuspendedSoftRelease(AssetData* asset)
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+            // The queue holds a weak reference, so the asset isn't destroyed before it's offered to its pool.
+            asset->AcquireWeak();
+            m_suspendedSoftReleases.push_back(asset);
+        }
+
+        // Release may have been resumed after the suspend count was checked and before the asset was queued.
+        if (m_suspendAssetRelease == 0)
+        {
+            SoftReleaseSuspendedAssets();
+        }
+    }
+
+    void AssetManager::SoftReleaseSuspendedAssets()
+    {
+        AZStd::vector<AssetData*> suspendedAssets;
+        {
+            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+            suspendedAssets.swap(m_suspendedSoftReleases);
+        }
+
+        for (AssetData* asset : suspendedAssets)
+        {
+            if (asset->GetUseCount() == 0)
+            {
+                SoftReleaseAsset(asset);
+            }
+        }
+        ReleaseSoftReleasedAssets(suspendedAssets);
+    }
+
+    void AssetManager::OnSoftReleasedAssetReused(AssetData* asset)
+    {
+        const AssetType assetType = asset->GetType();
+        SoftReleaseStatistics statistics;
+        {
+            AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+            auto entry = m_softReleasedAssets.find(asset);
+            if (entry == m_softReleasedAssets.end())
+            {
+                return;
+            }
+
+            SoftReleasePool& pool = m_softReleasePools[assetType];
+            pool.m_statistics.m_residentBytes -= entry->second->m_sizeBytes;
+            pool.m_statistics.m_residentAssets--;
+            pool.m_statistics.m_hits++;
+            pool.m_assets.erase(entry->second);
+            m_softReleasedAssets.erase(entry);
+            statistics = pool.m_statistics;
+        }
+        // The new user holds a reference, so this doesn't destroy the asset.
+        asset->ReleaseWeak();
+        NotifySoftReleaseStatistics(assetType, statistics);
+    }
+
+    template<typename Filter>
+    void AssetManager::RemoveSoftReleasedAssets(AZStd::vector<AssetData*>& removed, Filter&& filter)
+    {
+        for (auto& [assetType, pool] : m_softReleasePools)
+        {
+            for (auto it = pool.m_assets.begin(); it != pool.m_assets.end();)
+            {
+                // If the flag was already cleared the asset is being reused and the reusing thread will remove it.
+                if (filter(it->m_asset) && it->m_asset->m_isSoftReleased.exchange(false))
+                {
+                    pool.m_statistics.m_residentBytes -= it->m_sizeBytes;
+                    pool.m_statistics.m_residentAssets--;
+                    m_softReleasedAssets.erase(it->m_asset);
+                    removed.push_back(it->m_asset);
+                    it = pool.m_assets.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    void AssetManager::EvictSoftReleasedAssets(SoftReleasePool& pool, AZStd::vector<AssetData*>& evicted)
+    {
+        auto it = pool.m_assets.end();
+        while (pool.m_statistics.m_residentBytes > pool.m_statistics.m_budgetBytes && it != pool.m_assets.begin())
+        {
+            --it;
+            // If the flag was already cleared the asset is being reused and the reusing thread will remove it.
+            if (it->m_asset->m_isSoftReleased.exchange(false))
+            {
+                pool.m_statistics.m_residentBytes -= it->m_sizeBytes;
+                pool.m_statistics.m_residentAssets--;
+                pool.m_statistics.m_evictions++;
+                pool.m_statistics.m_evictedBytes += it->m_sizeBytes;
+                m_softReleasedAssets.erase(it->m_asset);
+                evicted.push_back(it->m_asset);
+                it = pool.m_assets.erase(it);
+            }
+        }
+    }
+
+    void AssetManager::ReleaseSoftReleasedAssets(const AZStd::vector<AssetData*>& assets)
+    {
+        for (AssetData* asset : assets)
+        {
+            asset->ReleaseWeak();
+        }
+    }
+
+    void AssetManager::NotifySoftReleaseStatistics(const AssetType& assetType, const SoftReleaseStatistics& statistics)
+    {
+        if (m_debugAssetEvents)
+        {
+            m_debugAssetEvents->SoftReleaseStatisticsUpdate(assetType, statistics);
+        }
+    }
+
     //=========================================================================
     // AssignAssetData
     //=========================================================================
@@ -1692,8 +2064,9 @@ namespace AZ::Data
             bool requeue{ false };
             {
                 AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                auto found = m_assets.find(assetId);
-                AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
+                auto assets = m_assets.LockShard(assetId);
+                auto found = assets->find(assetId);
+                AZ_Assert(found == assets->end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
                     "New and old data types are mismatched!");
 
                 // if we are here it implies that we have two assets with the same asset id, and we are
@@ -1702,14 +2075,14 @@ namespace AZ::Data
                 // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore
                 // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.
                 asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                if (found != m_assets.end())
+                if (found != assets->end())
                 {
                     found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
                 }
 
                 // Held references to old data are retained, but replace the entry in the DB for future requests.
                 // Fire an OnAssetReloaded message so listeners can react to the new data.
-                m_assets[assetId] = asset.Get();
+                (*assets)[assetId] = asset.Get();
 
                 // Release the reload reference.
                 auto reloadInfo = m_reloads.find(assetId);
@@ -1848,6 +2221,39 @@ namespace AZ::Data
 
         auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, asset.GetType(), loadParams);
 
+        if (!isReload && m_numSoftReleaseBudgets > 0)
+        {
+            SoftReleaseStatistics statistics;
+            bool isBudgeted = false;
+            {
+                AZStd::scoped_lock<AZStd::mutex> softReleaseLock(m_softReleaseMutex);
+                auto pool = m_softReleasePools.find(asset.GetType());
+                if (pool != m_softReleasePools.end() && pool->second.m_statistics.m_budgetBytes > 0)
+                {
+                    pool->second.m_statistics.m_misses++;
+                    statistics = pool->second.m_statistics;
+                    isBudgeted = true;
+                }
+            }
+            if (isBudgeted)
+            {
+                NotifySoftReleaseStatistics(asset.GetType(), statistics);
+            }
+        }
+
+        if (!isReload && m_isRecordingLoads)
+        {
+            AZStd::scoped_lock<AZStd::mutex> recordingLock(m_loadRecordingMutex);
+            if (m_isRecordingLoads && m_recordedAssetIds.insert(asset.GetId()).second)
+            {
+                AssetPrefetchManifest::Entry& entry = m_recordedLoads.emplace_back();
+                entry.m_assetId = asset.GetId();
+                entry.m_assetType = asset.GetType();
+                entry.m_loadTimeUs = aznumeric_cast<u64>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                    AZStd::chrono::steady_clock::now() - m_loadRecordingStart).count());
+            }
+        }
+
         // Track the load request and queue the asset data stream load.
         AddActiveStreamerRequest(asset.GetId(), dataStream);
         dataStream->Open(
@@ -2082,7 +2488,7 @@ namespace AZ::Data
     //=========================================================================
     AssetStreamInfo AssetManager::GetLoadStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+        AZStd::shared_lock<AZStd::shared_mutex> catalogLock(m_catalogMutex);
         AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
         if (catIt == m_catalogs.end())
         {
@@ -2098,7 +2504,7 @@ namespace AZ::Data
     //=========================================================================
     AssetStreamInfo AssetManager::GetSaveStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> catalogLock(m_catalogMutex);
+        AZStd::shared_lock<AZStd::shared_mutex> catalogLock(m_catalogMutex);
         AssetCatalogMap::iterator catIt = m_catalogs.find(assetType);
         if (catIt == m_catalogs.end())
         {
@@ -2404,28 +2810,40 @@ namespace AZ::Data
         AZStd::map<AZStd::string, TypeInfo> assetTypeInfos;
         uint64_t totalSize = 0;
 
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        // Take a snapshot of the loaded assets first so no shard of the asset map is locked while the catalogs are queried.
+        struct LoadedAssetInfo
+        {
+            AssetId m_assetId;
+            AssetType m_assetType;
+            const char* m_typeName;
+            int m_useCount;
+        };
+        AZStd::vector<LoadedAssetInfo> loadedAssets;
+        m_assets.ForEach([&loadedAssets](const AssetId& assetId, AssetData* assetData)
+        {
+            loadedAssets.push_back({ assetId, assetData->GetType(), assetData->RTTI_GetTypeName(), assetData->GetUseCount() });
+        });
 
         // we need to cache the AssetStreamInfo since json objects are referencing the names in it. 
         AZStd::vector<AssetStreamInfo> cachedStreamInfos;
-        cachedStreamInfos.reserve(m_assets.size());
+        cachedStreamInfos.reserve(loadedAssets.size());
 
-        for (const auto& assetEntry : m_assets)
+        for (const LoadedAssetInfo& loadedAsset : loadedAssets)
         {
-            cachedStreamInfos.emplace_back(GetLoadStreamInfoForAsset(assetEntry.first, assetEntry.second->GetType()));
+            cachedStreamInfos.emplace_back(GetLoadStreamInfoForAsset(loadedAsset.m_assetId, loadedAsset.m_assetType));
 
             const AssetStreamInfo& streamInfo = cachedStreamInfos.back();
             totalSize += streamInfo.m_dataLen;
-            auto& typeInfo = assetTypeInfos[AZStd::string(assetEntry.second->RTTI_GetTypeName())];
+            auto& typeInfo = assetTypeInfos[AZStd::string(loadedAsset.m_typeName)];
             typeInfo.size += streamInfo.m_dataLen;
             typeInfo.count++;
 
             rapidjson::Value assetInfoObject(rapidjson::kObjectType);
 
-            assetInfoObject.AddMember("Type", rapidjson::StringRef(assetEntry.second->RTTI_GetTypeName()), doc.GetAllocator());
+            assetInfoObject.AddMember("Type", rapidjson::StringRef(loadedAsset.m_typeName), doc.GetAllocator());
             assetInfoObject.AddMember("Path", rapidjson::StringRef(streamInfo.m_streamName.c_str()), doc.GetAllocator());
             assetInfoObject.AddMember("SizeInBytes", static_cast<uint64_t>(streamInfo.m_dataLen), doc.GetAllocator());
-            assetInfoObject.AddMember("RefCount", static_cast<uint64_t>(assetEntry.second->GetUseCount()), doc.GetAllocator());
+            assetInfoObject.AddMember("RefCount", static_cast<uint64_t>(loadedAsset.m_useCount), doc.GetAllocator());
             infoArray.PushBack(assetInfoObject, doc.GetAllocator());
         }
                 
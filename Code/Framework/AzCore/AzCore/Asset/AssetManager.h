@@ -12,13 +12,20 @@
 #include <AzCore/Asset/AssetContainer.h>
 #include <AzCore/Asset/AssetDataStream.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Asset/AssetPrefetchManifest.h>
+#include <AzCore/Asset/ShardedAssetMap.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/containers/list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
 
@@ -56,6 +63,18 @@ namespace AZ
         class AssetDatabaseJob;
         class WaitForAsset;
 
+        //! Statistics for the assets of a single type that are kept resident after their last reference was released.
+        struct SoftReleaseStatistics
+        {
+            u64 m_budgetBytes{ 0 };     //!< The maximum size of the released assets that are kept resident.
+            u64 m_residentBytes{ 0 };   //!< The size of the released assets that are currently kept resident.
+            u64 m_residentAssets{ 0 };  //!< The number of released assets that are currently kept resident.
+            u64 m_hits{ 0 };            //!< Number of times a resident asset was used again instead of being loaded.
+            u64 m_misses{ 0 };          //!< Number of times an asset had to be loaded from storage.
+            u64 m_evictions{ 0 };       //!< Number of resident assets that were destroyed to stay within budget.
+            u64 m_evictedBytes{ 0 };    //!< Total size of the resident assets that were destroyed to stay within budget.
+        };
+
         struct IDebugAssetEvent
         {
             AZ_RTTI(IDebugAssetEvent, "{1FEF8289-C730-426D-B3B9-4BBA66339D66}");
@@ -65,8 +84,14 @@ namespace AZ
 
             virtual void AssetStatusUpdate(AZ::Data::AssetId id, AZ::Data::AssetData::AssetStatus status) = 0;
             virtual void ReleaseAsset(AZ::Data::AssetId id) = 0;
+            //! Called when the statistics of the soft release pool of an asset type change. See AssetManager::SetSoftReleaseBudget.
+            virtual void SoftReleaseStatisticsUpdate(
+                [[maybe_unused]] const AZ::Data::AssetType& assetType, [[maybe_unused]] const SoftReleaseStatistics& statistics)
+            {
+            }
         };
 
+
         struct AssetContainerKey
         {
             AssetId m_assetId;
@@ -152,7 +177,7 @@ namespace AZ
 
             typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
             typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
-            typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
+            using AssetMap = ShardedAssetMap<AssetData*>;
             typedef AZStd::unordered_map<AssetContainerKey, AZStd::weak_ptr<AssetContainer>> WeakAssetContainerMap;
             typedef AZStd::unordered_map<AssetContainer*, AZStd::shared_ptr<AssetContainer>> OwnedAssetContainerMap;
 
@@ -286,6 +311,46 @@ namespace AZ
             */
             AssetHandler* GetHandler(const AssetType& assetType);
 
+            /**
+            * Starts recording the order in which assets are loaded, for instance at the start of a level load.
+            * Only the first load of every asset is recorded and reloads are ignored. Starting a new recording discards
+            * the loads of any recording that's in progress.
+            */
+            void StartLoadRecording();
+            /**
+            * Stops recording loads and returns the loads that were started since StartLoadRecording was called.
+            * The returned manifest can be stored and passed to PrefetchAssets on later runs.
+            */
+            AssetPrefetchManifest StopLoadRecording();
+            bool IsRecordingLoads() const;
+
+            /**
+            * Queues loads for all assets in a previously recorded manifest at the lowest priority, with deadlines derived from
+            * the recorded load times plus the given offset. This allows the streamer to read the assets in the background
+            * before the code that needs them requests them, at which point the loads are promoted to the priority and deadline
+            * of the actual request. Entries for assets that are no longer in the catalog or have changed type are skipped.
+            * The returned handles keep the prefetched assets alive and need to be held until the actual requests were made.
+            */
+            AZStd::vector<Asset<AssetData>> PrefetchAssets(
+                const AssetPrefetchManifest& manifest, AZStd::chrono::microseconds deadlineOffset = AZStd::chrono::microseconds(0));
+
+            /**
+            * Sets the memory budget for assets of the given type that are kept resident after their last reference is released.
+            * Released assets that fit in the budget aren't destroyed, so requesting them again doesn't require another load.
+            * When the budget is exceeded the least recently released assets are destroyed first. The size of an asset is
+            * taken from the catalog. A budget of zero disables the soft release for the type and destroys all resident assets
+            * of that type. Budgets are also read from the settings registry key in SoftReleaseBudgetsRegistryKey by the
+            * AssetManagerComponent.
+            */
+            void SetSoftReleaseBudget(const AssetType& assetType, u64 budgetBytes);
+            u64 GetSoftReleaseBudget(const AssetType& assetType) const;
+            SoftReleaseStatistics GetSoftReleaseStatistics(const AssetType& assetType) const;
+            //! Destroys all assets that are kept resident after their last reference was released. Budgets are kept.
+            void FlushSoftReleasedAssets();
+
+            //! Object with asset type ids as field names and budgets in bytes as values.
+            static constexpr const char* SoftReleaseBudgetsRegistryKey = "/O3DE/AzCore/AssetManager/SoftReleaseBudgets";
+
             AssetStreamInfo     GetLoadStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType);
             AssetStreamInfo     GetSaveStreamInfoForAsset(const AssetId& assetId, const AssetType& assetType);
 
@@ -379,7 +444,7 @@ namespace AZ
             * If all "external" references to the asset are destroyed (i.e. nothing but loading code references the asset),
             * this makes sure that the containers are cleaned up and the loading is canceled as a part of destroying the AssetData.
             **/
-            void ReleaseAssetContainersForAsset(AssetData* asset);
+            void ReleaseAssetContainersForAsset(const AssetId& assetId, int creationToken);
 
             /**
             * Clears all references to the owned asset container.
@@ -408,9 +473,11 @@ namespace AZ
 
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
-            AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            AZStd::shared_mutex     m_catalogMutex;     // lock when accessing the catalog map, lookups only need shared access
+            AssetMap                m_assets;           // sharded, operations on a single asset only lock the shard of that asset
+            // Lock for asset reloads and status changes of loading assets, and when visiting all assets. When combined with a
+            // shard lock from m_assets this lock has to be taken first.
+            AZStd::recursive_mutex  m_assetMutex;
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -420,7 +487,7 @@ namespace AZ
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
 
-            int m_creationTokenGenerator = 0; // this is used to generate unique identifiers for assets
+            AZStd::atomic_int m_creationTokenGenerator{ 0 }; // this is used to generate unique identifiers for assets
 
             typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
             ReloadMap               m_reloads;          // book-keeping and reference-holding for asset reloads
@@ -450,6 +517,56 @@ namespace AZ
 
             bool m_assetInfoUpgradingEnabled = true;
 
+            //! Loads recorded since StartLoadRecording was called, in the order they were queued.
+            AZStd::vector<AssetPrefetchManifest::Entry> m_recordedLoads;
+            //! Used to only record the first load of an asset.
+            AZStd::unordered_set<AssetId> m_recordedAssetIds;
+            AZStd::chrono::steady_clock::time_point m_loadRecordingStart;
+            AZStd::mutex m_loadRecordingMutex;
+            //! Checked before taking m_loadRecordingMutex so loads don't need to lock when there's no recording.
+            AZStd::atomic_bool m_isRecordingLoads{ false };
+
+            struct SoftReleasedAsset
+            {
+                AssetData* m_asset;
+                u64 m_sizeBytes;
+            };
+            using SoftReleaseList = AZStd::list<SoftReleasedAsset>;
+            struct SoftReleasePool
+            {
+                //! Most recently released assets are at the front.
+                SoftReleaseList m_assets;
+                SoftReleaseStatistics m_statistics;
+            };
+
+            //! Keeps a released asset resident if its type has a soft release budget.
+            void SoftReleaseAsset(AssetData* asset);
+            //! Called by the asset when it's used again while it was kept resident.
+            void OnSoftReleasedAssetReused(AssetData* asset);
+            //! Queues an asset that became unused while asset releases are suspended.
+            void QueueSuspendedSoftRelease(AssetData* asset);
+            //! Offers the assets that became unused while asset releases were suspended to their soft release pools.
+            void SoftReleaseSuspendedAssets();
+            //! Removes resident assets for which the filter returns true and returns them so they can be released after
+            //! the soft release lock has been released. Needs to be called with m_softReleaseMutex locked.
+            template<typename Filter>
+            void RemoveSoftReleasedAssets(AZStd::vector<AssetData*>& removed, Filter&& filter);
+            //! Removes the least recently released assets of a pool until it's within budget. Needs to be called with
+            //! m_softReleaseMutex locked.
+            void EvictSoftReleasedAssets(SoftReleasePool& pool, AZStd::vector<AssetData*>& evicted);
+            //! Drops the references to assets that were removed from the soft release pools, which destroys them.
+            static void ReleaseSoftReleasedAssets(const AZStd::vector<AssetData*>& assets);
+            void NotifySoftReleaseStatistics(const AssetType& assetType, const SoftReleaseStatistics& statistics);
+
+            AZStd::unordered_map<AssetType, SoftReleasePool> m_softReleasePools;
+            //! Lookup from resident assets to their entry in the pool of their type.
+            AZStd::unordered_map<AssetData*, SoftReleaseList::iterator> m_softReleasedAssets;
+            //! Assets that became unused while asset releases were suspended. Each entry holds a weak reference.
+            AZStd::vector<AssetData*> m_suspendedSoftReleases;
+            mutable AZStd::mutex m_softReleaseMutex;
+            //! Checked before taking m_softReleaseMutex so releases don't need to lock if no type has a budget.
+            AZStd::atomic_int m_numSoftReleaseBudgets{ 0 };
+
             static EnvironmentVariable<AssetManager*>  s_assetDB;
 
             // used internally by the cycle checking on the job system.  Used for blocking loads.
@@ -15,6 +15,8 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/Slice/SliceAssetHandler.h>
 #include <AzCore/Slice/SliceComponent.h>
 #include <AzCore/Math/Crc.h>
@@ -42,6 +44,27 @@ namespace AZ
     {
         Data::AssetManager::Descriptor desc;
         Data::AssetManager::Create(desc);
+
+        if (auto registry = SettingsRegistry::Get(); registry != nullptr)
+        {
+            auto SetSoftReleaseBudget = [registry](const SettingsRegistryInterface::VisitArgs& visitArgs)
+            {
+                u64 budgetBytes = 0;
+                Data::AssetType assetType = Uuid::CreateStringPermissive(visitArgs.m_fieldName);
+                if (!assetType.IsNull() && registry->Get(budgetBytes, visitArgs.m_jsonKeyPath))
+                {
+                    Data::AssetManager::Instance().SetSoftReleaseBudget(assetType, budgetBytes);
+                }
+                else
+                {
+                    AZ_Warning("AssetManager", false, "Invalid soft release budget '%.*s'. Expected an asset type id with a size in bytes.",
+                        AZ_STRING_ARG(visitArgs.m_fieldName));
+                }
+                return SettingsRegistryInterface::VisitResponse::Skip;
+            };
+            SettingsRegistryVisitorUtils::VisitObject(*registry, SetSoftReleaseBudget, Data::AssetManager::SoftReleaseBudgetsRegistryKey);
+        }
+
         SystemTickBus::Handler::BusConnect();
     }
 
@@ -166,6 +189,7 @@ namespace AZ
     {
         Data::AssetId::Reflect(context);
         Data::AssetData::Reflect(context);
+        Data::AssetPrefetchManifest::Reflect(context);
 
         if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
         {
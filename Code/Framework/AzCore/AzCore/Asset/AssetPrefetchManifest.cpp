@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetPrefetchManifest.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ::Data
+{
+    void AssetPrefetchManifest::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<Entry>()
+                ->Version(1)
+                ->Field("AssetId", &Entry::m_assetId)
+                ->Field("AssetType", &Entry::m_assetType)
+                ->Field("LoadTimeUs", &Entry::m_loadTimeUs);
+
+            serializeContext->Class<AssetPrefetchManifest>()
+                ->Version(1)
+                ->Field("Entries", &AssetPrefetchManifest::m_entries);
+        }
+    }
+} // namespace AZ::Data
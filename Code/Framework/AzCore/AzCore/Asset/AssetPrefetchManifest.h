@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace AZ::Data
+{
+    //! The ordered list of asset loads that were started during a recorded session, for instance while a level was loading.
+    //! Level loads follow the same dependency chains every time, so the manifest can be used on later loads to queue all
+    //! reads up front, instead of waiting for every load to finish before its dependencies are discovered.
+    //! See AssetManager::StartLoadRecording and AssetManager::PrefetchAssets.
+    struct AssetPrefetchManifest
+    {
+        AZ_TYPE_INFO(AssetPrefetchManifest, "{6B5E0C51-9E2D-4B0A-A8F4-3D7E1C2B9A64}");
+        AZ_CLASS_ALLOCATOR(AssetPrefetchManifest, SystemAllocator);
+
+        struct Entry
+        {
+            AZ_TYPE_INFO(AssetPrefetchManifest::Entry, "{0F3C8D27-5A1B-4E69-B2C4-7D9E6A5F1B38}");
+
+            AssetId m_assetId;
+            AssetType m_assetType;
+            u64 m_loadTimeUs{ 0 }; //!< Time in microseconds since the start of the recording at which the load was started.
+        };
+
+        static void Reflect(ReflectContext* context);
+
+        //! The recorded loads, in the order in which they were started.
+        AZStd::vector<Entry> m_entries;
+    };
+} // namespace AZ::Data
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::Data
+{
+    //! Map from AssetId to a value that's split over a fixed number of shards, each guarded by its own lock.
+    //! Threads that work on different assets will almost always end up in different shards, so lookups, inserts and
+    //! removals from many threads no longer serialize on a single mutex.
+    //! Operations on a single id only lock the shard that id belongs to. Code that holds the lock of one shard must
+    //! not lock another shard, with the exception of ForEach and Size which visit the shards one at a time.
+    template<typename Value, size_t ShardCount = 64>
+    class ShardedAssetMap
+    {
+    public:
+        static_assert(ShardCount > 1 && (ShardCount & (ShardCount - 1)) == 0, "The number of shards needs to be a power of two larger than one.");
+
+        using MapType = AZStd::unordered_map<AssetId, Value>;
+        using MutexType = AZStd::recursive_mutex;
+
+        //! Exclusive access to the shard that holds a specific asset id. The shard remains locked for as long as this
+        //! object is alive.
+        class LockedShard
+        {
+        public:
+            LockedShard(MutexType& mutex, MapType& map)
+                : m_lock(mutex)
+                , m_map(map)
+            {
+            }
+
+            MapType* operator->() { return &m_map; }
+            MapType& operator*() { return m_map; }
+
+        private:
+            AZStd::unique_lock<MutexType> m_lock;
+            MapType& m_map;
+        };
+
+        ShardedAssetMap() = default;
+        ShardedAssetMap(const ShardedAssetMap&) = delete;
+        ShardedAssetMap& operator=(const ShardedAssetMap&) = delete;
+
+        //! Locks the shard that contains the given id and returns access to it.
+        LockedShard LockShard(const AssetId& id)
+        {
+            Shard& shard = GetShard(id);
+            return LockedShard(shard.m_mutex, shard.m_map);
+        }
+
+        //! Returns true if the given id is in the map. The result may be stale by the time it's used.
+        bool Contains(const AssetId& id) const
+        {
+            const Shard& shard = GetShard(id);
+            AZStd::scoped_lock lock(shard.m_mutex);
+            return shard.m_map.find(id) != shard.m_map.end();
+        }
+
+        //! Returns the total number of entries. Shards are counted one at a time, so the result is a snapshot that
+        //! may be stale if other threads are modifying the map.
+        size_t Size() const
+        {
+            size_t result = 0;
+            for (const Shard& shard : m_shards)
+            {
+                AZStd::scoped_lock lock(shard.m_mutex);
+                result += shard.m_map.size();
+            }
+            return result;
+        }
+
+        //! Calls the callback for every entry with the owning shard locked. Shards are visited one at a time. The
+        //! callback can't add or remove entries.
+        template<typename Callback>
+        void ForEach(Callback&& callback)
+        {
+            for (Shard& shard : m_shards)
+            {
+                AZStd::scoped_lock lock(shard.m_mutex);
+                for (auto& entry : shard.m_map)
+                {
+                    callback(entry.first, entry.second);
+                }
+            }
+        }
+
+    private:
+        //! Every shard is placed on its own cache line so the locks of neighboring shards don't share a line.
+        struct alignas(64) Shard
+        {
+            mutable MutexType m_mutex;
+            MapType m_map;
+        };
+
+        static size_t GetShardIndex(const AssetId& id)
+        {
+            // The hash is also used for the buckets inside a shard, so use the high bits of a Fibonacci hash to pick the
+            // shard. This keeps the shard choice independent from the bucket choice.
+            const AZ::u64 hash = static_cast<AZ::u64>(AZStd::hash<AssetId>{}(id)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(hash >> (64 - ShardBits));
+        }
+
+        Shard& GetShard(const AssetId& id) { return m_shards[GetShardIndex(id)]; }
+        const Shard& GetShard(const AssetId& id) const { return m_shards[GetShardIndex(id)]; }
+
+        static constexpr size_t CalculateShardBits()
+        {
+            size_t bits = 0;
+            while ((size_t(1) << bits) < ShardCount)
+            {
+                ++bits;
+            }
+            return bits;
+        }
+        static constexpr size_t ShardBits = CalculateShardBits();
+
+        AZStd::array<Shard, ShardCount> m_shards;
+    };
+} // namespace AZ::Data
@@ -23,6 +23,8 @@ namespace AZ::IO
         m_offset = rhs.m_offset;
         m_compressedSize = rhs.m_compressedSize;
         m_uncompressedSize = rhs.m_uncompressedSize;
+        m_blockSize = rhs.m_blockSize;
+        m_blockOffsets = AZStd::move(rhs.m_blockOffsets);
         m_conflictResolution = rhs.m_conflictResolution;
         m_isCompressed = rhs.m_isCompressed;
         m_isSharedPak = rhs.m_isSharedPak;
@@ -30,6 +32,16 @@ namespace AZ::IO
         return *this;
     }
 
+    bool CompressionInfo::IsBlockCompressed() const
+    {
+        return m_blockSize != 0 && m_blockOffsets;
+    }
+
+    size_t CompressionInfo::GetNumBlocks() const
+    {
+        return IsBlockCompressed() ? (m_uncompressedSize + m_blockSize - 1) / m_blockSize : 0;
+    }
+
     namespace CompressionUtils
     {
         bool FindCompressionInfo(CompressionInfo& info, const AZ::IO::PathView filePath)
@@ -38,5 +50,36 @@ namespace AZ::IO
             CompressionBus::Broadcast(&CompressionBus::Events::FindCompressionInfo, result, info, filePath);
             return result;
         }
+
+        bool Decompress(const CompressionInfo& info, const void* compressed, size_t compressedSize,
+            void* uncompressed, size_t uncompressedBufferSize)
+        {
+            if (!info.IsBlockCompressed())
+            {
+                return info.m_decompressor(info, compressed, compressedSize, uncompressed, uncompressedBufferSize);
+            }
+
+            const AZStd::vector<u64>& blockOffsets = *info.m_blockOffsets;
+            const size_t numBlocks = info.GetNumBlocks();
+            if (blockOffsets.size() != numBlocks + 1 || blockOffsets.back() > compressedSize ||
+                uncompressedBufferSize < info.m_uncompressedSize)
+            {
+                return false;
+            }
+
+            auto compressedBytes = reinterpret_cast<const u8*>(compressed);
+            auto uncompressedBytes = reinterpret_cast<u8*>(uncompressed);
+            for (size_t block = 0; block < numBlocks; ++block)
+            {
+                size_t blockStart = block * info.m_blockSize;
+                size_t blockSize = AZStd::min(info.m_blockSize, info.m_uncompressedSize - blockStart);
+                if (!info.m_decompressor(info, compressedBytes + blockOffsets[block], blockOffsets[block + 1] - blockOffsets[block],
+                    uncompressedBytes + blockStart, blockSize))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
     }
 } // namespace AZ::IO
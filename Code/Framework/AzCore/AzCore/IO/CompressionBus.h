@@ -10,8 +10,10 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string_view.h>
 
 namespace AZ
@@ -43,6 +45,11 @@ namespace AZ
             CompressionInfo(CompressionInfo&& rhs);
             CompressionInfo& operator=(CompressionInfo&& rhs);
 
+            //! Whether or not the file was compressed as a sequence of independently compressed blocks.
+            bool IsBlockCompressed() const;
+            //! Returns the number of compressed blocks or 0 if the file isn't block compressed.
+            size_t GetNumBlocks() const;
+
             //! Relative path to the archive file.
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
@@ -55,6 +62,13 @@ namespace AZ
             size_t m_compressedSize = 0;
             //! Size after the file has been decompressed.
             size_t m_uncompressedSize = 0;
+            //! Uncompressed size of the blocks if the file was compressed as a sequence of independently compressed blocks. Only the
+            //! last block can be smaller. If 0 the file was compressed as a whole and needs to be decompressed as a whole.
+            //! The archive providers in the engine don't fill in block tables yet, this is for providers that store them.
+            size_t m_blockSize = 0;
+            //! Offsets of the compressed blocks relative to m_offset, followed by the offset where the last block ends. The table is
+            //! shared so copies of the compression info don't duplicate it. Only used if m_blockSize is not 0.
+            AZStd::shared_ptr<const AZStd::vector<u64>> m_blockOffsets;
             //! Preferred solution when an archive is found in the archive and as a separate file.
             ConflictResolution m_conflictResolution = ConflictResolution::UseArchiveOnly;
             //! Whether or not the file is compressed. If the file is not compressed, the compressed and uncompressed sizes should match.
@@ -80,6 +94,11 @@ namespace AZ
         namespace CompressionUtils
         {
             bool FindCompressionInfo(CompressionInfo& info, const AZ::IO::PathView filePath);
+
+            //! Decompresses the entire file using the decompressor in the compression info. Block compressed files are
+            //! decompressed one block after the other.
+            bool Decompress(const CompressionInfo& info, const void* compressed, size_t compressedSize,
+                void* uncompressed, size_t uncompressedBufferSize);
         }
     }
 }
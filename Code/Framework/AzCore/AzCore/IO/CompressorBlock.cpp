@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if !defined(AZCORE_EXCLUDE_ZLIB)
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/CompressorBlock.h>
+#include <AzCore/IO/CompressorStream.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AZ::IO
+{
+    namespace CompressorBlockInternal
+    {
+        //! Compresses a single block. If compression doesn't reduce the size the block is stored uncompressed, which the reader
+        //! detects because the stored size matches the uncompressed size of the block.
+        void CompressBlock(const AZ::u8* data, size_t dataSize, int compressionLevel, AZStd::vector<AZ::u8>& result)
+        {
+            ZLib zlib;
+            zlib.StartCompressor(compressionLevel);
+            unsigned int remaining = aznumeric_caster(dataSize);
+            result.resize_no_construct(zlib.GetMinCompressedBufferSize(remaining));
+            unsigned int compressedSize =
+                zlib.Compress(data, remaining, result.data(), aznumeric_caster(result.size()), ZLib::FT_FINISH);
+            if (remaining == 0 && compressedSize < dataSize)
+            {
+                result.resize(compressedSize);
+            }
+            else
+            {
+                result.assign(data, data + dataSize);
+            }
+        }
+    } // namespace CompressorBlockInternal
+
+    CompressorBlock::CompressorBlock(AZ::u32 maxBlocksPerBatch)
+        : m_maxBlocksPerBatch(maxBlocksPerBatch)
+    {
+        if (m_maxBlocksPerBatch == 0)
+        {
+            m_maxBlocksPerBatch = AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+        }
+    }
+
+    AZ::u32 CompressorBlock::TypeId()
+    {
+        return AZ_CRC_CE("BlockZLib");
+    }
+
+    bool CompressorBlock::ReadHeaderAndData(CompressorStream* stream, AZ::u8* data, unsigned int dataSize)
+    {
+        if (stream->GetCompressorData() != nullptr)  // we already have compressor data
+        {
+            return false;
+        }
+
+        if (dataSize < sizeof(CompressorBlockHeader))
+        {
+            AZ_Error("CompressorBlock", false, "We did not read enough data, we have only %u bytes left in the buffer and we need %zu.",
+                dataSize, sizeof(CompressorBlockHeader));
+            return false;
+        }
+
+        CompressorBlockHeader header = *reinterpret_cast<CompressorBlockHeader*>(data);
+        AZStd::endian_swap(header.m_blockSize);
+        AZStd::endian_swap(header.m_numBlocks);
+        if (header.m_blockSize == 0)
+        {
+            AZ_Error("CompressorBlock", false, "Block compressed stream has an invalid block size of 0.");
+            return false;
+        }
+
+        // The block index is stored at the end of the stream.
+        SizeType compressedFileEnd = stream->GetLength();
+        SizeType indexSize = sizeof(AZ::u64) * (static_cast<SizeType>(header.m_numBlocks) + 1);
+        constexpr SizeType firstBlockOffset = sizeof(CompressorHeader) + sizeof(CompressorBlockHeader);
+        if (compressedFileEnd < firstBlockOffset + indexSize)
+        {
+            AZ_Error("CompressorBlock", false, "Block compressed stream is too small to contain the index for %u blocks.", header.m_numBlocks);
+            return false;
+        }
+
+        AZStd::unique_ptr<CompressorBlockData> blockData = AZStd::make_unique<CompressorBlockData>();
+        blockData->m_compressor = this;
+        blockData->m_uncompressedSize = 0;
+        blockData->m_blockSize = header.m_blockSize;
+        blockData->m_blockOffsets.resize_no_construct(header.m_numBlocks + 1);
+
+        SizeType indexOffset = compressedFileEnd - indexSize;
+        GenericStream* baseStream = stream->GetWrappedStream();
+        if (baseStream->ReadAtOffset(indexSize, blockData->m_blockOffsets.data(), indexOffset) != indexSize)
+        {
+            return false;
+        }
+
+        for (AZ::u64& offset : blockData->m_blockOffsets)
+        {
+            AZStd::endian_swap(offset);
+        }
+        if (blockData->m_blockOffsets.front() != firstBlockOffset || blockData->m_blockOffsets.back() != indexOffset ||
+            !AZStd::is_sorted(blockData->m_blockOffsets.begin(), blockData->m_blockOffsets.end()))
+        {
+            AZ_Error("CompressorBlock", false, "Block compressed stream has a corrupted block index.");
+            return false;
+        }
+
+        blockData->m_zlib.StartDecompressor();
+
+        stream->SetCompressorData(blockData.release());
+        return true;
+    }
+
+    bool CompressorBlock::WriteHeaderAndData(CompressorStream* stream)
+    {
+        if (!Compressor::WriteHeaderAndData(stream))
+        {
+            return false;
+        }
+
+        CompressorBlockData* blockData = static_cast<CompressorBlockData*>(stream->GetCompressorData());
+        CompressorBlockHeader header;
+        header.m_blockSize = blockData->m_blockSize;
+        header.m_numBlocks = aznumeric_caster(blockData->m_blockOffsets.size());
+        AZStd::endian_swap(header.m_blockSize);
+        AZStd::endian_swap(header.m_numBlocks);
+        GenericStream* baseStream = stream->GetWrappedStream();
+        return baseStream->WriteAtOffset(sizeof(header), &header, sizeof(CompressorHeader)) == sizeof(header);
+    }
+
+    CompressorBlock::SizeType CompressorBlock::Read(CompressorStream* stream, SizeType byteSize, SizeType offset, void* buffer)
+    {
+        AZ_Assert(stream->GetCompressorData(), "This stream doesn't have decompression enabled.");
+        CompressorBlockData* blockData = static_cast<CompressorBlockData*>(stream->GetCompressorData());
+        AZ_Assert(!blockData->m_isWriting, "You can't read/decompress while writing a compressed stream %s.", stream->GetFilename());
+
+        AZ::u8* output = reinterpret_cast<AZ::u8*>(buffer);
+        SizeType numRead = 0;
+        while (byteSize > 0 && offset < blockData->m_uncompressedSize)
+        {
+            // All blocks have the same uncompressed size, so the block can be found without searching.
+            size_t blockIndex = aznumeric_caster(offset / blockData->m_blockSize);
+            if (blockIndex + 1 >= blockData->m_blockOffsets.size())
+            {
+                AZ_Error("CompressorBlock", false, "Offset %llu is outside the blocks stored in stream %s.", offset, stream->GetFilename());
+                break;
+            }
+
+            SizeType blockStart = static_cast<SizeType>(blockIndex) * blockData->m_blockSize;
+            size_t blockSize = aznumeric_caster(AZStd::min<SizeType>(blockData->m_blockSize, blockData->m_uncompressedSize - blockStart));
+            size_t offsetInBlock = aznumeric_caster(offset - blockStart);
+            size_t copySize = aznumeric_caster(AZStd::min<SizeType>(byteSize, blockSize - offsetInBlock));
+
+            if (blockIndex != blockData->m_cachedBlock)
+            {
+                if (offsetInBlock == 0 && copySize == blockSize)
+                {
+                    // The entire block is requested, so skip the cache and decompress straight into the output.
+                    if (!DecompressBlock(stream, blockIndex, output, blockSize))
+                    {
+                        break;
+                    }
+                    output += copySize;
+                    offset += copySize;
+                    byteSize -= copySize;
+                    numRead += copySize;
+                    continue;
+                }
+
+                blockData->m_decompressedCache.resize_no_construct(blockSize);
+                if (!DecompressBlock(stream, blockIndex, blockData->m_decompressedCache.data(), blockSize))
+                {
+                    blockData->m_cachedBlock = CompressorBlockData::InvalidBlock;
+                    break;
+                }
+                blockData->m_cachedBlock = blockIndex;
+            }
+
+            memcpy(output, blockData->m_decompressedCache.data() + offsetInBlock, copySize);
+            output += copySize;
+            offset += copySize;
+            byteSize -= copySize;
+            numRead += copySize;
+        }
+        return numRead;
+    }
+
+    bool CompressorBlock::DecompressBlock(CompressorStream* stream, size_t blockIndex, AZ::u8* output, size_t outputSize)
+    {
+        CompressorBlockData* blockData = static_cast<CompressorBlockData*>(stream->GetCompressorData());
+        SizeType compressedOffset = blockData->m_blockOffsets[blockIndex];
+        SizeType compressedSize = blockData->m_blockOffsets[blockIndex + 1] - compressedOffset;
+        GenericStream* baseStream = stream->GetWrappedStream();
+
+        if (compressedSize == outputSize)
+        {
+            // The block didn't compress and was stored as is.
+            return baseStream->ReadAtOffset(compressedSize, output, compressedOffset) == compressedSize;
+        }
+
+        blockData->m_compressedBuffer.resize_no_construct(aznumeric_caster(compressedSize));
+        if (baseStream->ReadAtOffset(compressedSize, blockData->m_compressedBuffer.data(), compressedOffset) != compressedSize)
+        {
+            return false;
+        }
+
+        // Every block is a complete zlib stream, so the decompressor only needs a reset between blocks.
+        blockData->m_zlib.ResetDecompressor();
+        unsigned int remaining = aznumeric_caster(outputSize);
+        blockData->m_zlib.Decompress(
+            blockData->m_compressedBuffer.data(), aznumeric_caster(compressedSize), output, remaining, ZLib::FT_FINISH);
+        AZ_Error("CompressorBlock", remaining == 0, "Failed to decompress block %zu of stream %s.", blockIndex, stream->GetFilename());
+        return remaining == 0;
+    }
+
+    CompressorBlock::SizeType CompressorBlock::Write(CompressorStream* stream, SizeType byteSize, const void* data, SizeType offset)
+    {
+        AZ_UNUSED(offset);
+
+        AZ_Assert(stream && stream->GetCompressorData(), "This stream doesn't have compression enabled. Call Stream::WriteCompressed after you create the file.");
+        AZ_Assert(offset == SizeType(-1) || offset == stream->GetCurPos(), "We can write compressed data only at the end of the stream.");
+
+        CompressorBlockData* blockData = static_cast<CompressorBlockData*>(stream->GetCompressorData());
+        AZ_Assert(blockData->m_isWriting, "You can't write while reading/decompressing a compressed stream.");
+
+        const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+        blockData->m_pendingData.insert(blockData->m_pendingData.end(), bytes, bytes + byteSize);
+        blockData->m_uncompressedSize += byteSize;
+
+        if (blockData->m_pendingData.size() >= static_cast<size_t>(blockData->m_blockSize) * m_maxBlocksPerBatch)
+        {
+            if (!FlushBlocks(stream, false))
+            {
+                return 0;
+            }
+        }
+        return byteSize;
+    }
+
+    bool CompressorBlock::FlushBlocks(CompressorStream* stream, bool isFinal)
+    {
+        using namespace CompressorBlockInternal;
+
+        CompressorBlockData* blockData = static_cast<CompressorBlockData*>(stream->GetCompressorData());
+        const size_t blockSize = blockData->m_blockSize;
+        const size_t pendingSize = blockData->m_pendingData.size();
+        const size_t numBlocks = isFinal ? (pendingSize + blockSize - 1) / blockSize : pendingSize / blockSize;
+        if (numBlocks == 0)
+        {
+            return true;
+        }
+
+        const AZ::u8* pendingData = blockData->m_pendingData.data();
+        const int compressionLevel = blockData->m_compressionLevel;
+        AZStd::vector<AZStd::vector<AZ::u8>> compressedBlocks(numBlocks);
+
+        TaskGraphActiveInterface* taskGraphActive = AZ::Interface<TaskGraphActiveInterface>::Get();
+        if (numBlocks > 1 && taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            static const TaskDescriptor compressBlockDescriptor{ "Compress block", "IO" };
+            TaskGraph compressGraph{ "CompressorBlock::FlushBlocks" };
+            for (size_t i = 0; i < numBlocks; ++i)
+            {
+                compressGraph.AddTask(
+                    compressBlockDescriptor,
+                    [&compressedBlocks, pendingData, pendingSize, blockSize, compressionLevel, i]()
+                    {
+                        size_t start = i * blockSize;
+                        CompressBlock(pendingData + start, AZStd::min(blockSize, pendingSize - start), compressionLevel, compressedBlocks[i]);
+                    });
+            }
+            TaskGraphEvent finishedEvent{ "CompressorBlock::FlushBlocks Wait" };
+            compressGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            for (size_t i = 0; i < numBlocks; ++i)
+            {
+                size_t start = i * blockSize;
+                CompressBlock(pendingData + start, AZStd::min(blockSize, pendingSize - start), compressionLevel, compressedBlocks[i]);
+            }
+        }
+
+        // Blocks are appended in order so the index stays sorted.
+        GenericStream* baseStream = stream->GetWrappedStream();
+        for (const AZStd::vector<AZ::u8>& block : compressedBlocks)
+        {
+            blockData->m_blockOffsets.push_back(baseStream->GetLength());
+            baseStream->Seek(0U, GenericStream::SeekMode::ST_SEEK_END);
+            if (baseStream->Write(block.size(), block.data()) != block.size())
+            {
+                return false;
+            }
+        }
+
+        size_t consumed = AZStd::min(numBlocks * blockSize, pendingSize);
+        blockData->m_pendingData.erase(blockData->m_pendingData.begin(), blockData->m_pendingData.begin() + consumed);
+        return true;
+    }
+
+    bool CompressorBlock::WriteSeekPoint([[maybe_unused]] CompressorStream* stream)
+    {
+        // Every block can be decompressed on its own, so there's no need for additional seek points.
+        return true;
+    }
+
+    bool CompressorBlock::StartCompressor(CompressorStream* stream, int compressionLevel, SizeType autoSeekDataSize)
+    {
+        AZ_Assert(stream && !stream->GetCompressorData(), "Stream has compressor already enabled.");
+
+        CompressorBlockData* blockData = aznew CompressorBlockData;
+        blockData->m_compressor = this;
+        blockData->m_uncompressedSize = 0;
+        blockData->m_blockSize = autoSeekDataSize > 0 ? aznumeric_cast<AZ::u32>(autoSeekDataSize) : DefaultBlockSize;
+        blockData->m_compressionLevel = AZ::GetClamp(compressionLevel, 1, 9); // remap to zlib levels
+        blockData->m_isWriting = true;
+        blockData->m_pendingData.reserve(static_cast<size_t>(blockData->m_blockSize) * m_maxBlocksPerBatch);
+
+        stream->SetCompressorData(blockData);
+
+        return WriteHeaderAndData(stream);
+    }
+
+    bool CompressorBlock::Close(CompressorStream* stream)
+    {
+        AZ_Assert(stream->IsOpen(), "Stream is not open to be closed.");
+
+        CompressorBlockData* blockData = static_cast<CompressorBlockData*>(stream->GetCompressorData());
+        GenericStream* baseStream = stream->GetWrappedStream();
+
+        bool result = true;
+        if (blockData->m_isWriting)
+        {
+            result = FlushBlocks(stream, true);
+            if (result)
+            {
+                // The header contains the number of blocks, which is only known now.
+                result = WriteHeaderAndData(stream);
+            }
+            if (result)
+            {
+                // Write the index, including the end of the last block.
+                AZStd::vector<AZ::u64> index(blockData->m_blockOffsets);
+                index.push_back(baseStream->GetLength());
+                for (AZ::u64& offset : index)
+                {
+                    AZStd::endian_swap(offset);
+                }
+                SizeType dataToWrite = index.size() * sizeof(AZ::u64);
+                baseStream->Seek(0U, GenericStream::SeekMode::ST_SEEK_END);
+                result = (baseStream->Write(dataToWrite, index.data()) == dataToWrite);
+            }
+        }
+
+        // last step reset stream compressor data.
+        stream->SetCompressorData(nullptr);
+        return result;
+    }
+} // namespace AZ::IO
+
+#endif // #if !defined(AZCORE_EXCLUDE_ZLIB)
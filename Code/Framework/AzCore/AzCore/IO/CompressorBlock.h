@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Compression/Compression.h>
+#include <AzCore/IO/Compressor.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    /**
+     * Header stored after the standard compression header.
+     * All data is stored in network order (big endian).
+     */
+    struct CompressorBlockHeader
+    {
+        AZ::u32     m_blockSize;    ///< Uncompressed size of every block, except for the last block which can be smaller.
+        AZ::u32     m_numBlocks;    ///< Number of blocks. The index at the end of the stream has m_numBlocks + 1 entries.
+    };
+
+    /**
+     * Block compressor per stream data.
+     */
+    class CompressorBlockData
+        : public CompressorData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressorBlockData, AZ::SystemAllocator);
+
+        static constexpr size_t InvalidBlock = static_cast<size_t>(-1);
+
+        ZLib                        m_zlib;                     ///< Decompressor, only used when reading.
+        //! Offsets of the compressed blocks in the stream. When reading there's one extra entry with the end of the last
+        //! block, so the compressed size of block i is always m_blockOffsets[i + 1] - m_blockOffsets[i].
+        AZStd::vector<AZ::u64>      m_blockOffsets;
+        AZStd::vector<AZ::u8>       m_pendingData;              ///< Uncompressed data that hasn't been compressed yet. Only used when writing.
+        AZStd::vector<AZ::u8>       m_decompressedCache;        ///< Decompressed data of m_cachedBlock. Only used when reading.
+        AZStd::vector<AZ::u8>       m_compressedBuffer;         ///< Compressed data of the block that's being decompressed.
+        size_t                      m_cachedBlock{ InvalidBlock }; ///< Index of the block that's stored in m_decompressedCache.
+        AZ::u32                     m_blockSize{ 0 };
+        int                         m_compressionLevel{ 0 };
+        bool                        m_isWriting{ false };
+    };
+
+    /**
+     * Compressor that splits the stream in fixed size blocks which are compressed independently of each other. The offsets
+     * of the compressed blocks are stored in an index at the end of the stream, which is loaded when the stream is opened.
+     * Because all blocks but the last have the same uncompressed size, the block that contains any uncompressed offset can be
+     * calculated directly and a seek never needs to decompress more than a single block.
+     * Blocks are collected while writing and compressed in batches. When the task graph is active the blocks in a batch are
+     * compressed in parallel.
+     */
+    class CompressorBlock
+        : public Compressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressorBlock, AZ::SystemAllocator);
+
+        static constexpr AZ::u32 DefaultBlockSize = 64 * 1024;
+
+        /**
+         * \param maxBlocksPerBatch the number of blocks that are collected before they're compressed. This is also the maximum number of
+         * blocks that are compressed in parallel. If 0 the number of hardware threads is used.
+         */
+        explicit CompressorBlock(AZ::u32 maxBlocksPerBatch = 0);
+        ~CompressorBlock() override = default;
+
+        /// Return compressor type id.
+        static AZ::u32 TypeId();
+        AZ::u32 GetTypeId() const override { return TypeId(); }
+        /// Called when we open a stream to Read for the first time. Data contains the first. dataSize <= m_maxHeaderSize.
+        bool ReadHeaderAndData(CompressorStream* stream, AZ::u8* data, unsigned int dataSize) override;
+        /// Called when we are about to start writing to a compressed stream.
+        bool WriteHeaderAndData(CompressorStream* stream) override;
+        /// Forwarded function from the Device when we from a compressed stream.
+        SizeType Read(CompressorStream* stream, SizeType byteSize, SizeType offset, void* buffer) override;
+        /// Forwarded function from the Device when we write to a compressed stream.
+        SizeType Write(CompressorStream* stream, SizeType byteSize, const void* data, SizeType offset = SizeType(-1)) override;
+        /// Every block is a seek point, so no additional data is written.
+        bool WriteSeekPoint(CompressorStream* stream) override;
+        /// Starts compressing, autoSeekDataSize is used as the block size. If 0, DefaultBlockSize is used.
+        bool StartCompressor(CompressorStream* stream, int compressionLevel, SizeType autoSeekDataSize) override;
+        /// Called just before we close the stream. All compression data will be flushed and finalized. (You can't add data afterwards).
+        bool Close(CompressorStream* stream) override;
+
+    protected:
+        /// Compresses the pending data and appends the blocks to the stream. Unless isFinal is set, a partially filled block is kept
+        /// in the pending data so it can be completed by the next write.
+        bool FlushBlocks(CompressorStream* stream, bool isFinal);
+        /// Reads block blockIndex from the stream and decompresses it in output, which has to be exactly the uncompressed size of the block.
+        bool DecompressBlock(CompressorStream* stream, size_t blockIndex, AZ::u8* output, size_t outputSize);
+
+        AZ::u32 m_maxBlocksPerBatch;
+    };
+} // namespace AZ::IO
@@ -6,10 +6,12 @@
  *
  */
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/IO/CompressorStream.h>
 #include <AzCore/IO/Compressor.h>
+#include <AzCore/IO/CompressorBlock.h>
 #include <AzCore/IO/CompressorZLib.h>
 #include <AzCore/IO/CompressorZStd.h>
 #include <AzCore/IO/FileIO.h>
@@ -72,7 +74,21 @@ bool CompressorStream::CanWrite() const
 
 void CompressorStream::Seek(OffsetType bytes, SeekMode mode)
 {
-    if (m_stream)
+    if (m_compressorData)
+    {
+        // Seeking in a compressed stream moves through the uncompressed data. The compressor finds the compressed data on the next read.
+        OffsetType base = 0;
+        if (mode == ST_SEEK_CUR)
+        {
+            base = static_cast<OffsetType>(m_uncompressedPosition);
+        }
+        else if (mode == ST_SEEK_END)
+        {
+            base = static_cast<OffsetType>(GetUncompressedLength());
+        }
+        m_uncompressedPosition = static_cast<SizeType>(AZStd::max<OffsetType>(base + bytes, 0));
+    }
+    else if (m_stream)
     {
         m_stream->Seek(bytes, mode);
     }
@@ -80,16 +96,36 @@ void CompressorStream::Seek(OffsetType bytes, SeekMode mode)
 
 SizeType CompressorStream::Read(SizeType bytes, void* oBuffer)
 {
-    return m_compressorData && m_compressorData->m_compressor ? m_compressorData->m_compressor->Read(this, bytes, GetCurPos(), oBuffer) : m_stream->Read(bytes, oBuffer);
+    if (m_compressorData && m_compressorData->m_compressor)
+    {
+        SizeType numRead = m_compressorData->m_compressor->Read(this, bytes, m_uncompressedPosition, oBuffer);
+        m_uncompressedPosition += numRead;
+        return numRead;
+    }
+    return m_stream->Read(bytes, oBuffer);
 }
 
 SizeType CompressorStream::Write(SizeType bytes, const void* iBuffer)
 {
-    return m_compressorData && m_compressorData->m_compressor ? m_compressorData->m_compressor->Write(this, bytes, iBuffer, GetCurPos()) : m_stream->Write(bytes, iBuffer);
+    if (m_compressorData && m_compressorData->m_compressor)
+    {
+        SizeType numWritten = m_compressorData->m_compressor->Write(this, bytes, iBuffer, m_uncompressedPosition);
+        m_uncompressedPosition += numWritten;
+        return numWritten;
+    }
+    return m_stream->Write(bytes, iBuffer);
 }
 
+/*!
+\brief Retrieves the current position. If a compressor is active this is the position in the uncompressed data, otherwise it's the position
+in the underlying stream.
+*/
 AZ::IO::SizeType CompressorStream::GetCurPos() const
 {
+    if (m_compressorData)
+    {
+        return m_uncompressedPosition;
+    }
     return m_stream ? m_stream->GetCurPos() : 0;
 }
 
@@ -97,11 +133,20 @@ AZ::IO::SizeType CompressorStream::GetCurPos() const
 \brief Reads from the compressor stream using the specified offset
 \param bytes Amount of bytes to read
 \param oBuffer Buffer to read bytes into. This buffer must be at least sizeof(@bytes)
-\param offset If the compressor is active then this offset is passed into the compressor to determine where the nearest seek point is located otherwise the underlying stream ReadAtOffset is called.
+\param offset If the compressor is active then this is an offset in the uncompressed data, which the compressor uses to find the nearest seek point, otherwise the underlying stream ReadAtOffset is called.
+If negative the read starts at the current position.
 */
 SizeType CompressorStream::ReadAtOffset(SizeType bytes, void *oBuffer, OffsetType offset)
 {
-    return m_compressorData && m_compressorData->m_compressor ? m_compressorData->m_compressor->Read(this, bytes, offset, oBuffer) : m_stream->ReadAtOffset(bytes, oBuffer, offset);
+    if (m_compressorData && m_compressorData->m_compressor)
+    {
+        if (offset >= 0)
+        {
+            m_uncompressedPosition = static_cast<SizeType>(offset);
+        }
+        return Read(bytes, oBuffer);
+    }
+    return m_stream->ReadAtOffset(bytes, oBuffer, offset);
 }
 
 /*!
@@ -129,6 +174,7 @@ bool CompressorStream::ReOpen()
 {
     if (m_stream->ReOpen())
     {
+        m_uncompressedPosition = 0;
         ReadCompressedHeader();
         return true;
     }
@@ -141,6 +187,7 @@ void CompressorStream::Close()
     {
         m_compressorData->m_compressor->Close(this);
     }
+    m_uncompressedPosition = 0;
     m_stream->Close();
 }
 
@@ -290,6 +337,10 @@ Compressor* CompressorStream::CreateCompressor(AZ::u32 compressorId)
     {
         m_compressor.reset(aznew CompressorZStd);
     }
+    else if (compressorId == CompressorBlock::TypeId())
+    {
+        m_compressor.reset(aznew CompressorBlock);
+    }
     else
     {
         AZ_Assert(false, "Unable to create compressor with type id [0x%08x]", compressorId);
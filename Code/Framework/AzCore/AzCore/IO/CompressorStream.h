@@ -76,6 +76,7 @@ namespace AZ
             bool m_isStreamOwner; ///< Boolean which determines whether this class is responsible for ownership of the stream
             AZStd::unique_ptr<CompressorData> m_compressorData; ///< CompressorData structure used for containing metadata related to the compressor in use
             AZStd::unique_ptr<Compressor> m_compressor; ///< Compressor object responsible for performing compressions/decompression
+            SizeType m_uncompressedPosition = 0; ///< Position in the uncompressed data, used instead of the position of the underlying stream when a compressor is active
         };
 
     } // namespace IO
@@ -11,6 +11,8 @@
 #include <AzCore/std/function/function_fwd.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/std/string/fixed_string.h>
 #include <AzCore/std/string/string.h>
@@ -40,6 +42,10 @@ namespace AZ
         using HandleType = AZ::u32;
         static const HandleType InvalidHandle = 0;
 
+        // Declared in AzCore/IO/FileIOAsync.h
+        struct FileReadRequest;
+        class FileReadFuture;
+
         enum class SeekType : AZ::u32
         {
             SeekFromStart,
@@ -116,6 +122,14 @@ namespace AZ
             virtual Result Flush(HandleType fileHandle) = 0;
             virtual bool Eof(HandleType fileHandle) = 0;
 
+            /// Asynchronous reads. Include AzCore/IO/FileIOAsync.h to use these.
+            /// The reads are forwarded to AZ::IO::Streamer if it's available so they don't block the calling thread and are
+            /// scheduled alongside all other streaming requests, using the deadline and priority of the request. Small reads
+            /// to nearby parts of the same file within a batch are coalesced into a single read.
+            /// If Streamer isn't available the reads are done synchronously through this instance.
+            FileReadFuture ReadAsync(const FileReadRequest& request);
+            AZStd::vector<FileReadFuture> ReadAsync(AZStd::span<const FileReadRequest> requests);
+
             /// the only requirement on the ModTime functions is that it must be comparable with subsequent calls to the same function.
             /// there is no specific requirement that they be cross-platform or adhere to any standard, but they should still be comparable
             /// across sessions.
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIOAsync.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ::IO
+{
+    namespace Internal
+    {
+        struct FileReadState
+        {
+            AZ_CLASS_ALLOCATOR(FileReadState, SystemAllocator);
+
+            void Complete(ResultCode result)
+            {
+                {
+                    AZStd::scoped_lock lock(m_mutex);
+                    m_result = result;
+                    m_isReady = true;
+                }
+                m_condition.notify_all();
+            }
+
+            AZStd::vector<u8> m_data;
+            AZStd::mutex m_mutex;
+            AZStd::condition_variable m_condition;
+            const char* m_callSite{ nullptr };
+            ResultCode m_result{ ResultCode::Error };
+            AZStd::atomic_bool m_isReady{ false };
+        };
+    } // namespace Internal
+
+    namespace FileIOAsyncInternal
+    {
+        //! Reads up to this size are considered for coalescing with neighboring reads.
+        static constexpr u64 MaxCoalescedReadSize = 64 * 1024;
+        //! Maximum size of a read that combines multiple requests.
+        static constexpr u64 MaxCoalescedSize = 512 * 1024;
+        //! Largest gap between two reads that's read and discarded in order to combine the reads. Reading a few extra
+        //! kilobytes is cheaper than issuing an additional request.
+        static constexpr u64 MaxCoalescedGap = 4 * 1024;
+        static constexpr const char* UnknownCallSite = "Unknown";
+        static constexpr const char* BlockingStatsName = "FileIOBlockingStats";
+
+        //! The number of call sites is small, so the statistics are stored in fixed size containers. This avoids allocating
+        //! memory from inside waits and keeps the statistics usable from any module.
+        static constexpr size_t MaxTrackedCallSites = 128;
+        static constexpr size_t MaxCallSiteNameLength = 64;
+
+        struct BlockingStatsEntry
+        {
+            AZStd::fixed_string<MaxCallSiteNameLength> m_name;
+            u64 m_numWaits{ 0 };
+            u64 m_numBlockingWaits{ 0 };
+            AZStd::chrono::microseconds m_totalBlocked{ 0 };
+            AZStd::chrono::microseconds m_maxBlocked{ 0 };
+        };
+
+        struct BlockingStatsStorage
+        {
+            AZStd::mutex m_mutex;
+            AZStd::fixed_vector<BlockingStatsEntry, MaxTrackedCallSites> m_callSites;
+        };
+
+        static BlockingStatsStorage& GetBlockingStats()
+        {
+            // Waits happen on any thread, so the variable is created through a function local static, which is initialized
+            // exactly once. CreateVariable returns the variable of another module if it already exists.
+            static EnvironmentVariable<BlockingStatsStorage> s_blockingStats =
+                Environment::CreateVariable<BlockingStatsStorage>(BlockingStatsName);
+            return *s_blockingStats;
+        }
+
+        //! Combined read for one or more requests to the same file.
+        struct ReadGroup
+        {
+            struct Target
+            {
+                AZStd::shared_ptr<Internal::FileReadState> m_state;
+                u64 m_offsetInGroup{ 0 };
+            };
+
+            AZStd::vector<Target> m_targets;
+            const AZStd::string* m_path{ nullptr };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            IStreamerTypes::Deadline m_deadline{ IStreamerTypes::s_noDeadline };
+            IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityLowest };
+            //! Large reads are never combined with the reads that follow.
+            bool m_allowCoalescing{ false };
+        };
+
+        static void ReadSynchronously(FileIOBase& fileIO, const FileReadRequest& request, Internal::FileReadState& state)
+        {
+            // Without Streamer the read blocks the thread that starts it instead of the thread that waits for it.
+            ScopedFileIOBlockTimer blockTimer(request.m_callSite);
+
+            HandleType handle = InvalidHandle;
+            if (!fileIO.Open(request.m_path.c_str(), OpenMode::ModeRead | OpenMode::ModeBinary, handle))
+            {
+                state.Complete(ResultCode::Error);
+                return;
+            }
+
+            u64 size = request.m_size;
+            if (size == FileReadRequest::EntireFile)
+            {
+                u64 fileSize = 0;
+                fileIO.Size(handle, fileSize);
+                size = fileSize > request.m_offset ? fileSize - request.m_offset : 0;
+            }
+
+            state.m_data.resize_no_construct(aznumeric_caster(size));
+            bool success = fileIO.Seek(handle, aznumeric_cast<s64>(request.m_offset), SeekType::SeekFromStart) &&
+                fileIO.Read(handle, state.m_data.data(), size, true);
+            fileIO.Close(handle);
+
+            if (!success)
+            {
+                state.m_data = {};
+            }
+            state.Complete(success ? ResultCode::Success : ResultCode::Error);
+        }
+
+        static FileRequestPtr QueueGroup(IStreamer& streamer, ReadGroup&& group)
+        {
+            if (group.m_targets.size() == 1)
+            {
+                // Read directly into the result.
+                AZStd::shared_ptr<Internal::FileReadState> state = AZStd::move(group.m_targets[0].m_state);
+                state->m_data.resize_no_construct(aznumeric_caster(group.m_size));
+                FileRequestPtr request = streamer.Read(*group.m_path, state->m_data.data(), state->m_data.size(), state->m_data.size(),
+                    group.m_deadline, group.m_priority, aznumeric_caster(group.m_offset));
+                streamer.SetRequestCompleteCallback(request, [state = AZStd::move(state), &streamer](FileRequestHandle handle)
+                    {
+                        void* buffer = nullptr;
+                        u64 numBytesRead = 0;
+                        bool success = streamer.GetRequestStatus(handle) == IStreamerTypes::RequestStatus::Completed &&
+                            streamer.GetReadRequestResult(handle, buffer, numBytesRead) && numBytesRead == state->m_data.size();
+                        if (!success)
+                        {
+                            state->m_data = {};
+                        }
+                        state->Complete(success ? ResultCode::Success : ResultCode::Error);
+                    });
+                return request;
+            }
+
+            // Read the entire range and split it up between the requests once the read completes.
+            auto buffer = AZStd::make_shared<AZStd::vector<u8>>();
+            buffer->resize_no_construct(aznumeric_caster(group.m_size));
+            FileRequestPtr request = streamer.Read(*group.m_path, buffer->data(), buffer->size(), buffer->size(),
+                group.m_deadline, group.m_priority, aznumeric_caster(group.m_offset));
+            streamer.SetRequestCompleteCallback(request,
+                [buffer = AZStd::move(buffer), targets = AZStd::move(group.m_targets), &streamer](FileRequestHandle handle)
+                {
+                    void* readBuffer = nullptr;
+                    u64 numBytesRead = 0;
+                    bool success = streamer.GetRequestStatus(handle) == IStreamerTypes::RequestStatus::Completed &&
+                        streamer.GetReadRequestResult(handle, readBuffer, numBytesRead) && numBytesRead == buffer->size();
+                    for (const ReadGroup::Target& target : targets)
+                    {
+                        if (success)
+                        {
+                            auto begin = buffer->begin() + target.m_offsetInGroup;
+                            target.m_state->m_data.assign(begin, begin + target.m_state->m_data.size());
+                        }
+                        else
+                        {
+                            target.m_state->m_data = {};
+                        }
+                        target.m_state->Complete(success ? ResultCode::Success : ResultCode::Error);
+                    }
+                });
+            return request;
+        }
+    } // namespace FileIOAsyncInternal
+
+    //
+    // FileReadFuture
+    //
+
+    FileReadFuture::FileReadFuture(AZStd::shared_ptr<Internal::FileReadState> state)
+        : m_state(AZStd::move(state))
+    {
+    }
+
+    bool FileReadFuture::IsValid() const
+    {
+        return m_state != nullptr;
+    }
+
+    bool FileReadFuture::IsReady() const
+    {
+        return m_state && m_state->m_isReady;
+    }
+
+    void FileReadFuture::Wait() const
+    {
+        AZ_Assert(m_state, "Waiting on a FileReadFuture that isn't connected to a read.");
+        const char* callSite = m_state->m_callSite ? m_state->m_callSite : FileIOAsyncInternal::UnknownCallSite;
+        if (m_state->m_isReady)
+        {
+            FileIOBlockingStats::Record(callSite, AZStd::chrono::microseconds::zero());
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "FileReadFuture::Wait - %s", callSite);
+        auto start = AZStd::chrono::steady_clock::now();
+        {
+            AZStd::unique_lock lock(m_state->m_mutex);
+            m_state->m_condition.wait(lock, [this]() { return m_state->m_isReady.load(); });
+        }
+        auto blocked = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - start);
+        FileIOBlockingStats::Record(callSite, AZStd::max(blocked, AZStd::chrono::microseconds(1)));
+    }
+
+    ResultCode FileReadFuture::GetResult() const
+    {
+        Wait();
+        return m_state->m_result;
+    }
+
+    const AZStd::vector<u8>& FileReadFuture::GetData() const
+    {
+        Wait();
+        return m_state->m_data;
+    }
+
+    AZStd::vector<u8> FileReadFuture::TakeData()
+    {
+        Wait();
+        return AZStd::move(m_state->m_data);
+    }
+
+    //
+    // FileIOBlockingStats
+    //
+
+    void FileIOBlockingStats::Record(const char* callSite, AZStd::chrono::microseconds blocked)
+    {
+        using namespace FileIOAsyncInternal;
+
+        BlockingStatsStorage& storage = GetBlockingStats();
+        AZStd::string_view name(callSite ? callSite : UnknownCallSite);
+        name = name.substr(0, MaxCallSiteNameLength);
+
+        AZStd::scoped_lock lock(storage.m_mutex);
+        auto it = AZStd::find_if(storage.m_callSites.begin(), storage.m_callSites.end(),
+            [name](const BlockingStatsEntry& entry)
+            {
+                return entry.m_name == name;
+            });
+        if (it == storage.m_callSites.end())
+        {
+            if (storage.m_callSites.size() == storage.m_callSites.capacity())
+            {
+                AZ_WarningOnce("FileIO", false, "Too many call sites to track blocking file reads. Call site '%.*s' is ignored.",
+                    AZ_STRING_ARG(name));
+                return;
+            }
+            storage.m_callSites.emplace_back().m_name = name;
+            it = storage.m_callSites.end() - 1;
+        }
+
+        BlockingStatsEntry& entry = *it;
+        entry.m_numWaits++;
+        if (blocked.count() > 0)
+        {
+            entry.m_numBlockingWaits++;
+            entry.m_totalBlocked += blocked;
+            entry.m_maxBlocked = AZStd::max(entry.m_maxBlocked, blocked);
+        }
+    }
+
+    AZStd::vector<FileIOBlockingStats::CallSite> FileIOBlockingStats::GetCallSites()
+    {
+        AZStd::vector<CallSite> result;
+        {
+            FileIOAsyncInternal::BlockingStatsStorage& storage = FileIOAsyncInternal::GetBlockingStats();
+            AZStd::scoped_lock lock(storage.m_mutex);
+            result.reserve(storage.m_callSites.size());
+            for (const FileIOAsyncInternal::BlockingStatsEntry& entry : storage.m_callSites)
+            {
+                CallSite& callSite = result.emplace_back();
+                callSite.m_name = entry.m_name;
+                callSite.m_numWaits = entry.m_numWaits;
+                callSite.m_numBlockingWaits = entry.m_numBlockingWaits;
+                callSite.m_totalBlocked = entry.m_totalBlocked;
+                callSite.m_maxBlocked = entry.m_maxBlocked;
+            }
+        }
+        AZStd::sort(result.begin(), result.end(),
+            [](const CallSite& lhs, const CallSite& rhs)
+            {
+                return lhs.m_totalBlocked > rhs.m_totalBlocked;
+            });
+        return result;
+    }
+
+    void FileIOBlockingStats::Reset()
+    {
+        FileIOAsyncInternal::BlockingStatsStorage& storage = FileIOAsyncInternal::GetBlockingStats();
+        AZStd::scoped_lock lock(storage.m_mutex);
+        storage.m_callSites.clear();
+    }
+
+    //
+    // ScopedFileIOBlockTimer
+    //
+
+    ScopedFileIOBlockTimer::ScopedFileIOBlockTimer(const char* callSite)
+        : m_start(AZStd::chrono::steady_clock::now())
+        , m_callSite(callSite)
+    {
+    }
+
+    ScopedFileIOBlockTimer::~ScopedFileIOBlockTimer()
+    {
+        auto blocked = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_start);
+        FileIOBlockingStats::Record(m_callSite, AZStd::max(blocked, AZStd::chrono::microseconds(1)));
+    }
+
+    //
+    // FileIOBase
+    //
+
+    FileReadFuture FileIOBase::ReadAsync(const FileReadRequest& request)
+    {
+        return AZStd::move(ReadAsync(AZStd::span<const FileReadRequest>(&request, 1))[0]);
+    }
+
+    AZStd::vector<FileReadFuture> FileIOBase::ReadAsync(AZStd::span<const FileReadRequest> requests)
+    {
+        using namespace FileIOAsyncInternal;
+
+        AZStd::vector<FileReadFuture> futures;
+        futures.reserve(requests.size());
+        AZStd::vector<AZStd::shared_ptr<Internal::FileReadState>> states;
+        states.reserve(requests.size());
+        for (const FileReadRequest& request : requests)
+        {
+            auto state = AZStd::make_shared<Internal::FileReadState>();
+            state->m_callSite = request.m_callSite;
+            futures.emplace_back(state);
+            states.push_back(AZStd::move(state));
+        }
+
+        IStreamer* streamer = Interface<IStreamer>::Get();
+        if (!streamer)
+        {
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                ReadSynchronously(*this, requests[i], *states[i]);
+            }
+            return futures;
+        }
+
+        // Resolve the read sizes and order the reads by file and offset so neighboring reads can be combined.
+        AZStd::vector<u64> sizes;
+        sizes.reserve(requests.size());
+        AZStd::vector<size_t> order;
+        order.reserve(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            u64 size = requests[i].m_size;
+            if (size == FileReadRequest::EntireFile)
+            {
+                u64 fileSize = 0;
+                if (!Size(requests[i].m_path.c_str(), fileSize))
+                {
+                    states[i]->Complete(ResultCode::Error);
+                    sizes.push_back(0);
+                    continue;
+                }
+                size = fileSize > requests[i].m_offset ? fileSize - requests[i].m_offset : 0;
+            }
+            sizes.push_back(size);
+            if (size == 0)
+            {
+                states[i]->Complete(ResultCode::Success);
+                continue;
+            }
+            order.push_back(i);
+        }
+        AZStd::sort(order.begin(), order.end(),
+            [&requests](size_t lhs, size_t rhs)
+            {
+                int compare = requests[lhs].m_path.compare(requests[rhs].m_path);
+                return compare != 0 ? compare < 0 : requests[lhs].m_offset < requests[rhs].m_offset;
+            });
+
+        AZStd::vector<FileRequestPtr> streamerRequests;
+        ReadGroup group;
+        for (size_t index : order)
+        {
+            const FileReadRequest& request = requests[index];
+            u64 size = sizes[index];
+            u64 end = request.m_offset + size;
+
+            bool canCoalesce = group.m_allowCoalescing && size <= MaxCoalescedReadSize && *group.m_path == request.m_path &&
+                request.m_offset <= group.m_offset + group.m_size + MaxCoalescedGap &&
+                AZStd::max(end, group.m_offset + group.m_size) - group.m_offset <= MaxCoalescedSize;
+            if (!canCoalesce)
+            {
+                if (!group.m_targets.empty())
+                {
+                    streamerRequests.push_back(QueueGroup(*streamer, AZStd::move(group)));
+                }
+                group = ReadGroup{};
+                group.m_path = &request.m_path;
+                group.m_offset = request.m_offset;
+                group.m_allowCoalescing = size <= MaxCoalescedReadSize;
+            }
+            group.m_size = AZStd::max(group.m_size, end - group.m_offset);
+            group.m_deadline = AZStd::min(group.m_deadline, request.m_deadline);
+            group.m_priority = AZStd::max(group.m_priority, request.m_priority);
+            states[index]->m_data.resize_no_construct(aznumeric_caster(size));
+            group.m_targets.push_back({ AZStd::move(states[index]), request.m_offset - group.m_offset });
+        }
+        if (!group.m_targets.empty())
+        {
+            streamerRequests.push_back(QueueGroup(*streamer, AZStd::move(group)));
+        }
+
+        if (!streamerRequests.empty())
+        {
+            streamer->QueueRequestBatch(AZStd::move(streamerRequests));
+        }
+        return futures;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    //! Description of a single read started with FileIOBase::ReadAsync.
+    struct FileReadRequest
+    {
+        //! Use as the size to read everything from the offset to the end of the file.
+        static constexpr u64 EntireFile = AZStd::numeric_limits<u64>::max();
+
+        //! Path to the file to read. This can include aliases such as @products@.
+        AZStd::string m_path;
+        u64 m_offset{ 0 };
+        u64 m_size{ EntireFile };
+        //! The amount of time from queuing the read that the data is needed.
+        IStreamerTypes::Deadline m_deadline{ IStreamerTypes::s_noDeadline };
+        IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityMedium };
+        //! Name used to attribute the time threads spend waiting for this read, for instance "LyShine.LoadCanvas".
+        //! The string needs to outlive the read, so typically this is a string literal.
+        const char* m_callSite{ nullptr };
+    };
+
+    namespace Internal
+    {
+        struct FileReadState;
+    }
+
+    //! Handle to the result of a read started with FileIOBase::ReadAsync. Copies of the future share the same result.
+    class FileReadFuture
+    {
+    public:
+        FileReadFuture() = default;
+        explicit FileReadFuture(AZStd::shared_ptr<Internal::FileReadState> state);
+
+        //! Returns false for default constructed futures, which are not connected to a read.
+        bool IsValid() const;
+        //! Returns true if the read has completed. This never blocks.
+        bool IsReady() const;
+        //! Blocks until the read has completed. The time spent waiting is recorded in FileIOBlockingStats for the call site
+        //! of the request.
+        void Wait() const;
+
+        //! Waits for the read to complete and returns whether it succeeded.
+        ResultCode GetResult() const;
+        //! Waits for the read to complete and returns the read data. The data is empty if the read failed.
+        const AZStd::vector<u8>& GetData() const;
+        //! Waits for the read to complete and moves the read data out of the shared result.
+        AZStd::vector<u8> TakeData();
+
+    private:
+        AZStd::shared_ptr<Internal::FileReadState> m_state;
+    };
+
+    //! Keeps track of how long threads are blocked on file reads, per call site. Waits on FileReadFuture are recorded
+    //! automatically. Call sites that still use synchronous reads can be measured with ScopedFileIOBlockTimer.
+    class FileIOBlockingStats
+    {
+    public:
+        struct CallSite
+        {
+            AZStd::string m_name;
+            //! Total number of waits, including waits on reads that had already completed.
+            u64 m_numWaits{ 0 };
+            //! Number of waits where the calling thread had to block.
+            u64 m_numBlockingWaits{ 0 };
+            AZStd::chrono::microseconds m_totalBlocked{ 0 };
+            AZStd::chrono::microseconds m_maxBlocked{ 0 };
+        };
+
+        static void Record(const char* callSite, AZStd::chrono::microseconds blocked);
+        //! Returns the recorded call sites, sorted by the total time blocked.
+        static AZStd::vector<CallSite> GetCallSites();
+        static void Reset();
+    };
+
+    //! Records the time spent in a scope as blocking file IO for the call site.
+    class ScopedFileIOBlockTimer
+    {
+    public:
+        explicit ScopedFileIOBlockTimer(const char* callSite);
+        ~ScopedFileIOBlockTimer();
+
+    private:
+        AZStd::chrono::steady_clock::time_point m_start;
+        const char* m_callSite;
+    };
+} // namespace AZ::IO
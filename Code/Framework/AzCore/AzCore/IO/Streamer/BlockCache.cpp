@@ -12,7 +12,9 @@
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ::IO
@@ -45,8 +47,14 @@ namespace AZ::IO
             cacheSize = aznumeric_caster(blockSize * 2);
         }
 
+        if (m_growthBudgetMib > 0)
+        {
+            BlockCache::SetGrowthBudget(m_growthBudgetMib * 1_mib);
+        }
+
         auto stackEntry = AZStd::make_shared<BlockCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+            m_maxCacheSizeMib * 1_mib);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -62,8 +70,10 @@ namespace AZ::IO
                 ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
             serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
+                ->Field("MaxCacheSizeMib", &BlockCacheConfig::m_maxCacheSizeMib)
+                ->Field("GrowthBudgetMib", &BlockCacheConfig::m_growthBudgetMib)
                 ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
         }
     }
@@ -71,6 +81,26 @@ namespace AZ::IO
     static constexpr char CacheHitRateName[] = "Cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
 
+    namespace BlockCacheInternal
+    {
+        //! Growth is shared between all block caches, including the ones created by the DedicatedCache.
+        static AZStd::atomic<u64> s_growthBudget{ 0 };
+        static AZStd::atomic<u64> s_growthUsed{ 0 };
+
+        static bool ReserveGrowth(u64 size)
+        {
+            u64 used = s_growthUsed.load();
+            do
+            {
+                if (used + size > s_growthBudget.load())
+                {
+                    return false;
+                }
+            } while (!s_growthUsed.compare_exchange_weak(used, used + size));
+            return true;
+        }
+    } // namespace BlockCacheInternal
+
     void BlockCache::Section::Prefix(const Section& section)
     {
         AZ_Assert(section.m_used, "Trying to prefix an unused section");
@@ -99,7 +129,7 @@ namespace AZ::IO
         m_blockOffset = 0; // Two merged sections do not support caching.
     }
 
-    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u64 maxCacheSize)
         : StreamStackEntry("Block cache")
         , m_alignment(alignment)
         , m_onlyEpilogWrites(onlyEpilogWrites)
@@ -107,27 +137,35 @@ namespace AZ::IO
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
         AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
 
-        m_numBlocks = aznumeric_caster(cacheSize / blockSize);
-        m_cacheSize = cacheSize - (cacheSize % blockSize); // Only use the amount needed for the cache.
         m_blockSize = blockSize;
-        if (m_numBlocks == 1)
+        m_numBlocks = 0;
+        m_cacheSize = 0;
+        m_blocksPerAllocation = aznumeric_caster(cacheSize / blockSize);
+        m_maxCacheSize = AZStd::max(maxCacheSize - (maxCacheSize % blockSize), cacheSize - (cacheSize % blockSize));
+        if (m_blocksPerAllocation == 1)
         {
             m_onlyEpilogWrites = true;
         }
 
-        m_cache = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
-            m_cacheSize, alignment));
-        m_cachedPaths = AZStd::unique_ptr<RequestPath[]>(new RequestPath[m_numBlocks]);
-        m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
-        m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
-        m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
-
+        AddCacheBlocks(m_blocksPerAllocation);
         ResetCache();
     }
 
     BlockCache::~BlockCache()
     {
-        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_cache, m_cacheSize, m_alignment);
+        u64 remaining = m_cacheSize;
+        for (u8* allocation : m_cacheAllocations)
+        {
+            u64 allocationSize = AZStd::min(remaining, aznumeric_cast<u64>(m_blocksPerAllocation) * m_blockSize);
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(allocation, allocationSize, m_alignment);
+            remaining -= allocationSize;
+        }
+
+        u64 grownSize = m_cacheSize - aznumeric_cast<u64>(m_blocksPerAllocation) * m_blockSize;
+        if (grownSize > 0)
+        {
+            BlockCacheInternal::s_growthUsed -= grownSize;
+        }
     }
 
     void BlockCache::QueueRequest(FileRequest* request)
@@ -315,11 +353,13 @@ namespace AZ::IO
                     main.Prefix(prolog);
                     m_hitRateStat.PushSample(0.0);
                     Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                    RecordFileClassAccess(data.m_path, false);
                 }
                 else
                 {
                     m_hitRateStat.PushSample(1.0);
                     Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                    RecordFileClassAccess(data.m_path, true);
                 }
             }
             else
@@ -333,6 +373,7 @@ namespace AZ::IO
 
                 m_hitRateStat.PushSample(readFromCache ? 1.0 : 0.0);
                 Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                RecordFileClassAccess(data.m_path, readFromCache);
             }
         }
 
@@ -353,6 +394,7 @@ namespace AZ::IO
 
             m_hitRateStat.PushSample(readFromCache ? 1.0 : 0.0);
             Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+            RecordFileClassAccess(data.m_path, readFromCache);
         }
 
         if (fullyCached)
@@ -394,6 +436,32 @@ namespace AZ::IO
             m_name, "Available slots", CalculateAvailableRequestSlots(),
             "The total number of slots available to processing cache-able requests with. If this value is low more memory may need to be "
             "allocated to the cache so more slots are available."));
+        statistics.push_back(Statistic::CreateIntegerRange(
+            m_name, "Recent blocks", m_recentBlocks.m_size, 0, m_numBlocks,
+            "The number of blocks in the cache that have been used once. Blocks read by large sequential reads stay in this list and "
+            "are evicted first."));
+        statistics.push_back(Statistic::CreateIntegerRange(
+            m_name, "Frequent blocks", m_frequentBlocks.m_size, 0, m_numBlocks,
+            "The number of blocks in the cache that have been used more than once."));
+        statistics.push_back(Statistic::CreateIntegerRange(
+            m_name, "Recent target", m_recentTarget, 0, m_numBlocks,
+            "The number of blocks the cache aims to keep in the recent list. This adapts to the access pattern; it grows when recently "
+            "evicted blocks are requested again and shrinks when evicted frequently used blocks are requested again."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Ghost hits", aznumeric_cast<s64>(m_ghostHits),
+            "The number of times a block was requested shortly after it was evicted. High values indicate the cache is too small for "
+            "the working set."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Current cache size", m_cacheSize,
+            "The current size of the cache, which is larger than the configured size if the cache has grown."));
+        for (size_t i = 0; i < m_numFileClasses; ++i)
+        {
+            const FileClassStatistic& fileClass = m_fileClassStatistics[i];
+            const u64 total = fileClass.m_hits + fileClass.m_misses;
+            statistics.push_back(Statistic::CreatePercentage(
+                m_name, fileClass.m_statisticName, total > 0 ? aznumeric_cast<double>(fileClass.m_hits) / aznumeric_cast<double>(total) : 0.0,
+                "The percentage of cacheable sections for files with this extension that were serviced with cached data."));
+        }
 
         StreamStackEntry::CollectStatistics(statistics);
     }
@@ -414,6 +482,16 @@ namespace AZ::IO
             aznumeric_cast<s32>(m_delayedSections.size());
     }
 
+    u64 BlockCache::GetCacheSize() const
+    {
+        return m_cacheSize;
+    }
+
+    void BlockCache::SetGrowthBudget(u64 budget)
+    {
+        BlockCacheInternal::s_growthBudget = budget;
+    }
+
     BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath)
     {
         u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
@@ -429,9 +507,10 @@ namespace AZ::IO
 
     BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock)
     {
+        // Requesting a block that's still being loaded also counts as a reuse.
+        TouchBlock(cacheBlock);
         if (!IsCacheBlockInFlight(cacheBlock))
         {
-            TouchBlock(cacheBlock);
             memcpy(section.m_output, GetCacheBlockData(cacheBlock) + section.m_blockOffset, section.m_copySize);
             return CacheResult::ReadFromCache;
         }
@@ -460,7 +539,7 @@ namespace AZ::IO
             Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
 
             section.m_parent = request;
-            cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset);
+            cacheLocation = RecycleBlock(filePath, section.m_readOffset);
             if (cacheLocation != s_fileNotCached)
             {
                 FileRequest* readRequest = m_context->GetNewInternalRequest();
@@ -545,7 +624,8 @@ namespace AZ::IO
 
         if (requestWasSuccessful)
         {
-            TouchBlock(cacheBlockIndex);
+            // The block was added to the recent list when it was recycled, so there's no need to touch it here as loading the
+            // block doesn't count as a use.
             m_inFlightRequests[cacheBlockIndex] = nullptr;
         }
         else
@@ -682,43 +762,116 @@ namespace AZ::IO
     u8* BlockCache::GetCacheBlockData(u32 index)
     {
         AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
-        return m_cache + (index * m_blockSize);
+        return m_cacheAllocations[index / m_blocksPerAllocation] + ((index % m_blocksPerAllocation) * m_blockSize);
     }
 
     void BlockCache::TouchBlock(u32 index)
     {
         AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
-        m_blockLastTouched[index] = AZStd::chrono::steady_clock::now();
+        if (m_blockLists[index] != BlockList::Free)
+        {
+            UnlinkBlock(index);
+            LinkBlock(index, BlockList::Frequent);
+        }
     }
 
-    u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
+    u32 BlockCache::RecycleBlock(const RequestPath& filePath, u64 offset)
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
 
-        // Find the oldest cache block.
-        TimePoint oldest = m_blockLastTouched[0];
-        u32 oldestIndex = 0;
-        for (u32 i = 1; i < m_numBlocks; ++i)
+        GhostKey key(filePath.GetHash(), offset);
+        auto ghost = m_ghosts.find(key);
+        const bool frequentGhostHit = ghost != m_ghosts.end() && ghost->second.m_list == BlockList::Frequent;
+        if (ghost != m_ghosts.end())
         {
-            if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+            m_ghostHits++;
+            m_ghostHitsSinceGrowth++;
+            TryGrowCache();
+        }
+
+        u32 index = s_fileNotCached;
+        if (!m_freeBlocks.empty())
+        {
+            index = m_freeBlocks.back();
+            m_freeBlocks.pop_back();
+        }
+        else
+        {
+            index = EvictBlock(frequentGhostHit);
+            if (index == s_fileNotCached)
             {
-                oldest = m_blockLastTouched[i];
-                oldestIndex = i;
+                // All blocks are in-flight. Leave the ghost entry so it still counts when the request is retried.
+                return s_fileNotCached;
             }
         }
 
-        if (!IsCacheBlockInFlight(oldestIndex))
+        m_cachedPaths[index] = filePath;
+        m_cachedOffsets[index] = offset;
+
+        // Evicting a block adds a ghost entry, so look the ghost up again.
+        ghost = m_ghosts.find(key);
+        if (ghost != m_ghosts.end())
         {
-            // Recycle the block.
-            m_cachedPaths[oldestIndex] = filePath;
-            m_cachedOffsets[oldestIndex] = offset;
-            TouchBlock(oldestIndex);
-            return oldestIndex;
+            // Adapt the target size of the recent list. A hit in the recent ghost list means the recent list was too small, while
+            // a hit in the frequent ghost list means the frequent list was too small.
+            if (ghost->second.m_list == BlockList::Recent)
+            {
+                u32 delta = AZStd::max(1u, aznumeric_cast<u32>(m_frequentGhosts.size() / m_recentGhosts.size()));
+                m_recentTarget = AZStd::min(m_numBlocks, m_recentTarget + delta);
+            }
+            else
+            {
+                u32 delta = AZStd::max(1u, aznumeric_cast<u32>(m_recentGhosts.size() / m_frequentGhosts.size()));
+                m_recentTarget = m_recentTarget > delta ? m_recentTarget - delta : 0;
+            }
+
+            // The block was recently used, so it goes straight into the frequent list.
+            RemoveGhost(ghost);
+            LinkBlock(index, BlockList::Frequent);
         }
         else
         {
-            return s_fileNotCached;
+            LinkBlock(index, BlockList::Recent);
+        }
+        TrimGhosts();
+        return index;
+    }
+
+    u32 BlockCache::EvictBlock(bool frequentGhostHit)
+    {
+        const u32 recentSize = m_recentBlocks.m_size;
+        const bool evictRecent = recentSize > 0 &&
+            (recentSize > m_recentTarget || (frequentGhostHit && recentSize == m_recentTarget) || m_frequentBlocks.m_size == 0);
+
+        BlockList victimList = evictRecent ? BlockList::Recent : BlockList::Frequent;
+        u32 victim = FindEvictableBlock(GetResidentList(victimList));
+        if (victim == s_fileNotCached)
+        {
+            // All blocks in the preferred list are in-flight, so fall back to the other list.
+            victimList = evictRecent ? BlockList::Frequent : BlockList::Recent;
+            victim = FindEvictableBlock(GetResidentList(victimList));
+            if (victim == s_fileNotCached)
+            {
+                return s_fileNotCached;
+            }
         }
+
+        AddGhost(GhostKey(m_cachedPaths[victim].GetHash(), m_cachedOffsets[victim]), victimList);
+        UnlinkBlock(victim);
+        return victim;
+    }
+
+    u32 BlockCache::FindEvictableBlock(const ResidentList& list) const
+    {
+        // Start at the least recently used block and skip any blocks that are still being read into.
+        for (u32 index = list.m_tail; index != s_fileNotCached; index = m_previousBlocks[index])
+        {
+            if (!IsCacheBlockInFlight(index))
+            {
+                return index;
+            }
+        }
+        return s_fileNotCached;
     }
 
     u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
@@ -747,19 +900,189 @@ namespace AZ::IO
 
         m_cachedPaths[index].Clear();
         m_cachedOffsets[index] = 0;
-        m_blockLastTouched[index] = TimePoint::min();
         m_inFlightRequests[index] = nullptr;
+        if (m_blockLists[index] != BlockList::Free)
+        {
+            UnlinkBlock(index);
+            m_freeBlocks.push_back(index);
+        }
     }
 
     void BlockCache::ResetCache()
     {
-        for (u32 i = 0; i < m_numBlocks; ++i)
+        m_freeBlocks.clear();
+        for (u32 i = m_numBlocks; i > 0; --i)
         {
-            ResetCacheEntry(i);
+            u32 index = i - 1;
+            m_cachedPaths[index].Clear();
+            m_cachedOffsets[index] = 0;
+            m_inFlightRequests[index] = nullptr;
+            m_blockLists[index] = BlockList::Free;
+            m_previousBlocks[index] = s_fileNotCached;
+            m_nextBlocks[index] = s_fileNotCached;
+            // Push in reverse so blocks are handed out starting at the first block.
+            m_freeBlocks.push_back(index);
         }
+        m_recentBlocks = {};
+        m_frequentBlocks = {};
+        m_recentGhosts.clear();
+        m_frequentGhosts.clear();
+        m_ghosts.clear();
+        m_recentTarget = 0;
         m_numInFlightRequests = 0;
     }
 
+    auto BlockCache::GetResidentList(BlockList list) -> ResidentList&
+    {
+        AZ_Assert(list != BlockList::Free, "The free blocks are not stored in a resident list.");
+        return list == BlockList::Recent ? m_recentBlocks : m_frequentBlocks;
+    }
+
+    void BlockCache::LinkBlock(u32 index, BlockList list)
+    {
+        AZ_Assert(m_blockLists[index] == BlockList::Free, "Cache block %u is linked into a list while it's already in one.", index);
+        ResidentList& residentList = GetResidentList(list);
+        m_blockLists[index] = list;
+        m_previousBlocks[index] = s_fileNotCached;
+        m_nextBlocks[index] = residentList.m_head;
+        if (residentList.m_head != s_fileNotCached)
+        {
+            m_previousBlocks[residentList.m_head] = index;
+        }
+        else
+        {
+            residentList.m_tail = index;
+        }
+        residentList.m_head = index;
+        residentList.m_size++;
+    }
+
+    void BlockCache::UnlinkBlock(u32 index)
+    {
+        AZ_Assert(m_blockLists[index] != BlockList::Free, "Cache block %u is unlinked while it's not in a list.", index);
+        ResidentList& residentList = GetResidentList(m_blockLists[index]);
+        u32 previous = m_previousBlocks[index];
+        u32 next = m_nextBlocks[index];
+        (previous != s_fileNotCached ? m_nextBlocks[previous] : residentList.m_head) = next;
+        (next != s_fileNotCached ? m_previousBlocks[next] : residentList.m_tail) = previous;
+        m_previousBlocks[index] = s_fileNotCached;
+        m_nextBlocks[index] = s_fileNotCached;
+        m_blockLists[index] = BlockList::Free;
+        residentList.m_size--;
+    }
+
+    void BlockCache::AddGhost(const GhostKey& key, BlockList list)
+    {
+        GhostQueue& queue = list == BlockList::Recent ? m_recentGhosts : m_frequentGhosts;
+        if (auto existing = m_ghosts.find(key); existing != m_ghosts.end())
+        {
+            RemoveGhost(existing);
+        }
+        queue.push_front(key);
+        m_ghosts.emplace(key, GhostEntry{ queue.begin(), list });
+    }
+
+    void BlockCache::RemoveGhost(AZStd::unordered_map<GhostKey, GhostEntry>::iterator ghost)
+    {
+        GhostQueue& queue = ghost->second.m_list == BlockList::Recent ? m_recentGhosts : m_frequentGhosts;
+        queue.erase(ghost->second.m_position);
+        m_ghosts.erase(ghost);
+    }
+
+    void BlockCache::TrimGhosts()
+    {
+        // ARC keeps the recent list and its ghosts at no more than the cache size and all lists combined at no more than
+        // twice the cache size.
+        while (!m_recentGhosts.empty() && m_recentBlocks.m_size + m_recentGhosts.size() > m_numBlocks)
+        {
+            m_ghosts.erase(m_recentGhosts.back());
+            m_recentGhosts.pop_back();
+        }
+        while (!m_frequentGhosts.empty() &&
+            m_recentBlocks.m_size + m_frequentBlocks.m_size + m_recentGhosts.size() + m_frequentGhosts.size() > 2 * m_numBlocks)
+        {
+            m_ghosts.erase(m_frequentGhosts.back());
+            m_frequentGhosts.pop_back();
+        }
+    }
+
+    void BlockCache::TryGrowCache()
+    {
+        if (m_cacheSize >= m_maxCacheSize || m_ghostHitsSinceGrowth < AZStd::max(1u, m_blocksPerAllocation / 2))
+        {
+            return;
+        }
+        m_ghostHitsSinceGrowth = 0;
+
+        u32 maxBlocks = aznumeric_cast<u32>(m_maxCacheSize / m_blockSize);
+        u32 count = AZStd::min(m_blocksPerAllocation, maxBlocks - m_numBlocks);
+        if (BlockCacheInternal::ReserveGrowth(aznumeric_cast<u64>(count) * m_blockSize))
+        {
+            AddCacheBlocks(count);
+        }
+    }
+
+    void BlockCache::AddCacheBlocks(u32 count)
+    {
+        AZ_Assert(m_numBlocks % m_blocksPerAllocation == 0, "Block cache can't grow after adding a partial allocation.");
+        u64 allocationSize = aznumeric_cast<u64>(count) * m_blockSize;
+        m_cacheAllocations.push_back(reinterpret_cast<u8*>(
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(allocationSize, m_alignment)));
+
+        u32 newNumBlocks = m_numBlocks + count;
+        m_cachedPaths.resize(newNumBlocks);
+        m_cachedOffsets.resize(newNumBlocks, 0);
+        m_inFlightRequests.resize(newNumBlocks, nullptr);
+        m_blockLists.resize(newNumBlocks, BlockList::Free);
+        m_previousBlocks.resize(newNumBlocks, s_fileNotCached);
+        m_nextBlocks.resize(newNumBlocks, s_fileNotCached);
+        for (u32 index = newNumBlocks; index > m_numBlocks; --index)
+        {
+            m_freeBlocks.push_back(index - 1);
+        }
+        m_numBlocks = newNumBlocks;
+        m_cacheSize += allocationSize;
+    }
+
+    void BlockCache::RecordFileClassAccess(const RequestPath& filePath, bool hit)
+    {
+        AZStd::string_view extension = filePath.GetRelativePath().Extension().Native();
+        if (extension.empty())
+        {
+            extension = "<none>";
+        }
+        extension = extension.substr(0, FileClassStatistic::MaxNameLength);
+
+        FileClassStatistic* fileClass = nullptr;
+        for (size_t i = 0; i < m_numFileClasses; ++i)
+        {
+            if (AZ::StringFunc::Equal(m_fileClassStatistics[i].m_extension, extension))
+            {
+                fileClass = &m_fileClassStatistics[i];
+                break;
+            }
+        }
+
+        if (!fileClass)
+        {
+            // Combine all classes after the maximum has been reached into the last entry.
+            const bool isOther = m_numFileClasses >= MaxFileClasses - 1;
+            fileClass = &m_fileClassStatistics[isOther ? MaxFileClasses - 1 : m_numFileClasses];
+            if (m_numFileClasses < MaxFileClasses)
+            {
+                // The statistic name is only assigned once as statistics refer to it instead of copying it.
+                fileClass->m_extension = isOther ? AZStd::string_view("<other>") : extension;
+                fileClass->m_statisticName = CacheHitRateName;
+                fileClass->m_statisticName += " (";
+                fileClass->m_statisticName += fileClass->m_extension;
+                fileClass->m_statisticName += ")";
+                m_numFileClasses++;
+            }
+        }
+
+        (hit ? fileClass->m_hits : fileClass->m_misses)++;
+    }
+
     void BlockCache::Report(const Requests::ReportData& data) const
     {
         switch (data.m_reportType)
@@ -775,6 +1098,10 @@ namespace AZ::IO
                 "additional data. Use a drive nodes sector size as a guide."));
             data.m_output.push_back(
                 Statistic::CreateInteger(m_name, "Block count", m_numBlocks, "The total number of blocks the cache has available."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max cache size", m_maxCacheSize,
+                "The size the cache is allowed to grow to when recently evicted blocks are frequently requested again. Growth is "
+                "further limited by the growth budget shared by all block caches."));
             data.m_output.push_back(Statistic::CreateByteSize(
                 m_name, "Alignment", m_alignment,
                 "The number of bytes the cache will align to. For prologs this means adding bytes to the start of the request to meet the "
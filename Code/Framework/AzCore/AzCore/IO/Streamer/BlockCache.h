@@ -15,9 +15,14 @@
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/utils.h>
 
 namespace AZ::IO
 {
@@ -53,15 +58,28 @@ namespace AZ::IO
 
         //! The overall size of the cache in megabytes.
         u32 m_cacheSizeMib{ 8 };
+        //! The size the cache is allowed to grow to in megabytes. The cache grows in steps of m_cacheSizeMib when
+        //! blocks that were recently evicted are requested again, which indicates the working set doesn't fit.
+        //! If this is not larger than m_cacheSizeMib the cache will not grow.
+        u32 m_maxCacheSizeMib{ 0 };
+        //! The combined amount of memory in megabytes that all block caches together are allowed to grow by.
+        //! This is shared by every block cache in the application, so multiple caches can't exceed it.
+        u32 m_growthBudgetMib{ 0 };
         //! The size of the individual blocks inside the cache.
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
     };
 
+    //! Caches the blocks at the start and end of read requests so that reads that share a block only read it once.
+    //! Blocks are evicted using Adaptive Replacement Cache (ARC). Blocks are kept in either a list of blocks that were
+    //! used once (recent) or a list of blocks that have been used multiple times (frequent). The keys of blocks evicted
+    //! from these lists are remembered in ghost lists, which are used to adapt the target size of the recent list. This
+    //! prevents large sequential reads from flushing blocks that are frequently reused.
     class BlockCache
         : public StreamStackEntry
     {
     public:
-        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        //! @param maxCacheSize The size the cache is allowed to grow to. If this is not larger than cacheSize, the cache won't grow.
+        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u64 maxCacheSize = 0);
         BlockCache(BlockCache&& rhs) = delete;
         BlockCache(const BlockCache& rhs) = delete;
         ~BlockCache() override;
@@ -86,6 +104,11 @@ namespace AZ::IO
         double CalculateHitRatePercentage() const;
         double CalculateCacheableRatePercentage() const;
         s32 CalculateAvailableRequestSlots() const;
+        //! Returns the current size of the cache, which can be larger than the initial size if the cache has grown.
+        u64 GetCacheSize() const;
+
+        //! Sets the combined amount of memory in bytes all block caches are allowed to grow by.
+        static void SetGrowthBudget(u64 budget);
 
     protected:
         static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
@@ -114,7 +137,43 @@ namespace AZ::IO
             void Prefix(const Section& section);
         };
 
-        using TimePoint = AZStd::chrono::steady_clock::time_point;
+        //! The ARC list a cache block is stored in.
+        enum class BlockList : u8
+        {
+            Free, //!< The block isn't used and is available from m_freeBlocks.
+            Recent, //!< The block has been used once since it was loaded.
+            Frequent //!< The block has been used more than once since it was loaded.
+        };
+
+        //! Doubly linked list threaded through the cache block indices. The head is the most recently used block.
+        struct ResidentList
+        {
+            u32 m_head{ s_fileNotCached };
+            u32 m_tail{ s_fileNotCached };
+            u32 m_size{ 0 };
+        };
+
+        //! Identifies a block that has been evicted. Only the hash of the path is stored as ghost entries don't hold data and a
+        //! collision only affects how the cache adapts.
+        using GhostKey = AZStd::pair<size_t, u64>;
+        using GhostQueue = AZStd::list<GhostKey>;
+        struct GhostEntry
+        {
+            GhostQueue::iterator m_position;
+            BlockList m_list;
+        };
+
+        //! Hit rate bookkeeping per file class, which is the extension of the file.
+        struct FileClassStatistic
+        {
+            static constexpr size_t MaxNameLength = 32;
+            AZStd::fixed_string<MaxNameLength> m_extension;
+            AZStd::fixed_string<MaxNameLength + 32> m_statisticName;
+            u64 m_hits{ 0 };
+            u64 m_misses{ 0 };
+        };
+        //! The maximum number of file classes tracked. Once reached, all other classes are combined in the last entry.
+        static constexpr size_t MaxFileClasses = 16;
 
         void ReadFile(FileRequest* request, Requests::ReadData& data);
         void ContinueReadFile(FileRequest* request, u64 fileLength);
@@ -126,13 +185,32 @@ namespace AZ::IO
             u64 offset, u64 size, u8* buffer) const;
 
         u8* GetCacheBlockData(u32 index);
+        //! Marks the block as used again, which moves it to the front of the frequent list.
         void TouchBlock(u32 index);
-        AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
+        //! Assigns a cache block to the file block, evicting a block if there's no free block.
+        //! Returns s_fileNotCached if all blocks are in-flight.
+        AZ::u32 RecycleBlock(const RequestPath& filePath, u64 offset);
+        //! Selects a block to evict using the ARC policy and remembers its key in the matching ghost list.
+        u32 EvictBlock(bool frequentGhostHit);
+        u32 FindEvictableBlock(const ResidentList& list) const;
         u32 FindInCache(const RequestPath& filePath, u64 offset) const;
         bool IsCacheBlockInFlight(u32 index) const;
         void ResetCacheEntry(u32 index);
         void ResetCache();
 
+        ResidentList& GetResidentList(BlockList list);
+        void LinkBlock(u32 index, BlockList list);
+        void UnlinkBlock(u32 index);
+        void AddGhost(const GhostKey& key, BlockList list);
+        void RemoveGhost(AZStd::unordered_map<GhostKey, GhostEntry>::iterator ghost);
+        void TrimGhosts();
+
+        //! Adds another allocation of cache blocks if evicted blocks are frequently requested and there's room in the budget.
+        void TryGrowCache();
+        void AddCacheBlocks(u32 count);
+
+        void RecordFileClassAccess(const RequestPath& filePath, bool hit);
+
         void Report(const Requests::ReportData& data) const;
 
         //! Map of the file requests that are being processed and the sections of the parent requests they'll complete.
@@ -143,20 +221,42 @@ namespace AZ::IO
         AZ::Statistics::RunningStatistic m_hitRateStat;
         AZ::Statistics::RunningStatistic m_cacheableStat;
 
-        u8* m_cache;
+        //! Allocations holding the cache blocks. The first allocation is made at construction and additional allocations are
+        //! added when the cache grows. Every allocation, except possibly the last one, holds m_blocksPerAllocation blocks.
+        AZStd::vector<u8*> m_cacheAllocations;
         u64 m_cacheSize;
+        u64 m_maxCacheSize;
         u32 m_blockSize;
         u32 m_alignment;
         u32 m_numBlocks;
+        u32 m_blocksPerAllocation;
         s32 m_numInFlightRequests{ 0 };
         //! The file path associated with a cache block.
-        AZStd::unique_ptr<RequestPath[]> m_cachedPaths; // Array of m_numBlocks size.
+        AZStd::vector<RequestPath> m_cachedPaths; // Array of m_numBlocks size.
         //! The offset into the file the cache blocks starts at.
-        AZStd::unique_ptr<u64[]> m_cachedOffsets; // Array of m_numBlocks size.
-        //! The last time the cache block was read from.
-        AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
+        AZStd::vector<u64> m_cachedOffsets; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
-        AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        AZStd::vector<FileRequest*> m_inFlightRequests; // Array of m_numBlocks size.
+
+        //! ARC state. The list a block is in and the links to the neighboring blocks in that list.
+        AZStd::vector<BlockList> m_blockLists; // Array of m_numBlocks size.
+        AZStd::vector<u32> m_previousBlocks; // Array of m_numBlocks size.
+        AZStd::vector<u32> m_nextBlocks; // Array of m_numBlocks size.
+        AZStd::vector<u32> m_freeBlocks;
+        ResidentList m_recentBlocks;
+        ResidentList m_frequentBlocks;
+        //! Keys of blocks recently evicted from the recent and frequent lists. The front is the most recently evicted.
+        GhostQueue m_recentGhosts;
+        GhostQueue m_frequentGhosts;
+        AZStd::unordered_map<GhostKey, GhostEntry> m_ghosts;
+        //! The number of blocks ARC aims to keep in the recent list. Grows when recently evicted blocks are requested again and
+        //! shrinks when evicted frequently used blocks are requested again.
+        u32 m_recentTarget{ 0 };
+        u64 m_ghostHits{ 0 };
+        u32 m_ghostHitsSinceGrowth{ 0 };
+
+        AZStd::array<FileClassStatistic, MaxFileClasses> m_fileClassStatistics;
+        size_t m_numFileClasses{ 0 };
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
@@ -43,7 +43,8 @@ namespace AZ::IO
         }
 
         auto stackEntry = AZStd::make_shared<DedicatedCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), m_writeOnlyEpilog);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), m_writeOnlyEpilog,
+            m_maxCacheSizeMib * 1_mib);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -53,8 +54,9 @@ namespace AZ::IO
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
             serializeContext->Class<DedicatedCacheConfig, IStreamerStackConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("CacheSizeMib", &DedicatedCacheConfig::m_cacheSizeMib)
+                ->Field("MaxCacheSizeMib", &DedicatedCacheConfig::m_maxCacheSizeMib)
                 ->Field("BlockSize", &DedicatedCacheConfig::m_blockSize)
                 ->Field("WriteOnlyEpilog", &DedicatedCacheConfig::m_writeOnlyEpilog);
         }
@@ -66,9 +68,10 @@ namespace AZ::IO
     // DedicatedCache
     //
 
-    DedicatedCache::DedicatedCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    DedicatedCache::DedicatedCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u64 maxCacheSize)
         : StreamStackEntry("Dedicated cache")
         , m_cacheSize(cacheSize)
+        , m_maxCacheSize(maxCacheSize)
         , m_alignment(alignment)
         , m_blockSize(blockSize)
         , m_onlyEpilogWrites(onlyEpilogWrites)
@@ -285,7 +288,7 @@ namespace AZ::IO
             index = m_cachedFileCaches.size();
             m_cachedFileNames.push_back(data.m_path);
             m_cachedFileRanges.push_back(data.m_range);
-            m_cachedFileCaches.push_back(AZStd::make_unique<BlockCache>(m_cacheSize, m_blockSize, m_alignment, m_onlyEpilogWrites));
+            m_cachedFileCaches.push_back(AZStd::make_unique<BlockCache>(m_cacheSize, m_blockSize, m_alignment, m_onlyEpilogWrites, m_maxCacheSize));
             m_cachedFileCaches[index]->SetNext(m_next);
             m_cachedFileCaches[index]->SetContext(*m_context);
             m_cachedFileRefCounts.push_back(1);
@@ -42,6 +42,9 @@ namespace AZ::IO
         BlockCacheConfig::BlockSize m_blockSize{ BlockCacheConfig::BlockSize::MemoryAlignment };
         //! The overall size of the cache in megabytes.
         u32 m_cacheSizeMib{ 8 };
+        //! The size each cache is allowed to grow to in megabytes. Growth comes out of the budget shared by all block caches, see
+        //! BlockCacheConfig::m_growthBudgetMib. If this is not larger than m_cacheSizeMib the caches will not grow.
+        u32 m_maxCacheSizeMib{ 0 };
         //! If true, only the epilog is written otherwise the prolog and epilog are written. In either case both prolog and epilog are read.
         //! For uses of the cache that read mostly sequentially this flag should be set to true. If reads are more random than it's better
         //! to set this flag to false.
@@ -52,7 +55,7 @@ namespace AZ::IO
         : public StreamStackEntry
     {
     public:
-        DedicatedCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        DedicatedCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u64 maxCacheSize = 0);
 
         void SetNext(AZStd::shared_ptr<StreamStackEntry> next) override;
         void SetContext(StreamerContext& context) override;
@@ -96,6 +99,7 @@ namespace AZ::IO
 #endif
 
         u64 m_cacheSize;
+        u64 m_maxCacheSize;
         u32 m_alignment;
         u32 m_blockSize;
         bool m_onlyEpilogWrites;
@@ -271,10 +271,12 @@ namespace AZ::IO::Requests
 namespace AZ::IO
 {
     class Streamer_SchedulerTest_RequestSorting_Test;
+    class Streamer_SchedulerTest_DeadlineAwareSorting_Test;
 
     class FileRequest final
     {
         friend Streamer_SchedulerTest_RequestSorting_Test;
+        friend Streamer_SchedulerTest_DeadlineAwareSorting_Test;
 
     public:
         inline constexpr static AZStd::chrono::steady_clock::time_point s_noDeadlineTime = AZStd::chrono::steady_clock::time_point::max();
@@ -412,6 +414,7 @@ namespace AZ::IO
         friend class Scheduler;
         friend class Device;
         friend class Streamer_SchedulerTest_RequestSorting_Test;
+        friend class Streamer_SchedulerTest_DeadlineAwareSorting_Test;
         friend bool operator==(const FileRequestHandle& lhs, const FileRequestPtr& rhs);
 
     public:
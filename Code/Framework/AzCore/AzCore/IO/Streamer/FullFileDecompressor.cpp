@@ -738,7 +738,7 @@ namespace AZ::IO
             "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
             request->m_readSize, compressionInfo.m_uncompressedSize);
 
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+        bool success = CompressionUtils::Decompress(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
             compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
 
@@ -758,7 +758,7 @@ namespace AZ::IO
         AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
         AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+        bool success = CompressionUtils::Decompress(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
             compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
 
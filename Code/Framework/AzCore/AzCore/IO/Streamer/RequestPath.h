@@ -46,11 +46,13 @@ namespace AZ
             PathView GetRelativePath() const;
             size_t GetHash() const;
 
+            //! Resolves aliases in the path, if this hasn't been done already. The hash only identifies the file after resolving.
+            void ResolvePath() const;
+
         private:
             constexpr static const size_t s_invalidPathHash = std::numeric_limits<size_t>::max();
             constexpr static const size_t s_emptyPathHash = std::numeric_limits<size_t>::min();
 
-            void ResolvePath() const;
             size_t FindAliasOffset(AZStd::string_view path) const;
 
             mutable FixedMaxPath m_path;
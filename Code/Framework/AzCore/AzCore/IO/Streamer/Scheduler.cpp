@@ -21,7 +21,19 @@ namespace AZ::IO
     static constexpr const char* ImmediateReadsName = "Immediate reads";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
-    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
+    //! Returns the hash of the path after it has been resolved, so the hash identifies the file regardless of the alias used.
+    static size_t GetResolvedPathHash(const RequestPath& path)
+    {
+        if (!path.GetRelativePath().empty())
+        {
+            path.ResolvePath();
+        }
+        return path.GetHash();
+    }
+
+    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity,
+        SchedulingMode schedulingMode)
+        : m_schedulingMode(schedulingMode)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment provided to AZ::IO::Scheduler isn't a power of two.");
         AZ_Assert(IStreamerTypes::IsPowerOf2(sizeAlignment), "Size alignment provided to AZ::IO::Scheduler isn't a power of two.");
@@ -133,6 +145,27 @@ namespace AZ::IO
             SchedulerName, "Is suspended", m_isSuspended,
             "Whether or not the scheduler is suspended. When suspended the scheduler will not do any processing and effectively prevents "
             "Streamer from doing any work.", Statistic::GraphType::None));
+
+        // The per frame counts are closed by EndStatisticsFrame, so any number of consumers can collect statistics.
+        statistics.push_back(Statistic::CreateIntegerRange(
+            SchedulerName, "Reads queued after deadline per frame", aznumeric_cast<s64>(m_missedDeadlinesLastFrame),
+            aznumeric_cast<s64>(m_missedDeadlinesPerFrameStat.GetMinimum()), aznumeric_cast<s64>(m_missedDeadlinesPerFrameStat.GetMaximum()),
+            "The number of reads that were queued for processing during the last frame after their deadline had already passed. These "
+            "reads will arrive late no matter how they're scheduled. A consistently high value indicates that deadlines are too tight or "
+            "that there are more requests than the storage drives can handle."));
+        statistics.push_back(Statistic::CreateIntegerRange(
+            SchedulerName, "Panic requests per frame", aznumeric_cast<s64>(m_panicsLastFrame),
+            aznumeric_cast<s64>(m_panicsPerFrameStat.GetMinimum()), aznumeric_cast<s64>(m_panicsPerFrameStat.GetMaximum()),
+            "The number of reads that were queued for processing during the last frame while estimated to complete after their deadline."));
+        statistics.push_back(Statistic::CreateInteger(
+            SchedulerName, "Reads queued after deadline", aznumeric_cast<s64>(m_missedDeadlineCount.load()),
+            "The total number of reads that were queued for processing after their deadline had already passed. These reads will arrive "
+            "late no matter how they're scheduled. A steadily increasing value indicates that deadlines are too tight or that there are "
+            "more requests than the storage drives can handle."));
+        statistics.push_back(Statistic::CreateInteger(
+            SchedulerName, "Panic requests", aznumeric_cast<s64>(m_panicCount.load()),
+            "The total number of reads that were queued for processing while estimated to complete after their deadline. These reads are "
+            "prioritized over reads that are cheaper to process, which reduces the overall read speed."));
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         statistics.push_back(Statistic::CreateBoolean(
             SchedulerName, "Is idle", m_stackStatus.m_isIdle,
@@ -181,11 +214,28 @@ namespace AZ::IO
         m_threadData.m_streamStack->CollectStatistics(statistics);
     }
 
+    void Scheduler::EndStatisticsFrame()
+    {
+        const u64 missedDeadlineCount = m_missedDeadlineCount.load();
+        const u64 panicCount = m_panicCount.load();
+        m_missedDeadlinesLastFrame = missedDeadlineCount - m_missedDeadlineCountAtFrameStart;
+        m_panicsLastFrame = panicCount - m_panicCountAtFrameStart;
+        m_missedDeadlineCountAtFrameStart = missedDeadlineCount;
+        m_panicCountAtFrameStart = panicCount;
+        m_missedDeadlinesPerFrameStat.PushEntry(m_missedDeadlinesLastFrame);
+        m_panicsPerFrameStat.PushEntry(m_panicsLastFrame);
+    }
+
     void Scheduler::GetRecommendations(IStreamerTypes::Recommendations& recommendations) const
     {
         recommendations = m_recommendations;
     }
 
+    auto Scheduler::GetSchedulingMode() const -> SchedulingMode
+    {
+        return m_schedulingMode;
+    }
+
     void Scheduler::Thread_MainLoop()
     {
         m_threadData.m_streamStack->SetContext(m_context);
@@ -313,6 +363,8 @@ namespace AZ::IO
                     }
                 }
 
+                Thread_RecordDeadlineStatus(next, parentReadRequest->m_deadline);
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 if (m_processingSize == 0)
                 {
@@ -633,9 +685,21 @@ namespace AZ::IO
 
         m_threadData.m_streamStack->UpdateCompletionEstimates(now, m_threadData.m_internalPendingRequests,
             pendingQueue.begin(), pendingQueue.end());
+        // The requests that are already in the stream stack need to finish before any of the pending requests can complete.
+        AZStd::chrono::steady_clock::time_point drainTime = now;
+        for (const FileRequest* request : m_threadData.m_internalPendingRequests)
+        {
+            drainTime = AZStd::max(drainTime, request->GetEstimatedCompletion());
+        }
         m_threadData.m_internalPendingRequests.clear();
 
-        if (m_context.GetNumPreparedRequests() > 1)
+        if (m_schedulingMode == SchedulingMode::DeadlineAware && m_context.GetNumPreparedRequests() > 1)
+        {
+            AZ_PROFILE_SCOPE(AzCore,
+                "Scheduler::Thread_ScheduleRequests - Deadline aware sorting %i requests", m_context.GetNumPreparedRequests());
+            Thread_ScheduleRequestsDeadlineAware(pendingQueue, drainTime);
+        }
+        else if (m_context.GetNumPreparedRequests() > 1)
         {
             AZ_PROFILE_SCOPE(AzCore,
                 "Scheduler::Thread_ScheduleRequests - Sorting %i requests", m_context.GetNumPreparedRequests());
@@ -668,4 +732,277 @@ namespace AZ::IO
             AZStd::sort(pendingQueue.begin(), pendingQueue.end(), sorter);
         }
     }
+
+    void Scheduler::Thread_ScheduleRequestsDeadlineAware(
+        StreamerContext::PreparedQueue& queue, AZStd::chrono::steady_clock::time_point drainTime)
+    {
+        AZStd::vector<ScheduleEntry>& entries = m_threadData.m_scheduleEntries;
+        entries.clear();
+        entries.reserve(queue.size());
+
+        // The stream stack estimates the pending requests one after the other in their current order, so the difference with the
+        // estimate of the previous request is the time needed to process a request, including the cost of switching files and seeking.
+        AZStd::chrono::steady_clock::time_point previousCompletion = drainTime;
+        for (FileRequest* request : queue)
+        {
+            ScheduleEntry& entry = entries.emplace_back();
+            entry.m_request = request;
+            entry.m_pendingId = request->GetPendingId();
+
+            AZStd::chrono::steady_clock::time_point estimatedCompletion = request->GetEstimatedCompletion();
+            if (estimatedCompletion > previousCompletion)
+            {
+                entry.m_serviceTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(estimatedCompletion - previousCompletion);
+                previousCompletion = estimatedCompletion;
+            }
+
+            AZStd::visit([&entry](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, AZStd::monostate>)
+                {
+                    entry.m_orderPriority = IStreamerTypes::s_priorityLowest;
+                }
+                else
+                {
+                    entry.m_orderPriority = Command::s_orderPriority;
+                    if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+                    {
+                        entry.m_file = &args.m_path;
+                        entry.m_offset = args.m_offset;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+                    {
+                        // Use the location in the archive so reads from the same archive are ordered by their position on disk.
+                        entry.m_file = &args.m_compressionInfo.m_archiveFilename;
+                        entry.m_offset = args.m_compressionInfo.m_offset;
+                    }
+                }
+            }, request->GetCommand());
+
+            if (entry.m_file)
+            {
+                entry.m_tier = ScheduleTier::Elevator;
+                entry.m_fileHash = GetResolvedPathHash(*entry.m_file);
+                if (const Requests::ReadRequestData* readRequest = request->GetCommandFromChain<Requests::ReadRequestData>();
+                    readRequest != nullptr)
+                {
+                    entry.m_deadline = readRequest->m_deadline;
+                    entry.m_priority = readRequest->m_priority;
+                    if (estimatedCompletion > entry.m_deadline)
+                    {
+                        entry.m_tier = ScheduleTier::Urgent;
+                    }
+                }
+            }
+        }
+
+        // Bring the requests in panic to the front in order of their deadline.
+        AZStd::sort(entries.begin(), entries.end(),
+            [](const ScheduleEntry& lhs, const ScheduleEntry& rhs)
+            {
+                bool lhsUrgent = lhs.m_tier == ScheduleTier::Urgent;
+                bool rhsUrgent = rhs.m_tier == ScheduleTier::Urgent;
+                if (lhsUrgent != rhsUrgent)
+                {
+                    return lhsUrgent;
+                }
+                if (lhsUrgent)
+                {
+                    if (lhs.m_deadline != rhs.m_deadline)
+                    {
+                        return lhs.m_deadline < rhs.m_deadline;
+                    }
+                    if (lhs.m_priority != rhs.m_priority)
+                    {
+                        return lhs.m_priority > rhs.m_priority;
+                    }
+                }
+                return lhs.m_pendingId < rhs.m_pendingId;
+            });
+
+        // Only keep the requests in panic urgent if they can still complete before their deadline when processed in order of their
+        // deadline. If a request would complete too late, the request with the lowest priority and the longest processing time is
+        // dropped, which maximizes the number of requests that complete on time. Dropped requests can't meet their deadline anymore,
+        // so instead of pushing out requests that still can, they're processed with the regular reads in the most efficient order.
+        AZStd::vector<size_t>& admitted = m_threadData.m_admittedEntries;
+        admitted.clear();
+        AZStd::chrono::steady_clock::time_point completion = drainTime;
+        for (size_t i = 0; i < entries.size() && entries[i].m_tier == ScheduleTier::Urgent; ++i)
+        {
+            admitted.push_back(i);
+            completion += entries[i].m_serviceTime;
+            while (completion > entries[i].m_deadline)
+            {
+                auto victim = admitted.begin();
+                for (auto it = admitted.begin() + 1; it != admitted.end(); ++it)
+                {
+                    const ScheduleEntry& candidate = entries[*it];
+                    const ScheduleEntry& current = entries[*victim];
+                    if (candidate.m_priority < current.m_priority ||
+                        (candidate.m_priority == current.m_priority && candidate.m_serviceTime >= current.m_serviceTime))
+                    {
+                        victim = it;
+                    }
+                }
+
+                size_t victimIndex = *victim;
+                completion -= entries[victimIndex].m_serviceTime;
+                entries[victimIndex].m_tier = ScheduleTier::Elevator;
+                admitted.erase(victim);
+                if (victimIndex == i)
+                {
+                    break;
+                }
+            }
+        }
+
+        // Group the reads per file in order of their offset so the elevator groups can be determined.
+        AZStd::sort(entries.begin(), entries.end(),
+            [](const ScheduleEntry& lhs, const ScheduleEntry& rhs)
+            {
+                if (lhs.m_tier != rhs.m_tier)
+                {
+                    return lhs.m_tier < rhs.m_tier;
+                }
+                if (lhs.m_tier == ScheduleTier::Elevator)
+                {
+                    if (lhs.m_fileHash != rhs.m_fileHash)
+                    {
+                        return lhs.m_fileHash < rhs.m_fileHash;
+                    }
+                    if (lhs.m_offset != rhs.m_offset)
+                    {
+                        return lhs.m_offset < rhs.m_offset;
+                    }
+                }
+                return lhs.m_pendingId < rhs.m_pendingId;
+            });
+
+        auto assignGroup = [&entries](size_t begin, size_t end, bool isAheadOfHead)
+        {
+            AZStd::chrono::steady_clock::time_point groupDeadline = AZStd::chrono::steady_clock::time_point::max();
+            size_t groupPendingId = AZStd::numeric_limits<size_t>::max();
+            for (size_t i = begin; i < end; ++i)
+            {
+                groupDeadline = AZStd::min(groupDeadline, entries[i].m_deadline);
+                groupPendingId = AZStd::min(groupPendingId, entries[i].m_pendingId);
+            }
+            for (size_t i = begin; i < end; ++i)
+            {
+                entries[i].m_groupDeadline = groupDeadline;
+                entries[i].m_groupPendingId = groupPendingId;
+                entries[i].m_isAheadOfHead = isAheadOfHead;
+            }
+        };
+
+        // The reads in the file that was last read from that are at or after the last read position continue the sweep through that
+        // file. The reads before the last position have to wait for the next sweep. This guarantees progress for all reads, as the
+        // read position only moves forward until the end of the file. The other files are visited in order of their most urgent read,
+        // so reads that have already missed their deadline are picked up first.
+        const RequestPath& headFile = m_threadData.m_lastFilePath;
+        const size_t headFileHash = GetResolvedPathHash(headFile);
+        const u64 headOffset = m_threadData.m_lastFileOffset;
+        size_t groupBegin = 0;
+        while (groupBegin < entries.size() && entries[groupBegin].m_tier != ScheduleTier::Elevator)
+        {
+            ++groupBegin;
+        }
+        while (groupBegin < entries.size())
+        {
+            const ScheduleEntry& first = entries[groupBegin];
+            size_t groupEnd = groupBegin + 1;
+            while (groupEnd < entries.size() && entries[groupEnd].m_fileHash == first.m_fileHash && *entries[groupEnd].m_file == *first.m_file)
+            {
+                ++groupEnd;
+            }
+
+            if (first.m_fileHash == headFileHash && *first.m_file == headFile)
+            {
+                size_t split = groupBegin;
+                while (split < groupEnd && entries[split].m_offset < headOffset)
+                {
+                    ++split;
+                }
+                assignGroup(groupBegin, split, false);
+                assignGroup(split, groupEnd, true);
+            }
+            else
+            {
+                assignGroup(groupBegin, groupEnd, false);
+            }
+            groupBegin = groupEnd;
+        }
+
+        AZStd::sort(entries.begin(), entries.end(),
+            [](const ScheduleEntry& lhs, const ScheduleEntry& rhs)
+            {
+                // Requests such as cancel need to be processed before any other requests.
+                if (lhs.m_orderPriority != rhs.m_orderPriority)
+                {
+                    return lhs.m_orderPriority > rhs.m_orderPriority;
+                }
+                if (lhs.m_tier != rhs.m_tier)
+                {
+                    return lhs.m_tier < rhs.m_tier;
+                }
+
+                switch (lhs.m_tier)
+                {
+                case ScheduleTier::Urgent:
+                    if (lhs.m_deadline != rhs.m_deadline)
+                    {
+                        return lhs.m_deadline < rhs.m_deadline;
+                    }
+                    if (lhs.m_priority != rhs.m_priority)
+                    {
+                        return lhs.m_priority > rhs.m_priority;
+                    }
+                    break;
+                case ScheduleTier::Elevator:
+                    if (lhs.m_isAheadOfHead != rhs.m_isAheadOfHead)
+                    {
+                        return lhs.m_isAheadOfHead;
+                    }
+                    if (lhs.m_groupDeadline != rhs.m_groupDeadline)
+                    {
+                        return lhs.m_groupDeadline < rhs.m_groupDeadline;
+                    }
+                    if (lhs.m_groupPendingId != rhs.m_groupPendingId)
+                    {
+                        return lhs.m_groupPendingId < rhs.m_groupPendingId;
+                    }
+                    if (lhs.m_offset != rhs.m_offset)
+                    {
+                        return lhs.m_offset < rhs.m_offset;
+                    }
+                    break;
+                default:
+                    break;
+                }
+                return lhs.m_pendingId < rhs.m_pendingId;
+            });
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            queue[i] = entries[i].m_request;
+        }
+    }
+
+    void Scheduler::Thread_RecordDeadlineStatus(const FileRequest* request, AZStd::chrono::steady_clock::time_point deadline)
+    {
+        if (deadline == FileRequest::s_noDeadlineTime)
+        {
+            return;
+        }
+
+        if (deadline < AZStd::chrono::steady_clock::now())
+        {
+            m_missedDeadlineCount++;
+        }
+        else if (request->GetEstimatedCompletion() > deadline)
+        {
+            m_panicCount++;
+        }
+    }
 } // namespace AZ::IO
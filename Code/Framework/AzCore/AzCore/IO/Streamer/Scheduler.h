@@ -25,6 +25,7 @@ namespace AZ::IO
 {
     class FileRequest;
     class Streamer_SchedulerTest_RequestSorting_Test;
+    class Streamer_SchedulerTest_DeadlineAwareSorting_Test;
 
     namespace Requests
     {
@@ -35,8 +36,21 @@ namespace AZ::IO
     class Scheduler final
     {
     public:
+        //! The strategy used to order requests that are waiting to be queued on the stream stack.
+        enum class SchedulingMode : u8
+        {
+            //! Requests that are at risk of missing their deadline go first, after which reads that continue in the file
+            //! that was last read from are preferred.
+            Default,
+            //! Requests that are at risk of missing their deadline go first in order of their deadline, but only if they can
+            //! still complete on time according to the completion estimates of the stream stack. Requests that can't meet
+            //! their deadline anymore no longer push out those that can. All other reads are ordered by their on-disk
+            //! offset, sweeping forward through the file or archive that was last read from before moving to the next file.
+            DeadlineAware
+        };
+
         explicit Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment = AZCORE_GLOBAL_NEW_ALIGNMENT,
-            u64 sizeAlignment = 1, u64 granularity = 1_mib);
+            u64 sizeAlignment = 1, u64 granularity = 1_mib, SchedulingMode schedulingMode = SchedulingMode::Default);
         ~Scheduler();
 
         void Start(const AZStd::thread_desc& threadDesc);
@@ -62,11 +76,17 @@ namespace AZ::IO
         //! referencing the same window of requests, but in practice these differences are too minute
         //! to detect.
         void CollectStatistics(AZStd::vector<Statistic>& statistics);
+        //! Closes the statistics for the current frame. The per frame counters cover the reads queued since the previous call.
+        //! This is called once per frame on the main thread, independently of how many consumers collect statistics.
+        void EndStatisticsFrame();
 
         void GetRecommendations(IStreamerTypes::Recommendations& recommendations) const;
 
+        SchedulingMode GetSchedulingMode() const;
+
     private:
         friend class Streamer_SchedulerTest_RequestSorting_Test;
+        friend class Streamer_SchedulerTest_DeadlineAwareSorting_Test;
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
 
         void Thread_MainLoop();
@@ -86,6 +106,40 @@ namespace AZ::IO
         //! Determine which of the two provided requests is more important to process next.
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
         void Thread_ScheduleRequests();
+        //! Orders the requests in the queue for SchedulingMode::DeadlineAware.
+        //! @param queue The requests to sort. All requests need to have up to date completion estimates.
+        //! @param drainTime The estimated time at which the requests that are already in the stream stack have completed.
+        void Thread_ScheduleRequestsDeadlineAware(StreamerContext::PreparedQueue& queue, AZStd::chrono::steady_clock::time_point drainTime);
+        void Thread_RecordDeadlineStatus(const FileRequest* request, AZStd::chrono::steady_clock::time_point deadline);
+
+        enum class ScheduleTier : u8
+        {
+            Urgent, //!< Reads in panic that can still complete before their deadline.
+            Command, //!< Requests that don't read, such as meta data and exists checks.
+            Elevator //!< Reads that have time to spare or that can't complete before their deadline anymore.
+        };
+
+        //! Information about a single request that's used by the deadline aware scheduling.
+        struct ScheduleEntry final
+        {
+            AZStd::chrono::steady_clock::time_point m_deadline{ AZStd::chrono::steady_clock::time_point::max() };
+            //! The earliest deadline of all requests in the same elevator group.
+            AZStd::chrono::steady_clock::time_point m_groupDeadline{ AZStd::chrono::steady_clock::time_point::max() };
+            //! Estimated time needed to process the request based on the stream stack's throughput and seek models.
+            AZStd::chrono::microseconds m_serviceTime{ 0 };
+            FileRequest* m_request{ nullptr };
+            const RequestPath* m_file{ nullptr };
+            u64 m_offset{ 0 };
+            size_t m_fileHash{ 0 };
+            size_t m_pendingId{ 0 };
+            //! The lowest pending id of all requests in the same elevator group.
+            size_t m_groupPendingId{ 0 };
+            IStreamerTypes::Priority m_orderPriority{ IStreamerTypes::s_priorityLowest };
+            IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityLowest };
+            ScheduleTier m_tier{ ScheduleTier::Command };
+            //! True if the request reads from the last file read from at or after the last read position.
+            bool m_isAheadOfHead{ false };
+        };
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
@@ -93,6 +147,10 @@ namespace AZ::IO
             //! Requests pending in the Streaming stack entries. Cached here so it doesn't need to allocate
             //! and free memory whenever scheduling happens.
             AZStd::vector<FileRequest*> m_internalPendingRequests;
+            //! Scratch data for the deadline aware scheduling. Cached here so it doesn't need to allocate and free memory
+            //! whenever scheduling happens.
+            AZStd::vector<ScheduleEntry> m_scheduleEntries;
+            AZStd::vector<size_t> m_admittedEntries;
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
@@ -103,6 +161,21 @@ namespace AZ::IO
         IStreamerTypes::Recommendations m_recommendations;
 
         StreamStackEntry::Status m_stackStatus;
+
+        //! Total number of reads that were queued on the stream stack after their deadline had already passed.
+        //! This is updated by the scheduling thread and never reset, so statistics can be collected by several consumers.
+        AZStd::atomic<u64> m_missedDeadlineCount{ 0 };
+        //! Total number of reads that were queued on the stream stack while estimated to complete after their deadline.
+        AZStd::atomic<u64> m_panicCount{ 0 };
+        //! Totals at the end of the previous frame, used to calculate the per frame counts in EndStatisticsFrame.
+        u64 m_missedDeadlineCountAtFrameStart{ 0 };
+        u64 m_panicCountAtFrameStart{ 0 };
+        AverageWindow<u64, double, s_statisticsWindowSize> m_missedDeadlinesPerFrameStat;
+        AverageWindow<u64, double, s_statisticsWindowSize> m_panicsPerFrameStat;
+        u64 m_missedDeadlinesLastFrame{ 0 };
+        u64 m_panicsLastFrame{ 0 };
+
+        SchedulingMode m_schedulingMode{ SchedulingMode::Default };
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZStd::chrono::steady_clock::time_point m_processingStartTime;
         size_t m_processingSize{ 0 };
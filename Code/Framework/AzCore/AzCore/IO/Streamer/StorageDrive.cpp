@@ -234,22 +234,36 @@ namespace AZ::IO
                     AZStd::chrono::microseconds fileOpenCloseTimeAverage = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(m_fileOpenCloseTimeAverage.CalculateAverage());
                     startTime += fileOpenCloseTimeAverage;
                 }
-                startTime += s_averageSeekTime;
+                startTime += GetSeekTime();
                 activeOffset = std::numeric_limits<u64>::max();
             }
             else if (activeOffset != offset)
             {
-                startTime += s_averageSeekTime;
+                startTime += GetSeekTime();
             }
 
-            u64 totalBytesRead = m_readSizeAverage.GetTotal();
-            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
-            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            startTime += EstimateTransferTime(readSize);
             activeOffset = offset + readSize;
         }
         request->SetEstimatedCompletion(startTime);
     }
 
+    Statistic::TimeValue StorageDrive::EstimateTransferTime(u64 size) const
+    {
+        // Prefer the reads that didn't need to seek as they only measure the throughput of the drive. Until those are available,
+        // fall back to all reads, which always contain an initial dummy value.
+        bool hasSequentialReads = m_sequentialReadSizeAverage.GetNumRecorded() > 0 && m_sequentialReadSizeAverage.GetTotal() > 0;
+        u64 totalBytesRead = hasSequentialReads ? m_sequentialReadSizeAverage.GetTotal() : m_readSizeAverage.GetTotal();
+        double totalReadTime = aznumeric_caster(
+            hasSequentialReads ? m_sequentialReadTimeAverage.GetTotal().count() : m_readTimeAverage.GetTotal().count());
+        return Statistic::TimeValue(aznumeric_cast<u64>((size * totalReadTime) / totalBytesRead));
+    }
+
+    Statistic::TimeValue StorageDrive::GetSeekTime() const
+    {
+        return m_seekTimeAverage.GetNumRecorded() > 0 ? m_seekTimeAverage.CalculateAverage() : s_averageSeekTime;
+    }
+
     void StorageDrive::ReadFile(FileRequest* request)
     {
         AZ_PROFILE_FUNCTION(AzCore);
@@ -301,14 +315,27 @@ namespace AZ::IO
 
         AZ_Assert(file, "While searching for file '%s' StorageDevice::ReadFile failed to detect a problem.", data->m_path.GetRelativePath());
         u64 bytesRead = 0;
+        bool needsSeek = file->Tell() != data->m_offset;
+        AZStd::chrono::steady_clock::time_point readStart = AZStd::chrono::steady_clock::now();
+        if (needsSeek)
         {
-            TIMED_AVERAGE_WINDOW_SCOPE(m_readTimeAverage);
-            if (file->Tell() != data->m_offset)
-            {
-                file->Seek(data->m_offset, SystemFile::SeekMode::SF_SEEK_BEGIN);
-            }
-            bytesRead = file->Read(data->m_size, data->m_output);
+            file->Seek(data->m_offset, SystemFile::SeekMode::SF_SEEK_BEGIN);
         }
+        bytesRead = file->Read(data->m_size, data->m_output);
+        auto readTime = AZStd::chrono::duration_cast<Statistic::TimeValue>(AZStd::chrono::steady_clock::now() - readStart);
+
+        if (needsSeek)
+        {
+            // Anything beyond the time needed to transfer the data is attributed to seeking.
+            Statistic::TimeValue transferTime = EstimateTransferTime(bytesRead);
+            m_seekTimeAverage.PushEntry(readTime > transferTime ? readTime - transferTime : Statistic::TimeValue::zero());
+        }
+        else
+        {
+            m_sequentialReadTimeAverage.PushEntry(readTime);
+            m_sequentialReadSizeAverage.PushEntry(bytesRead);
+        }
+        m_readTimeAverage.PushEntry(readTime);
         m_readSizeAverage.PushEntry(bytesRead);
 
         m_activeCacheSlot = cacheIndex;
@@ -440,6 +467,14 @@ namespace AZ::IO
                 "seen a lot of use, other applications are using the same drive and/or anti-virus scans are slowing down reads."));
         }
 
+        if (m_seekTimeAverage.GetNumRecorded() > 0)
+        {
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Seek time", m_seekTimeAverage.CalculateAverage(), m_seekTimeAverage.GetMinimum(), m_seekTimeAverage.GetMaximum(),
+                "The average additional time needed for reads that don't continue where the previous read stopped. This is used to "
+                "estimate when requests complete. A large value means that ordering reads by their position on disk is important."));
+        }
+
         if (m_fileOpenCloseTimeAverage.GetNumRecorded() > 0)
         {
             statistics.push_back(Statistic::CreateTimeRange(
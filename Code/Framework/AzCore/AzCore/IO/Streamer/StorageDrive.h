@@ -77,6 +77,10 @@ namespace AZ::IO
 
         void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
             const RequestPath*& activeFile, u64& activeOffset) const;
+        //! Estimates the time needed to transfer the given number of bytes, excluding the cost of seeking.
+        Statistic::TimeValue EstimateTransferTime(u64 size) const;
+        //! Returns the measured average cost of seeking or a common default if no seeks have been measured yet.
+        Statistic::TimeValue GetSeekTime() const;
 
         void Report(const Requests::ReportData& data) const;
 
@@ -85,6 +89,11 @@ namespace AZ::IO
         TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataTimeAverage;
         TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
         AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        //! Timing for reads that continued at the position of the previous read, used to determine the throughput of the drive.
+        TimedAverageWindow<s_statisticsWindowSize> m_sequentialReadTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_sequentialReadSizeAverage;
+        //! The time reads that needed to seek took longer than the throughput of the drive accounts for.
+        TimedAverageWindow<s_statisticsWindowSize> m_seekTimeAverage;
         //! File requests that are queued for processing.
         AZStd::deque<FileRequest*> m_pendingRequests;
 
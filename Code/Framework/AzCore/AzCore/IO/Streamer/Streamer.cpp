@@ -169,19 +169,63 @@ namespace AZ::IO
 
     void Streamer::QueueRequest(const FileRequestPtr& request)
     {
+        if (m_traceRecorder.IsRecording())
+        {
+            RecordTrace(request);
+        }
         m_streamStack->QueueRequest(request);
     }
 
     void Streamer::QueueRequestBatch(const AZStd::vector<FileRequestPtr>& requests)
     {
+        if (m_traceRecorder.IsRecording())
+        {
+            for (const FileRequestPtr& request : requests)
+            {
+                RecordTrace(request);
+            }
+        }
         m_streamStack->QueueRequestBatch(requests);
     }
 
     void Streamer::QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests)
     {
+        if (m_traceRecorder.IsRecording())
+        {
+            for (const FileRequestPtr& request : requests)
+            {
+                RecordTrace(request);
+            }
+        }
         m_streamStack->QueueRequestBatch(AZStd::move(requests));
     }
 
+    void Streamer::StartTraceCapture()
+    {
+        m_traceRecorder.Start();
+    }
+
+    void Streamer::StopTraceCapture(StreamerTrace& trace)
+    {
+        m_traceRecorder.Stop(trace);
+    }
+
+    bool Streamer::IsCapturingTrace() const
+    {
+        return m_traceRecorder.IsRecording();
+    }
+
+    void Streamer::RecordTrace(const FileRequestPtr& request)
+    {
+        // Only reads are captured. Other requests such as cache flushes depend on the state of the application that made the
+        // capture and can't be meaningfully replayed.
+        if (auto read = AZStd::get_if<Requests::ReadRequestData>(&request->m_request.GetCommand()); read != nullptr)
+        {
+            m_traceRecorder.Record(
+                read->m_path.GetRelativePath().Native(), read->m_offset, read->m_size, read->m_deadline, read->m_priority);
+        }
+    }
+
     bool Streamer::HasRequestCompleted(FileRequestHandle request) const
     {
         return GetRequestStatus(request) >= IStreamerTypes::RequestStatus::Completed;
@@ -252,6 +296,11 @@ namespace AZ::IO
         return m_streamStack->IsSuspended();
     }
 
+    void Streamer::EndStatisticsFrame()
+    {
+        m_streamStack->EndStatisticsFrame();
+    }
+
     void Streamer::RecordStatistics()
     {
         AZStd::vector<Statistic> statistics;
@@ -12,6 +12,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -200,11 +201,23 @@ namespace AZ::IO
 
         //! Records the statistics to a profiler.
         void RecordStatistics();
+        //! Closes the per frame statistics. Needs to be called once per frame.
+        void EndStatisticsFrame();
+
+        //! Starts capturing all read requests that are queued, including their timing, deadlines and sizes. Starting a new
+        //! capture discards the requests recorded by a previous capture that wasn't stopped.
+        void StartTraceCapture();
+        //! Stops the active capture and moves the captured read requests into the provided trace.
+        void StopTraceCapture(StreamerTrace& trace);
+        bool IsCapturingTrace() const;
 
         Streamer(const AZStd::thread_desc& threadDesc, AZStd::unique_ptr<Scheduler> streamStack);
         ~Streamer() override;
 
     private:
+        void RecordTrace(const FileRequestPtr& request);
+
+        StreamerTraceRecorder m_traceRecorder;
         StreamerContext m_streamerContext;
         AZStd::unique_ptr<Scheduler> m_streamStack;
         IStreamerTypes::Recommendations m_recommendations;
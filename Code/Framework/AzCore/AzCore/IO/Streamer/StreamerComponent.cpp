@@ -10,6 +10,8 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/FileIOAsync.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
@@ -18,6 +20,7 @@
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/IO/Streamer/StorageDrive.h>
 #include <AzCore/IO/Streamer/ReadSplitter.h>
 #include <AzCore/Interface/Interface.h>
@@ -37,6 +40,8 @@ namespace AZ
     AZ_CVAR(AZ::CVarFixedString, cl_streamerProfile, "", nullptr, ConsoleFunctorFlags::Null,
         "Overrides the profile provided by the hardware.");
 
+    static constexpr const char* DefaultStreamerTracePath = "@user@/StreamerTraces/Capture.azstrace";
+
     StreamerComponent::StreamerComponent()
     {
         // Use platform appropriate defaults for the threading information.
@@ -103,8 +108,11 @@ namespace AZ
         }
         if (stack)
         {
+            bool deadlineAwareScheduling = false;
+            settingsRegistry->Get(deadlineAwareScheduling, "/Amazon/AzCore/Streamer/DeadlineAwareScheduling");
             return AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(stack), hardwareInfo.m_maxPhysicalSectorSize,
-                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer);
+                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer,
+                deadlineAwareScheduling ? AZ::IO::Scheduler::SchedulingMode::DeadlineAware : AZ::IO::Scheduler::SchedulingMode::Default);
         }
         else
         {
@@ -113,10 +121,8 @@ namespace AZ
         }
     }
 
-    void StreamerComponent::Activate()
+    AZStd::thread_desc StreamerComponent::GetDeviceThreadDesc() const
     {
-        AZ_Assert(Interface<IO::IStreamer>::Get() == nullptr, "Streamer has already been activated.");
-
         AZStd::thread_desc threadDesc;
         if (m_deviceThreadCpuId != threadDesc.m_cpuId)
         {
@@ -126,6 +132,14 @@ namespace AZ
         {
             threadDesc.m_priority = m_deviceThreadPriority;
         }
+        return threadDesc;
+    }
+
+    void StreamerComponent::Activate()
+    {
+        AZ_Assert(Interface<IO::IStreamer>::Get() == nullptr, "Streamer has already been activated.");
+
+        AZStd::thread_desc threadDesc = GetDeviceThreadDesc();
 
         AZStd::string_view profile;
         AZ::CVarFixedString profileCVar = static_cast<AZ::CVarFixedString>(cl_streamerProfile);
@@ -157,6 +171,8 @@ namespace AZ
 
     void StreamerComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_streamer->EndStatisticsFrame();
+
         bool isEnabled = false;
         if (auto profilerSystem = AZ::Debug::ProfilerSystemInterface::Get(); profilerSystem)
         {
@@ -234,6 +250,30 @@ namespace AZ
         }
     }
 
+    void StreamerComponent::ReportFileIOBlocking(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        AZStd::vector<AZ::IO::FileIOBlockingStats::CallSite> callSites = AZ::IO::FileIOBlockingStats::GetCallSites();
+        if (callSites.empty())
+        {
+            AZ_Printf("Streamer", "No blocking file reads have been recorded.\n");
+        }
+        for (const AZ::IO::FileIOBlockingStats::CallSite& callSite : callSites)
+        {
+            double averageMs = callSite.m_numBlockingWaits > 0
+                ? (callSite.m_totalBlocked.count() / 1000.0) / aznumeric_cast<double>(callSite.m_numBlockingWaits)
+                : 0.0;
+            AZ_Printf(
+                "Streamer", "%s: %llu waits, %llu blocked, total %.2f ms, average %.2f ms, max %.2f ms.\n", callSite.m_name.c_str(),
+                callSite.m_numWaits, callSite.m_numBlockingWaits, callSite.m_totalBlocked.count() / 1000.0, averageMs,
+                callSite.m_maxBlocked.count() / 1000.0);
+        }
+
+        if (!someStrings.empty() && someStrings[0] == "reset")
+        {
+            AZ::IO::FileIOBlockingStats::Reset();
+        }
+    }
+
     void StreamerComponent::FlushCaches(const AZ::ConsoleCommandContainer&)
     {
         if (m_streamer)
@@ -241,4 +281,69 @@ namespace AZ
             m_streamer->QueueRequest(m_streamer->FlushCaches());
         }
     }
+
+    void StreamerComponent::StreamerStartTraceCapture(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_streamer)
+        {
+            m_streamer->StartTraceCapture();
+            AZ_Printf("Streamer", "Started capturing a trace of all read requests.\n");
+        }
+    }
+
+    void StreamerComponent::StreamerStopTraceCapture(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (!m_streamer || !m_streamer->IsCapturingTrace())
+        {
+            AZ_Warning("Streamer", false, "There's no active trace capture to stop.");
+            return;
+        }
+
+        AZ::IO::StreamerTrace trace;
+        m_streamer->StopTraceCapture(trace);
+
+        AZStd::string path = someStrings.empty() ? AZStd::string(DefaultStreamerTracePath) : AZStd::string(someStrings[0]);
+        AZ::IO::FileIOStream file(path.c_str(),
+            AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath);
+        if (file.IsOpen() && trace.Save(file))
+        {
+            AZ_Printf("Streamer", "Saved a trace with %zu read requests to '%s'.\n", trace.GetEntries().size(), path.c_str());
+        }
+        else
+        {
+            AZ_Error("Streamer", false, "Unable to save the Streamer trace to '%s'.", path.c_str());
+        }
+    }
+
+    void StreamerComponent::StreamerReplayTrace(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        AZStd::string path = someStrings.size() > 0 ? AZStd::string(someStrings[0]) : AZStd::string(DefaultStreamerTracePath);
+        AZStd::string_view profile = someStrings.size() > 1 ? someStrings[1] : AZStd::string_view{};
+        AZ::IO::StreamerTraceReplaySettings settings;
+        settings.m_preserveTiming = !(someStrings.size() > 2 && someStrings[2] == "fast");
+
+        AZ::IO::StreamerTrace trace;
+        {
+            AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+            if (!file.IsOpen() || !trace.Load(file))
+            {
+                AZ_Error("Streamer", false, "Unable to load the Streamer trace from '%s'.", path.c_str());
+                return;
+            }
+        }
+
+        // The replay runs on its own streamer so the stack can be configured differently from the one used by the
+        // application and the caches start out cold, as they did during the capture.
+        AZ::IO::Streamer replayStreamer(GetDeviceThreadDesc(), CreateStreamerStack(profile));
+        AZ::IO::StreamerTraceReplayResult result = AZ::IO::ReplayStreamerTrace(replayStreamer, trace, settings);
+
+        AZStd::string_view profileName = profile.empty() ? AZStd::string_view("<hardware default>") : profile;
+        AZ_Printf("Streamer", "Replayed %zu read requests from '%s' with profile '%.*s'%s.\n", result.m_numRequests, path.c_str(),
+            AZ_STRING_ARG(profileName), result.m_timedOut ? " (timed out)" : "");
+        AZ_Printf("Streamer", "  Total duration: %.3f ms\n", result.m_totalDuration.count() / 1000.0);
+        AZ_Printf("Streamer", "  Average latency: %.3f ms, max latency: %.3f ms\n",
+            result.m_averageLatency.count() / 1000.0, result.m_maxLatency.count() / 1000.0);
+        AZ_Printf("Streamer", "  Bytes read: %llu, failed requests: %zu, missed deadlines: %zu\n",
+            result.m_bytesRead, result.m_numFailed, result.m_numMissedDeadlines);
+    }
 } // namespace AZ
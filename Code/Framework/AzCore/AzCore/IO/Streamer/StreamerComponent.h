@@ -46,14 +46,30 @@ namespace AZ
         static void Reflect(ReflectContext* reflection);
 
         static AZStd::unique_ptr<AZ::IO::Scheduler> CreateSimpleStreamerStack();
+        AZStd::thread_desc GetDeviceThreadDesc() const;
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
+        void StreamerStartTraceCapture(const AZ::ConsoleCommandContainer& someStrings);
+        void StreamerStopTraceCapture(const AZ::ConsoleCommandContainer& someStrings);
+        void StreamerReplayTrace(const AZ::ConsoleCommandContainer& someStrings);
+        void ReportFileIOBlocking(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StreamerStartTraceCapture, AZ::ConsoleFunctorFlags::Null,
+            "Starts capturing all read requests queued on AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StreamerStopTraceCapture, AZ::ConsoleFunctorFlags::Null,
+            "Stops the active capture and saves the trace. Usage: StreamerStopTraceCapture [path]. "
+            "The default path is @user@/StreamerTraces/Capture.azstrace");
+        AZ_CONSOLEFUNC(StreamerComponent, StreamerReplayTrace, AZ::ConsoleFunctorFlags::Null,
+            "Replays a captured trace on a separate streamer and reports the timings. "
+            "Usage: StreamerReplayTrace [path] [profile] [fast]. The profile selects a stack from /Amazon/AzCore/Streamer/Profiles, "
+            "if omitted the profile for the hardware is used. With 'fast' the requests are queued without the delays from the capture.");
+        AZ_CONSOLEFUNC(StreamerComponent, ReportFileIOBlocking, AZ::ConsoleFunctorFlags::Null,
+            "Reports the time threads spent blocked on file reads per call site. Usage: ReportFileIOBlocking [reset]");
         
         AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
         int m_deviceThreadCpuId;
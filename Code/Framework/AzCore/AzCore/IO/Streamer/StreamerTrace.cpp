@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::IO
+{
+    namespace StreamerTraceInternal
+    {
+        static constexpr char Magic[4] = { 'A', 'Z', 'S', 'T' };
+
+        void WriteVarUInt(AZStd::vector<u8>& buffer, u64 value)
+        {
+            while (value >= 0x80)
+            {
+                buffer.push_back(static_cast<u8>(value | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<u8>(value));
+        }
+
+        bool ReadVarUInt(const AZStd::vector<u8>& buffer, size_t& position, u64& value)
+        {
+            value = 0;
+            for (u32 shift = 0; shift < 64; shift += 7)
+            {
+                if (position >= buffer.size())
+                {
+                    return false;
+                }
+                u8 byte = buffer[position++];
+                value |= static_cast<u64>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace StreamerTraceInternal
+
+    //
+    // StreamerTrace
+    //
+
+    u32 StreamerTrace::AddPath(AZStd::string_view path)
+    {
+        AZStd::string key(path);
+        auto it = m_pathLookup.find(key);
+        if (it != m_pathLookup.end())
+        {
+            return it->second;
+        }
+        u32 index = aznumeric_caster(m_paths.size());
+        m_paths.push_back(key);
+        m_pathLookup.emplace(AZStd::move(key), index);
+        return index;
+    }
+
+    void StreamerTrace::AddEntry(const Entry& entry)
+    {
+        AZ_Assert(entry.m_pathIndex < m_paths.size(), "Path index %u for trace entry is out of range.", entry.m_pathIndex);
+        m_entries.push_back(entry);
+    }
+
+    const AZStd::vector<AZStd::string>& StreamerTrace::GetPaths() const
+    {
+        return m_paths;
+    }
+
+    const AZStd::vector<StreamerTrace::Entry>& StreamerTrace::GetEntries() const
+    {
+        return m_entries;
+    }
+
+    bool StreamerTrace::IsEmpty() const
+    {
+        return m_entries.empty();
+    }
+
+    void StreamerTrace::Clear()
+    {
+        m_paths.clear();
+        m_pathLookup.clear();
+        m_entries.clear();
+    }
+
+    bool StreamerTrace::Save(GenericStream& stream) const
+    {
+        using namespace StreamerTraceInternal;
+
+        AZStd::vector<u8> buffer;
+        buffer.insert(buffer.end(), AZStd::begin(Magic), AZStd::end(Magic));
+        WriteVarUInt(buffer, Version);
+
+        WriteVarUInt(buffer, m_paths.size());
+        for (const AZStd::string& path : m_paths)
+        {
+            WriteVarUInt(buffer, path.size());
+            buffer.insert(buffer.end(), path.begin(), path.end());
+        }
+
+        // Requests can be recorded slightly out of order when they're queued from multiple threads, so sort them to store
+        // the timestamps as small, positive deltas.
+        AZStd::vector<Entry> entries = m_entries;
+        AZStd::stable_sort(entries.begin(), entries.end(),
+            [](const Entry& lhs, const Entry& rhs)
+            {
+                return lhs.m_timestamp < rhs.m_timestamp;
+            });
+
+        WriteVarUInt(buffer, entries.size());
+        AZStd::chrono::microseconds previousTimestamp{ 0 };
+        for (const Entry& entry : entries)
+        {
+            WriteVarUInt(buffer, aznumeric_cast<u64>((entry.m_timestamp - previousTimestamp).count()));
+            previousTimestamp = entry.m_timestamp;
+            // 0 is reserved for requests without a deadline.
+            WriteVarUInt(buffer, entry.m_deadline == IStreamerTypes::s_noDeadline
+                ? 0 : aznumeric_cast<u64>(AZStd::max(entry.m_deadline.count(), AZStd::chrono::microseconds::rep(0))) + 1);
+            WriteVarUInt(buffer, entry.m_offset);
+            WriteVarUInt(buffer, entry.m_size);
+            WriteVarUInt(buffer, entry.m_pathIndex);
+            buffer.push_back(entry.m_priority);
+        }
+
+        return stream.Write(buffer.size(), buffer.data()) == buffer.size();
+    }
+
+    bool StreamerTrace::Load(GenericStream& stream)
+    {
+        using namespace StreamerTraceInternal;
+
+        Clear();
+
+        SizeType size = stream.GetLength() - stream.GetCurPos();
+        AZStd::vector<u8> buffer;
+        buffer.resize_no_construct(aznumeric_caster(size));
+        if (stream.Read(size, buffer.data()) != size)
+        {
+            AZ_Error("StreamerTrace", false, "Unable to read the Streamer trace from '%s'.", stream.GetFilename());
+            return false;
+        }
+
+        if (buffer.size() < sizeof(Magic) || memcmp(buffer.data(), Magic, sizeof(Magic)) != 0)
+        {
+            AZ_Error("StreamerTrace", false, "'%s' is not a Streamer trace.", stream.GetFilename());
+            return false;
+        }
+
+        size_t position = sizeof(Magic);
+        u64 version = 0;
+        if (!ReadVarUInt(buffer, position, version) || version != Version)
+        {
+            AZ_Error("StreamerTrace", false, "Streamer trace '%s' has unsupported version %llu.", stream.GetFilename(), version);
+            return false;
+        }
+
+        auto fail = [this, &stream]()
+        {
+            AZ_Error("StreamerTrace", false, "Streamer trace '%s' is corrupted.", stream.GetFilename());
+            Clear();
+            return false;
+        };
+
+        u64 numPaths = 0;
+        if (!ReadVarUInt(buffer, position, numPaths))
+        {
+            return fail();
+        }
+        for (u64 i = 0; i < numPaths; ++i)
+        {
+            u64 length = 0;
+            if (!ReadVarUInt(buffer, position, length) || length > buffer.size() - position)
+            {
+                return fail();
+            }
+            AddPath(AZStd::string_view(reinterpret_cast<const char*>(buffer.data() + position), aznumeric_caster(length)));
+            position += aznumeric_cast<size_t>(length);
+        }
+
+        u64 numEntries = 0;
+        if (!ReadVarUInt(buffer, position, numEntries))
+        {
+            return fail();
+        }
+        m_entries.reserve(aznumeric_caster(AZStd::min<u64>(numEntries, buffer.size())));
+        AZStd::chrono::microseconds timestamp{ 0 };
+        for (u64 i = 0; i < numEntries; ++i)
+        {
+            u64 delta = 0;
+            u64 deadline = 0;
+            u64 pathIndex = 0;
+            Entry entry;
+            if (!ReadVarUInt(buffer, position, delta) || !ReadVarUInt(buffer, position, deadline) ||
+                !ReadVarUInt(buffer, position, entry.m_offset) || !ReadVarUInt(buffer, position, entry.m_size) ||
+                !ReadVarUInt(buffer, position, pathIndex) || pathIndex >= m_paths.size() || position >= buffer.size())
+            {
+                return fail();
+            }
+            timestamp += AZStd::chrono::microseconds(delta);
+            entry.m_timestamp = timestamp;
+            entry.m_deadline = deadline == 0 ? IStreamerTypes::s_noDeadline : IStreamerTypes::Deadline(deadline - 1);
+            entry.m_pathIndex = aznumeric_caster(pathIndex);
+            entry.m_priority = buffer[position++];
+            m_entries.push_back(entry);
+        }
+        return true;
+    }
+
+    //
+    // StreamerTraceRecorder
+    //
+
+    void StreamerTraceRecorder::Start()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_trace.Clear();
+        m_startTime = AZStd::chrono::steady_clock::now();
+        m_isRecording = true;
+    }
+
+    void StreamerTraceRecorder::Stop(StreamerTrace& trace)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_isRecording = false;
+        trace = AZStd::move(m_trace);
+        m_trace.Clear();
+    }
+
+    bool StreamerTraceRecorder::IsRecording() const
+    {
+        return m_isRecording;
+    }
+
+    void StreamerTraceRecorder::Record(AZStd::string_view path, u64 offset, u64 size,
+        AZStd::chrono::steady_clock::time_point deadline, IStreamerTypes::Priority priority)
+    {
+        auto now = AZStd::chrono::steady_clock::now();
+
+        AZStd::scoped_lock lock(m_mutex);
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        StreamerTrace::Entry entry;
+        entry.m_timestamp = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_startTime);
+        entry.m_deadline = deadline == FileRequest::s_noDeadlineTime
+            ? IStreamerTypes::s_noDeadline
+            : AZStd::chrono::duration_cast<IStreamerTypes::Deadline>(deadline - now);
+        entry.m_offset = offset;
+        entry.m_size = size;
+        entry.m_pathIndex = m_trace.AddPath(path);
+        entry.m_priority = priority;
+        m_trace.AddEntry(entry);
+    }
+
+    //
+    // Replay
+    //
+
+    StreamerTraceReplayResult ReplayStreamerTrace(IStreamer& streamer, const StreamerTrace& trace, const StreamerTraceReplaySettings& settings)
+    {
+        using namespace AZStd::chrono;
+
+        StreamerTraceReplayResult result;
+        const AZStd::vector<StreamerTrace::Entry>& entries = trace.GetEntries();
+        const AZStd::vector<AZStd::string>& paths = trace.GetPaths();
+        result.m_numRequests = entries.size();
+        if (entries.empty())
+        {
+            return result;
+        }
+
+        struct ReplayState
+        {
+            IStreamerTypes::DefaultRequestMemoryAllocator m_allocator;
+            AZStd::mutex m_mutex;
+            AZStd::binary_semaphore m_allCompleted;
+            microseconds m_totalLatency{ 0 };
+            AZStd::atomic_size_t m_numCompleted{ 0 };
+        } state;
+
+        AZStd::vector<FileRequestPtr> requests;
+        requests.reserve(entries.size());
+        const steady_clock::time_point startTime = steady_clock::now();
+        for (const StreamerTrace::Entry& entry : entries)
+        {
+            if (settings.m_preserveTiming)
+            {
+                steady_clock::time_point queueTime = startTime + entry.m_timestamp;
+                steady_clock::time_point now = steady_clock::now();
+                if (queueTime > now)
+                {
+                    AZStd::this_thread::sleep_for(duration_cast<microseconds>(queueTime - now));
+                }
+            }
+
+            const steady_clock::time_point requestStart = steady_clock::now();
+            FileRequestPtr request = streamer.Read(
+                paths[entry.m_pathIndex], state.m_allocator, entry.m_size, entry.m_deadline, entry.m_priority, entry.m_offset);
+            const IStreamerTypes::Deadline deadline = entry.m_deadline;
+            streamer.SetRequestCompleteCallback(request,
+                [&state, &result, &streamer, requestStart, deadline, numRequests = entries.size()](FileRequestHandle handle)
+                {
+                    microseconds latency = duration_cast<microseconds>(steady_clock::now() - requestStart);
+
+                    void* buffer = nullptr;
+                    u64 numBytesRead = 0;
+                    bool succeeded = streamer.GetRequestStatus(handle) == IStreamerTypes::RequestStatus::Completed &&
+                        streamer.GetReadRequestResult(handle, buffer, numBytesRead, IStreamerTypes::ClaimMemory::Yes);
+                    if (buffer)
+                    {
+                        state.m_allocator.Release(buffer);
+                    }
+
+                    {
+                        AZStd::scoped_lock lock(state.m_mutex);
+                        state.m_totalLatency += latency;
+                        result.m_maxLatency = AZStd::max(result.m_maxLatency, latency);
+                        result.m_bytesRead += numBytesRead;
+                        result.m_numFailed += succeeded ? 0 : 1;
+                        result.m_numMissedDeadlines += (deadline != IStreamerTypes::s_noDeadline && latency > deadline) ? 1 : 0;
+                    }
+
+                    if (++state.m_numCompleted == numRequests)
+                    {
+                        state.m_allCompleted.release();
+                    }
+                });
+            streamer.QueueRequest(request);
+            requests.push_back(AZStd::move(request));
+        }
+
+        if (!state.m_allCompleted.try_acquire_for(settings.m_timeout))
+        {
+            // The callbacks reference data on this stack, so cancel what's left and wait for those requests to finish.
+            result.m_timedOut = true;
+            for (FileRequestPtr& request : requests)
+            {
+                if (!streamer.HasRequestCompleted(request))
+                {
+                    streamer.QueueRequest(streamer.Cancel(request));
+                }
+            }
+            state.m_allCompleted.acquire();
+        }
+
+        result.m_totalDuration = duration_cast<microseconds>(steady_clock::now() - startTime);
+        result.m_averageLatency = state.m_totalLatency / static_cast<microseconds::rep>(entries.size());
+        return result;
+    }
+} // namespace AZ::IO
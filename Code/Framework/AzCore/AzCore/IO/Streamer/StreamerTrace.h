@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+    class IStreamer;
+
+    //! A captured sequence of read requests that were submitted to AZ::IO::Streamer. Traces can be saved to a compact binary
+    //! format and replayed against a different streaming stack to compare configurations with the exact same workload.
+    class StreamerTrace
+    {
+    public:
+        //! A single read request.
+        struct Entry
+        {
+            //! Time the request was queued, relative to the start of the capture.
+            AZStd::chrono::microseconds m_timestamp{ 0 };
+            //! Deadline relative to the time the request was queued or IStreamerTypes::s_noDeadline.
+            IStreamerTypes::Deadline m_deadline{ IStreamerTypes::s_noDeadline };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            //! Index in the path table of the trace.
+            u32 m_pathIndex{ 0 };
+            IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityMedium };
+        };
+
+        //! Adds a path to the path table if it's not already there and returns the index of the path.
+        u32 AddPath(AZStd::string_view path);
+        void AddEntry(const Entry& entry);
+
+        const AZStd::vector<AZStd::string>& GetPaths() const;
+        const AZStd::vector<Entry>& GetEntries() const;
+        bool IsEmpty() const;
+        void Clear();
+
+        //! Writes the trace to the stream. Entries are stored sorted by timestamp with variable length encoded fields, so a
+        //! typical read takes only a handful of bytes.
+        bool Save(GenericStream& stream) const;
+        //! Replaces the content of this trace with the trace stored in the stream.
+        bool Load(GenericStream& stream);
+
+        static constexpr u32 Version = 1;
+
+    private:
+        AZStd::vector<AZStd::string> m_paths;
+        AZStd::unordered_map<AZStd::string, u32> m_pathLookup;
+        AZStd::vector<Entry> m_entries;
+    };
+
+    //! Thread safe collector for the read requests submitted to Streamer while a capture is active.
+    class StreamerTraceRecorder
+    {
+    public:
+        void Start();
+        //! Stops the capture and moves the captured requests into the provided trace.
+        void Stop(StreamerTrace& trace);
+        bool IsRecording() const;
+
+        //! Records a read request that's queued now. The deadline is the absolute deadline of the request.
+        void Record(AZStd::string_view path, u64 offset, u64 size, AZStd::chrono::steady_clock::time_point deadline,
+            IStreamerTypes::Priority priority);
+
+    private:
+        StreamerTrace m_trace;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        AZStd::mutex m_mutex;
+        AZStd::atomic_bool m_isRecording{ false };
+    };
+
+    //! Options for replaying a trace.
+    struct StreamerTraceReplaySettings
+    {
+        //! If true requests are queued with the same spacing as in the trace, otherwise they're queued as fast as possible.
+        bool m_preserveTiming{ true };
+        //! Maximum amount of time to wait for all requests to complete.
+        AZStd::chrono::seconds m_timeout{ 300 };
+    };
+
+    //! Results from replaying a trace.
+    struct StreamerTraceReplayResult
+    {
+        AZStd::chrono::microseconds m_totalDuration{ 0 };
+        AZStd::chrono::microseconds m_averageLatency{ 0 };
+        AZStd::chrono::microseconds m_maxLatency{ 0 };
+        u64 m_bytesRead{ 0 };
+        size_t m_numRequests{ 0 };
+        size_t m_numFailed{ 0 };
+        size_t m_numMissedDeadlines{ 0 };
+        bool m_timedOut{ false };
+    };
+
+    //! Queues the requests in the trace on the provided streamer and waits for all of them to complete. The read data is
+    //! discarded.
+    StreamerTraceReplayResult ReplayStreamerTrace(
+        IStreamer& streamer, const StreamerTrace& trace, const StreamerTraceReplaySettings& settings = {});
+} // namespace AZ::IO
@@ -683,6 +683,8 @@ Data::AssetPtr ScriptSystemComponent::CreateAsset(const Data::AssetId& id, const
 // LoadAssetData
 //
 // Loads the script data from disk into SciptAsset memory. This does NOT load the asset into any lua_State.
+// The asset manager has already read the asset through Streamer when this is called, so the stream is in memory and
+// script loading doesn't need FileIOBase::ReadAsync.
 //=========================================================================
 
 Data::AssetHandler::LoadResult ScriptSystemComponent::LoadAssetData
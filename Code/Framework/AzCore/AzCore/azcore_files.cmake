@@ -23,9 +23,12 @@ set(FILES
     Asset/AssetManagerBus.h
     Asset/AssetManagerComponent.cpp
     Asset/AssetManagerComponent.h
+    Asset/AssetPrefetchManifest.cpp
+    Asset/AssetPrefetchManifest.h
     Asset/AssetSerializer.cpp
     Asset/AssetSerializer.h
     Asset/AssetTypeInfoBus.h
+    Asset/ShardedAssetMap.h
     Asset/AssetInternal/WeakAsset.h
     base.h
     Casting/lossy_cast.h
@@ -153,6 +156,8 @@ set(FILES
     IO/CompressionBus.cpp
     IO/Compressor.cpp
     IO/Compressor.h
+    IO/CompressorBlock.cpp
+    IO/CompressorBlock.h
     IO/CompressorStream.cpp
     IO/CompressorStream.h
     IO/CompressorZLib.cpp
@@ -161,6 +166,8 @@ set(FILES
     IO/CompressorZStd.h
     IO/FileIO.cpp
     IO/FileIO.h
+    IO/FileIOAsync.cpp
+    IO/FileIOAsync.h
     IO/FileReader.cpp
     IO/FileReader.h
     IO/IOUtils.h
@@ -212,6 +219,8 @@ set(FILES
     IO/Streamer/Streamer.h
     IO/Streamer/StreamerContext.h
     IO/Streamer/StreamerContext.cpp
+    IO/Streamer/StreamerTrace.cpp
+    IO/Streamer/StreamerTrace.h
     IO/Streamer/StreamerComponent.cpp
     IO/Streamer/StreamerComponent.h
     IO/Streamer/StreamStackEntry.h
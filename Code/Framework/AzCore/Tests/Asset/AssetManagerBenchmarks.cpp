@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class ContentionBenchmarkAsset
+        : public AZ::Data::AssetData
+    {
+    public:
+        AZ_RTTI(ContentionBenchmarkAsset, "{3C9A3C7B-4D5E-4C1F-9E0B-8A6B2F1D7E43}", AZ::Data::AssetData);
+        AZ_CLASS_ALLOCATOR(ContentionBenchmarkAsset, AZ::SystemAllocator);
+    };
+
+    class ContentionBenchmarkAssetHandler
+        : public AZ::Data::AssetHandler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ContentionBenchmarkAssetHandler, AZ::SystemAllocator);
+
+        AZ::Data::AssetPtr CreateAsset(const AZ::Data::AssetId&, const AZ::Data::AssetType&) override
+        {
+            return aznew ContentionBenchmarkAsset();
+        }
+
+        LoadResult LoadAssetData(const AZ::Data::Asset<AZ::Data::AssetData>&, AZStd::shared_ptr<AZ::Data::AssetDataStream>,
+            const AZ::Data::AssetFilterCB&) override
+        {
+            return LoadResult::LoadComplete;
+        }
+
+        void DestroyAsset(AZ::Data::AssetPtr ptr) override
+        {
+            delete ptr;
+        }
+
+        void GetHandledAssetTypes(AZStd::vector<AZ::Data::AssetType>& assetTypes) override
+        {
+            assetTypes.push_back(azrtti_typeid<ContentionBenchmarkAsset>());
+        }
+    };
+
+    //! Measures the contention in the AssetManager when many threads resolve assets from a large, shared dependency graph.
+    //! Every iteration takes a reference to a root asset and to all the assets it depends on, up to a fixed depth, the
+    //! same way a load would walk the dependencies. The roots differ per thread, but the graph is shared so threads
+    //! regularly visit the same assets.
+    class AssetManagerContentionBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NumAssets = 100'000;
+        static constexpr size_t NumDependencies = 4;
+        static constexpr size_t MaxDepth = 3;
+
+        void RunBenchmark(benchmark::State& state, bool keepGraphLoaded)
+        {
+            if (state.thread_index() == 0)
+            {
+                CreateGraph(keepGraphLoaded);
+            }
+
+            struct Visit
+            {
+                size_t m_index;
+                size_t m_depth;
+            };
+            AZStd::vector<Visit> pending;
+            AZStd::vector<AZ::Data::Asset<ContentionBenchmarkAsset>> references;
+            size_t root = (static_cast<size_t>(state.thread_index()) * NumAssets) / static_cast<size_t>(state.threads());
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                pending.push_back({ root, 0 });
+                while (!pending.empty())
+                {
+                    Visit visit = pending.back();
+                    pending.pop_back();
+
+                    AZ::Data::Asset<ContentionBenchmarkAsset> asset =
+                        AZ::Data::AssetManager::Instance().FindOrCreateAsset<ContentionBenchmarkAsset>(
+                            m_assetIds[visit.m_index], AZ::Data::AssetLoadBehavior::Default);
+                    // Hold on to a copy like a dependent asset would.
+                    references.push_back(asset);
+
+                    if (visit.m_depth < MaxDepth)
+                    {
+                        for (size_t i = 0; i < NumDependencies; ++i)
+                        {
+                            pending.push_back({ m_dependencies[visit.m_index * NumDependencies + i], visit.m_depth + 1 });
+                        }
+                    }
+                }
+                benchmark::DoNotOptimize(references.data());
+                references.clear();
+                root = (root + 1) % NumAssets;
+            }
+
+            if (state.thread_index() == 0)
+            {
+                DestroyGraph();
+            }
+        }
+
+    private:
+        void CreateGraph(bool keepGraphLoaded)
+        {
+            AZ::Data::AssetManager::Descriptor desc;
+            AZ::Data::AssetManager::Create(desc);
+            // There's no catalog, so skip the lookups to upgrade asset ids.
+            AZ::Data::AssetManager::Instance().SetAssetInfoUpgradingEnabled(false);
+            // The handler is deleted by the AssetManager when it's destroyed.
+            AZ::Data::AssetManager::Instance().RegisterHandler(
+                aznew ContentionBenchmarkAssetHandler(), azrtti_typeid<ContentionBenchmarkAsset>());
+
+            m_assetIds.reserve(NumAssets);
+            for (size_t i = 0; i < NumAssets; ++i)
+            {
+                m_assetIds.emplace_back(AZ::Uuid::CreateRandom());
+            }
+
+            // Use a fixed seed so every run creates the same graph.
+            AZ::u64 seed = 0x2545F4914F6CDD1Dull;
+            m_dependencies.resize(NumAssets * NumDependencies);
+            for (size_t& dependency : m_dependencies)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                dependency = static_cast<size_t>(seed % NumAssets);
+            }
+
+            if (keepGraphLoaded)
+            {
+                m_loadedAssets.reserve(NumAssets);
+                for (const AZ::Data::AssetId& assetId : m_assetIds)
+                {
+                    m_loadedAssets.push_back(AZ::Data::AssetManager::Instance().FindOrCreateAsset<ContentionBenchmarkAsset>(
+                        assetId, AZ::Data::AssetLoadBehavior::Default));
+                }
+            }
+        }
+
+        void DestroyGraph()
+        {
+            m_loadedAssets = {};
+            m_dependencies = {};
+            m_assetIds = {};
+            AZ::Data::AssetManager::Destroy();
+        }
+
+        AZStd::vector<AZ::Data::AssetId> m_assetIds;
+        AZStd::vector<size_t> m_dependencies;
+        AZStd::vector<AZ::Data::Asset<ContentionBenchmarkAsset>> m_loadedAssets;
+    };
+
+    // All assets in the graph are kept alive, so every visit is a lookup and a handle copy.
+    BENCHMARK_DEFINE_F(AssetManagerContentionBenchmark, FindOrCreateAsset_LoadedGraph)(benchmark::State& state)
+    {
+        RunBenchmark(state, true);
+    }
+
+    // Assets are only kept alive by the walks, so assets are continuously created and released while other threads look
+    // them up.
+    BENCHMARK_DEFINE_F(AssetManagerContentionBenchmark, FindOrCreateAsset_UnloadedGraph)(benchmark::State& state)
+    {
+        RunBenchmark(state, false);
+    }
+
+    BENCHMARK_REGISTER_F(AssetManagerContentionBenchmark, FindOrCreateAsset_LoadedGraph)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+    BENCHMARK_REGISTER_F(AssetManagerContentionBenchmark, FindOrCreateAsset_UnloadedGraph)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
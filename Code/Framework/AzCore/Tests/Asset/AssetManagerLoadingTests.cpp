@@ -2692,6 +2692,156 @@ namespace UnitTest
         }
     }
 
+    TEST_F(AssetManagerTests, LoadRecording_LoadAssets_RecordsFirstLoadOfEachAssetInOrder)
+    {
+        m_assetHandlerAndCatalog->SetArtificialDelayMilliseconds(0, 0);
+
+        AssetManager::Instance().StartLoadRecording();
+        EXPECT_TRUE(AssetManager::Instance().IsRecordingLoads());
+        {
+            auto asset2 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset2Id, AZ::Data::AssetLoadBehavior::Default);
+            asset2.BlockUntilLoadComplete();
+            auto asset1 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default);
+            asset1.BlockUntilLoadComplete();
+        }
+        {
+            // Loading the asset a second time shouldn't add another entry.
+            auto asset2 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset2Id, AZ::Data::AssetLoadBehavior::Default);
+            asset2.BlockUntilLoadComplete();
+        }
+        AssetPrefetchManifest manifest = AssetManager::Instance().StopLoadRecording();
+        EXPECT_FALSE(AssetManager::Instance().IsRecordingLoads());
+
+        ASSERT_EQ(2, manifest.m_entries.size());
+        EXPECT_EQ(AssetId(MyAsset2Id), manifest.m_entries[0].m_assetId);
+        EXPECT_EQ(AssetId(MyAsset1Id), manifest.m_entries[1].m_assetId);
+        EXPECT_EQ(azrtti_typeid<AssetWithCustomData>(), manifest.m_entries[0].m_assetType);
+        EXPECT_LE(manifest.m_entries[0].m_loadTimeUs, manifest.m_entries[1].m_loadTimeUs);
+
+        // Loads after the recording has stopped aren't recorded.
+        {
+            auto asset3 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset3Id, AZ::Data::AssetLoadBehavior::Default);
+            asset3.BlockUntilLoadComplete();
+        }
+        EXPECT_TRUE(AssetManager::Instance().StopLoadRecording().m_entries.empty());
+    }
+
+    TEST_F(AssetManagerTests, SoftRelease_BudgetExceeded_LeastRecentlyReleasedAssetIsEvicted)
+    {
+        m_assetHandlerAndCatalog->SetArtificialDelayMilliseconds(0, 0);
+        const AssetType assetType = azrtti_typeid<AssetWithCustomData>();
+
+        // The test catalog doesn't provide sizes, so every asset counts as 1 KiB, which leaves room for two assets.
+        AssetManager::Instance().SetSoftReleaseBudget(assetType, 2048);
+        EXPECT_EQ(2048, AssetManager::Instance().GetSoftReleaseBudget(assetType));
+
+        auto LoadAndRelease = [](const AZ::Uuid& assetId)
+        {
+            auto asset = AssetManager::Instance().GetAsset<AssetWithCustomData>(assetId, AZ::Data::AssetLoadBehavior::Default);
+            asset.BlockUntilLoadComplete();
+            EXPECT_TRUE(asset.IsReady());
+        };
+        // The last reference to an asset may be released by a load job, so wait until the pool has picked it up.
+        auto WaitForResidentAssets = [assetType](u64 expected)
+        {
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+            while (AssetManager::Instance().GetSoftReleaseStatistics(assetType).m_residentAssets != expected &&
+                AZStd::chrono::steady_clock::now() < maxTimeout)
+            {
+                AssetManager::Instance().DispatchEvents();
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(expected, AssetManager::Instance().GetSoftReleaseStatistics(assetType).m_residentAssets);
+        };
+
+        LoadAndRelease(MyAsset1Id);
+        WaitForResidentAssets(1);
+        EXPECT_EQ(0, m_assetHandlerAndCatalog->m_numDestructions);
+
+        // Requesting the released asset again uses the resident copy instead of loading it.
+        const int numLoads = m_assetHandlerAndCatalog->m_numLoads;
+        LoadAndRelease(MyAsset1Id);
+        EXPECT_EQ(numLoads, m_assetHandlerAndCatalog->m_numLoads);
+        WaitForResidentAssets(1);
+
+        LoadAndRelease(MyAsset2Id);
+        WaitForResidentAssets(2);
+        LoadAndRelease(MyAsset3Id);
+        WaitForResidentAssets(2);
+
+        SoftReleaseStatistics statistics = AssetManager::Instance().GetSoftReleaseStatistics(assetType);
+        EXPECT_EQ(1, statistics.m_hits);
+        EXPECT_EQ(3, statistics.m_misses);
+        EXPECT_EQ(1, statistics.m_evictions);
+        EXPECT_EQ(1024, statistics.m_evictedBytes);
+        EXPECT_EQ(2048, statistics.m_residentBytes);
+        EXPECT_EQ(1, m_assetHandlerAndCatalog->m_numDestructions);
+        EXPECT_FALSE(AssetManager::Instance().FindAsset(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default));
+        EXPECT_TRUE(AssetManager::Instance().FindAsset(MyAsset2Id, AZ::Data::AssetLoadBehavior::Default));
+
+        // Removing the budget destroys all resident assets.
+        AssetManager::Instance().SetSoftReleaseBudget(assetType, 0);
+        EXPECT_EQ(0, AssetManager::Instance().GetSoftReleaseStatistics(assetType).m_residentAssets);
+        EXPECT_EQ(3, m_assetHandlerAndCatalog->m_numDestructions);
+    }
+
+    TEST_F(AssetManagerTests, SoftRelease_ReleasedWhileSuspended_IsKeptResidentOnResume)
+    {
+        m_assetHandlerAndCatalog->SetArtificialDelayMilliseconds(0, 0);
+        const AssetType assetType = azrtti_typeid<AssetWithCustomData>();
+        AssetManager::Instance().SetSoftReleaseBudget(assetType, 2048);
+
+        {
+            auto asset = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default);
+            asset.BlockUntilLoadComplete();
+            EXPECT_TRUE(asset.IsReady());
+
+            // Wait for the load job to drop its reference, so the last one is released below while releases are suspended.
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+            while (asset->GetUseCount() > 1 && AZStd::chrono::steady_clock::now() < maxTimeout)
+            {
+                AssetManager::Instance().DispatchEvents();
+                AZStd::this_thread::yield();
+            }
+            ASSERT_EQ(1, asset->GetUseCount());
+
+            AssetManager::Instance().SuspendAssetRelease();
+        }
+        EXPECT_EQ(0, AssetManager::Instance().GetSoftReleaseStatistics(assetType).m_residentAssets);
+        AssetManager::Instance().ResumeAssetRelease();
+
+        EXPECT_EQ(1, AssetManager::Instance().GetSoftReleaseStatistics(assetType).m_residentAssets);
+        EXPECT_EQ(0, m_assetHandlerAndCatalog->m_numDestructions);
+        EXPECT_TRUE(AssetManager::Instance().FindAsset(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default));
+
+        AssetManager::Instance().SetSoftReleaseBudget(assetType, 0);
+        EXPECT_EQ(1, m_assetHandlerAndCatalog->m_numDestructions);
+    }
+
+    TEST_F(AssetManagerTests, PrefetchAssets_ManifestWithUnknownAsset_LoadsKnownAssets)
+    {
+        m_assetHandlerAndCatalog->SetArtificialDelayMilliseconds(0, 0);
+
+        AssetPrefetchManifest manifest;
+        manifest.m_entries.push_back({ AssetId(MyAsset1Id), azrtti_typeid<AssetWithCustomData>(), 0 });
+        manifest.m_entries.push_back({ AssetId(AZ::Uuid::CreateRandom()), azrtti_typeid<AssetWithCustomData>(), 10 });
+        manifest.m_entries.push_back({ AssetId(MyAsset3Id), azrtti_typeid<AssetWithCustomData>(), 20 });
+
+        AZStd::vector<Asset<AssetData>> prefetched = AssetManager::Instance().PrefetchAssets(manifest);
+        ASSERT_EQ(2, prefetched.size());
+        EXPECT_EQ(AssetId(MyAsset1Id), prefetched[0].GetId());
+        EXPECT_EQ(AssetId(MyAsset3Id), prefetched[1].GetId());
+
+        // Requesting a prefetched asset attaches to the load that's already in flight.
+        auto asset3 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset3Id, AZ::Data::AssetLoadBehavior::Default);
+        EXPECT_EQ(prefetched[1].Get(), asset3.Get());
+        asset3.BlockUntilLoadComplete();
+        EXPECT_TRUE(asset3.IsReady());
+
+        prefetched[0].BlockUntilLoadComplete();
+        EXPECT_TRUE(prefetched[0].IsReady());
+    }
+
     TEST_F(AssetManagerTests, FindOrCreateAsset)
     {
         m_assetHandlerAndCatalog->SetArtificialDelayMilliseconds(0, 0);
@@ -3671,4 +3821,88 @@ namespace UnitTest
             EXPECT_EQ(assetStatus.m_error, 1);
         }
     }
+
+    class AssetContainerSchedulingTest
+        : public LeakDetectionFixture
+    {
+    public:
+        //! Exposes the scheduling of the dependent assets without loading anything.
+        struct SchedulingAssetContainer
+            : public AssetContainer
+        {
+            using AssetContainer::m_dependencyDeadlines;
+
+            void Schedule(AZStd::vector<AssetInfo>& dependencies, PreloadAssetListType preloads, const AssetId& rootId,
+                const AssetLoadParameters& loadParams)
+            {
+                AZStd::vector<AssetId> waitingList{ rootId };
+                for (const AssetInfo& info : dependencies)
+                {
+                    waitingList.push_back(info.m_assetId);
+                }
+                AddWaitingAssets(waitingList);
+                SetupPreloadLists(AZStd::move(preloads), rootId);
+                ScheduleDependentAssets(dependencies, rootId, loadParams);
+                ClearWaitingAssets();
+            }
+        };
+
+        static AssetInfo MakeInfo(const AssetId& assetId)
+        {
+            AssetInfo info;
+            info.m_assetId = assetId;
+            return info;
+        }
+
+        const AssetId RootId{ AZ::Uuid("{7C0F5D8E-3B1A-4E2F-9D6C-5A4B3C2D1E0F}") };
+        const AssetId AId{ AZ::Uuid("{1A2B3C4D-5E6F-4A1B-8C2D-3E4F5A6B7C8D}") };
+        const AssetId BId{ AZ::Uuid("{2B3C4D5E-6F7A-4B2C-9D3E-4F5A6B7C8D9E}") };
+        const AssetId CId{ AZ::Uuid("{3C4D5E6F-7A8B-4C3D-8E4F-5A6B7C8D9E0F}") };
+        const AssetId DId{ AZ::Uuid("{4D5E6F7A-8B9C-4D4E-9F5A-6B7C8D9E0F1A}") };
+    };
+
+    TEST_F(AssetContainerSchedulingTest, ScheduleDependentAssets_PreloadChain_DeepestPreloadsAreQueuedFirstWithEarliestDeadlines)
+    {
+        // Root preloads A, which preloads B, which preloads C. D is a regular dependency of the root.
+        PreloadAssetListType preloads;
+        preloads[RootId].insert(AId);
+        preloads[AId].insert(BId);
+        preloads[BId].insert(CId);
+
+        // The catalog returns dependencies breadth first.
+        AZStd::vector<AssetInfo> dependencies{ MakeInfo(AId), MakeInfo(DId), MakeInfo(BId), MakeInfo(CId) };
+        AssetLoadParameters loadParams;
+        loadParams.m_deadline = AZStd::chrono::milliseconds(400);
+
+        SchedulingAssetContainer container;
+        container.Schedule(dependencies, AZStd::move(preloads), RootId, loadParams);
+
+        ASSERT_EQ(4, dependencies.size());
+        EXPECT_EQ(CId, dependencies[0].m_assetId);
+        EXPECT_EQ(BId, dependencies[1].m_assetId);
+        EXPECT_EQ(AId, dependencies[2].m_assetId);
+        EXPECT_EQ(DId, dependencies[3].m_assetId);
+
+        // The root is three preloads deep, so the deadline is split in four levels. D isn't preloaded by anything, so it
+        // doesn't compete with the preload chain and gets the full deadline.
+        EXPECT_EQ(AZStd::chrono::milliseconds(100), container.m_dependencyDeadlines[CId]);
+        EXPECT_EQ(AZStd::chrono::milliseconds(200), container.m_dependencyDeadlines[BId]);
+        EXPECT_EQ(AZStd::chrono::milliseconds(300), container.m_dependencyDeadlines[AId]);
+        EXPECT_EQ(AZStd::chrono::milliseconds(400), container.m_dependencyDeadlines[DId]);
+    }
+
+    TEST_F(AssetContainerSchedulingTest, ScheduleDependentAssets_NoDeadline_OnlyOrderChanges)
+    {
+        PreloadAssetListType preloads;
+        preloads[AId].insert(BId);
+
+        AZStd::vector<AssetInfo> dependencies{ MakeInfo(AId), MakeInfo(BId) };
+        SchedulingAssetContainer container;
+        container.Schedule(dependencies, AZStd::move(preloads), RootId, AssetLoadParameters{});
+
+        ASSERT_EQ(2, dependencies.size());
+        EXPECT_EQ(BId, dependencies[0].m_assetId);
+        EXPECT_EQ(AId, dependencies[1].m_assetId);
+        EXPECT_TRUE(container.m_dependencyDeadlines.empty());
+    }
 }
@@ -808,19 +808,19 @@ namespace UnitTest
 
         auto&& assets = m_testAssetManager->GetAssets();
 
-        EXPECT_EQ(assets.size(), 1);
-        EXPECT_NE(assets.find(MyAsset1Id), assets.end());
+        EXPECT_EQ(assets.Size(), 1);
+        EXPECT_TRUE(assets.Contains(MyAsset1Id));
 
         AssetManager::Instance().ResumeAssetRelease();
         
         // Sleep to allow for the assets to release
         int retryCount = 100;
-        while ((--retryCount>0) && assets.size() > 0)
+        while ((--retryCount>0) && assets.Size() > 0)
         {
             AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
         }
 
-        EXPECT_EQ(assets.size(), 0);
+        EXPECT_EQ(assets.Size(), 0);
     }
 
     TEST_F(AssetManagerTest, AssetManager_SuspendResumeAssetRelease_ReusedAssetIsNotReleased)
@@ -840,7 +840,65 @@ namespace UnitTest
 
         AssetManager::Instance().ResumeAssetRelease();
 
-        EXPECT_EQ(assets.size(), 1);
-        EXPECT_NE(assets.find(MyAsset1Id), assets.end());
+        EXPECT_EQ(assets.Size(), 1);
+        EXPECT_TRUE(assets.Contains(MyAsset1Id));
+    }
+
+    TEST_F(AssetManagerTest, AssetManager_FindOrCreateAssetFromMultipleThreads_EveryAssetIsCreatedOnce)
+    {
+        constexpr size_t NumThreads = 8;
+        constexpr size_t NumAssets = 512;
+
+        AZStd::vector<AssetId> assetIds;
+        assetIds.reserve(NumAssets);
+        for (size_t i = 0; i < NumAssets; ++i)
+        {
+            assetIds.emplace_back(Uuid::CreateRandom());
+        }
+
+        const int startCreations = m_assetHandlerAndCatalog->m_numCreations;
+        const int startDestructions = m_assetHandlerAndCatalog->m_numDestructions;
+
+        // Every thread visits the assets in a different order and also copies the handles it gets, so lookups, creations
+        // and reference count changes for the same asset happen at the same time on different threads.
+        AZStd::vector<AZStd::vector<Asset<AssetWithCustomData>>> threadAssets(NumThreads);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads.emplace_back([threadIndex, &assetIds, &threadAssets]()
+            {
+                AZStd::vector<Asset<AssetWithCustomData>>& assets = threadAssets[threadIndex];
+                assets.resize(NumAssets);
+                for (size_t i = 0; i < NumAssets; ++i)
+                {
+                    const size_t assetIndex = (i * (2 * threadIndex + 1) + threadIndex) % NumAssets;
+                    Asset<AssetWithCustomData> asset = AssetManager::Instance().FindOrCreateAsset<AssetWithCustomData>(
+                        assetIds[assetIndex], AssetLoadBehavior::Default);
+                    assets[assetIndex] = asset;
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(NumAssets, m_assetHandlerAndCatalog->m_numCreations - startCreations);
+        EXPECT_EQ(NumAssets, m_testAssetManager->GetAssets().Size());
+        for (size_t i = 0; i < NumAssets; ++i)
+        {
+            ASSERT_TRUE(threadAssets[0][i]);
+            EXPECT_EQ(assetIds[i], threadAssets[0][i].GetId());
+            for (size_t threadIndex = 1; threadIndex < NumThreads; ++threadIndex)
+            {
+                EXPECT_EQ(threadAssets[0][i].Get(), threadAssets[threadIndex][i].Get());
+            }
+            EXPECT_EQ(NumThreads, threadAssets[0][i]->GetUseCount());
+        }
+
+        threadAssets.clear();
+
+        EXPECT_EQ(NumAssets, m_assetHandlerAndCatalog->m_numDestructions - startDestructions);
+        EXPECT_EQ(0, m_testAssetManager->GetAssets().Size());
     }
 }
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/CompressorBlock.h>
+#include <AzCore/IO/CompressorStream.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    //! Provides a task executor and reports the task graph as active, so code that checks for it uses the task graph.
+    class ActiveTaskGraph
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        ActiveTaskGraph()
+        {
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        ~ActiveTaskGraph()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+    private:
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    class CompressorBlockFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr AZ::u32 BlockSize = 1024;
+        static constexpr size_t UncompressedSize = 10 * BlockSize + 300;
+
+        void SetUp() override
+        {
+            // The first half compresses well, the second half is noise that has to be stored uncompressed.
+            m_uncompressed.resize(UncompressedSize);
+            AZ::u32 seed = 0x9E3779B9;
+            for (size_t i = 0; i < UncompressedSize; ++i)
+            {
+                if (i < UncompressedSize / 2)
+                {
+                    m_uncompressed[i] = static_cast<AZ::u8>((i / 16) % 7);
+                }
+                else
+                {
+                    seed ^= seed << 13;
+                    seed ^= seed >> 17;
+                    seed ^= seed << 5;
+                    m_uncompressed[i] = static_cast<AZ::u8>(seed);
+                }
+            }
+
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> output(&m_compressed);
+            AZ::IO::CompressorStream compressorStream(&output, false);
+            ASSERT_TRUE(compressorStream.WriteCompressedHeader(AZ::IO::CompressorBlock::TypeId(), 9, BlockSize));
+            // Write in chunks that don't line up with the blocks.
+            constexpr size_t ChunkSize = 700;
+            for (size_t offset = 0; offset < UncompressedSize; offset += ChunkSize)
+            {
+                size_t size = AZStd::min(ChunkSize, UncompressedSize - offset);
+                ASSERT_EQ(size, compressorStream.Write(size, m_uncompressed.data() + offset));
+            }
+            compressorStream.Close();
+        }
+
+        void TearDown() override
+        {
+            m_uncompressed = {};
+            m_compressed = {};
+        }
+
+        AZStd::vector<AZ::u8> m_uncompressed;
+        AZStd::vector<AZ::u8> m_compressed;
+    };
+
+    TEST_F(CompressorBlockFixture, Read_EntireStream_MatchesWrittenData)
+    {
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> input(&m_compressed);
+        AZ::IO::CompressorStream compressorStream(&input, false);
+        ASSERT_TRUE(compressorStream.IsCompressed());
+        EXPECT_EQ(UncompressedSize, compressorStream.GetUncompressedLength());
+        EXPECT_LT(compressorStream.GetCompressedLength(), UncompressedSize);
+
+        AZStd::vector<AZ::u8> result(UncompressedSize);
+        EXPECT_EQ(UncompressedSize, compressorStream.Read(UncompressedSize, result.data()));
+        EXPECT_EQ(m_uncompressed, result);
+        EXPECT_EQ(UncompressedSize, compressorStream.GetCurPos());
+
+        // Reading past the end doesn't return any data.
+        EXPECT_EQ(0, compressorStream.Read(1, result.data()));
+    }
+
+    TEST_F(CompressorBlockFixture, Read_AfterSeek_ReadsFromUncompressedOffset)
+    {
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> input(&m_compressed);
+        AZ::IO::CompressorStream compressorStream(&input, false);
+        ASSERT_TRUE(compressorStream.IsCompressed());
+
+        // Read across a block boundary, going backwards through the stream.
+        for (size_t offset : { size_t{ 9 * BlockSize + 1000 }, size_t{ 4 * BlockSize + 10 }, size_t{ BlockSize - 20 } })
+        {
+            AZStd::vector<AZ::u8> result(100);
+            compressorStream.Seek(static_cast<AZ::IO::OffsetType>(offset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+            EXPECT_EQ(result.size(), compressorStream.Read(result.size(), result.data()));
+            EXPECT_TRUE(AZStd::equal(result.begin(), result.end(), m_uncompressed.begin() + offset));
+            // Continue with the next bytes to read from the cached block.
+            EXPECT_EQ(result.size(), compressorStream.Read(result.size(), result.data()));
+            EXPECT_TRUE(AZStd::equal(result.begin(), result.end(), m_uncompressed.begin() + offset + result.size()));
+        }
+
+        AZStd::vector<AZ::u8> tail(50);
+        compressorStream.Seek(-static_cast<AZ::IO::OffsetType>(tail.size()), AZ::IO::GenericStream::ST_SEEK_END);
+        EXPECT_EQ(tail.size(), compressorStream.Read(tail.size(), tail.data()));
+        EXPECT_TRUE(AZStd::equal(tail.begin(), tail.end(), m_uncompressed.end() - tail.size()));
+    }
+
+    TEST_F(CompressorBlockFixture, Write_WithTaskGraphActive_MatchesSerialCompression)
+    {
+        // With the task graph active, batches of more than one block are compressed in parallel.
+        AZStd::vector<AZ::u8> compressed;
+        {
+            ActiveTaskGraph taskGraph;
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> output(&compressed);
+            AZ::IO::CompressorStream compressorStream(&output, false);
+            ASSERT_TRUE(compressorStream.WriteCompressedHeader(AZ::IO::CompressorBlock::TypeId(), 9, BlockSize));
+            // A single write queues all blocks, so the flush always has several blocks to compress.
+            EXPECT_EQ(UncompressedSize, compressorStream.Write(UncompressedSize, m_uncompressed.data()));
+            compressorStream.Close();
+        }
+
+        // Blocks are compressed independently, so the result is the same as the serial compression done in SetUp.
+        EXPECT_EQ(m_compressed, compressed);
+
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> input(&compressed);
+        AZ::IO::CompressorStream compressorStream(&input, false);
+        ASSERT_TRUE(compressorStream.IsCompressed());
+        AZStd::vector<AZ::u8> result(UncompressedSize);
+        EXPECT_EQ(UncompressedSize, compressorStream.Read(UncompressedSize, result.data()));
+        EXPECT_EQ(m_uncompressed, result);
+    }
+
+    TEST_F(CompressorBlockFixture, ReadHeader_CorruptedIndex_StreamIsNotUsable)
+    {
+        // The last index entry has to point to the start of the index.
+        m_compressed.back() ^= 0xFF;
+
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> input(&m_compressed);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::IO::CompressorStream compressorStream(&input, false);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_EQ(nullptr, compressorStream.GetCompressorData());
+    }
+} // namespace UnitTest
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIOAsync.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+#include <Tests/FileIOBaseTestTypes.h>
+
+namespace UnitTest
+{
+    //! Completes reads immediately by filling the output with the lower bits of the file offset and counts the reads.
+    class PatternReadStackEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        PatternReadStackEntry()
+            : AZ::IO::StreamStackEntry("Pattern reads")
+        {
+        }
+
+        void PrepareRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::ReadRequestData>(&request->GetCommand()); data != nullptr)
+            {
+                AZ::IO::FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, data->m_output, data->m_outputSize, data->m_path, data->m_offset, data->m_size);
+                m_context->PushPreparedRequest(read);
+            }
+            else
+            {
+                m_context->PushPreparedRequest(request);
+            }
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::ReadData>(&request->GetCommand()); data != nullptr)
+            {
+                auto output = reinterpret_cast<AZ::u8*>(data->m_output);
+                for (AZ::u64 i = 0; i < data->m_size; ++i)
+                {
+                    output[i] = static_cast<AZ::u8>(data->m_offset + i);
+                }
+                m_numReads++;
+            }
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        bool ExecuteRequests() override
+        {
+            return false;
+        }
+
+        void UpdateStatus(Status& status) const override
+        {
+            status.m_numAvailableSlots = 64;
+            status.m_isIdle = true;
+        }
+
+        AZStd::atomic_int m_numReads{ 0 };
+    };
+
+    class FileIOAsyncTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+            AZ::IO::FileIOBlockingStats::Reset();
+
+            m_filePath = m_tempDirectory.Resolve("FileIOAsync.bin").Native();
+            AZStd::string content;
+            for (size_t i = 0; i < FileSize; ++i)
+            {
+                content.push_back(static_cast<char>(i));
+            }
+            ASSERT_TRUE(AZ::Test::CreateTestFile(m_tempDirectory, "FileIOAsync.bin", content));
+        }
+
+        void TearDown() override
+        {
+            StopStreamer();
+            AZ::IO::FileIOBlockingStats::Reset();
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+            LeakDetectionFixture::TearDown();
+        }
+
+        void StartStreamer()
+        {
+            m_stackEntry = AZStd::make_shared<PatternReadStackEntry>();
+            m_streamer = aznew AZ::IO::Streamer(AZStd::thread_desc{}, AZStd::make_unique<AZ::IO::Scheduler>(m_stackEntry));
+            AZ::Interface<AZ::IO::IStreamer>::Register(m_streamer);
+        }
+
+        void StopStreamer()
+        {
+            if (m_streamer)
+            {
+                AZ::Interface<AZ::IO::IStreamer>::Unregister(m_streamer);
+                delete m_streamer;
+                m_streamer = nullptr;
+                m_stackEntry.reset();
+            }
+        }
+
+        static constexpr size_t FileSize = 2000;
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        TestFileIOBase m_fileIO;
+        AZStd::string m_filePath;
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+        AZStd::shared_ptr<PatternReadStackEntry> m_stackEntry;
+        AZ::IO::Streamer* m_streamer{ nullptr };
+    };
+
+    TEST_F(FileIOAsyncTest, ReadAsync_WithoutStreamer_ReadsSynchronously)
+    {
+        AZ::IO::FileReadRequest request;
+        request.m_path = m_filePath;
+        request.m_offset = 100;
+        request.m_callSite = "FileIOAsyncTest";
+        AZ::IO::FileReadFuture future = m_fileIO.ReadAsync(request);
+        ASSERT_TRUE(future.IsReady());
+
+        // The synchronous read blocked the calling thread, which is recorded for the call site.
+        AZStd::vector<AZ::IO::FileIOBlockingStats::CallSite> callSites = AZ::IO::FileIOBlockingStats::GetCallSites();
+        ASSERT_EQ(1, callSites.size());
+        EXPECT_STREQ("FileIOAsyncTest", callSites[0].m_name.c_str());
+        EXPECT_EQ(1, callSites[0].m_numBlockingWaits);
+        EXPECT_GT(callSites[0].m_totalBlocked.count(), 0);
+
+        ASSERT_EQ(AZ::IO::ResultCode::Success, future.GetResult());
+
+        const AZStd::vector<AZ::u8>& data = future.GetData();
+        ASSERT_EQ(FileSize - 100, data.size());
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            ASSERT_EQ(static_cast<AZ::u8>(i + 100), data[i]);
+        }
+    }
+
+    TEST_F(FileIOAsyncTest, ReadAsync_MissingFile_FailsWithoutData)
+    {
+        AZ::IO::FileReadRequest request;
+        request.m_path = m_tempDirectory.Resolve("Missing.bin").Native();
+        AZ::IO::FileReadFuture future = m_fileIO.ReadAsync(request);
+        EXPECT_EQ(AZ::IO::ResultCode::Error, future.GetResult());
+        EXPECT_TRUE(future.GetData().empty());
+    }
+
+    TEST_F(FileIOAsyncTest, ReadAsync_AdjacentSmallReads_AreCoalescedIntoOneStreamerRead)
+    {
+        StartStreamer();
+
+        AZStd::vector<AZ::IO::FileReadRequest> requests(4);
+        AZ::u64 offsets[] = { 512, 0, 300, 1100 };
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            requests[i].m_path = "@products@/level.bin";
+            requests[i].m_offset = offsets[i];
+            requests[i].m_size = 200;
+            requests[i].m_callSite = "FileIOAsyncTest";
+        }
+        // A read from another file is never combined.
+        requests.push_back(requests[0]);
+        requests.back().m_path = "@products@/other.bin";
+
+        AZStd::vector<AZ::IO::FileReadFuture> futures = m_fileIO.ReadAsync(requests);
+        ASSERT_EQ(requests.size(), futures.size());
+        for (size_t i = 0; i < futures.size(); ++i)
+        {
+            ASSERT_EQ(AZ::IO::ResultCode::Success, futures[i].GetResult());
+            const AZStd::vector<AZ::u8>& data = futures[i].GetData();
+            ASSERT_EQ(requests[i].m_size, data.size());
+            for (size_t j = 0; j < data.size(); ++j)
+            {
+                ASSERT_EQ(static_cast<AZ::u8>(requests[i].m_offset + j), data[j]);
+            }
+        }
+        EXPECT_EQ(2, m_stackEntry->m_numReads);
+
+        AZStd::vector<AZ::IO::FileIOBlockingStats::CallSite> callSites = AZ::IO::FileIOBlockingStats::GetCallSites();
+        ASSERT_EQ(1, callSites.size());
+        EXPECT_STREQ("FileIOAsyncTest", callSites[0].m_name.c_str());
+        // Each future was waited on by GetResult and GetData.
+        EXPECT_EQ(2 * futures.size(), callSites[0].m_numWaits);
+    }
+
+    TEST_F(FileIOAsyncTest, ReadAsync_DistantReads_AreNotCoalesced)
+    {
+        StartStreamer();
+
+        AZStd::vector<AZ::IO::FileReadRequest> requests(2);
+        requests[0].m_path = "@products@/level.bin";
+        requests[0].m_size = 128;
+        requests[1].m_path = "@products@/level.bin";
+        requests[1].m_offset = 1024 * 1024;
+        requests[1].m_size = 128;
+
+        AZStd::vector<AZ::IO::FileReadFuture> futures = m_fileIO.ReadAsync(requests);
+        for (AZ::IO::FileReadFuture& future : futures)
+        {
+            EXPECT_EQ(AZ::IO::ResultCode::Success, future.GetResult());
+        }
+        EXPECT_EQ(AZ::u8(0), futures[1].GetData()[0]);
+        EXPECT_EQ(2, m_stackEntry->m_numReads);
+    }
+} // namespace UnitTest
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace Benchmark
+{
+    //! Stream stack entry that immediately completes every request it receives. Used as the entry after the
+    //! cache so the benchmark measures the cache itself instead of the storage device.
+    class ImmediateCompletionStackEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        ImmediateCompletionStackEntry(AZ::u64 fileSize)
+            : AZ::IO::StreamStackEntry("Immediate completion")
+            , m_fileSize(fileSize)
+        {
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::FileMetaDataRetrievalData>(&request->GetCommand()); data != nullptr)
+            {
+                data->m_found = true;
+                data->m_fileSize = m_fileSize;
+            }
+            m_readCount += AZStd::holds_alternative<AZ::IO::Requests::ReadData>(request->GetCommand()) ? 1 : 0;
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        bool ExecuteRequests() override
+        {
+            return false;
+        }
+
+        AZ::u64 m_fileSize;
+        AZ::u64 m_readCount{ 0 };
+    };
+
+    //! Replays a synthetic access trace where small random reads into a hot set of blocks are interleaved with
+    //! a large sequential read that's split into small chunks, such as a level streaming in its geometry.
+    class BM_BlockCache
+        : public benchmark::Fixture
+    {
+        struct TraceEntry
+        {
+            const AZ::IO::RequestPath* m_path;
+            AZ::u64 m_offset;
+            AZ::u64 m_size;
+        };
+
+        void internalSetUp()
+        {
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            m_hotPath = "Hot";
+            m_scanPath = "Scan";
+
+            m_cache = AZStd::make_shared<AZ::IO::BlockCache>(CacheSize, BlockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, false);
+            m_reader = AZStd::make_shared<ImmediateCompletionStackEntry>(ScanBlockCount * BlockSize);
+            m_cache->SetNext(m_reader);
+            m_cache->SetContext(*m_context);
+
+            m_buffer.resize_no_construct(ReadSize);
+
+            AZ::SimpleLcgRandom random(1234);
+            m_trace.reserve(ScanBlockCount * ReadsPerScanBlock * 2);
+            for (AZ::u64 scanOffset = 0; scanOffset < ScanBlockCount * BlockSize; scanOffset += ReadSize)
+            {
+                // The scan never reads the start of a block, so every chunk goes through the cache.
+                m_trace.push_back({ &m_scanPath, scanOffset + 256, ReadSize - 512 });
+
+                AZ::u64 hotBlock = random.GetRandom() % HotBlockCount;
+                AZ::u64 hotOffset = random.GetRandom() % (BlockSize - ReadSize);
+                m_trace.push_back({ &m_hotPath, hotBlock * BlockSize + hotOffset, ReadSize });
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_trace = {};
+            m_buffer = {};
+            m_cache.reset();
+            m_reader.reset();
+            m_context.reset();
+        }
+
+    public:
+        static constexpr AZ::u32 BlockSize = 64 * 1024;
+        static constexpr AZ::u64 CacheSize = 64 * BlockSize;
+        static constexpr AZ::u64 HotBlockCount = 48;
+        static constexpr AZ::u64 ScanBlockCount = 1024;
+        static constexpr AZ::u64 ReadSize = 16 * 1024;
+        static constexpr AZ::u64 ReadsPerScanBlock = BlockSize / ReadSize;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void Replay()
+        {
+            for (const TraceEntry& entry : m_trace)
+            {
+                AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+                request->CreateRead(nullptr, m_buffer.data(), entry.m_size, *entry.m_path, entry.m_offset, entry.m_size);
+                m_cache->QueueRequest(request);
+                do
+                {
+                    while (m_context->FinalizeCompletedRequests())
+                    {
+                    }
+                } while (m_cache->ExecuteRequests());
+            }
+        }
+
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::shared_ptr<AZ::IO::BlockCache> m_cache;
+        AZStd::shared_ptr<ImmediateCompletionStackEntry> m_reader;
+        AZ::IO::RequestPath m_hotPath;
+        AZ::IO::RequestPath m_scanPath;
+        AZStd::vector<TraceEntry> m_trace;
+        AZStd::vector<AZ::u8> m_buffer;
+    };
+
+    BENCHMARK_F(BM_BlockCache, ReplayHotSetWithSequentialScan)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Replay();
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_trace.size());
+        state.counters["HitRate"] = m_cache->CalculateHitRatePercentage();
+        state.counters["ReadsPerReplay"] = aznumeric_cast<double>(m_reader->m_readCount) / state.iterations();
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
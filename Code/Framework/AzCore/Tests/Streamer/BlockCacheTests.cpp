@@ -65,7 +65,8 @@ namespace AZ::IO
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(
+                m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites, m_maxCacheSize);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -231,6 +232,7 @@ namespace AZ::IO
         u32* m_buffer{ nullptr };
         size_t m_bufferSize{ 0 };
         u64 m_cacheSize{ 5 * 1024 * 1024 };
+        u64 m_maxCacheSize{ 0 };
         u32 m_blockSize{ 64 * 1024 };
         u64 m_fakeFileLength{ 5 * m_blockSize };
         u64 m_readBufferLength{ 10 * 1024 * 1024 };
@@ -1167,4 +1169,88 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    TEST_F(Streamer_BlockCacheGenericTest, Eviction_ScanThroughFileAfterReusingBlock_ReusedBlockStaysInCache)
+    {
+        using ::testing::_;
+
+        m_cacheSize = 4 * m_blockSize;
+        m_fakeFileLength = 16 * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        RequestPath hotPath;
+        hotPath = "Hot";
+        RequestPath scanPath;
+        scanPath = "Scan";
+
+        // Read the same block twice so it's marked as frequently used.
+        EXPECT_CALL(*this, ReadFile(_, hotPath, _, _)).Times(1);
+        ProcessRead(m_buffer, hotPath, 256, 512, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, hotPath, 1024, 512, IStreamerTypes::RequestStatus::Completed);
+
+        // Scan through more blocks than fit in the cache.
+        EXPECT_CALL(*this, ReadFile(_, scanPath, _, _)).Times(16);
+        for (u64 i = 0; i < 16; ++i)
+        {
+            ProcessRead(m_buffer, scanPath, i * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        // The frequently used block should not have been evicted by the scan.
+        ProcessRead(m_buffer, hotPath, 2048, 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(2048, 512);
+    }
+
+    TEST_F(Streamer_BlockCacheGenericTest, Growth_RepeatedlyReadWorkingSetLargerThanCache_CacheGrowsUpToMaxSize)
+    {
+        using ::testing::_;
+
+        m_cacheSize = 4 * m_blockSize;
+        m_maxCacheSize = 8 * m_blockSize;
+        m_fakeFileLength = 6 * m_blockSize;
+        BlockCache::SetGrowthBudget(m_maxCacheSize);
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(::testing::AtLeast(6));
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            for (u64 i = 0; i < 6; ++i)
+            {
+                ProcessRead(m_buffer, m_path, i * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+            }
+        }
+        EXPECT_EQ(m_maxCacheSize, m_cache->GetCacheSize());
+
+        // Once the cache has grown the entire working set fits and no further reads are needed.
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(0);
+        for (u64 i = 0; i < 6; ++i)
+        {
+            ProcessRead(m_buffer, m_path, i * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        m_cache = nullptr;
+        BlockCache::SetGrowthBudget(0);
+    }
+
+    TEST_F(Streamer_BlockCacheGenericTest, Growth_NoGrowthBudget_CacheSizeIsUnchanged)
+    {
+        using ::testing::_;
+
+        m_cacheSize = 4 * m_blockSize;
+        m_maxCacheSize = 8 * m_blockSize;
+        m_fakeFileLength = 6 * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(::testing::AtLeast(6));
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            for (u64 i = 0; i < 6; ++i)
+            {
+                ProcessRead(m_buffer, m_path, i * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+            }
+        }
+        EXPECT_EQ(m_cacheSize, m_cache->GetCacheSize());
+    }
 } // namespace AZ::IO
@@ -15,6 +15,7 @@
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/FileIOBaseTestTypes.h>
 #include <Tests/Streamer/IStreamerTypesMock.h>
 #include <Tests/Streamer/StreamStackEntryMock.h>
 
@@ -428,4 +429,115 @@ namespace AZ::IO
             m_streamer->m_streamStack->Thread_PrioritizeRequests(&sameFileRequest->m_request, &sameFileRequest2->m_request),
             Scheduler::Order::Equal);
     }
+
+    TEST_F(Streamer_SchedulerTest, DeadlineAwareSorting)
+    {
+        using AZStd::chrono::milliseconds;
+
+        UnitTest::TestFileIOBase fileIO;
+        FileIOBase* prevFileIO = FileIOBase::GetInstance();
+        FileIOBase::SetInstance(&fileIO);
+
+        m_isStackIdle = true;
+        Scheduler scheduler(m_mock, AZCORE_GLOBAL_NEW_ALIGNMENT, 1, 1_mib, Scheduler::SchedulingMode::DeadlineAware);
+        m_isStackIdle = false;
+
+        char fakeBuffer[8];
+        AZStd::vector<FileRequestPtr> requests;
+        StreamerContext::PreparedQueue queue;
+        size_t pendingId = 0;
+        const auto now = AZStd::chrono::steady_clock::now();
+
+        auto addRead = [&](const char* path, u64 offset, AZStd::chrono::steady_clock::time_point deadline,
+            AZStd::chrono::steady_clock::time_point estimatedCompletion) -> FileRequest*
+        {
+            RequestPath requestPath;
+            requestPath = path;
+            FileRequestPtr readRequest = scheduler.CreateRequest();
+            readRequest->m_request.CreateReadRequest(
+                requestPath, fakeBuffer, sizeof(fakeBuffer), offset, sizeof(fakeBuffer), deadline, IStreamerTypes::s_priorityMedium);
+            FileRequestPtr read = scheduler.CreateRequest();
+            read->m_request.CreateRead(&read->m_request, fakeBuffer, sizeof(fakeBuffer), requestPath, offset, sizeof(fakeBuffer));
+            read->m_request.m_parent = &readRequest->m_request;
+            read->m_request.m_dependencies = 0;
+            read->m_request.m_pendingId = ++pendingId;
+            read->m_request.SetEstimatedCompletion(estimatedCompletion);
+
+            FileRequest* result = &read->m_request;
+            queue.push_back(result);
+            requests.push_back(AZStd::move(readRequest));
+            requests.push_back(AZStd::move(read));
+            return result;
+        };
+        auto reset = [&]()
+        {
+            queue.clear();
+            requests.clear();
+        };
+
+        //////////////////////////////////////////////////////////////
+        // Requests in panic that can't meet their deadline don't push out requests that can.
+        //////////////////////////////////////////////////////////////
+        {
+            // Every request takes 10ms based on the estimates. The first request can't complete within 5ms, but the other two can
+            // still meet their deadlines if the first request doesn't go first.
+            FileRequest* missed = addRead("Missed", 0, now + milliseconds(5), now + milliseconds(10));
+            FileRequest* urgent1 = addRead("Urgent1", 0, now + milliseconds(15), now + milliseconds(20));
+            FileRequest* urgent2 = addRead("Urgent2", 0, now + milliseconds(25), now + milliseconds(30));
+            FileRequest* relaxed = addRead("Relaxed", 0, FileRequest::s_noDeadlineTime, now + milliseconds(40));
+
+            scheduler.Thread_ScheduleRequestsDeadlineAware(queue, now);
+
+            ASSERT_EQ(4, queue.size());
+            EXPECT_EQ(urgent1, queue[0]);
+            EXPECT_EQ(urgent2, queue[1]);
+            EXPECT_EQ(missed, queue[2]);
+            EXPECT_EQ(relaxed, queue[3]);
+            reset();
+        }
+
+        //////////////////////////////////////////////////////////////
+        // Reads continue forward through the last file read from, after which the other files are visited in order.
+        //////////////////////////////////////////////////////////////
+        {
+            scheduler.m_threadData.m_lastFilePath = "Head";
+            scheduler.m_threadData.m_lastFileOffset = 100;
+
+            FileRequest* otherFile = addRead("Other", 10, FileRequest::s_noDeadlineTime, now);
+            FileRequest* headFar = addRead("Head", 300, FileRequest::s_noDeadlineTime, now);
+            FileRequest* headBehind = addRead("Head", 50, FileRequest::s_noDeadlineTime, now);
+            FileRequest* headNear = addRead("Head", 150, FileRequest::s_noDeadlineTime, now);
+
+            scheduler.Thread_ScheduleRequestsDeadlineAware(queue, now);
+
+            ASSERT_EQ(4, queue.size());
+            EXPECT_EQ(headNear, queue[0]);
+            EXPECT_EQ(headFar, queue[1]);
+            EXPECT_EQ(otherFile, queue[2]);
+            EXPECT_EQ(headBehind, queue[3]);
+            reset();
+        }
+
+        //////////////////////////////////////////////////////////////
+        // Reads that missed their deadline are picked up first once the current file has been swept.
+        //////////////////////////////////////////////////////////////
+        {
+            scheduler.m_threadData.m_lastFilePath = "Head";
+            scheduler.m_threadData.m_lastFileOffset = 0;
+
+            FileRequest* relaxed = addRead("Relaxed", 0, FileRequest::s_noDeadlineTime, now + milliseconds(1));
+            FileRequest* late = addRead("Late", 0, now - milliseconds(1), now + milliseconds(2));
+            FileRequest* head = addRead("Head", 500, FileRequest::s_noDeadlineTime, now + milliseconds(3));
+
+            scheduler.Thread_ScheduleRequestsDeadlineAware(queue, now);
+
+            ASSERT_EQ(3, queue.size());
+            EXPECT_EQ(head, queue[0]);
+            EXPECT_EQ(late, queue[1]);
+            EXPECT_EQ(relaxed, queue[2]);
+            reset();
+        }
+
+        FileIOBase::SetInstance(prevFileIO);
+    }
 } // namespace AZ::IO
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/FileIOBaseTestTypes.h>
+
+namespace UnitTest
+{
+    //! Stream stack entry that completes every read immediately without touching the file system, so a trace can be
+    //! replayed without the files it references.
+    class TraceReplayStackEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        TraceReplayStackEntry()
+            : AZ::IO::StreamStackEntry("Trace replay")
+        {
+        }
+
+        void PrepareRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::ReadRequestData>(&request->GetCommand()); data != nullptr)
+            {
+                AZ::IO::FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, data->m_output, data->m_outputSize, data->m_path, data->m_offset, data->m_size);
+                m_context->PushPreparedRequest(read);
+            }
+            else
+            {
+                m_context->PushPreparedRequest(request);
+            }
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        bool ExecuteRequests() override
+        {
+            return false;
+        }
+
+        void UpdateStatus(Status& status) const override
+        {
+            status.m_numAvailableSlots = 64;
+            status.m_isIdle = true;
+        }
+    };
+
+    class StreamerTraceTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+            m_streamer = aznew AZ::IO::Streamer(
+                AZStd::thread_desc{}, AZStd::make_unique<AZ::IO::Scheduler>(AZStd::make_shared<TraceReplayStackEntry>()));
+        }
+
+        void TearDown() override
+        {
+            delete m_streamer;
+            m_streamer = nullptr;
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        static AZ::IO::StreamerTrace CreateTrace()
+        {
+            AZ::IO::StreamerTrace trace;
+            AZ::u32 first = trace.AddPath("@products@/levels/first.pak");
+            AZ::u32 second = trace.AddPath("@products@/levels/second.pak");
+            EXPECT_EQ(first, trace.AddPath("@products@/levels/first.pak"));
+
+            AZ::IO::StreamerTrace::Entry entry;
+            entry.m_timestamp = AZStd::chrono::microseconds(10);
+            entry.m_deadline = AZStd::chrono::milliseconds(16);
+            entry.m_offset = 4096;
+            entry.m_size = 65536;
+            entry.m_pathIndex = first;
+            entry.m_priority = AZ::IO::IStreamerTypes::s_priorityHigh;
+            trace.AddEntry(entry);
+
+            entry.m_timestamp = AZStd::chrono::microseconds(2500);
+            entry.m_deadline = AZ::IO::IStreamerTypes::s_noDeadline;
+            entry.m_offset = 0;
+            entry.m_size = 128;
+            entry.m_pathIndex = second;
+            entry.m_priority = AZ::IO::IStreamerTypes::s_priorityLow;
+            trace.AddEntry(entry);
+            return trace;
+        }
+
+    protected:
+        TestFileIOBase m_fileIO;
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+        AZ::IO::Streamer* m_streamer{ nullptr };
+    };
+
+    TEST_F(StreamerTraceTest, SaveAndLoad_TraceWithDeadlines_AllEntriesAreRestored)
+    {
+        AZ::IO::StreamerTrace trace = CreateTrace();
+
+        AZStd::vector<AZ::u8> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> output(&buffer);
+        ASSERT_TRUE(trace.Save(output));
+
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> input(&buffer);
+        AZ::IO::StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(input));
+
+        EXPECT_EQ(trace.GetPaths(), loaded.GetPaths());
+        ASSERT_EQ(trace.GetEntries().size(), loaded.GetEntries().size());
+        for (size_t i = 0; i < trace.GetEntries().size(); ++i)
+        {
+            const AZ::IO::StreamerTrace::Entry& expected = trace.GetEntries()[i];
+            const AZ::IO::StreamerTrace::Entry& actual = loaded.GetEntries()[i];
+            EXPECT_EQ(expected.m_timestamp, actual.m_timestamp);
+            EXPECT_EQ(expected.m_deadline, actual.m_deadline);
+            EXPECT_EQ(expected.m_offset, actual.m_offset);
+            EXPECT_EQ(expected.m_size, actual.m_size);
+            EXPECT_EQ(expected.m_pathIndex, actual.m_pathIndex);
+            EXPECT_EQ(expected.m_priority, actual.m_priority);
+        }
+    }
+
+    TEST_F(StreamerTraceTest, Load_TruncatedTrace_FailsAndLeavesTraceEmpty)
+    {
+        AZ::IO::StreamerTrace trace = CreateTrace();
+
+        AZStd::vector<AZ::u8> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> output(&buffer);
+        ASSERT_TRUE(trace.Save(output));
+        buffer.resize(buffer.size() - 3);
+
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> input(&buffer);
+        AZ::IO::StreamerTrace loaded;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loaded.Load(input));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(loaded.IsEmpty());
+        EXPECT_TRUE(loaded.GetPaths().empty());
+    }
+
+    TEST_F(StreamerTraceTest, TraceCapture_QueuedReads_ReadsAreRecordedInOrder)
+    {
+        AZ::IO::IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+        m_streamer->StartTraceCapture();
+        EXPECT_TRUE(m_streamer->IsCapturingTrace());
+
+        AZ::IO::FileRequestPtr first = m_streamer->Read("first.bin", allocator, 100, AZStd::chrono::seconds(10),
+            AZ::IO::IStreamerTypes::s_priorityHigh, 20);
+        AZ::IO::FileRequestPtr second = m_streamer->Read("second.bin", allocator, 200);
+        m_streamer->QueueRequestBatch({ first, second, m_streamer->FlushCaches() });
+
+        AZ::IO::StreamerTrace trace;
+        m_streamer->StopTraceCapture(trace);
+        EXPECT_FALSE(m_streamer->IsCapturingTrace());
+
+        // Only the reads are recorded.
+        ASSERT_EQ(2, trace.GetEntries().size());
+        const AZ::IO::StreamerTrace::Entry& firstEntry = trace.GetEntries()[0];
+        EXPECT_STREQ("first.bin", trace.GetPaths()[firstEntry.m_pathIndex].c_str());
+        EXPECT_EQ(20, firstEntry.m_offset);
+        EXPECT_EQ(100, firstEntry.m_size);
+        EXPECT_EQ(AZ::IO::IStreamerTypes::s_priorityHigh, firstEntry.m_priority);
+        EXPECT_GT(firstEntry.m_deadline, AZStd::chrono::seconds(9));
+        EXPECT_LE(firstEntry.m_deadline, AZStd::chrono::seconds(10));
+
+        const AZ::IO::StreamerTrace::Entry& secondEntry = trace.GetEntries()[1];
+        EXPECT_STREQ("second.bin", trace.GetPaths()[secondEntry.m_pathIndex].c_str());
+        EXPECT_EQ(AZ::IO::IStreamerTypes::s_noDeadline, secondEntry.m_deadline);
+        EXPECT_GE(secondEntry.m_timestamp, firstEntry.m_timestamp);
+
+        // Wait for the captured requests to complete before the allocator goes out of scope.
+        while (!m_streamer->HasRequestCompleted(first) || !m_streamer->HasRequestCompleted(second))
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    TEST_F(StreamerTraceTest, Replay_TraceWithoutTiming_AllRequestsComplete)
+    {
+        AZ::IO::StreamerTrace trace = CreateTrace();
+        AZ::IO::StreamerTraceReplaySettings settings;
+        settings.m_preserveTiming = false;
+
+        AZ::IO::StreamerTraceReplayResult result = AZ::IO::ReplayStreamerTrace(*m_streamer, trace, settings);
+        EXPECT_FALSE(result.m_timedOut);
+        EXPECT_EQ(2, result.m_numRequests);
+        EXPECT_EQ(0, result.m_numFailed);
+        EXPECT_EQ(65536 + 128, result.m_bytesRead);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Replays a synthetic trace of level streaming reads through the complete Streamer front end and Scheduler. The stack
+    //! completes reads immediately, so this measures the overhead of queuing, scheduling and completing requests. Captured
+    //! traces can be replayed against real stacks with the StreamerReplayTrace console command.
+    class BM_StreamerTraceReplay
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+            m_streamer = aznew AZ::IO::Streamer(
+                AZStd::thread_desc{}, AZStd::make_unique<AZ::IO::Scheduler>(AZStd::make_shared<UnitTest::TraceReplayStackEntry>()));
+
+            m_trace = AZStd::make_unique<AZ::IO::StreamerTrace>();
+            for (AZ::u32 i = 0; i < NumFiles; ++i)
+            {
+                m_trace->AddPath(AZStd::string::format("@products@/streaming/file_%u.bin", i));
+            }
+            for (AZ::u32 i = 0; i < NumRequests; ++i)
+            {
+                AZ::IO::StreamerTrace::Entry entry;
+                entry.m_timestamp = AZStd::chrono::microseconds(i * 50);
+                entry.m_deadline = (i % 4 == 0) ? AZ::IO::IStreamerTypes::s_noDeadline : AZStd::chrono::milliseconds(5 + i % 30);
+                entry.m_pathIndex = i % NumFiles;
+                entry.m_offset = (i / NumFiles) * ReadSize;
+                entry.m_size = ReadSize;
+                entry.m_priority = AZ::IO::IStreamerTypes::s_priorityMedium;
+                m_trace->AddEntry(entry);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_trace.reset();
+            delete m_streamer;
+            m_streamer = nullptr;
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+    public:
+        static constexpr AZ::u32 NumFiles = 16;
+        static constexpr AZ::u32 NumRequests = 2048;
+        static constexpr AZ::u64 ReadSize = 16 * 1024;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        UnitTest::TestFileIOBase m_fileIO;
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+        AZ::IO::Streamer* m_streamer{ nullptr };
+        AZStd::unique_ptr<AZ::IO::StreamerTrace> m_trace;
+    };
+
+    BENCHMARK_F(BM_StreamerTraceReplay, ReplayWithoutTiming)(benchmark::State& state)
+    {
+        AZ::IO::StreamerTraceReplaySettings settings;
+        settings.m_preserveTiming = false;
+
+        AZ::IO::StreamerTraceReplayResult result;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            result = AZ::IO::ReplayStreamerTrace(*m_streamer, *m_trace, settings);
+        }
+
+        state.SetItemsProcessed(state.iterations() * NumRequests);
+        state.SetBytesProcessed(state.iterations() * NumRequests * ReadSize);
+        state.counters["AverageLatencyUs"] = aznumeric_cast<double>(result.m_averageLatency.count());
+        state.counters["MissedDeadlines"] = aznumeric_cast<double>(result.m_numMissedDeadlines);
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -10,6 +10,7 @@ set(FILES
     Main.cpp
     Asset/AssetCommon.cpp
     Asset/AssetDataStreamTests.cpp
+    Asset/AssetManagerBenchmarks.cpp
     Asset/AssetManagerLoadingTests.cpp
     Asset/AssetManagerStreamingTests.cpp
     Asset/BaseAssetManagerTest.cpp
@@ -101,6 +102,8 @@ set(FILES
     FileIOBaseTestTypes.h
     Geometry2DUtils.cpp
     Interface.cpp
+    IO/CompressorBlockTests.cpp
+    IO/FileIOAsyncTests.cpp
     IO/FileReaderTests.cpp
     IO/Path/PathReflectTests.cpp
     IO/Path/PathTests.cpp
@@ -248,6 +251,7 @@ set(FILES
     StatisticalProfilerBenchmarks.cpp
     StatisticalProfilerHelpers.h
     StatisticalProfilerTests.cpp
+    Streamer/BlockCachePerformanceTests.cpp
     Streamer/BlockCacheTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
@@ -258,6 +262,7 @@ set(FILES
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Streamer/StreamerTraceTests.cpp
     StreamerTests.cpp
     StringFunc.cpp
     SystemFileTest.cpp
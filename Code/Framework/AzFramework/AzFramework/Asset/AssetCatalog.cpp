@@ -15,6 +15,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
@@ -26,6 +27,7 @@
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/AssetRegistryBinary.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -555,26 +557,52 @@ namespace AzFramework
             // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
             // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
             AZStd::vector<char> bytes;
+            AssetRegistryBinaryView binaryCatalog;
             if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
             {
-                AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
-                AZ::u64 size = 0;
-                AZ::IO::FileIOBase::GetInstance()->Size(catalogRegistryFile, size);
-
-                if (size)
+                auto ReadCatalogFile = [&bytes](const char* catalogFileToRead)
                 {
-                    if (AZ::IO::FileIOBase::GetInstance()->Open(catalogRegistryFile, AZ::IO::OpenMode::ModeRead, handle))
+                    bytes.clear();
+                    AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+                    AZ::u64 size = 0;
+                    AZ::IO::FileIOBase::GetInstance()->Size(catalogFileToRead, size);
+
+                    if (size)
                     {
-                        bytes.resize_no_construct(size);
-                        // this call will fail on purpose if bytes.size() != size successfully actually read from disk.
-                        if (!AZ::IO::FileIOBase::GetInstance()->Read(handle, bytes.data(), bytes.size(), true))
+                        if (AZ::IO::FileIOBase::GetInstance()->Open(catalogFileToRead, AZ::IO::OpenMode::ModeRead, handle))
                         {
-                            AZ_Error("AssetCatalog", false, "File %s failed read - read was truncated!", catalogRegistryFile);
-                            bytes.set_capacity(0);
+                            bytes.resize_no_construct(size);
+                            // this call will fail on purpose if bytes.size() != size successfully actually read from disk.
+                            if (!AZ::IO::FileIOBase::GetInstance()->Read(handle, bytes.data(), bytes.size(), true))
+                            {
+                                AZ_Error("AssetCatalog", false, "File %s failed read - read was truncated!", catalogFileToRead);
+                                bytes.set_capacity(0);
+                            }
+                            AZ::IO::FileIOBase::GetInstance()->Close(handle);
                         }
-                        AZ::IO::FileIOBase::GetInstance()->Close(handle);
+                    }
+                };
+
+                // The Asset Processor can write a binary version of the catalog next to the xml one. It still needs to be converted
+                // into the in-memory registry, but that's much faster than deserializing through the ObjectStream, so prefer it when
+                // it's available.
+                AZ::IO::FixedMaxPath binaryCatalogFile(catalogRegistryFile);
+                binaryCatalogFile.ReplaceExtension(AssetRegistryBinary::FileExtension);
+                if (AZ::IO::FileIOBase::GetInstance()->Exists(binaryCatalogFile.c_str()))
+                {
+                    ReadCatalogFile(binaryCatalogFile.c_str());
+                    // A truncated or corrupt binary catalog must not leave the runtime without a catalog, the xml one is still there.
+                    if (!AssetRegistryBinary::IsBinaryCatalog(bytes) || !binaryCatalog.Attach(bytes))
+                    {
+                        AZ_Warning("AssetCatalog", false, "Binary asset catalog %s is not valid, loading %s instead.",
+                            binaryCatalogFile.c_str(), catalogRegistryFile);
                     }
                 }
+
+                if (!binaryCatalog.IsAttached())
+                {
+                    ReadCatalogFile(catalogRegistryFile);
+                }
             }
 
             if (!bytes.empty())
@@ -586,19 +614,26 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
-                AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+                if (binaryCatalog.IsAttached())
+                {
+                    binaryCatalog.ToAssetRegistry(*m_registry);
+                }
+                else
+                {
+                    AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
-                    AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
-                    [this, &catalogStream, &serializeContext]
-                    {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
-                    },
-                        "Asset Catalog Loading Thread"
-                        );
+                    ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
+                        AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
+                        [this, &catalogStream, &serializeContext]
+                        {
+                            AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        },
+                            "Asset Catalog Loading Thread"
+                            );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                    AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                }
 
                 AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
 
@@ -19,6 +19,13 @@ namespace AZ
     class SerializeContext;
 }
 
+namespace AssetRegistryInternal
+{
+    //! Creates the key used for path to AssetId lookups.
+    //! The path is normalized first so that the key doesn't depend on case or slash direction.
+    AZ::Uuid CreateUUIDForName(AZStd::string_view name);
+}
+
 namespace AzFramework
 {
     /**
@@ -28,6 +35,8 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class AssetRegistryBinaryWriter;
+        friend class AssetRegistryBinaryView;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator);
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/AssetRegistryBinary.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace AzFramework
+{
+    namespace AssetRegistryBinaryInternal
+    {
+        using namespace AssetRegistryBinary;
+
+        static_assert(sizeof(AZ::Uuid) == 16, "The binary asset catalog stores uuids as 16 raw bytes.");
+
+        constexpr size_t AlignSize(size_t size)
+        {
+            return (size + Alignment - 1) & ~(Alignment - 1);
+        }
+
+        void StoreUuid(AZ::u8 (&target)[16], const AZ::Uuid& uuid)
+        {
+            memcpy(target, &uuid, sizeof(target));
+        }
+
+        AZ::Uuid LoadUuid(const AZ::u8 (&source)[16])
+        {
+            AZ::Uuid result;
+            memcpy(&result, source, sizeof(source));
+            return result;
+        }
+
+        //! Orders records the same way in the writer and the reader. Uuids are compared byte by byte which
+        //! matches the ordering of AZ::Uuid::operator<.
+        int CompareKey(const AZ::u8 (&guid)[16], AZ::u32 subId, const AZ::Data::AssetId& id)
+        {
+            int result = memcmp(guid, &id.m_guid, sizeof(guid));
+            if (result != 0)
+            {
+                return result;
+            }
+            return subId < id.m_subId ? -1 : (subId > id.m_subId ? 1 : 0);
+        }
+
+        template<typename Record>
+        bool RecordLess(const Record& lhs, const Record& rhs)
+        {
+            int result = memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid));
+            return result < 0 || (result == 0 && lhs.m_subId < rhs.m_subId);
+        }
+
+        //! Binary search for a record with the given key in a table sorted by (m_guid, m_subId).
+        template<typename Record>
+        const Record* FindByKey(AZStd::span<const Record> records, const AZ::Data::AssetId& id)
+        {
+            size_t low = 0;
+            size_t high = records.size();
+            while (low < high)
+            {
+                size_t mid = low + (high - low) / 2;
+                int compare = CompareKey(records[mid].m_guid, records[mid].m_subId, id);
+                if (compare == 0)
+                {
+                    return &records[mid];
+                }
+                if (compare < 0)
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+            return nullptr;
+        }
+
+        class SegmentBuilder
+        {
+        public:
+            void AddAsset(
+                const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& info, const AZStd::vector<AZ::Data::ProductDependency>* dependencies)
+            {
+                AssetRecord& record = m_assets.emplace_back();
+                memset(&record, 0, sizeof(record));
+                StoreUuid(record.m_guid, id.m_guid);
+                record.m_subId = id.m_subId;
+                StoreUuid(record.m_assetType, info.m_assetType);
+                record.m_sizeBytes = info.m_sizeBytes;
+                record.m_pathOffset = aznumeric_cast<AZ::u32>(m_strings.size());
+                record.m_pathLength = aznumeric_cast<AZ::u32>(info.m_relativePath.size());
+                m_strings.append(info.m_relativePath);
+
+                // Dependency ranges are assigned in insertion order and stay valid when the asset table is sorted later.
+                record.m_firstDependency = aznumeric_cast<AZ::u32>(m_dependencies.size());
+                if (dependencies)
+                {
+                    for (const AZ::Data::ProductDependency& dependency : *dependencies)
+                    {
+                        DependencyRecord& dependencyRecord = m_dependencies.emplace_back();
+                        memset(&dependencyRecord, 0, sizeof(dependencyRecord));
+                        StoreUuid(dependencyRecord.m_guid, dependency.m_assetId.m_guid);
+                        dependencyRecord.m_subId = dependency.m_assetId.m_subId;
+                        dependencyRecord.m_flags = dependency.m_flags.to_ullong();
+                    }
+                    record.m_dependencyCount = aznumeric_cast<AZ::u32>(dependencies->size());
+                }
+            }
+
+            void AddRemoved(const AZ::Data::AssetId& id)
+            {
+                RemovedRecord& record = m_removed.emplace_back();
+                memset(&record, 0, sizeof(record));
+                StoreUuid(record.m_guid, id.m_guid);
+                record.m_subId = id.m_subId;
+            }
+
+            void AddPath(const AZ::Uuid& pathHash, const AZ::Data::AssetId& id)
+            {
+                PathRecord& record = m_paths.emplace_back();
+                memset(&record, 0, sizeof(record));
+                StoreUuid(record.m_pathHash, pathHash);
+                StoreUuid(record.m_guid, id.m_guid);
+                record.m_subId = id.m_subId;
+            }
+
+            void Emit(AZStd::vector<char>& output, SegmentKind kind)
+            {
+                AZStd::sort(m_assets.begin(), m_assets.end(), &RecordLess<AssetRecord>);
+                AZStd::sort(m_removed.begin(), m_removed.end(), &RecordLess<RemovedRecord>);
+                AZStd::sort(m_paths.begin(), m_paths.end(),
+                    [](const PathRecord& lhs, const PathRecord& rhs)
+                    {
+                        return memcmp(lhs.m_pathHash, rhs.m_pathHash, sizeof(lhs.m_pathHash)) < 0;
+                    });
+
+                SegmentHeader header;
+                header.m_kind = kind;
+                header.m_assetCount = aznumeric_cast<AZ::u32>(m_assets.size());
+                header.m_removedCount = aznumeric_cast<AZ::u32>(m_removed.size());
+                header.m_pathCount = aznumeric_cast<AZ::u32>(m_paths.size());
+                header.m_dependencyCount = aznumeric_cast<AZ::u32>(m_dependencies.size());
+                header.m_stringTableSize = m_strings.size();
+                header.m_segmentSize = sizeof(SegmentHeader)
+                    + m_assets.size() * sizeof(AssetRecord)
+                    + m_removed.size() * sizeof(RemovedRecord)
+                    + m_paths.size() * sizeof(PathRecord)
+                    + m_dependencies.size() * sizeof(DependencyRecord)
+                    + AlignSize(m_strings.size());
+
+                // Segments always start aligned because all records are multiples of the alignment and the
+                // string table is padded at the end.
+                const size_t start = output.size();
+                output.resize(start + header.m_segmentSize, 0);
+                char* cursor = output.data() + start;
+                auto write = [&cursor](const void* data, size_t size)
+                {
+                    if (size > 0)
+                    {
+                        memcpy(cursor, data, size);
+                        cursor += size;
+                    }
+                };
+                write(&header, sizeof(header));
+                write(m_assets.data(), m_assets.size() * sizeof(AssetRecord));
+                write(m_removed.data(), m_removed.size() * sizeof(RemovedRecord));
+                write(m_paths.data(), m_paths.size() * sizeof(PathRecord));
+                write(m_dependencies.data(), m_dependencies.size() * sizeof(DependencyRecord));
+                write(m_strings.data(), m_strings.size());
+            }
+
+        private:
+            AZStd::vector<AssetRecord> m_assets;
+            AZStd::vector<RemovedRecord> m_removed;
+            AZStd::vector<PathRecord> m_paths;
+            AZStd::vector<DependencyRecord> m_dependencies;
+            AZStd::string m_strings;
+        };
+    } // namespace AssetRegistryBinaryInternal
+
+    using namespace AssetRegistryBinaryInternal;
+
+    bool AssetRegistryBinary::IsBinaryCatalog(AZStd::span<const char> data)
+    {
+        if (data.size() < sizeof(SegmentHeader))
+        {
+            return false;
+        }
+        AZ::u32 magic;
+        memcpy(&magic, data.data(), sizeof(magic));
+        return magic == Magic;
+    }
+
+    //=========================================================================
+    // AssetRegistryBinaryWriter
+    //=========================================================================
+    void AssetRegistryBinaryWriter::WriteBaseSegment(AZStd::vector<char>& output, const AssetRegistry& registry)
+    {
+        SegmentBuilder builder;
+        for (const auto& [assetId, assetInfo] : registry.m_assetIdToInfo)
+        {
+            auto dependencies = registry.m_assetDependencies.find(assetId);
+            builder.AddAsset(assetId, assetInfo,
+                dependencies != registry.m_assetDependencies.end() ? &dependencies->second : nullptr);
+        }
+        for (const auto& [pathHash, assetId] : registry.m_assetPathToId)
+        {
+            builder.AddPath(pathHash, assetId);
+        }
+        builder.Emit(output, SegmentKind::Base);
+    }
+
+    void AssetRegistryBinaryWriter::WriteDeltaSegment(
+        AZStd::vector<char>& output,
+        const AssetRegistry& registry,
+        const AZStd::unordered_set<AZ::Data::AssetId>& changedAssets,
+        const AZStd::unordered_set<AZ::Data::AssetId>& removedAssets)
+    {
+        SegmentBuilder builder;
+        for (const AZ::Data::AssetId& assetId : changedAssets)
+        {
+            auto assetInfo = registry.m_assetIdToInfo.find(assetId);
+            if (assetInfo == registry.m_assetIdToInfo.end())
+            {
+                // The product was removed again after it changed, which is recorded as a removal if needed.
+                continue;
+            }
+            auto dependencies = registry.m_assetDependencies.find(assetId);
+            builder.AddAsset(assetId, assetInfo->second,
+                dependencies != registry.m_assetDependencies.end() ? &dependencies->second : nullptr);
+            builder.AddPath(AssetRegistryInternal::CreateUUIDForName(assetInfo->second.m_relativePath), assetId);
+        }
+        for (const AZ::Data::AssetId& assetId : removedAssets)
+        {
+            if (registry.m_assetIdToInfo.find(assetId) == registry.m_assetIdToInfo.end())
+            {
+                builder.AddRemoved(assetId);
+            }
+        }
+        builder.Emit(output, SegmentKind::Delta);
+    }
+
+    //=========================================================================
+    // AssetRegistryBinaryView
+    //=========================================================================
+    bool AssetRegistryBinaryView::Attach(AZStd::span<const char> data)
+    {
+        Detach();
+
+        if (reinterpret_cast<uintptr_t>(data.data()) % Alignment != 0)
+        {
+            AZ_Error("AssetCatalog", false, "Binary asset catalog data is not aligned to %zu bytes.", Alignment);
+            return false;
+        }
+
+        size_t offset = 0;
+        while (offset < data.size())
+        {
+            if (data.size() - offset < sizeof(SegmentHeader))
+            {
+                AZ_Error("AssetCatalog", false, "Binary asset catalog is truncated at offset %zu.", offset);
+                Detach();
+                return false;
+            }
+
+            const char* segmentStart = data.data() + offset;
+            const auto* header = reinterpret_cast<const SegmentHeader*>(segmentStart);
+            if (header->m_magic != Magic || header->m_version != Version)
+            {
+                AZ_Error("AssetCatalog", false, "Binary asset catalog segment at offset %zu has an unknown format.", offset);
+                Detach();
+                return false;
+            }
+
+            const SegmentKind expectedKind = m_segments.empty() ? SegmentKind::Base : SegmentKind::Delta;
+            const size_t tablesSize = sizeof(SegmentHeader)
+                + size_t{ header->m_assetCount } * sizeof(AssetRecord)
+                + size_t{ header->m_removedCount } * sizeof(RemovedRecord)
+                + size_t{ header->m_pathCount } * sizeof(PathRecord)
+                + size_t{ header->m_dependencyCount } * sizeof(DependencyRecord);
+            if (header->m_kind != expectedKind
+                || header->m_segmentSize > data.size() - offset
+                || header->m_segmentSize % Alignment != 0
+                || tablesSize + header->m_stringTableSize > header->m_segmentSize)
+            {
+                AZ_Error("AssetCatalog", false, "Binary asset catalog segment at offset %zu is corrupt.", offset);
+                Detach();
+                return false;
+            }
+
+            Segment& segment = m_segments.emplace_back();
+            segment.m_header = header;
+            const char* cursor = segmentStart + sizeof(SegmentHeader);
+            segment.m_assets = { reinterpret_cast<const AssetRecord*>(cursor), header->m_assetCount };
+            cursor += header->m_assetCount * sizeof(AssetRecord);
+            segment.m_removed = { reinterpret_cast<const RemovedRecord*>(cursor), header->m_removedCount };
+            cursor += header->m_removedCount * sizeof(RemovedRecord);
+            segment.m_paths = { reinterpret_cast<const PathRecord*>(cursor), header->m_pathCount };
+            cursor += header->m_pathCount * sizeof(PathRecord);
+            segment.m_dependencies = { reinterpret_cast<const DependencyRecord*>(cursor), header->m_dependencyCount };
+            cursor += header->m_dependencyCount * sizeof(DependencyRecord);
+            segment.m_strings = AZStd::string_view(cursor, header->m_stringTableSize);
+
+            for (const AssetRecord& record : segment.m_assets)
+            {
+                if (size_t{ record.m_pathOffset } + record.m_pathLength > segment.m_strings.size()
+                    || size_t{ record.m_firstDependency } + record.m_dependencyCount > segment.m_dependencies.size())
+                {
+                    AZ_Error("AssetCatalog", false, "Binary asset catalog segment at offset %zu has out of range records.", offset);
+                    Detach();
+                    return false;
+                }
+            }
+
+            offset += header->m_segmentSize;
+        }
+
+        return !m_segments.empty();
+    }
+
+    void AssetRegistryBinaryView::Detach()
+    {
+        m_segments.clear();
+    }
+
+    bool AssetRegistryBinaryView::IsAttached() const
+    {
+        return !m_segments.empty();
+    }
+
+    size_t AssetRegistryBinaryView::GetSegmentCount() const
+    {
+        return m_segments.size();
+    }
+
+    size_t AssetRegistryBinaryView::GetBaseSize() const
+    {
+        return m_segments.empty() ? 0 : m_segments.front().m_header->m_segmentSize;
+    }
+
+    size_t AssetRegistryBinaryView::GetDeltaSize() const
+    {
+        size_t result = 0;
+        for (size_t i = 1; i < m_segments.size(); ++i)
+        {
+            result += m_segments[i].m_header->m_segmentSize;
+        }
+        return result;
+    }
+
+    auto AssetRegistryBinaryView::FindInSegment(const Segment& segment, const AZ::Data::AssetId& id, const AssetRecord*& record)
+        -> LookupResult
+    {
+        record = FindByKey(segment.m_assets, id);
+        if (record)
+        {
+            return LookupResult::Found;
+        }
+        return FindByKey(segment.m_removed, id) ? LookupResult::Removed : LookupResult::NotPresent;
+    }
+
+    auto AssetRegistryBinaryView::FindRecord(const AZ::Data::AssetId& id) const -> AZStd::pair<const Segment*, const AssetRecord*>
+    {
+        // Newer segments override older ones, so search from the back.
+        for (auto it = m_segments.rbegin(); it != m_segments.rend(); ++it)
+        {
+            const AssetRecord* record = nullptr;
+            switch (FindInSegment(*it, id, record))
+            {
+            case LookupResult::Found:
+                return { &*it, record };
+            case LookupResult::Removed:
+                return { nullptr, nullptr };
+            default:
+                break;
+            }
+        }
+        return { nullptr, nullptr };
+    }
+
+    AZ::Data::AssetInfo AssetRegistryBinaryView::ToAssetInfo(const Segment& segment, const AssetRecord& record)
+    {
+        AZ::Data::AssetInfo result;
+        result.m_assetId = AZ::Data::AssetId(LoadUuid(record.m_guid), record.m_subId);
+        result.m_assetType = LoadUuid(record.m_assetType);
+        result.m_sizeBytes = record.m_sizeBytes;
+        result.m_relativePath = segment.m_strings.substr(record.m_pathOffset, record.m_pathLength);
+        return result;
+    }
+
+    AZStd::vector<AZ::Data::ProductDependency> AssetRegistryBinaryView::ToDependencies(const Segment& segment, const AssetRecord& record)
+    {
+        AZStd::vector<AZ::Data::ProductDependency> result;
+        result.reserve(record.m_dependencyCount);
+        for (const DependencyRecord& dependency : segment.m_dependencies.subspan(record.m_firstDependency, record.m_dependencyCount))
+        {
+            result.emplace_back(AZ::Data::AssetId(LoadUuid(dependency.m_guid), dependency.m_subId), AZStd::bitset<64>(dependency.m_flags));
+        }
+        return result;
+    }
+
+    bool AssetRegistryBinaryView::FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        auto [segment, record] = FindRecord(id);
+        if (record)
+        {
+            assetInfo = ToAssetInfo(*segment, *record);
+            return true;
+        }
+        return false;
+    }
+
+    AZ::Data::AssetId AssetRegistryBinaryView::FindAssetIdByPath(AZStd::string_view assetPath) const
+    {
+        if (assetPath.empty())
+        {
+            return {};
+        }
+
+        const AZ::Uuid pathHash = AssetRegistryInternal::CreateUUIDForName(assetPath);
+        for (auto it = m_segments.rbegin(); it != m_segments.rend(); ++it)
+        {
+            auto found = AZStd::lower_bound(it->m_paths.begin(), it->m_paths.end(), pathHash,
+                [](const PathRecord& record, const AZ::Uuid& hash)
+                {
+                    return memcmp(record.m_pathHash, &hash, sizeof(record.m_pathHash)) < 0;
+                });
+            if (found != it->m_paths.end() && memcmp(found->m_pathHash, &pathHash, sizeof(found->m_pathHash)) == 0)
+            {
+                AZ::Data::AssetId assetId(LoadUuid(found->m_guid), found->m_subId);
+                // The path may belong to a product that a later delta removed.
+                return FindRecord(assetId).second ? assetId : AZ::Data::AssetId();
+            }
+        }
+        return {};
+    }
+
+    AZStd::vector<AZ::Data::ProductDependency> AssetRegistryBinaryView::GetAssetDependencies(const AZ::Data::AssetId& id) const
+    {
+        auto [segment, record] = FindRecord(id);
+        return record ? ToDependencies(*segment, *record) : AZStd::vector<AZ::Data::ProductDependency>{};
+    }
+
+    void AssetRegistryBinaryView::ToAssetRegistry(AssetRegistry& registry) const
+    {
+        for (const Segment& segment : m_segments)
+        {
+            for (const RemovedRecord& removed : segment.m_removed)
+            {
+                registry.UnregisterAsset(AZ::Data::AssetId(LoadUuid(removed.m_guid), removed.m_subId));
+            }
+
+            for (const AssetRecord& record : segment.m_assets)
+            {
+                AZ::Data::AssetInfo assetInfo = ToAssetInfo(segment, record);
+                AZ::Data::AssetId assetId = assetInfo.m_assetId;
+                registry.RegisterAsset(assetId, assetInfo);
+                if (record.m_dependencyCount > 0)
+                {
+                    registry.SetAssetDependencies(assetId, ToDependencies(segment, record));
+                }
+                else
+                {
+                    registry.m_assetDependencies.erase(assetId);
+                }
+            }
+
+            // Applied after the products so that legacy aliases from the path table are kept as well.
+            for (const PathRecord& path : segment.m_paths)
+            {
+                registry.m_assetPathToId[LoadUuid(path.m_pathHash)] = AZ::Data::AssetId(LoadUuid(path.m_guid), path.m_subId);
+            }
+        }
+    }
+} // namespace AzFramework
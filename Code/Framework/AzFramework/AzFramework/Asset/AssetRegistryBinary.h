@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/utils.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    //! Binary representation of the AssetRegistry.
+    //! The file is a sequence of segments. The first segment is a base segment holding the full registry and
+    //! any following segments are deltas which add, replace or remove products. Every table inside a segment is
+    //! sorted and only contains fixed size records with offsets relative to the segment, so a file can be used
+    //! directly from memory (or a memory mapping) without deserializing it. Lookups are O(log n) per segment.
+    namespace AssetRegistryBinary
+    {
+        constexpr AZ::u32 Magic = 0x4243'334F; // "O3CB"
+        constexpr AZ::u16 Version = 1;
+        //! Extension of the binary catalog, which is written next to the xml catalog using the same file name.
+        constexpr const char* FileExtension = ".bin";
+        //! Alignment of every segment and table in the file.
+        constexpr size_t Alignment = alignof(AZ::u64);
+
+        enum class SegmentKind : AZ::u16
+        {
+            Base,
+            Delta
+        };
+
+        struct SegmentHeader
+        {
+            AZ::u32 m_magic{ Magic };
+            AZ::u16 m_version{ Version };
+            SegmentKind m_kind{ SegmentKind::Base };
+            //! Total size of the segment in bytes, including this header and padding.
+            AZ::u64 m_segmentSize{ 0 };
+            AZ::u32 m_assetCount{ 0 };
+            AZ::u32 m_removedCount{ 0 };
+            AZ::u32 m_pathCount{ 0 };
+            AZ::u32 m_dependencyCount{ 0 };
+            AZ::u64 m_stringTableSize{ 0 };
+            AZ::u64 m_reserved[3]{};
+        };
+        static_assert(sizeof(SegmentHeader) == 64, "The binary asset catalog segment header has to stay 64 bytes.");
+
+        //! Sorted by (m_guid, m_subId).
+        struct AssetRecord
+        {
+            AZ::u8 m_guid[16];
+            AZ::u8 m_assetType[16];
+            AZ::u64 m_sizeBytes;
+            AZ::u32 m_subId;
+            //! Offset and length of the relative path in the string table.
+            AZ::u32 m_pathOffset;
+            AZ::u32 m_pathLength;
+            //! Range of this asset's entries in the dependency table.
+            AZ::u32 m_firstDependency;
+            AZ::u32 m_dependencyCount;
+            AZ::u32 m_padding;
+        };
+        static_assert(sizeof(AssetRecord) == 64);
+
+        //! Products removed by a delta segment. Sorted by (m_guid, m_subId).
+        struct RemovedRecord
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u32 m_padding;
+        };
+        static_assert(sizeof(RemovedRecord) == 24);
+
+        //! Legacy path lookups. Sorted by m_pathHash, which is the same hash the AssetRegistry uses for its path map.
+        struct PathRecord
+        {
+            AZ::u8 m_pathHash[16];
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u32 m_padding;
+        };
+        static_assert(sizeof(PathRecord) == 40);
+
+        struct DependencyRecord
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u32 m_padding;
+            AZ::u64 m_flags;
+        };
+        static_assert(sizeof(DependencyRecord) == 32);
+
+        //! Returns true if the buffer starts with a binary asset catalog segment.
+        bool IsBinaryCatalog(AZStd::span<const char> data);
+    } // namespace AssetRegistryBinary
+
+    //! Serializes an AssetRegistry into binary asset catalog segments.
+    class AssetRegistryBinaryWriter
+    {
+    public:
+        //! Appends a base segment holding every product and path in the registry to output.
+        static void WriteBaseSegment(AZStd::vector<char>& output, const AssetRegistry& registry);
+
+        //! Appends a delta segment to output. Products in changedAssets are written with their current info and
+        //! dependencies from registry and replace any older entry. Products in removedAssets are marked as removed.
+        static void WriteDeltaSegment(
+            AZStd::vector<char>& output,
+            const AssetRegistry& registry,
+            const AZStd::unordered_set<AZ::Data::AssetId>& changedAssets,
+            const AZStd::unordered_set<AZ::Data::AssetId>& removedAssets);
+    };
+
+    //! Read-only view over a binary asset catalog stored in memory.
+    //! The view doesn't own the memory, the caller has to keep it alive for as long as the view is used.
+    //! The lookups are meant for tools that only need a few entries. The runtime AssetCatalog merges the view into its
+    //! AssetRegistry with ToAssetRegistry, because deltas from the Asset Processor and most catalog queries work on that
+    //! registry. For the runtime the gain over the xml catalog is the faster load, not lookups without deserializing.
+    class AssetRegistryBinaryView
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetRegistryBinaryView, AZ::SystemAllocator);
+
+        AssetRegistryBinaryView() = default;
+
+        //! Validates the segments in data and uses them for lookups. Returns false if the data is not a valid catalog,
+        //! in which case the view is left empty. The data needs to be aligned to AssetRegistryBinary::Alignment.
+        bool Attach(AZStd::span<const char> data);
+        void Detach();
+
+        bool IsAttached() const;
+        size_t GetSegmentCount() const;
+        //! Size in bytes of the base segment.
+        size_t GetBaseSize() const;
+        //! Combined size in bytes of all the delta segments.
+        size_t GetDeltaSize() const;
+
+        bool FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        AZ::Data::AssetId FindAssetIdByPath(AZStd::string_view assetPath) const;
+        AZStd::vector<AZ::Data::ProductDependency> GetAssetDependencies(const AZ::Data::AssetId& id) const;
+
+        //! Merges all segments into the provided registry. This is used to compact a catalog and by
+        //! the runtime catalog which needs the full registry in memory.
+        void ToAssetRegistry(AssetRegistry& registry) const;
+
+    private:
+        struct Segment
+        {
+            const AssetRegistryBinary::SegmentHeader* m_header{ nullptr };
+            AZStd::span<const AssetRegistryBinary::AssetRecord> m_assets;
+            AZStd::span<const AssetRegistryBinary::RemovedRecord> m_removed;
+            AZStd::span<const AssetRegistryBinary::PathRecord> m_paths;
+            AZStd::span<const AssetRegistryBinary::DependencyRecord> m_dependencies;
+            AZStd::string_view m_strings;
+        };
+
+        enum class LookupResult
+        {
+            NotPresent,
+            Found,
+            Removed
+        };
+
+        static LookupResult FindInSegment(const Segment& segment, const AZ::Data::AssetId& id, const AssetRegistryBinary::AssetRecord*& record);
+        //! Finds the newest record for the product across all segments or nullptr if it doesn't exist or was removed.
+        AZStd::pair<const Segment*, const AssetRegistryBinary::AssetRecord*> FindRecord(const AZ::Data::AssetId& id) const;
+        static AZ::Data::AssetInfo ToAssetInfo(const Segment& segment, const AssetRegistryBinary::AssetRecord& record);
+        static AZStd::vector<AZ::Data::ProductDependency> ToDependencies(const Segment& segment, const AssetRegistryBinary::AssetRecord& record);
+
+        AZStd::vector<Segment> m_segments;
+    };
+} // namespace AzFramework
@@ -9,6 +9,8 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -77,6 +79,11 @@ namespace AzFramework
             return m_rootSpawnableContainer.GetCurrentGeneration();
         }
 
+        // Start before queuing the root spawnable so its own load is recorded and the prefetches are queued before the
+        // dependencies are discovered.
+        BeginRootSpawnablePrefetch(rootSpawnable.GetId());
+
+        m_rootSpawnableAssignTime = AZStd::chrono::steady_clock::now();
         if (rootSpawnable.QueueLoad())
         {
             m_rootSpawnableId = rootSpawnable.GetId();
@@ -112,6 +119,7 @@ namespace AzFramework
         }
         else
         {
+            EndRootSpawnablePrefetch(false);
             AZ_Error("Spawnables", false, "Unable to queue root spawnable '%s' for loading.", rootSpawnable.GetHint().c_str());
         }
 
@@ -130,6 +138,7 @@ namespace AzFramework
             m_rootSpawnableContainer.Clear();
         }
         m_rootSpawnableId = AZ::Data::AssetId();
+        EndRootSpawnablePrefetch(false);
     }
 
     void SpawnableSystemComponent::ProcessSpawnableQueue()
@@ -159,6 +168,16 @@ namespace AzFramework
         [[maybe_unused]] AZ::Data::Asset<Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
     {
         AZ_TracePrintf("Spawnables", "Entities from new root spawnable '%s' are ready (generation: %i).\n", rootSpawnable.GetHint().c_str(), generation);
+
+        // Ready notifications are queued, so ignore the ones for root spawnables that have already been replaced.
+        if (rootSpawnable.GetId() == m_rootSpawnableId)
+        {
+            [[maybe_unused]] auto timeToReady = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(
+                AZStd::chrono::steady_clock::now() - m_rootSpawnableAssignTime);
+            AZ_TracePrintf("Spawnables", "Root spawnable '%s' took %lld ms to become ready.\n", rootSpawnable.GetHint().c_str(),
+                static_cast<long long>(timeToReady.count()));
+            EndRootSpawnablePrefetch(true);
+        }
     }
 
     void SpawnableSystemComponent::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
@@ -228,6 +247,86 @@ namespace AzFramework
         AZ::Data::AssetManager::Instance().UnregisterHandler(&m_assetHandler);
     }
 
+    void SpawnableSystemComponent::BeginRootSpawnablePrefetch(const AZ::Data::AssetId& rootSpawnableId)
+    {
+        EndRootSpawnablePrefetch(false);
+
+        auto registry = AZ::SettingsRegistry::Get();
+        if (!registry || !rootSpawnableId.IsValid())
+        {
+            return;
+        }
+
+        AZ::SettingsRegistryInterface::FixedValueString key(PrefetchManifestRegistryKey);
+        const size_t keyLength = key.size();
+        bool record = false;
+        registry->Get(record, key.append("/Record"));
+        key.resize(keyLength);
+        bool prefetch = false;
+        registry->Get(prefetch, key.append("/Prefetch"));
+        key.resize(keyLength);
+        AZ::s64 deadlineOffsetMs = 0;
+        registry->Get(deadlineOffsetMs, key.append("/DeadlineOffsetMs"));
+
+        // Loads are recorded when they're queued, so assets that were prefetched wouldn't show up in the recording. Recording
+        // therefore takes precedence over prefetching.
+        if (prefetch && !record)
+        {
+            AZStd::string manifestPath = GetPrefetchManifestPath(rootSpawnableId);
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            if (fileIO && fileIO->Exists(manifestPath.c_str()))
+            {
+                AZ::Data::AssetPrefetchManifest manifest;
+                auto result = AZ::JsonSerializationUtils::LoadObjectFromFile(manifest, manifestPath);
+                if (result.IsSuccess())
+                {
+                    m_prefetchedAssets = AZ::Data::AssetManager::Instance().PrefetchAssets(
+                        manifest, AZStd::chrono::milliseconds(AZStd::max<AZ::s64>(deadlineOffsetMs, 0)));
+                    AZ_TracePrintf("Spawnables", "Prefetching %zu assets from '%s'.\n", m_prefetchedAssets.size(), manifestPath.c_str());
+                }
+                else
+                {
+                    AZ_Warning("Spawnables", false, "Unable to load prefetch manifest '%s': %s", manifestPath.c_str(),
+                        result.GetError().c_str());
+                }
+            }
+        }
+
+        if (record)
+        {
+            AZ::Data::AssetManager::Instance().StartLoadRecording();
+            m_recordingSpawnableId = rootSpawnableId;
+        }
+    }
+
+    void SpawnableSystemComponent::EndRootSpawnablePrefetch(bool saveManifest)
+    {
+        if (m_recordingSpawnableId.IsValid())
+        {
+            AZ::Data::AssetPrefetchManifest manifest = AZ::Data::AssetManager::Instance().StopLoadRecording();
+            if (saveManifest && !manifest.m_entries.empty())
+            {
+                AZStd::string manifestPath = GetPrefetchManifestPath(m_recordingSpawnableId);
+                auto result = AZ::JsonSerializationUtils::SaveObjectToFile(&manifest, manifestPath);
+                AZ_Warning("Spawnables", result.IsSuccess(), "Unable to save prefetch manifest '%s': %s", manifestPath.c_str(),
+                    result.IsSuccess() ? "" : result.GetError().c_str());
+            }
+            m_recordingSpawnableId = AZ::Data::AssetId();
+        }
+        m_prefetchedAssets = {};
+    }
+
+    AZStd::string SpawnableSystemComponent::GetPrefetchManifestPath(const AZ::Data::AssetId& rootSpawnableId)
+    {
+        AZStd::string folder = PrefetchManifestDefaultFolder;
+        if (auto registry = AZ::SettingsRegistry::Get(); registry)
+        {
+            registry->Get(folder, AZ::SettingsRegistryInterface::FixedValueString(PrefetchManifestRegistryKey) + "/Folder");
+        }
+        return AZStd::string::format("%s/%s_%08x%s", folder.c_str(),
+            rootSpawnableId.m_guid.ToFixedString(false, false).c_str(), rootSpawnableId.m_subId, PrefetchManifestExtension);
+    }
+
     void SpawnableSystemComponent::LoadRootSpawnableFromSettingsRegistry()
     {
         auto registry = AZ::SettingsRegistry::Get();
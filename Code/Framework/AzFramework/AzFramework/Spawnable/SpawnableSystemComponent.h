@@ -31,6 +31,13 @@ namespace AzFramework
         AZ_COMPONENT(SpawnableSystemComponent, "{12D0DA52-BB86-4AC3-8862-9493E0D0E207}");
 
         inline static constexpr const char* RootSpawnableRegistryKey = "/Amazon/AzCore/Bootstrap/RootSpawnable";
+        //! Settings for the asset load manifests that are recorded while a root spawnable is loading and used to prefetch the
+        //! assets on later loads of the same root spawnable. Supports the bools "Record" and "Prefetch", the string "Folder"
+        //! to store the manifests in and the integer "DeadlineOffsetMs" that's added to the recorded load times. When both
+        //! "Record" and "Prefetch" are enabled only the recording is done.
+        inline static constexpr const char* PrefetchManifestRegistryKey = "/O3DE/AzFramework/Spawnables/PrefetchManifest";
+        inline static constexpr const char* PrefetchManifestDefaultFolder = "@user@/PrefetchManifests";
+        inline static constexpr const char* PrefetchManifestExtension = ".prefetch.json";
             
         SpawnableSystemComponent() = default;
         SpawnableSystemComponent(const SpawnableSystemComponent&) = delete;
@@ -84,6 +91,12 @@ namespace AzFramework
 
         void LoadRootSpawnableFromSettingsRegistry();
 
+        //! Starts recording asset loads for the root spawnable and queues the loads from a previously recorded manifest.
+        void BeginRootSpawnablePrefetch(const AZ::Data::AssetId& rootSpawnableId);
+        //! Stops recording asset loads, optionally storing the recorded manifest, and releases the prefetched assets.
+        void EndRootSpawnablePrefetch(bool saveManifest);
+        static AZStd::string GetPrefetchManifestPath(const AZ::Data::AssetId& rootSpawnableId);
+
         SpawnableAssetHandler m_assetHandler;
         SpawnableEntitiesManager m_entitiesManager;
         SpawnableEntitiesContainer m_rootSpawnableContainer;
@@ -91,6 +104,13 @@ namespace AzFramework
 
         AZ::Data::AssetId m_rootSpawnableId;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_criticalAssetsHandler;
+
+        //! Keeps the assets from the prefetch manifest alive until the root spawnable is ready.
+        AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>> m_prefetchedAssets;
+        //! The root spawnable the AssetManager is currently recording loads for, if any.
+        AZ::Data::AssetId m_recordingSpawnableId;
+        //! Time at which the current root spawnable was assigned, used to report how long it took for it to become ready.
+        AZStd::chrono::steady_clock::time_point m_rootSpawnableAssignTime;
     };
 } // namespace AzFramework
 
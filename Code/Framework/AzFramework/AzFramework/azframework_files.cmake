@@ -56,6 +56,8 @@ set(FILES
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
     Asset/AssetRegistry.cpp
+    Asset/AssetRegistryBinary.h
+    Asset/AssetRegistryBinary.cpp
     Asset/AssetSeedList.cpp
     Asset/AssetSeedList.h
     Asset/AssetSystemComponent.cpp
@@ -25,8 +25,10 @@
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistryBinary.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
@@ -466,6 +468,36 @@ namespace UnitTest
         EXPECT_TRUE(assetInfo.m_assetId.IsValid());
     }
 
+    TEST_F(AssetCatalogDeltaTest, LoadCatalog_TruncatedBinaryCatalog_FallsBackToXmlCatalog)
+    {
+        // A binary catalog next to the base catalog that was cut off while it was written, with an asset the xml catalog doesn't have
+        AzFramework::AssetRegistry binaryRegistry;
+        AZ::Data::AssetInfo info5;
+        info5.m_relativePath = path5;
+        binaryRegistry.RegisterAsset(asset5, info5);
+        AZStd::vector<char> binaryCatalog;
+        AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(binaryCatalog, binaryRegistry);
+        ASSERT_TRUE(AzFramework::AssetRegistryBinary::IsBinaryCatalog(binaryCatalog));
+
+        AZ::IO::FixedMaxPath binaryCatalogPath = baseCatalogPath;
+        binaryCatalogPath.ReplaceExtension(AzFramework::AssetRegistryBinary::FileExtension);
+        ASSERT_TRUE(AZ::Utils::WriteFile(AZStd::string_view(binaryCatalog.data(), binaryCatalog.size() / 2), binaryCatalogPath.Native()).IsSuccess());
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::ClearCatalog);
+        // Validating the binary catalog reports the truncation
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::LoadCatalog, baseCatalogPath.c_str());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZStd::string assetPath;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path1);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetPath, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, "");
+    }
+
     TEST_F(AssetCatalogDeltaTest, DeltaCatalogTest)
     {
         AZStd::string assetPath;
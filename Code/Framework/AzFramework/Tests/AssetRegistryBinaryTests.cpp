@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/AssetRegistryBinary.h>
+
+namespace UnitTest
+{
+    class AssetRegistryBinaryTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        static AZ::Data::AssetInfo MakeAssetInfo(const AZ::Data::AssetId& assetId, const char* path, AZ::u64 size)
+        {
+            AZ::Data::AssetInfo info;
+            info.m_assetId = assetId;
+            info.m_assetType = AZ::Uuid::CreateName("AssetRegistryBinaryTestType");
+            info.m_relativePath = path;
+            info.m_sizeBytes = size;
+            return info;
+        }
+
+        void SetUp() override
+        {
+            m_asset1 = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 0);
+            m_asset2 = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 1);
+            m_asset3 = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 2);
+
+            m_registry.RegisterAsset(m_asset1, MakeAssetInfo(m_asset1, "textures/one.streamingimage", 100));
+            m_registry.RegisterAsset(m_asset2, MakeAssetInfo(m_asset2, "materials/two.azmaterial", 200));
+            m_registry.RegisterAssetDependency(m_asset1, AZ::Data::ProductDependency(m_asset2, AZStd::bitset<64>(3)));
+        }
+
+        void TearDown() override
+        {
+            m_registry.Clear();
+            m_buffer = {};
+        }
+
+        AzFramework::AssetRegistry m_registry;
+        AZStd::vector<char> m_buffer;
+        AZ::Data::AssetId m_asset1;
+        AZ::Data::AssetId m_asset2;
+        AZ::Data::AssetId m_asset3;
+    };
+
+    TEST_F(AssetRegistryBinaryTest, BaseSegment_LookupsMatchRegistry)
+    {
+        AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(m_buffer, m_registry);
+        EXPECT_TRUE(AzFramework::AssetRegistryBinary::IsBinaryCatalog(m_buffer));
+
+        AzFramework::AssetRegistryBinaryView view;
+        ASSERT_TRUE(view.Attach(m_buffer));
+        EXPECT_EQ(1, view.GetSegmentCount());
+
+        AZ::Data::AssetInfo info;
+        ASSERT_TRUE(view.FindAssetInfo(m_asset1, info));
+        EXPECT_EQ(m_asset1, info.m_assetId);
+        EXPECT_EQ(100, info.m_sizeBytes);
+        EXPECT_STREQ("textures/one.streamingimage", info.m_relativePath.c_str());
+        EXPECT_EQ(AZ::Uuid::CreateName("AssetRegistryBinaryTestType"), info.m_assetType);
+        EXPECT_FALSE(view.FindAssetInfo(m_asset3, info));
+
+        // path lookups are case and slash insensitive, same as the AssetRegistry
+        EXPECT_EQ(m_asset2, view.FindAssetIdByPath("Materials\\Two.azmaterial"));
+        EXPECT_FALSE(view.FindAssetIdByPath("materials/missing.azmaterial").IsValid());
+
+        auto dependencies = view.GetAssetDependencies(m_asset1);
+        ASSERT_EQ(1, dependencies.size());
+        EXPECT_EQ(m_asset2, dependencies[0].m_assetId);
+        EXPECT_EQ(3, dependencies[0].m_flags.to_ullong());
+        EXPECT_TRUE(view.GetAssetDependencies(m_asset2).empty());
+    }
+
+    TEST_F(AssetRegistryBinaryTest, DeltaSegment_OverridesAndRemovesAssets)
+    {
+        AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(m_buffer, m_registry);
+        const size_t baseSize = m_buffer.size();
+
+        m_registry.RegisterAsset(m_asset3, MakeAssetInfo(m_asset3, "models/three.azmodel", 300));
+        m_registry.RegisterAsset(m_asset1, MakeAssetInfo(m_asset1, "textures/one.streamingimage", 150));
+        m_registry.SetAssetDependencies(m_asset1, {});
+        m_registry.UnregisterAsset(m_asset2);
+
+        AzFramework::AssetRegistryBinaryWriter::WriteDeltaSegment(m_buffer, m_registry, { m_asset1, m_asset3 }, { m_asset2 });
+
+        AzFramework::AssetRegistryBinaryView view;
+        ASSERT_TRUE(view.Attach(m_buffer));
+        EXPECT_EQ(2, view.GetSegmentCount());
+        EXPECT_EQ(baseSize, view.GetBaseSize());
+        EXPECT_EQ(m_buffer.size() - baseSize, view.GetDeltaSize());
+
+        AZ::Data::AssetInfo info;
+        ASSERT_TRUE(view.FindAssetInfo(m_asset1, info));
+        EXPECT_EQ(150, info.m_sizeBytes);
+        EXPECT_TRUE(view.GetAssetDependencies(m_asset1).empty());
+        EXPECT_TRUE(view.FindAssetInfo(m_asset3, info));
+        EXPECT_FALSE(view.FindAssetInfo(m_asset2, info));
+        EXPECT_FALSE(view.FindAssetIdByPath("materials/two.azmaterial").IsValid());
+        EXPECT_EQ(m_asset3, view.FindAssetIdByPath("models/three.azmodel"));
+    }
+
+    TEST_F(AssetRegistryBinaryTest, ToAssetRegistry_CompactsSegments)
+    {
+        AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(m_buffer, m_registry);
+        m_registry.RegisterAsset(m_asset3, MakeAssetInfo(m_asset3, "models/three.azmodel", 300));
+        m_registry.UnregisterAsset(m_asset2);
+        AzFramework::AssetRegistryBinaryWriter::WriteDeltaSegment(m_buffer, m_registry, { m_asset3 }, { m_asset2 });
+
+        AzFramework::AssetRegistryBinaryView view;
+        ASSERT_TRUE(view.Attach(m_buffer));
+
+        AzFramework::AssetRegistry merged;
+        view.ToAssetRegistry(merged);
+        EXPECT_EQ(2, merged.m_assetIdToInfo.size());
+        EXPECT_EQ(m_asset3, merged.GetAssetIdByPath("models/three.azmodel"));
+        EXPECT_EQ(m_asset1, merged.GetAssetIdByPath("textures/one.streamingimage"));
+        EXPECT_EQ(1, merged.GetAssetDependencies(m_asset1).size());
+
+        // writing the merged registry produces a single segment with the same content
+        AZStd::vector<char> compacted;
+        AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(compacted, merged);
+        AzFramework::AssetRegistryBinaryView compactedView;
+        ASSERT_TRUE(compactedView.Attach(compacted));
+        EXPECT_EQ(1, compactedView.GetSegmentCount());
+        AZ::Data::AssetInfo info;
+        EXPECT_TRUE(compactedView.FindAssetInfo(m_asset3, info));
+        EXPECT_FALSE(compactedView.FindAssetInfo(m_asset2, info));
+    }
+
+    TEST_F(AssetRegistryBinaryTest, Attach_TruncatedData_Fails)
+    {
+        AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(m_buffer, m_registry);
+        m_buffer.resize(m_buffer.size() - AzFramework::AssetRegistryBinary::Alignment);
+
+        AzFramework::AssetRegistryBinaryView view;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(view.Attach(m_buffer));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(view.IsAttached());
+    }
+} // namespace UnitTest
@@ -26,6 +26,7 @@ set(FILES
     OctreePerformanceTests.cpp
     OctreeTests.cpp
     AssetCatalog.cpp
+    AssetRegistryBinaryTests.cpp
     AssetProcessorConnection.cpp
     ProcessLaunchParseTests.cpp
     Application.cpp
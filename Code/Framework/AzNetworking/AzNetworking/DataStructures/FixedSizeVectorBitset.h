@@ -33,6 +33,16 @@ namespace AzNetworking
         //! @return reference to the LHS
         SelfType& operator |=(const SelfType& rhs);
 
+        //! Equality operator, two bitsets are equal if they have the same size and the same bits set.
+        //! @param rhs instance to compare against
+        //! @return boolean true if inputs are the same, false otherwise
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs instance to compare against
+        //! @return boolean true if inputs are different, false otherwise
+        bool operator !=(const SelfType& rhs) const;
+
         //! Sets the specified bit to the provided value.
         //! @param index index of the bit to set
         //! @param value value to set the bit to
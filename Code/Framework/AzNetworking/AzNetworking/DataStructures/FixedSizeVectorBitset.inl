@@ -33,6 +33,30 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator ==(const SelfType& rhs) const
+    {
+        if (GetSize() != rhs.GetSize())
+        {
+            return false;
+        }
+        uint32_t usedElementSize = (GetSize() + BitsetType::ElementTypeBits - 1) / BitsetType::ElementTypeBits;
+        for (uint32_t i = 0; i < usedElementSize; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
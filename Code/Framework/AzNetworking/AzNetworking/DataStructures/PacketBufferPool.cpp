@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AzNetworking
+{
+    PacketBufferPool::~PacketBufferPool()
+    {
+        AZ_Assert(m_availableBuffers.size() == m_allocatedCount, "PacketBufferPool destroyed while %u buffers are still in use",
+            m_allocatedCount - aznumeric_cast<uint32_t>(m_availableBuffers.size()));
+    }
+
+    PooledPacketBuffer PacketBufferPool::Acquire()
+    {
+        AZStd::unique_ptr<PacketBuffer> buffer;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            if (!m_availableBuffers.empty())
+            {
+                buffer = AZStd::move(m_availableBuffers.back());
+                m_availableBuffers.pop_back();
+            }
+            else
+            {
+                ++m_allocatedCount;
+            }
+        }
+
+        if (buffer == nullptr)
+        {
+            buffer = AZStd::make_unique<PacketBuffer>();
+        }
+        buffer->Reset();
+        return PooledPacketBuffer(this, buffer.release());
+    }
+
+    uint32_t PacketBufferPool::GetAllocatedCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_allocatedCount;
+    }
+
+    uint32_t PacketBufferPool::GetAvailableCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_availableBuffers.size());
+    }
+
+    void PacketBufferPool::Return(PacketBuffer* buffer)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_availableBuffers.emplace_back(buffer);
+    }
+}
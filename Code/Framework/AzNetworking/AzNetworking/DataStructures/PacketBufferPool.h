@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    class PacketBufferPool;
+
+    //! @class PacketBuffer
+    //! @brief byte buffer for an outgoing packet with room reserved in front of and behind the payload.
+    //! Headers and trailers, such as packet flags or the record header and MAC added by encryption, can be written around the
+    //! payload without moving it, so a packet can go from serialization to the socket without being copied between buffers.
+    class PacketBuffer
+    {
+    public:
+
+        //! Bytes reserved in front of the payload.
+        static constexpr uint32_t HeaderRoom = 64;
+
+        //! Bytes reserved behind the payload.
+        static constexpr uint32_t TrailerRoom = 128;
+
+        //! Total size of the underlying storage.
+        static constexpr uint32_t StorageSize = HeaderRoom + MaxPacketSize + TrailerRoom;
+
+        PacketBuffer() = default;
+        ~PacketBuffer() = default;
+
+        //! Returns the maximum payload size when no header room has been claimed.
+        //! @return the maximum payload size when no header room has been claimed
+        static constexpr uint32_t GetCapacity();
+
+        //! Clears the payload and restores the reserved header room.
+        void Reset();
+
+        //! Returns the payload size in bytes.
+        //! @return the payload size in bytes
+        uint32_t GetSize() const;
+
+        //! Resizes the payload, does not initialize new bytes.
+        //! @param newSize the new payload size in bytes
+        //! @return boolean true on success, false if the payload would overrun the reserved trailer room
+        bool Resize(uint32_t newSize);
+
+        //! Grows the payload to the front into the reserved header room, the existing payload is not moved.
+        //! @param headerSize the number of bytes to prepend to the payload
+        //! @return pointer to the new start of the payload, nullptr if there isn't enough header room left
+        uint8_t* ClaimHeaderRoom(uint32_t headerSize);
+
+        //! Makes the payload cover an arbitrary range of the underlying storage, used to write a packet over its own storage in place.
+        //! @param offset offset of the payload from the start of the storage
+        //! @param size   the payload size in bytes
+        //! @return boolean true on success, false if the range is outside the storage
+        bool SetPayloadRange(uint32_t offset, uint32_t size);
+
+        //! Const raw payload access.
+        //! @return const pointer to the start of the payload
+        const uint8_t* GetBuffer() const;
+
+        //! Non-const raw payload access.
+        //! @return non-const pointer to the start of the payload
+        uint8_t* GetBuffer();
+
+        //! Raw access to the start of the underlying storage, including the reserved header and trailer room.
+        //! @return non-const pointer to the start of the underlying storage
+        uint8_t* GetStorage();
+
+    private:
+
+        uint32_t m_offset = HeaderRoom;
+        uint32_t m_size = 0;
+        uint8_t m_storage[StorageSize];
+    };
+
+    //! @class PooledPacketBuffer
+    //! @brief move-only handle to a PacketBuffer, returns the buffer to its pool when released or destroyed.
+    class PooledPacketBuffer
+    {
+    public:
+
+        PooledPacketBuffer() = default;
+        PooledPacketBuffer(PacketBufferPool* pool, PacketBuffer* buffer);
+        PooledPacketBuffer(PooledPacketBuffer&& rhs);
+        ~PooledPacketBuffer();
+
+        PooledPacketBuffer& operator=(PooledPacketBuffer&& rhs);
+
+        PooledPacketBuffer(const PooledPacketBuffer&) = delete;
+        PooledPacketBuffer& operator=(const PooledPacketBuffer&) = delete;
+
+        //! Returns the buffer to its pool, the handle is empty afterwards.
+        void Release();
+
+        //! Returns true if this handle holds a buffer.
+        //! @return boolean true if this handle holds a buffer
+        bool IsValid() const;
+
+        PacketBuffer* operator->() const;
+        PacketBuffer& operator*() const;
+
+    private:
+
+        PacketBufferPool* m_pool = nullptr;
+        PacketBuffer* m_buffer = nullptr;
+    };
+
+    //! @class PacketBufferPool
+    //! @brief thread safe pool of PacketBuffers, buffers are allocated on demand and kept for reuse.
+    class PacketBufferPool
+    {
+    public:
+
+        PacketBufferPool() = default;
+        ~PacketBufferPool();
+
+        //! Acquires an empty buffer from the pool, allocating a new buffer if none are available.
+        //! @return handle to the acquired buffer
+        PooledPacketBuffer Acquire();
+
+        //! Returns the number of buffers this pool has allocated.
+        //! @return the number of buffers this pool has allocated
+        uint32_t GetAllocatedCount() const;
+
+        //! Returns the number of buffers currently available for reuse.
+        //! @return the number of buffers currently available for reuse
+        uint32_t GetAvailableCount() const;
+
+    private:
+
+        friend class PooledPacketBuffer;
+
+        //! Returns a buffer acquired from this pool.
+        //! @param buffer the buffer to return
+        void Return(PacketBuffer* buffer);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<AZStd::unique_ptr<PacketBuffer>> m_availableBuffers;
+        uint32_t m_allocatedCount = 0;
+    };
+}
+
+#include <AzNetworking/DataStructures/PacketBufferPool.inl>
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline constexpr uint32_t PacketBuffer::GetCapacity()
+    {
+        return MaxPacketSize;
+    }
+
+    inline void PacketBuffer::Reset()
+    {
+        m_offset = HeaderRoom;
+        m_size = 0;
+    }
+
+    inline uint32_t PacketBuffer::GetSize() const
+    {
+        return m_size;
+    }
+
+    inline bool PacketBuffer::Resize(uint32_t newSize)
+    {
+        if (m_offset + newSize > StorageSize)
+        {
+            return false;
+        }
+        m_size = newSize;
+        return true;
+    }
+
+    inline uint8_t* PacketBuffer::ClaimHeaderRoom(uint32_t headerSize)
+    {
+        if (headerSize > m_offset)
+        {
+            return nullptr;
+        }
+        m_offset -= headerSize;
+        m_size += headerSize;
+        return GetBuffer();
+    }
+
+    inline bool PacketBuffer::SetPayloadRange(uint32_t offset, uint32_t size)
+    {
+        if ((offset > StorageSize) || (size > StorageSize - offset))
+        {
+            return false;
+        }
+        m_offset = offset;
+        m_size = size;
+        return true;
+    }
+
+    inline const uint8_t* PacketBuffer::GetBuffer() const
+    {
+        return m_storage + m_offset;
+    }
+
+    inline uint8_t* PacketBuffer::GetBuffer()
+    {
+        return m_storage + m_offset;
+    }
+
+    inline uint8_t* PacketBuffer::GetStorage()
+    {
+        return m_storage;
+    }
+
+    inline PooledPacketBuffer::PooledPacketBuffer(PacketBufferPool* pool, PacketBuffer* buffer)
+        : m_pool(pool)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    inline PooledPacketBuffer::PooledPacketBuffer(PooledPacketBuffer&& rhs)
+        : m_pool(rhs.m_pool)
+        , m_buffer(rhs.m_buffer)
+    {
+        rhs.m_pool = nullptr;
+        rhs.m_buffer = nullptr;
+    }
+
+    inline PooledPacketBuffer::~PooledPacketBuffer()
+    {
+        Release();
+    }
+
+    inline PooledPacketBuffer& PooledPacketBuffer::operator=(PooledPacketBuffer&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Release();
+            m_pool = rhs.m_pool;
+            m_buffer = rhs.m_buffer;
+            rhs.m_pool = nullptr;
+            rhs.m_buffer = nullptr;
+        }
+        return *this;
+    }
+
+    inline void PooledPacketBuffer::Release()
+    {
+        if (m_buffer != nullptr)
+        {
+            m_pool->Return(m_buffer);
+            m_pool = nullptr;
+            m_buffer = nullptr;
+        }
+    }
+
+    inline bool PooledPacketBuffer::IsValid() const
+    {
+        return m_buffer != nullptr;
+    }
+
+    inline PacketBuffer* PooledPacketBuffer::operator->() const
+    {
+        return m_buffer;
+    }
+
+    inline PacketBuffer& PooledPacketBuffer::operator*() const
+    {
+        return *m_buffer;
+    }
+}
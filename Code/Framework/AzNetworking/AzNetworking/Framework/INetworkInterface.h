@@ -74,6 +74,10 @@ namespace AzNetworking
         //! Updates the INetworkInterface.
         virtual void Update() = 0;
 
+        //! Transmits any packets the network interface has queued for batched sending.
+        //! Update does this automatically, this should be called after sending packets outside of the network update.
+        virtual void FlushSends() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
@@ -9,9 +9,30 @@
 #pragma once
 
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/fixed_vector.h>
 
 namespace AzNetworking
 {
+    //! Maximum number of sockets a network interface can spread incoming traffic over.
+    static constexpr uint32_t MaxNetworkInterfaceShards = 16;
+
+    //! Metrics for one of the sockets of a network interface that listens on several SO_REUSEPORT sockets.
+    struct NetworkInterfaceShardMetrics
+    {
+        //! Returns the total number of packets sent on this shard's socket.
+        uint64_t m_sendPackets = 0;
+        //! Returns the total number of bytes sent on this shard's socket.
+        uint64_t m_sendBytes = 0;
+        //! Returns the total number of packets received on this shard's socket.
+        uint64_t m_recvPackets = 0;
+        //! Returns the total number of bytes received on this shard's socket.
+        uint64_t m_recvBytes = 0;
+        //! Returns the total number of packets decrypted and decompressed by this shard.
+        uint64_t m_decodedPackets = 0;
+        //! Returns the total number of milliseconds this shard spent decrypting and decompressing packets.
+        AZ::TimeMs m_decodeTimeMs = AZ::Time::ZeroTimeMs;
+    };
+
     struct NetworkInterfaceMetrics
     {
         //! Returns the total number of milliseconds spent updating this network interface.
@@ -34,6 +55,8 @@ namespace AzNetworking
         int64_t m_sendBytesCompressedDelta = 0;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
+        //! Returns the total number of times outgoing packet data was copied between buffers after serialization.
+        uint64_t m_sendPacketCopies = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
@@ -46,5 +69,7 @@ namespace AzNetworking
         uint64_t m_recvBytesUncompressed = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
+        //! Per socket metrics, this is empty unless the interface is listening on more than one socket.
+        AZStd::fixed_vector<NetworkInterfaceShardMetrics, MaxNetworkInterfaceShards> m_shards;
     };
 }
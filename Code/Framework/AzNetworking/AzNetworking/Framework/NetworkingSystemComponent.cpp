@@ -199,12 +199,23 @@ namespace AzNetworking
             AZLOG_INFO(" - Total sent bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytesUncompressed));
             AZLOG_INFO(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
             AZLOG_INFO(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
+            AZLOG_INFO(" - Total sent packet copies: %llu (%.2f per packet)", aznumeric_cast<AZ::u64>(metrics.m_sendPacketCopies),
+                (metrics.m_sendPackets > 0) ? aznumeric_cast<double>(metrics.m_sendPacketCopies) / aznumeric_cast<double>(metrics.m_sendPackets) : 0.0);
             AZLOG_INFO(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
             AZLOG_INFO(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
             AZLOG_INFO(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+            for (size_t shard = 0; shard < metrics.m_shards.size(); ++shard)
+            {
+                const NetworkInterfaceShardMetrics& shardMetrics = metrics.m_shards[shard];
+                AZLOG_INFO(" - Shard %u: sent %llu packets (%llu bytes), received %llu packets (%llu bytes), decoded %llu packets in %lld ms",
+                    aznumeric_cast<uint32_t>(shard),
+                    aznumeric_cast<AZ::u64>(shardMetrics.m_sendPackets), aznumeric_cast<AZ::u64>(shardMetrics.m_sendBytes),
+                    aznumeric_cast<AZ::u64>(shardMetrics.m_recvPackets), aznumeric_cast<AZ::u64>(shardMetrics.m_recvBytes),
+                    aznumeric_cast<AZ::u64>(shardMetrics.m_decodedPackets), aznumeric_cast<AZ::s64>(shardMetrics.m_decodeTimeMs));
+            }
         }
     }
 }
@@ -0,0 +1,886 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BaselineDeltaSerializer.h>
+#include <AzCore/std/typetraits/is_signed.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <math.h>
+#include <string.h>
+
+namespace AzNetworking
+{
+    // Encoded delta layout:
+    //   uint8    flags
+    //   uint32   float quantum (little endian IEEE bits, only present if FlagFloatQuantum is set)
+    //   varint   number of change runs
+    //   varint[] change run lengths, alternating unchanged and changed, starting with an unchanged run
+    //   bytes    encoded values of every changed value, in serialization order
+    static constexpr uint8_t FlagFloatQuantum = 0x01;
+    static constexpr uint32_t MaxVarintBytes = 10;
+
+    // Quantized float deltas larger than this fall back to sending the raw value
+    static constexpr double MaxQuantizedSteps = static_cast<double>(1 << 30);
+
+    static uint64_t ZigZagEncode(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    static int64_t ZigZagDecode(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    static void AppendVarint(AZStd::vector<uint8_t>& buffer, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            buffer.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<uint8_t>(value));
+    }
+
+    static void AppendFixed32(AZStd::vector<uint8_t>& buffer, uint32_t value)
+    {
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            buffer.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    static bool WriteVarint(uint8_t* buffer, uint32_t bufferCapacity, uint32_t& inOutOffset, uint64_t value)
+    {
+        do
+        {
+            if (inOutOffset >= bufferCapacity)
+            {
+                return false;
+            }
+            buffer[inOutOffset++] = static_cast<uint8_t>((value >= 0x80) ? (value | 0x80) : value);
+            value >>= 7;
+        } while (value > 0);
+        return true;
+    }
+
+    static uint32_t FloatToBits(float value)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static float BitsToFloat(uint32_t bits)
+    {
+        float value = 0.0f;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Maps IEEE bit patterns to integers that are ordered like the floats they represent, so nearby values have small deltas.
+    // Negative zero and positive zero map to different integers, which keeps the encoding lossless.
+    static int64_t FloatBitsToOrdered(uint64_t bits, uint64_t signBit)
+    {
+        const uint64_t magnitude = bits & (signBit - 1);
+        return (bits & signBit) ? -static_cast<int64_t>(magnitude) - 1 : static_cast<int64_t>(magnitude);
+    }
+
+    static uint64_t OrderedToFloatBits(int64_t ordered, uint64_t signBit)
+    {
+        return (ordered < 0) ? (static_cast<uint64_t>(-(ordered + 1)) | signBit) : static_cast<uint64_t>(ordered);
+    }
+
+    static constexpr uint64_t FloatSignBit = 0x80000000u;
+    static constexpr uint64_t DoubleSignBit = 0x8000000000000000ull;
+
+    template <typename TYPE>
+    static constexpr SerializerBaseline::ValueType GetIntegerValueType()
+    {
+        if constexpr (AZStd::is_same_v<TYPE, bool>)
+        {
+            return SerializerBaseline::ValueType::Bool;
+        }
+        else if constexpr (AZStd::is_signed_v<TYPE>)
+        {
+            return (sizeof(TYPE) == 1) ? SerializerBaseline::ValueType::Int8
+                 : (sizeof(TYPE) == 2) ? SerializerBaseline::ValueType::Int16
+                 : (sizeof(TYPE) == 4) ? SerializerBaseline::ValueType::Int32
+                 : SerializerBaseline::ValueType::Int64;
+        }
+        else
+        {
+            return (sizeof(TYPE) == 1) ? SerializerBaseline::ValueType::Uint8
+                 : (sizeof(TYPE) == 2) ? SerializerBaseline::ValueType::Uint16
+                 : (sizeof(TYPE) == 4) ? SerializerBaseline::ValueType::Uint32
+                 : SerializerBaseline::ValueType::Uint64;
+        }
+    }
+
+    template <typename TYPE>
+    static uint64_t IntegerToBits(TYPE value)
+    {
+        if constexpr (AZStd::is_same_v<TYPE, bool>)
+        {
+            return value ? 1 : 0;
+        }
+        else if constexpr (AZStd::is_signed_v<TYPE>)
+        {
+            return static_cast<uint64_t>(static_cast<int64_t>(value));
+        }
+        else
+        {
+            return static_cast<uint64_t>(value);
+        }
+    }
+
+    template <typename TYPE>
+    static TYPE BitsToInteger(uint64_t bits)
+    {
+        if constexpr (AZStd::is_same_v<TYPE, bool>)
+        {
+            return bits != 0;
+        }
+        else if constexpr (AZStd::is_signed_v<TYPE>)
+        {
+            return static_cast<TYPE>(static_cast<int64_t>(bits));
+        }
+        else
+        {
+            return static_cast<TYPE>(bits);
+        }
+    }
+
+    void SerializerBaseline::Clear()
+    {
+        m_values.clear();
+        m_bytes.clear();
+    }
+
+    bool SerializerBaseline::IsEmpty() const
+    {
+        return m_values.empty();
+    }
+
+    uint32_t SerializerBaseline::GetValueCount() const
+    {
+        return static_cast<uint32_t>(m_values.size());
+    }
+
+    const SerializerBaseline::Value* SerializerBaseline::GetValue(uint32_t index, ValueType type) const
+    {
+        if ((index < m_values.size()) && (m_values[index].m_type == type))
+        {
+            return &m_values[index];
+        }
+        return nullptr;
+    }
+
+    const uint8_t* SerializerBaseline::GetBytes(const Value& value) const
+    {
+        return m_bytes.data() + value.m_bits;
+    }
+
+    void SerializerBaseline::AddValue(ValueType type, uint64_t bits)
+    {
+        m_values.push_back(Value{ type, bits, 0 });
+    }
+
+    void SerializerBaseline::AddBytes(const uint8_t* buffer, uint32_t byteCount)
+    {
+        m_values.push_back(Value{ ValueType::Bytes, static_cast<uint64_t>(m_bytes.size()), byteCount });
+        m_bytes.insert(m_bytes.end(), buffer, buffer + byteCount);
+    }
+
+    BaselineDeltaSerializerCreate::BaselineDeltaSerializerCreate(const SerializerBaseline& baseline, SerializerBaseline& outCurrent, float floatQuantum)
+        : m_baseline(baseline)
+        , m_current(outCurrent)
+        , m_floatQuantum(floatQuantum > 0.0f ? floatQuantum : 0.0f)
+        , m_runLengths(1, 0)
+    {
+        m_current.Clear();
+    }
+
+    bool BaselineDeltaSerializerCreate::WriteDelta(uint8_t* buffer, uint32_t bufferCapacity, uint32_t& outSize) const
+    {
+        outSize = 0;
+        if (!m_serializerValid || (bufferCapacity == 0))
+        {
+            return false;
+        }
+
+        uint32_t offset = 0;
+        buffer[offset++] = (m_floatQuantum > 0.0f) ? FlagFloatQuantum : 0;
+        if (m_floatQuantum > 0.0f)
+        {
+            if (offset + 4 > bufferCapacity)
+            {
+                return false;
+            }
+            const uint32_t quantumBits = FloatToBits(m_floatQuantum);
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                buffer[offset++] = static_cast<uint8_t>(quantumBits >> (i * 8));
+            }
+        }
+
+        // A trailing unchanged run carries no information for the receiver
+        uint32_t runCount = static_cast<uint32_t>(m_runLengths.size());
+        if ((runCount & 1) == 1)
+        {
+            --runCount;
+        }
+
+        if (!WriteVarint(buffer, bufferCapacity, offset, runCount))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < runCount; ++i)
+        {
+            if (!WriteVarint(buffer, bufferCapacity, offset, m_runLengths[i]))
+            {
+                return false;
+            }
+        }
+
+        if (offset + m_valueBytes.size() > bufferCapacity)
+        {
+            return false;
+        }
+        if (!m_valueBytes.empty())
+        {
+            memcpy(buffer + offset, m_valueBytes.data(), m_valueBytes.size());
+            offset += static_cast<uint32_t>(m_valueBytes.size());
+        }
+
+        outSize = offset;
+        return true;
+    }
+
+    SerializerMode BaselineDeltaSerializerCreate::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(int8_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] int8_t minValue, [[maybe_unused]] int8_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(int16_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] int16_t minValue, [[maybe_unused]] int16_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(int32_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] int32_t minValue, [[maybe_unused]] int32_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(long& value, [[maybe_unused]] const char* name, [[maybe_unused]] long minValue, [[maybe_unused]] long maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(AZ::s64& value, [[maybe_unused]] const char* name, [[maybe_unused]] AZ::s64 minValue, [[maybe_unused]] AZ::s64 maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(uint8_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] uint8_t minValue, [[maybe_unused]] uint8_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(uint16_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] uint16_t minValue, [[maybe_unused]] uint16_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(uint32_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] uint32_t minValue, [[maybe_unused]] uint32_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(unsigned long& value, [[maybe_unused]] const char* name, [[maybe_unused]] unsigned long minValue, [[maybe_unused]] unsigned long maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(AZ::u64& value, [[maybe_unused]] const char* name, [[maybe_unused]] AZ::u64 minValue, [[maybe_unused]] AZ::u64 maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        return SerializeFloat(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        return SerializeDouble(value);
+    }
+
+    bool BaselineDeltaSerializerCreate::SerializeBytes(uint8_t* buffer, [[maybe_unused]] uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), SerializerBaseline::ValueType::Bytes);
+        const bool changed = (baseValue == nullptr)
+                          || (baseValue->m_byteCount != outSize)
+                          || ((outSize > 0) && (memcmp(m_baseline.GetBytes(*baseValue), buffer, outSize) != 0));
+        PushChanged(changed);
+        if (changed)
+        {
+            AppendVarint(m_valueBytes, outSize);
+            m_valueBytes.insert(m_valueBytes.end(), buffer, buffer + outSize);
+        }
+        m_current.AddBytes(buffer, outSize);
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerCreate::BeginObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    bool BaselineDeltaSerializerCreate::EndObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    const uint8_t* BaselineDeltaSerializerCreate::GetBuffer() const
+    {
+        return nullptr;
+    }
+
+    uint32_t BaselineDeltaSerializerCreate::GetCapacity() const
+    {
+        return 0;
+    }
+
+    uint32_t BaselineDeltaSerializerCreate::GetSize() const
+    {
+        return static_cast<uint32_t>(m_valueBytes.size());
+    }
+
+    template <typename TYPE>
+    bool BaselineDeltaSerializerCreate::SerializeInteger(TYPE value)
+    {
+        constexpr SerializerBaseline::ValueType valueType = GetIntegerValueType<TYPE>();
+        const uint64_t bits = IntegerToBits(value);
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), valueType);
+        const bool changed = (baseValue == nullptr) || (baseValue->m_bits != bits);
+        PushChanged(changed);
+
+        // A changed bool with a baseline can only have flipped, so it doesn't need any value bytes
+        const bool isFlippedBool = (valueType == SerializerBaseline::ValueType::Bool) && (baseValue != nullptr);
+        if (changed && !isFlippedBool)
+        {
+            const uint64_t baseBits = (baseValue != nullptr) ? baseValue->m_bits : 0;
+            AppendVarint(m_valueBytes, ZigZagEncode(static_cast<int64_t>(bits - baseBits)));
+        }
+        m_current.AddValue(valueType, bits);
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerCreate::SerializeFloat(float value)
+    {
+        const uint32_t bits = FloatToBits(value);
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), SerializerBaseline::ValueType::Float);
+        const uint32_t baseBits = (baseValue != nullptr) ? static_cast<uint32_t>(baseValue->m_bits) : 0;
+
+        if (m_floatQuantum <= 0.0f)
+        {
+            const bool changed = (baseValue == nullptr) || (baseBits != bits);
+            PushChanged(changed);
+            if (changed)
+            {
+                const int64_t delta = FloatBitsToOrdered(bits, FloatSignBit) - FloatBitsToOrdered(baseBits, FloatSignBit);
+                AppendVarint(m_valueBytes, ZigZagEncode(delta));
+            }
+            m_current.AddValue(SerializerBaseline::ValueType::Float, bits);
+            return m_serializerValid;
+        }
+
+        // Quantized deltas are lossy, the baseline records the value the receiver reconstructs so that errors don't accumulate
+        const double baseFloat = static_cast<double>(BitsToFloat(baseBits));
+        const double steps = round((static_cast<double>(value) - baseFloat) / static_cast<double>(m_floatQuantum));
+        const float quantized = static_cast<float>(baseFloat + steps * static_cast<double>(m_floatQuantum));
+        if (isfinite(value) && isfinite(baseFloat) && (fabs(steps) <= MaxQuantizedSteps) && isfinite(quantized))
+        {
+            const int64_t quantizedSteps = static_cast<int64_t>(steps);
+            const bool changed = (baseValue == nullptr) || (quantizedSteps != 0);
+            PushChanged(changed);
+            if (changed)
+            {
+                // The low bit distinguishes quantized steps from raw values
+                AppendVarint(m_valueBytes, ZigZagEncode(quantizedSteps) << 1);
+            }
+            m_current.AddValue(SerializerBaseline::ValueType::Float, changed ? FloatToBits(quantized) : baseBits);
+            return m_serializerValid;
+        }
+
+        const bool changed = (baseValue == nullptr) || (baseBits != bits);
+        PushChanged(changed);
+        if (changed)
+        {
+            AppendVarint(m_valueBytes, 1);
+            AppendFixed32(m_valueBytes, bits);
+        }
+        m_current.AddValue(SerializerBaseline::ValueType::Float, bits);
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerCreate::SerializeDouble(double value)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), SerializerBaseline::ValueType::Double);
+        const bool changed = (baseValue == nullptr) || (baseValue->m_bits != bits);
+        PushChanged(changed);
+        if (changed)
+        {
+            const uint64_t baseBits = (baseValue != nullptr) ? baseValue->m_bits : 0;
+            const uint64_t delta = static_cast<uint64_t>(FloatBitsToOrdered(bits, DoubleSignBit))
+                                 - static_cast<uint64_t>(FloatBitsToOrdered(baseBits, DoubleSignBit));
+            AppendVarint(m_valueBytes, ZigZagEncode(static_cast<int64_t>(delta)));
+        }
+        m_current.AddValue(SerializerBaseline::ValueType::Double, bits);
+        return m_serializerValid;
+    }
+
+    void BaselineDeltaSerializerCreate::PushChanged(bool changed)
+    {
+        const bool isChangedRun = ((m_runLengths.size() - 1) & 1) != 0;
+        if (changed != isChangedRun)
+        {
+            m_runLengths.push_back(0);
+        }
+        ++m_runLengths.back();
+    }
+
+    BaselineDeltaSerializerApply::BaselineDeltaSerializerApply
+    (
+        const SerializerBaseline& baseline,
+        const uint8_t* buffer,
+        uint32_t bufferSize,
+        SerializerBaseline& outCurrent
+    )
+        : m_baseline(baseline)
+        , m_current(outCurrent)
+        , m_buffer(buffer)
+        , m_bufferSize(bufferSize)
+    {
+        m_current.Clear();
+
+        uint8_t flags = 0;
+        if (!ReadBytes(&flags, 1))
+        {
+            return;
+        }
+
+        if ((flags & FlagFloatQuantum) != 0)
+        {
+            uint8_t quantumBytes[4] = {};
+            if (!ReadBytes(quantumBytes, 4))
+            {
+                return;
+            }
+            const uint32_t quantumBits = quantumBytes[0] | (quantumBytes[1] << 8) | (quantumBytes[2] << 16) | (static_cast<uint32_t>(quantumBytes[3]) << 24);
+            m_floatQuantum = BitsToFloat(quantumBits);
+            if (!isfinite(m_floatQuantum) || (m_floatQuantum <= 0.0f))
+            {
+                m_serializerValid = false;
+                return;
+            }
+        }
+
+        uint64_t runCount = 0;
+        if (!ReadVarint(runCount) || (runCount > bufferSize))
+        {
+            m_serializerValid = false;
+            return;
+        }
+
+        m_runLengths.reserve(static_cast<size_t>(runCount));
+        for (uint64_t i = 0; i < runCount; ++i)
+        {
+            uint64_t runLength = 0;
+            if (!ReadVarint(runLength) || (runLength > AZStd::numeric_limits<uint32_t>::max()))
+            {
+                m_serializerValid = false;
+                return;
+            }
+            m_runLengths.push_back(static_cast<uint32_t>(runLength));
+        }
+    }
+
+    bool BaselineDeltaSerializerApply::IsComplete() const
+    {
+        if (!m_serializerValid || (m_readOffset != m_bufferSize))
+        {
+            return false;
+        }
+
+        // Every remaining run must be empty
+        for (uint32_t i = m_runIndex; i < m_runLengths.size(); ++i)
+        {
+            const uint32_t consumed = (i == m_runIndex) ? m_runConsumed : 0;
+            if (m_runLengths[i] > consumed)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    SerializerMode BaselineDeltaSerializerApply::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(int8_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] int8_t minValue, [[maybe_unused]] int8_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(int16_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] int16_t minValue, [[maybe_unused]] int16_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(int32_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] int32_t minValue, [[maybe_unused]] int32_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(long& value, [[maybe_unused]] const char* name, [[maybe_unused]] long minValue, [[maybe_unused]] long maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(AZ::s64& value, [[maybe_unused]] const char* name, [[maybe_unused]] AZ::s64 minValue, [[maybe_unused]] AZ::s64 maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(uint8_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] uint8_t minValue, [[maybe_unused]] uint8_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(uint16_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] uint16_t minValue, [[maybe_unused]] uint16_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(uint32_t& value, [[maybe_unused]] const char* name, [[maybe_unused]] uint32_t minValue, [[maybe_unused]] uint32_t maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(unsigned long& value, [[maybe_unused]] const char* name, [[maybe_unused]] unsigned long minValue, [[maybe_unused]] unsigned long maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(AZ::u64& value, [[maybe_unused]] const char* name, [[maybe_unused]] AZ::u64 minValue, [[maybe_unused]] AZ::u64 maxValue)
+    {
+        return SerializeInteger(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        return SerializeFloat(value);
+    }
+
+    bool BaselineDeltaSerializerApply::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        return SerializeDouble(value);
+    }
+
+    bool BaselineDeltaSerializerApply::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), SerializerBaseline::ValueType::Bytes);
+        bool changed = false;
+        if (!PopChanged(changed))
+        {
+            return false;
+        }
+
+        const uint8_t* source = nullptr;
+        uint32_t byteCount = 0;
+        if (changed)
+        {
+            uint64_t encodedCount = 0;
+            if (!ReadVarint(encodedCount) || (encodedCount > bufferCapacity) || (m_readOffset + encodedCount > m_bufferSize))
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            byteCount = static_cast<uint32_t>(encodedCount);
+            source = m_buffer + m_readOffset;
+            m_readOffset += byteCount;
+        }
+        else if ((baseValue != nullptr) && (baseValue->m_byteCount <= bufferCapacity))
+        {
+            byteCount = baseValue->m_byteCount;
+            source = m_baseline.GetBytes(*baseValue);
+        }
+        else
+        {
+            m_serializerValid = false;
+            return false;
+        }
+
+        m_hasChanged |= (outSize != byteCount) || ((byteCount > 0) && (memcmp(buffer, source, byteCount) != 0));
+        if (byteCount > 0)
+        {
+            memmove(buffer, source, byteCount);
+        }
+        outSize = byteCount;
+        m_current.AddBytes(buffer, byteCount);
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerApply::BeginObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    bool BaselineDeltaSerializerApply::EndObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    const uint8_t* BaselineDeltaSerializerApply::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t BaselineDeltaSerializerApply::GetCapacity() const
+    {
+        return m_bufferSize;
+    }
+
+    uint32_t BaselineDeltaSerializerApply::GetSize() const
+    {
+        return m_readOffset;
+    }
+
+    void BaselineDeltaSerializerApply::ClearTrackedChangesFlag()
+    {
+        m_hasChanged = false;
+    }
+
+    bool BaselineDeltaSerializerApply::GetTrackedChangesFlag() const
+    {
+        return m_hasChanged;
+    }
+
+    template <typename TYPE>
+    bool BaselineDeltaSerializerApply::SerializeInteger(TYPE& value)
+    {
+        constexpr SerializerBaseline::ValueType valueType = GetIntegerValueType<TYPE>();
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), valueType);
+        bool changed = false;
+        if (!PopChanged(changed))
+        {
+            return false;
+        }
+
+        uint64_t bits = 0;
+        if (!changed)
+        {
+            if (baseValue == nullptr)
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            bits = baseValue->m_bits;
+        }
+        else if ((valueType == SerializerBaseline::ValueType::Bool) && (baseValue != nullptr))
+        {
+            bits = (baseValue->m_bits != 0) ? 0 : 1;
+        }
+        else
+        {
+            uint64_t encoded = 0;
+            if (!ReadVarint(encoded))
+            {
+                return false;
+            }
+            const uint64_t baseBits = (baseValue != nullptr) ? baseValue->m_bits : 0;
+            bits = baseBits + static_cast<uint64_t>(ZigZagDecode(encoded));
+        }
+
+        const TYPE newValue = BitsToInteger<TYPE>(bits);
+        m_hasChanged |= (newValue != value);
+        value = newValue;
+        m_current.AddValue(valueType, IntegerToBits(newValue));
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerApply::SerializeFloat(float& value)
+    {
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), SerializerBaseline::ValueType::Float);
+        const uint32_t baseBits = (baseValue != nullptr) ? static_cast<uint32_t>(baseValue->m_bits) : 0;
+        bool changed = false;
+        if (!PopChanged(changed))
+        {
+            return false;
+        }
+
+        uint32_t bits = baseBits;
+        if (!changed)
+        {
+            if (baseValue == nullptr)
+            {
+                m_serializerValid = false;
+                return false;
+            }
+        }
+        else
+        {
+            uint64_t encoded = 0;
+            if (!ReadVarint(encoded))
+            {
+                return false;
+            }
+
+            if (m_floatQuantum <= 0.0f)
+            {
+                const int64_t ordered = FloatBitsToOrdered(baseBits, FloatSignBit) + ZigZagDecode(encoded);
+                bits = static_cast<uint32_t>(OrderedToFloatBits(ordered, FloatSignBit));
+            }
+            else if ((encoded & 1) != 0)
+            {
+                uint8_t rawBytes[4] = {};
+                if (!ReadBytes(rawBytes, 4))
+                {
+                    return false;
+                }
+                bits = rawBytes[0] | (rawBytes[1] << 8) | (rawBytes[2] << 16) | (static_cast<uint32_t>(rawBytes[3]) << 24);
+            }
+            else
+            {
+                const double steps = static_cast<double>(ZigZagDecode(encoded >> 1));
+                const double baseFloat = static_cast<double>(BitsToFloat(baseBits));
+                bits = FloatToBits(static_cast<float>(baseFloat + steps * static_cast<double>(m_floatQuantum)));
+            }
+        }
+
+        const float newValue = BitsToFloat(bits);
+        m_hasChanged |= (newValue != value);
+        value = newValue;
+        m_current.AddValue(SerializerBaseline::ValueType::Float, bits);
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerApply::SerializeDouble(double& value)
+    {
+        const SerializerBaseline::Value* baseValue = m_baseline.GetValue(m_current.GetValueCount(), SerializerBaseline::ValueType::Double);
+        bool changed = false;
+        if (!PopChanged(changed))
+        {
+            return false;
+        }
+
+        uint64_t bits = 0;
+        if (!changed)
+        {
+            if (baseValue == nullptr)
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            bits = baseValue->m_bits;
+        }
+        else
+        {
+            uint64_t encoded = 0;
+            if (!ReadVarint(encoded))
+            {
+                return false;
+            }
+            const uint64_t baseBits = (baseValue != nullptr) ? baseValue->m_bits : 0;
+            const uint64_t ordered = static_cast<uint64_t>(FloatBitsToOrdered(baseBits, DoubleSignBit)) + static_cast<uint64_t>(ZigZagDecode(encoded));
+            bits = OrderedToFloatBits(static_cast<int64_t>(ordered), DoubleSignBit);
+        }
+
+        double newValue = 0.0;
+        memcpy(&newValue, &bits, sizeof(newValue));
+        m_hasChanged |= (newValue != value);
+        value = newValue;
+        m_current.AddValue(SerializerBaseline::ValueType::Double, bits);
+        return m_serializerValid;
+    }
+
+    bool BaselineDeltaSerializerApply::PopChanged(bool& outChanged)
+    {
+        if (!m_serializerValid)
+        {
+            return false;
+        }
+
+        while ((m_runIndex < m_runLengths.size()) && (m_runConsumed >= m_runLengths[m_runIndex]))
+        {
+            ++m_runIndex;
+            m_runConsumed = 0;
+        }
+
+        // Values past the last run are unchanged, the trailing unchanged run is never written
+        outChanged = (m_runIndex < m_runLengths.size()) && ((m_runIndex & 1) != 0);
+        if (m_runIndex < m_runLengths.size())
+        {
+            ++m_runConsumed;
+        }
+        return true;
+    }
+
+    bool BaselineDeltaSerializerApply::ReadVarint(uint64_t& outValue)
+    {
+        outValue = 0;
+        for (uint32_t i = 0; i < MaxVarintBytes; ++i)
+        {
+            if (m_readOffset >= m_bufferSize)
+            {
+                break;
+            }
+            const uint8_t byte = m_buffer[m_readOffset++];
+            outValue |= static_cast<uint64_t>(byte & 0x7F) << (i * 7);
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        m_serializerValid = false;
+        return false;
+    }
+
+    bool BaselineDeltaSerializerApply::ReadBytes(uint8_t* outBuffer, uint32_t byteCount)
+    {
+        if (m_readOffset + byteCount > m_bufferSize)
+        {
+            m_serializerValid = false;
+            return false;
+        }
+        memcpy(outBuffer, m_buffer + m_readOffset, byteCount);
+        m_readOffset += byteCount;
+        return true;
+    }
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    //! SerializerBaseline
+    //! Records every primitive value an object writes during serialization, in serialization order.
+    //! BaselineDeltaSerializerCreate encodes an object against a baseline both endpoints share, and BaselineDeltaSerializerApply
+    //! reconstructs the object from the encoded delta and that same baseline. Both produce the baseline for the next delta.
+    class SerializerBaseline
+    {
+    public:
+
+        enum class ValueType : uint8_t
+        {
+            Bool,
+            Int8,
+            Int16,
+            Int32,
+            Int64,
+            Uint8,
+            Uint16,
+            Uint32,
+            Uint64,
+            Float,
+            Double,
+            Bytes
+        };
+
+        struct Value
+        {
+            ValueType m_type = ValueType::Bool;
+            uint64_t m_bits = 0; //< Sign or zero extended integers, raw IEEE bits for floats, or the byte offset of a byte array
+            uint32_t m_byteCount = 0;
+        };
+
+        void Clear();
+        bool IsEmpty() const;
+        uint32_t GetValueCount() const;
+
+        //! Returns the value at the provided index, or nullptr if there is no value of the requested type at that index.
+        const Value* GetValue(uint32_t index, ValueType type) const;
+        const uint8_t* GetBytes(const Value& value) const;
+
+        void AddValue(ValueType type, uint64_t bits);
+        void AddBytes(const uint8_t* buffer, uint32_t byteCount);
+
+    private:
+
+        AZStd::vector<Value> m_values;
+        AZStd::vector<uint8_t> m_bytes;
+    };
+
+    //! A serializer that encodes an object against a SerializerBaseline.
+    //! Values equal to the baseline are skipped using run-length encoded change runs, integers are written as zig-zag varint deltas,
+    //! and floats as varint deltas in ulps, or optionally quantized to a fixed step.
+    //! The values of the serialized object, as the receiver will reconstruct them, are recorded as the baseline for the next delta.
+    //! NOTE: Objects with a changing serialization footprint are supported, but values only compress against baseline values of the same
+    //! type at the same position.
+    class BaselineDeltaSerializerCreate
+        : public ISerializer
+    {
+    public:
+
+        //! @param baseline     values the receiver already has, may be empty
+        //! @param outCurrent   receives the values of the serialized object as the receiver will reconstruct them
+        //! @param floatQuantum step float deltas are rounded to, 0 encodes floats losslessly
+        BaselineDeltaSerializerCreate(const SerializerBaseline& baseline, SerializerBaseline& outCurrent, float floatQuantum = 0.0f);
+        ~BaselineDeltaSerializerCreate() override = default;
+
+        //! Writes the encoded delta of everything serialized so far.
+        //! @param buffer         buffer to write the encoded delta into
+        //! @param bufferCapacity capacity of the buffer in bytes
+        //! @param outSize        receives the number of bytes written
+        //! @return false if the buffer was too small to hold the delta
+        bool WriteDelta(uint8_t* buffer, uint32_t bufferCapacity, uint32_t& outSize) const;
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(bool& value, const char* name) override;
+        bool Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue) override;
+        bool Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue) override;
+        bool Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue) override;
+        bool Serialize(long& value, const char* name, long minValue, long maxValue) override;
+        bool Serialize(AZ::s64& value, const char* name, AZ::s64 minValue, AZ::s64 maxValue) override;
+        bool Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(unsigned long& value, const char* name, unsigned long minValue, unsigned long maxValue) override;
+        bool Serialize(AZ::u64& value, const char* name, AZ::u64 minValue, AZ::u64 maxValue) override;
+        bool Serialize(float& value, const char* name, float minValue, float maxValue) override;
+        bool Serialize(double& value, const char* name, double minValue, double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char* name) override;
+        bool EndObject(const char* name) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override {}
+        bool GetTrackedChangesFlag() const override { return false; }
+        // ISerializer interfaces
+
+    private:
+
+        BaselineDeltaSerializerCreate(const BaselineDeltaSerializerCreate&) = delete;
+        BaselineDeltaSerializerCreate& operator=(const BaselineDeltaSerializerCreate&) = delete;
+
+        template <typename TYPE>
+        bool SerializeInteger(TYPE value);
+        bool SerializeFloat(float value);
+        bool SerializeDouble(double value);
+        void PushChanged(bool changed);
+
+    private:
+
+        const SerializerBaseline& m_baseline;
+        SerializerBaseline& m_current;
+        float m_floatQuantum = 0.0f;
+
+        //! Alternating runs of unchanged and changed values, starting with an unchanged run
+        AZStd::vector<uint32_t> m_runLengths;
+        AZStd::vector<uint8_t> m_valueBytes;
+    };
+
+    //! A serializer that reconstructs an object from a delta written by BaselineDeltaSerializerCreate and the baseline it was encoded against.
+    //! The reconstructed values are recorded as the baseline for the next delta.
+    class BaselineDeltaSerializerApply
+        : public ISerializer
+    {
+    public:
+
+        //! @param baseline   the baseline the delta was encoded against
+        //! @param buffer     the encoded delta
+        //! @param bufferSize size of the encoded delta in bytes
+        //! @param outCurrent receives the reconstructed values
+        BaselineDeltaSerializerApply(const SerializerBaseline& baseline, const uint8_t* buffer, uint32_t bufferSize, SerializerBaseline& outCurrent);
+        ~BaselineDeltaSerializerApply() override = default;
+
+        //! Returns true if the delta was valid and every encoded value was consumed by the serialized object.
+        bool IsComplete() const;
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(bool& value, const char* name) override;
+        bool Serialize(int8_t& value, const char* name, int8_t minValue, int8_t maxValue) override;
+        bool Serialize(int16_t& value, const char* name, int16_t minValue, int16_t maxValue) override;
+        bool Serialize(int32_t& value, const char* name, int32_t minValue, int32_t maxValue) override;
+        bool Serialize(long& value, const char* name, long minValue, long maxValue) override;
+        bool Serialize(AZ::s64& value, const char* name, AZ::s64 minValue, AZ::s64 maxValue) override;
+        bool Serialize(uint8_t& value, const char* name, uint8_t minValue, uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(unsigned long& value, const char* name, unsigned long minValue, unsigned long maxValue) override;
+        bool Serialize(AZ::u64& value, const char* name, AZ::u64 minValue, AZ::u64 maxValue) override;
+        bool Serialize(float& value, const char* name, float minValue, float maxValue) override;
+        bool Serialize(double& value, const char* name, double minValue, double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char* name) override;
+        bool EndObject(const char* name) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override;
+        bool GetTrackedChangesFlag() const override;
+        // ISerializer interfaces
+
+    private:
+
+        BaselineDeltaSerializerApply(const BaselineDeltaSerializerApply&) = delete;
+        BaselineDeltaSerializerApply& operator=(const BaselineDeltaSerializerApply&) = delete;
+
+        template <typename TYPE>
+        bool SerializeInteger(TYPE& value);
+        bool SerializeFloat(float& value);
+        bool SerializeDouble(double& value);
+        bool PopChanged(bool& outChanged);
+        bool ReadVarint(uint64_t& outValue);
+        bool ReadBytes(uint8_t* outBuffer, uint32_t byteCount);
+
+    private:
+
+        const SerializerBaseline& m_baseline;
+        SerializerBaseline& m_current;
+        const uint8_t* m_buffer = nullptr;
+        uint32_t m_bufferSize = 0;
+        uint32_t m_readOffset = 0;
+        float m_floatQuantum = 0.0f;
+
+        AZStd::vector<uint32_t> m_runLengths;
+        uint32_t m_runIndex = 0;
+        uint32_t m_runConsumed = 0;
+        bool m_hasChanged = false;
+    };
+}
@@ -188,6 +188,12 @@ namespace AzNetworking
         return m_listenThread.GetSocketCount() > 0;
     }
 
+    void TcpNetworkInterface::FlushSends()
+    {
+        // Tcp connections write to their sockets immediately, there is nothing queued to flush
+        ;
+    }
+
     void TcpNetworkInterface::QueueNewConnection(const PendingConnection& pendingConnection)
     {
         m_pendingConnections.PushBackItem(pendingConnection);
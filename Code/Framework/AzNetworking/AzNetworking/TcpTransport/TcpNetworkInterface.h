@@ -103,6 +103,7 @@ namespace AzNetworking
         AZ::TimeMs GetTimeoutMs() const override;
         bool IsEncrypted() const override;
         bool IsOpen() const override;
+        void FlushSends() override;
         //! @}
 
         //! Queues a new incoming connection for this network interface.
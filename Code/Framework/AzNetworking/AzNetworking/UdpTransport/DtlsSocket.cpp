@@ -69,12 +69,12 @@ namespace AzNetworking
         UdpSocket::Close();
     }
 
-    int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
+    int32_t DtlsSocket::SendInternal(const IpAddress& address, PooledPacketBuffer&& buffer, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
     {
         if (!encrypt)
         {
             // If the packet has requested to remain unencrypted then just send directly
-            return UdpSocket::SendInternal(address, data, size, encrypt, dtlsEndpoint);
+            return UdpSocket::SendInternal(address, AZStd::move(buffer), encrypt, dtlsEndpoint);
         }
 
         if (dtlsEndpoint.m_sslSocket == nullptr)
@@ -84,16 +84,26 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         // Write out the packet we were requested to send
-        SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        const uint32_t size = buffer->GetSize();
+        SSL_write(dtlsEndpoint.m_sslSocket, buffer->GetBuffer(), size);
+
+        // The write has consumed the plaintext, so the encrypted record is read back over the same buffer,
+        // the reserved header and trailer room leave space for the record header and MAC around the payload
+        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, buffer->GetStorage(), PacketBuffer::StorageSize);
+        if (sentBytesEnc <= 0)
+        {
+            AZLOG_ERROR("Failed to read encrypted packet data from the DTLS write buffer");
+            return SocketOpResultError;
+        }
+        buffer->SetPayloadRange(0, aznumeric_cast<uint32_t>(sentBytesEnc));
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
         m_sentPacketsEncrypted++;
+        m_sentPacketCopies++;
 
-        return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
+        return UdpSocket::SendInternal(address, AZStd::move(buffer), encrypt, dtlsEndpoint);
 #else
         return 0;
 #endif
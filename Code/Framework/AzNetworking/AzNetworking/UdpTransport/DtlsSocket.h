@@ -57,7 +57,7 @@ namespace AzNetworking
 
     private:
 
-        int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
+        int32_t SendInternal(const IpAddress& address, PooledPacketBuffer&& buffer, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
 
         SSL_CTX* m_sslContext = nullptr;
     };
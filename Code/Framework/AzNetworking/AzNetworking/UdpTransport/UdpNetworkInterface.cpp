@@ -17,6 +17,9 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
 
 namespace AzNetworking
@@ -38,6 +41,7 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(uint32_t, net_UdpListenShards, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Number of SO_REUSEPORT sockets, each with its own reader thread, a listening Udp interface spreads incoming traffic over. Received packets are decrypted in parallel per socket.");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -67,12 +71,19 @@ namespace AzNetworking
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+
+        AZStd::unique_ptr<SocketShard> shard = AZStd::make_unique<SocketShard>();
+        shard->m_socket = m_socket.get();
+        shard->m_readerThread = &m_readerThread;
+        m_shards.push_back(AZStd::move(shard));
+
         m_heartbeatThread.RegisterNetworkInterface(this);
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
         m_heartbeatThread.UnregisterNetworkInterface(this);
+        CloseListenShards();
         m_readerThread.UnregisterSocket(m_socket.get());
     }
 
@@ -116,9 +127,17 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
+
+        // Sharding needs a fixed port, otherwise every socket would bind to a different ephemeral port
+        const bool shardListen = AZ_TRAIT_USE_SOCKET_REUSEPORT && (net_UdpListenShards > 1) && (m_port != 0);
+        m_socket->SetReusePort(shardListen);
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
             m_readerThread.RegisterSocket(m_socket.get());
+            if (shardListen)
+            {
+                OpenListenShards();
+            }
             return true;
         }
         else
@@ -154,7 +173,7 @@ namespace AzNetworking
 
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, remoteAddress, *this, ConnectionRole::Connector);
         UdpPacketEncodingBuffer dtlsData;
-        m_socket->ConnectDtlsEndpoint(connection->GetDtlsEndpoint(), remoteAddress, dtlsData);
+        GetShardForAddress(remoteAddress).m_socket->ConnectDtlsEndpoint(connection->GetDtlsEndpoint(), remoteAddress, dtlsData);
 
         // We're initiating this connection, so go to a connecting state until we receive some kind of response so that we know it's alive and valid
         connection->m_state = ConnectionState::Connecting;
@@ -180,156 +199,78 @@ namespace AzNetworking
             return;
         }
 
+        // Send everything queued since the last update, typically the game tick's outgoing packets
+        FlushSends();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
-        if (packets == nullptr)
+        for (uint32_t shardIndex = 1; shardIndex < GetShardCount(); ++shardIndex)
+        {
+            // The first shard uses the shared reader thread, which the networking system component swaps
+            m_shards[shardIndex]->m_readerThread->SwapBuffers();
+        }
+
+        if (m_readerThread.GetReceivedPackets(m_socket.get()) == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
             return;
         }
 
-        for (uint32_t i = 0; i < packets->size(); ++i)
+        // Decrypt and decompress first, in parallel when there are several shards
+        if (GetShardCount() > 1 && AZ::JobContext::GetGlobalContext() != nullptr)
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
-            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-
-            // Don't exceed our timeslice, even if unprocessed data remains
-            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
-            {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
-                break;
-            }
-
-            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
-            if (connection == nullptr)
-            {
-                AcceptConnection(packet);
-                continue;
-            }
-
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
+            AZ::JobCompletion jobCompletion;
+            for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
             {
-                connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
-                continue;
-            }
-            
-            const ConnectionState connectionState = connection->GetConnectionState();
-            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
-            {
-                // Skip packets from disconnected connections
-                continue;
-            }
-
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
-            {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
+                AZ::Job* job = AZ::CreateJobFunction([this, shard = shard.get()]()
+                    {
+                        DecodeShardPackets(*shard);
+                    }, true /*auto delete*/, nullptr);
+                job->SetDependent(&jobCompletion);
+                job->Start();
             }
-            else if (decodedPacketSize < 0)
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
+                DecodeShardPackets(*shard);
             }
+        }
 
-            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
-            {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
-            }
+        // Then process the decoded packets on this thread, since they can accept connections and call into the connection listener
+        uint32_t totalPackets = 0;
+        for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
+        {
+            totalPackets += aznumeric_cast<uint32_t>(shard->m_decodedPackets.size());
+        }
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+        uint32_t processedPackets = 0;
+        for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
+        {
+            for (DecodedPacket& decodedPacket : shard->m_decodedPackets)
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+                // Don't exceed our timeslice, even if unprocessed data remains
+                if ((AZ::GetElapsedTimeMs() - startTimeMs) > net_UdpPacketTimeSliceMs)
                 {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
+                    break;
                 }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
-            }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
-
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
-            if (timeoutItem == nullptr)
-            {
-                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
-                continue;
+                ++processedPackets;
+                DispatchPacket(*shard, decodedPacket, startTimeMs);
             }
-            else
-            {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
-                {
-                    continue;
-                }
-
-                // Note that the serializer passed in here is unused for UDP
-                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
-                {
-                    continue;
-                }
-
-                timeoutItem->UpdateTimeoutTime(startTimeMs);
-                connection->m_timeoutCounter = 0;
+        }
 
-                PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-                {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
+        if (processedPackets < totalPackets)
+        {
+            AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(totalPackets - processedPackets), aznumeric_cast<int32_t>(totalPackets));
+            GetMetrics().m_discardedPackets += totalPackets - processedPackets;
+        }
 
-                if (handledPacket == PacketDispatchResult::Success)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
-                {
-                    // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
-                    // This will appear as a SerializationError due to the incomplete encryption handshake
-                    // If it's not an expected unencrypted type then skip it for now
-                    continue;
-                }
-                else if (handledPacket == PacketDispatchResult::Skipped)
-                {
-                    // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
-                    continue;
-                }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
-            }
+        for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
+        {
+            GetMetrics().m_recvBytesUncompressed += shard->m_recvBytesUncompressed;
         }
+
         const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
 
         // Time out any stale client connections
@@ -346,14 +287,40 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Send any acks and replies generated while processing the received packets
+        FlushSends();
+
         // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
-        GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        NetworkInterfaceMetrics& metrics = GetMetrics();
+        metrics.m_sendPackets = 0;
+        metrics.m_sendBytes = 0;
+        metrics.m_sendPacketsEncrypted = 0;
+        metrics.m_sendBytesEncryptionInflation = 0;
+        metrics.m_sendPacketCopies = m_sentFragmentCopies;
+        metrics.m_recvPackets = 0;
+        metrics.m_recvBytes = 0;
+        metrics.m_shards.clear();
+        for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
+        {
+            NetworkInterfaceShardMetrics& shardMetrics = shard->m_metrics;
+            shardMetrics.m_sendPackets = shard->m_socket->GetSentPackets();
+            shardMetrics.m_sendBytes = shard->m_socket->GetSentBytes();
+            shardMetrics.m_recvPackets = shard->m_socket->GetRecvPackets();
+            shardMetrics.m_recvBytes = shard->m_socket->GetRecvBytes();
+            if (GetShardCount() > 1)
+            {
+                metrics.m_shards.push_back(shardMetrics);
+            }
+
+            metrics.m_sendPackets += shardMetrics.m_sendPackets;
+            metrics.m_sendBytes += shardMetrics.m_sendBytes;
+            metrics.m_sendPacketsEncrypted += shard->m_socket->GetSentPacketsEncrypted();
+            metrics.m_sendBytesEncryptionInflation += shard->m_socket->GetSentBytesEncryptionInflation();
+            metrics.m_sendPacketCopies += shard->m_socket->GetSentPacketCopies();
+            metrics.m_recvPackets += shardMetrics.m_recvPackets;
+            metrics.m_recvBytes += shardMetrics.m_recvBytes;
+        }
+        metrics.m_recvTimeMs += receiveTimeMs;
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
@@ -396,9 +363,11 @@ namespace AzNetworking
         }
 
         m_port = 0;
+        CloseListenShards();
         m_readerThread.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
         m_socket->Close();
+        m_socket->SetReusePort(false);
         return true;
     }
 
@@ -438,6 +407,7 @@ namespace AzNetworking
         const AZ::TimeMs expectedTimeoutMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(avgRtt * 1000.0f * net_RttFudgeScalar));
         const AZ::TimeMs packetTimeoutMs = AZStd::max<AZ::TimeMs>(expectedTimeoutMs, net_MinPacketTimeoutMs); // Consider packets lost after twice the current connection Rtt
         AZLOG(NET_Debug, "Registering packetId %u with timeout %u", aznumeric_cast<uint32_t>(packetId), aznumeric_cast<uint32_t>(packetTimeoutMs));
+        AZStd::scoped_lock<AZStd::mutex> lock(m_sendStateMutex);
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
@@ -515,11 +485,15 @@ namespace AzNetworking
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer buffer;
+        // The packet is serialized into a pooled buffer that is handed to the socket as is, compression writes into a second
+        // pooled buffer and encryption happens within the buffer that is sent, so the payload isn't copied between buffers
+        UdpSocket* socket = GetShardForAddress(address).m_socket;
+        PooledPacketBuffer buffer = socket->AcquirePacketBuffer();
+        uint32_t flagSize = 0;
         {
-            buffer.Resize(buffer.GetCapacity());
+            buffer->Resize(buffer->GetCapacity());
 
-            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            NetworkInputSerializer networkSerializer(buffer->GetBuffer(), buffer->GetCapacity());
             ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
 
             if (!header.SerializePacketFlags(serializer))
@@ -527,6 +501,7 @@ namespace AzNetworking
                 AZLOG_ERROR("PacketId %u failed flag serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
+            flagSize = serializer.GetSize();
 
             if (!serializer.Serialize(header, "Header"))
             {
@@ -540,27 +515,28 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            buffer.Resize(serializer.GetSize());
+            buffer->Resize(serializer.GetSize());
         }
-        uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
-        uint8_t* packetData = buffer.GetBuffer();
+        const uint32_t uncompressedSize = buffer->GetSize();
 
         // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
-        if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
+        if (uncompressedSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
         {
             // Each fragmented packet we send adds an extra fragmented packet header, need to deduct that from our chunk size, otherwise we infinitely loop
             // SSL encryption can also inflate our payload so we pre-emptively deduct an estimated tax
             const uint32_t chunkSize = connection.GetConnectionMtu() - net_FragmentedHeaderOverhead - net_SslInflationOverhead;
-            const uint32_t numChunks = AZ::DivideAndRoundUp(packetSize, chunkSize); // We want to round up on the remainder
-            const uint8_t* chunkStart = packetData;
+            const uint32_t numChunks = AZ::DivideAndRoundUp(uncompressedSize, chunkSize); // We want to round up on the remainder
+            const uint8_t* chunkStart = buffer->GetBuffer();
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
-            uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+            uint32_t bytesRemaining = uncompressedSize;
+            CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, 0, aznumeric_cast<uint8_t>(numChunks), ChunkBuffer());
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
+                // Chunks are copied straight into the fragment, rather than through an intermediate chunk buffer
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
+                m_sentFragmentCopies++;
                 const SequenceId chunkReliableId = (net_FragmentsAlwaysReliable || reliabilityType == ReliabilityType::Reliable)
                     ? connection.m_reliableQueue.GetNextSequenceId()
                     : InvalidSequenceId;
@@ -573,27 +549,22 @@ namespace AzNetworking
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer writeBuffer;
         if (m_compressor && shouldCompress)
         {
-            NetworkInputSerializer flagSerializer(writeBuffer.GetBuffer(), static_cast<uint32_t>(writeBuffer.GetCapacity()));
-            ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
+            AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
 
-            header.SetPacketFlag(PacketFlag::Compressed, true);
-            if (!header.SerializePacketFlags(serializer))
+            // Compress the packet into a second buffer, make sure to offset by the size of the flags which are serialized separately
+            PooledPacketBuffer compressedBuffer = socket->AcquirePacketBuffer();
+            const uint32_t payloadSize = uncompressedSize - flagSize;
+            const uint8_t* payload = buffer->GetBuffer() + flagSize;
+            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
+            if (maxSizeNeeded > compressedBuffer->GetCapacity())
             {
-                AZLOG_ERROR("PacketId %u failed flag serialization for compression and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+                AZLOG_ERROR("PacketId %u is too large to compress and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
-            uint32_t flagSize = flagSerializer.GetSize();
-            AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
-
-            // Compress the packet, make sure to offset by the size of the flag which is now serialized
-            const uint32_t payloadSize = static_cast<uint32_t>(buffer.GetSize() - flagSize);
-            uint8_t* payload = buffer.GetBuffer() + flagSize;
-            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            CompressorError compErr = m_compressor->Compress(payload, payloadSize, compressedBuffer->GetBuffer(), maxSizeNeeded, compressionMemBytesUsed);
 
             if (compErr != CompressorError::Ok)
             {
@@ -604,12 +575,23 @@ namespace AzNetworking
             // Only use compression if there's actual gain
             if (compressionMemBytesUsed < payloadSize)
             {
-                writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
-                packetSize = static_cast<uint32_t>(writeBuffer.GetSize());
-                packetData = writeBuffer.GetBuffer();
+                // The flags go into the header room in front of the compressed payload
+                compressedBuffer->Resize(aznumeric_cast<uint32_t>(compressionMemBytesUsed));
+                NetworkInputSerializer flagSerializer(compressedBuffer->ClaimHeaderRoom(flagSize), flagSize);
+                ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
+
+                header.SetPacketFlag(PacketFlag::Compressed, true);
+                if (!header.SerializePacketFlags(serializer))
+                {
+                    AZLOG_ERROR("PacketId %u failed flag serialization for compression and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+                    return InvalidPacketId;
+                }
+                buffer = AZStd::move(compressedBuffer);
+
                 // Track byte delta caused by compression
-                GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
-            }        
+                AZStd::scoped_lock<AZStd::mutex> lock(m_sendStateMutex);
+                GetMetrics().m_sendBytesCompressedDelta += (payloadSize - compressionMemBytesUsed);
+            }
         }
 
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
@@ -623,11 +605,13 @@ namespace AzNetworking
         AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
         const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
-        if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        const uint32_t packetSize = buffer->GetSize();
+        if (socket->Send(address, AZStd::move(buffer), shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
-            GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendStateMutex);
+            GetMetrics().m_sendBytesUncompressed += uncompressedSize + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
         else
@@ -696,7 +680,7 @@ namespace AzNetworking
 
         AZLOG(Debug_UdpConnect, "Accepted new Udp Connection");
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, connectPacket.m_address, *this, ConnectionRole::Acceptor);
-        DtlsEndpoint::ConnectResult result = m_socket->AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
+        DtlsEndpoint::ConnectResult result = GetShardForAddress(connectPacket.m_address).m_socket->AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
 
         // Transition state based on our how our socket resolved
         connection->m_state = result == DtlsEndpoint::ConnectResult::Complete ? ConnectionState::Connected : ConnectionState::Connecting;
@@ -705,6 +689,219 @@ namespace AzNetworking
         m_connectionSet.AddConnection(AZStd::move(connection));
     }
 
+    void UdpNetworkInterface::DecodeShardPackets(SocketShard& shard)
+    {
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        shard.m_decodedPackets.clear();
+        shard.m_decodedData.clear();
+        shard.m_recvBytesUncompressed = 0;
+
+        // Traffic is assigned to shards by remote address rather than by the socket it arrived on, so a connection's packets are
+        // always decoded by the same shard
+        for (const AZStd::unique_ptr<SocketShard>& sourceShard : m_shards)
+        {
+            const UdpReaderThread::ReceivedPackets* packets = sourceShard->m_readerThread->GetReceivedPackets(sourceShard->m_socket);
+            if (packets == nullptr)
+            {
+                continue;
+            }
+
+            for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+            {
+                if (&GetShardForAddress(packet.m_address) != &shard)
+                {
+                    continue;
+                }
+
+                DecodedPacket& decodedPacket = shard.m_decodedPackets.emplace_back();
+                decodedPacket.m_packet = &packet;
+
+                // Accepting connections and finishing DTLS handshakes changes shared state, leave those to the main thread
+                UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+                if (connection == nullptr || connection->GetDtlsEndpoint().IsConnecting())
+                {
+                    decodedPacket.m_result = DecodeResult::Deferred;
+                    continue;
+                }
+
+                DecodePacket(shard, *connection, packet, decodedPacket);
+            }
+        }
+
+        shard.m_metrics.m_decodedPackets += shard.m_decodedPackets.size();
+        shard.m_metrics.m_decodeTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void UdpNetworkInterface::DecodePacket(SocketShard& shard, UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet, DecodedPacket& outPacket) const
+    {
+        outPacket.m_connection = &connection;
+        outPacket.m_result = DecodeResult::Discard;
+
+        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
+        if (disconnectReason != DisconnectReason::MAX)
+        {
+            outPacket.m_result = DecodeResult::Disconnect;
+            return;
+        }
+
+        const ConnectionState connectionState = connection.GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+        {
+            // Skip packets from disconnected connections
+            return;
+        }
+
+        int32_t decodedPacketSize = 0;
+        shard.m_decryptBuffer.Resize(shard.m_decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, shard.m_decryptBuffer.GetBuffer(), decodedPacketSize);
+        shard.m_decryptBuffer.Resize(decodedPacketSize);
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return;
+        }
+
+        connection.GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, AZ::GetElapsedTimeMs());
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outPacket.m_header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            shard.m_recvBytesUncompressed += flagSerializer.GetReadSize();
+        }
+
+        if (m_compressor && outPacket.m_header.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(decodedPacketData, decodedPacketSize, shard.m_decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return;
+            }
+            decodedPacketData = shard.m_decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(shard.m_decompressBuffer.GetSize());
+        }
+        shard.m_recvBytesUncompressed += decodedPacketSize;
+
+        // The decrypt and decompress buffers are reused for the next packet, so keep a copy of the payload until it's dispatched
+        outPacket.m_dataOffset = aznumeric_cast<uint32_t>(shard.m_decodedData.size());
+        outPacket.m_dataSize = aznumeric_cast<uint32_t>(decodedPacketSize);
+        shard.m_decodedData.insert(shard.m_decodedData.end(), decodedPacketData, decodedPacketData + decodedPacketSize);
+        outPacket.m_result = DecodeResult::Decoded;
+    }
+
+    void UdpNetworkInterface::DispatchPacket(SocketShard& shard, DecodedPacket& decodedPacket, AZ::TimeMs startTimeMs)
+    {
+        const UdpReaderThread::ReceivedPacket& packet = *decodedPacket.m_packet;
+        if (decodedPacket.m_result == DecodeResult::Deferred)
+        {
+            // The connection may have been accepted by an earlier packet during this update
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if (connection == nullptr)
+            {
+                AcceptConnection(packet);
+                return;
+            }
+            DecodePacket(shard, *connection, packet, decodedPacket);
+        }
+
+        UdpConnection* connection = decodedPacket.m_connection;
+        if (decodedPacket.m_result == DecodeResult::Disconnect)
+        {
+            connection->Disconnect(GetDisconnectReasonForSocketResult(packet.m_receivedBytes), TerminationEndpoint::Local);
+            return;
+        }
+        else if (decodedPacket.m_result != DecodeResult::Decoded)
+        {
+            return;
+        }
+
+        const ConnectionState connectionState = connection->GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+        {
+            // An earlier packet during this update disconnected the connection
+            return;
+        }
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        UdpPacketHeader& header = decodedPacket.m_header;
+        const uint8_t* decodedPacketData = shard.m_decodedData.data() + decodedPacket.m_dataOffset;
+        const uint32_t decodedPacketSize = decodedPacket.m_dataSize;
+
+        TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+        if (timeoutItem == nullptr)
+        {
+            connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+            return;
+        }
+
+        // Deserialize the packet header
+        NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+        ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+        if (!serializer.Serialize(header, "Header"))
+        {
+            return;
+        }
+
+        // Note that the serializer passed in here is unused for UDP
+        if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+        {
+            return;
+        }
+
+        timeoutItem->UpdateTimeoutTime(startTimeMs);
+        connection->m_timeoutCounter = 0;
+
+        PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
+        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+        {
+            handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
+        }
+        else
+        {
+            handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
+        }
+
+        if (handledPacket == PacketDispatchResult::Success)
+        {
+            connection->UpdateHeartbeat(currentTimeMs);
+            if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
+            {
+                // Connection is realized once a packet is received and socket handshake is verified complete
+                connection->m_state = ConnectionState::Connected;
+            }
+        }
+        else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
+            !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
+        {
+            // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
+            // This will appear as a SerializationError due to the incomplete encryption handshake
+            // If it's not an expected unencrypted type then skip it for now
+            return;
+        }
+        else if (handledPacket == PacketDispatchResult::Skipped)
+        {
+            // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
+            return;
+        }
+        else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
+        {
+            connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+        }
+    }
+
     void UdpNetworkInterface::RequestDisconnect(UdpConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
     {
         if (connection == nullptr)
@@ -799,4 +996,61 @@ namespace AzNetworking
     {
         return m_lastSystemTickUpdate.load();
     }
+
+    void UdpNetworkInterface::FlushSends()
+    {
+        for (AZStd::unique_ptr<SocketShard>& shard : m_shards)
+        {
+            if (shard->m_socket->IsOpen())
+            {
+                shard->m_socket->FlushSends();
+            }
+        }
+    }
+
+    uint32_t UdpNetworkInterface::GetShardCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_shards.size());
+    }
+
+    UdpNetworkInterface::SocketShard& UdpNetworkInterface::GetShardForAddress(const IpAddress& address) const
+    {
+        const size_t shardIndex = (m_shards.size() > 1) ? AZStd::hash<IpAddress>()(address) % m_shards.size() : 0;
+        return *m_shards[shardIndex];
+    }
+
+    void UdpNetworkInterface::OpenListenShards()
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        const uint32_t shardCount = AZStd::clamp<uint32_t>(net_UdpListenShards, 1, MaxNetworkInterfaceShards);
+        for (uint32_t shardIndex = 1; shardIndex < shardCount; ++shardIndex)
+        {
+            AZStd::unique_ptr<SocketShard> shard = AZStd::make_unique<SocketShard>();
+            shard->m_ownedSocket.reset(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket());
+            shard->m_ownedSocket->SetReusePort(true);
+            if (!shard->m_ownedSocket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open listen shard %u on port %u, continuing with %u shards",
+                    shardIndex, aznumeric_cast<uint32_t>(m_port), GetShardCount());
+                break;
+            }
+
+            shard->m_ownedReaderThread = AZStd::make_unique<UdpReaderThread>();
+            shard->m_socket = shard->m_ownedSocket.get();
+            shard->m_readerThread = shard->m_ownedReaderThread.get();
+            shard->m_readerThread->RegisterSocket(shard->m_socket);
+            m_shards.push_back(AZStd::move(shard));
+        }
+#endif
+    }
+
+    void UdpNetworkInterface::CloseListenShards()
+    {
+        for (size_t shardIndex = 1; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            // Destroying the shard stops its reader thread before its socket is closed
+            m_shards[shardIndex]->m_readerThread->UnregisterSocket(m_shards[shardIndex]->m_socket);
+        }
+        m_shards.erase(m_shards.begin() + 1, m_shards.end());
+    }
 }
@@ -17,6 +17,7 @@
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
@@ -118,12 +119,84 @@ namespace AzNetworking
         AZ::TimeMs GetTimeoutMs() const override;
         bool IsEncrypted() const override;
         bool IsOpen() const override;
+        void FlushSends() override;
         //! @}
 
         AZStd::atomic<AZ::TimeMs> GetLastSystemTickUpdate() const;
 
+        //! Returns the number of sockets this interface reads from. This is only above one while listening with net_UdpListenShards set.
+        //! @return the number of sockets this interface reads from
+        uint32_t GetShardCount() const;
+
     private:
 
+        //! Outcome of decrypting and decompressing a received packet.
+        enum class DecodeResult
+        {
+            Decoded,    //!< The payload is ready to be dispatched
+            Discard,    //!< The packet was consumed by the handshake or is invalid
+            Disconnect, //!< The socket reported an error for the connection
+            Deferred    //!< The sender has no connection yet, the packet has to be handled on the main thread
+        };
+
+        //! A received packet after decryption and decompression, waiting to be dispatched.
+        struct DecodedPacket
+        {
+            const UdpReaderThread::ReceivedPacket* m_packet = nullptr;
+            UdpConnection* m_connection = nullptr;
+            DecodeResult m_result = DecodeResult::Discard;
+            UdpPacketHeader m_header;
+            //! Location of the decoded payload in the owning shard's m_decodedData.
+            uint32_t m_dataOffset = 0;
+            uint32_t m_dataSize = 0;
+        };
+
+        //! One of the sockets a listening interface reads from. Every interface has at least one shard, which wraps m_socket and the
+        //! shared reader thread. Additional shards own an SO_REUSEPORT socket bound to the same port and their own reader thread.
+        struct SocketShard
+        {
+            UdpSocket* m_socket = nullptr;
+            UdpReaderThread* m_readerThread = nullptr;
+            AZStd::unique_ptr<UdpSocket> m_ownedSocket;
+            AZStd::unique_ptr<UdpReaderThread> m_ownedReaderThread;
+
+            UdpPacketEncodingBuffer m_decryptBuffer;
+            UdpPacketEncodingBuffer m_decompressBuffer;
+            AZStd::vector<DecodedPacket> m_decodedPackets;
+            AZStd::vector<uint8_t> m_decodedData;
+            uint64_t m_recvBytesUncompressed = 0;
+            NetworkInterfaceShardMetrics m_metrics;
+        };
+
+        //! Returns the shard that decodes and sends the traffic of a remote endpoint.
+        //! @param address the address of the remote endpoint
+        //! @return the shard the remote endpoint is assigned to
+        SocketShard& GetShardForAddress(const IpAddress& address) const;
+
+        //! Opens the additional SO_REUSEPORT sockets configured by net_UdpListenShards.
+        void OpenListenShards();
+
+        //! Closes the additional sockets and stops their reader threads.
+        void CloseListenShards();
+
+        //! Decrypts and decompresses every received packet assigned to the shard. This only reads shared state, and every connection
+        //! belongs to a single shard, so shards can decode in parallel.
+        //! @param shard the shard to decode the packets for
+        void DecodeShardPackets(SocketShard& shard);
+
+        //! Decrypts and decompresses a single packet into the shard's decoded data.
+        //! @param shard      the shard to store the decoded payload in
+        //! @param connection the connection the packet was received from
+        //! @param packet     the received packet
+        //! @param outPacket  the decoded packet
+        void DecodePacket(SocketShard& shard, UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet, DecodedPacket& outPacket) const;
+
+        //! Processes a decoded packet on its connection and dispatches the payload to the connection listener.
+        //! @param shard         the shard that decoded the packet
+        //! @param decodedPacket the decoded packet
+        //! @param startTimeMs   the time the network update started
+        void DispatchPacket(SocketShard& shard, DecodedPacket& decodedPacket, AZ::TimeMs startTimeMs);
+
         //! Registers a packet with a timeout queue on the provided connection.
         //! @param connectionId identifier of the connection to register
         //! @param packetId     packet id of the packet to register for the given connection
@@ -143,6 +216,7 @@ namespace AzNetworking
         //! @param packet             serializable object to transmit
         //! @param reliableSequence   the reliable sequence number to use for this packet, providing InvalidSequenceId will cause the packet to be sent unreliably
         //! @return packet id for the transmitted packet
+        //! Different connections may send packets concurrently, state shared between connections is guarded by m_sendStateMutex.
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
         //! Accepts an incoming udp connection.
@@ -182,11 +256,13 @@ namespace AzNetworking
         UdpConnectionSet m_connectionSet;
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
+        AZStd::mutex m_sendStateMutex;
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
         UdpReaderThread& m_readerThread;
         UdpHeartbeatThread& m_heartbeatThread;
         AZStd::atomic<AZ::TimeMs> m_lastSystemTickUpdate;
+        AZStd::atomic<uint32_t> m_sentFragmentCopies{ 0 };
 
         struct RemovedConnection
         {
@@ -196,8 +272,7 @@ namespace AzNetworking
         };
         AZStd::vector<RemovedConnection> m_removedConnections;
 
-        UdpPacketEncodingBuffer m_decryptBuffer;
-        UdpPacketEncodingBuffer m_decompressBuffer;
+        AZStd::vector<AZStd::unique_ptr<SocketShard>> m_shards;
 
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
@@ -176,7 +176,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +184,47 @@ namespace AzNetworking
                     break;
                 }
 
+                if (receivedPackets.full())
+                {
+                    break;
+                }
+
+                // Each slot reserves a full MTU in the receive buffer, received datagrams are packed together afterwards
+                const uint32_t availableSlots = aznumeric_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t availablePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t slotCount = AZStd::min(AZStd::min(availableSlots, availablePackets), UdpSocket::MaxDatagramBatchSize);
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + slotCount * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                UdpSocket::ReceiveSlot slots[UdpSocket::MaxDatagramBatchSize];
+                for (uint32_t i = 0; i < slotCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    slots[i].m_buffer = dstData + i * MaxUdpTransmissionUnit;
+                    slots[i].m_capacity = MaxUdpTransmissionUnit;
                 }
-                else
+
+                const uint32_t receivedCount = socket->ReceiveBatch(slots, slotCount);
+                uint8_t* writeData = dstData;
+                for (uint32_t i = 0; i < receivedCount; ++i)
+                {
+                    const int32_t receivedBytes = slots[i].m_receivedBytes;
+                    if (receivedBytes <= 0)
+                    {
+                        continue;
+                    }
+
+                    if (writeData != slots[i].m_buffer)
+                    {
+                        memmove(writeData, slots[i].m_buffer, receivedBytes);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(slots[i].m_address, writeData, receivedBytes));
+                    writeData += receivedBytes;
+                }
+                receiveBuffer.Resize(bufferHead + aznumeric_cast<uint32_t>(writeData - dstData));
+
+                if (receivedCount < slotCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
                     break;
                 }
             }
@@ -23,6 +23,33 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, outgoing datagrams are queued and sent in batches on each network update");
+#if AZ_TRAIT_USE_SOCKET_UDP_GSO
+    AZ_CVAR(bool, net_UdpUseGso, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched datagrams to the same endpoint are sent as a single UDP segmentation offload send");
+
+#   if !defined(UDP_SEGMENT)
+#       define UDP_SEGMENT 103
+#   endif
+
+    // The payload of a segmented send has to fit in a single IP packet before segmentation
+    static constexpr uint32_t MaxGsoPayloadSize = 63 * 1024;
+#endif
+
+    struct UdpSocket::SendBatch
+    {
+        struct Datagram
+        {
+            IpAddress m_address;
+            uint32_t m_size = 0;
+            // Queued datagrams keep the buffer they were written into, so queuing doesn't copy the payload
+            PooledPacketBuffer m_buffer;
+        };
+
+        AZStd::fixed_vector<Datagram, MaxDatagramBatchSize> m_datagrams;
+        bool m_gsoUnsupported = false;
+    };
+
+    UdpSocket::UdpSocket() = default;
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +95,20 @@ namespace AzNetworking
             }
         }
 
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        if (m_reusePort)
+        {
+            const int32_t enable = 1;
+            if (setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, (const char*)&enable, sizeof(enable)) != SocketOpResultSuccess)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_WARN("Failed to set SO_REUSEPORT on UDP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                Close();
+                return false;
+            }
+        }
+#endif
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -91,15 +132,25 @@ namespace AzNetworking
             return false;
         }
 
+        SetSendBatching(net_UdpBatchSends);
         return true;
     }
 
     void UdpSocket::Close()
     {
+        if (IsOpen())
+        {
+            FlushSends();
+        }
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
 
+    PooledPacketBuffer UdpSocket::AcquirePacketBuffer() const
+    {
+        return m_packetBufferPool.Acquire();
+    }
+
     int32_t UdpSocket::Send
     (
         const IpAddress& address,
@@ -107,12 +158,36 @@ namespace AzNetworking
         uint32_t size,
         bool encrypt,
         DtlsEndpoint& dtlsEndpoint,
-        [[maybe_unused]] const ConnectionQuality& connectionQuality
+        const ConnectionQuality& connectionQuality
     ) const
     {
         AZ_Assert(size > 0, "Invalid data size for send");
         AZ_Assert(data != nullptr, "NULL data pointer passed to send");
 
+        PooledPacketBuffer buffer = AcquirePacketBuffer();
+        if (!buffer->Resize(size))
+        {
+            AZLOG_ERROR("Payload of %u bytes does not fit in a packet buffer", size);
+            return SocketOpResultError;
+        }
+        memcpy(buffer->GetBuffer(), data, size);
+        m_sentPacketCopies++;
+
+        return Send(address, AZStd::move(buffer), encrypt, dtlsEndpoint, connectionQuality);
+    }
+
+    int32_t UdpSocket::Send
+    (
+        const IpAddress& address,
+        PooledPacketBuffer&& buffer,
+        bool encrypt,
+        DtlsEndpoint& dtlsEndpoint,
+        [[maybe_unused]] const ConnectionQuality& connectionQuality
+    ) const
+    {
+        const uint32_t size = buffer.IsValid() ? buffer->GetSize() : 0;
+        AZ_Assert(size > 0, "Invalid data size for send");
+
         AZ_Assert(address.GetAddress(ByteOrder::Host) != 0, "Invalid address");
         AZ_Assert(address.GetPort(ByteOrder::Host) != 0, "Invalid address");
 
@@ -138,7 +213,7 @@ namespace AzNetworking
         if (connectionQuality.m_latencyMs <= AZ::Time::ZeroTimeMs)
 #endif
         {
-            sentBytes = SendInternal(address, data, size, encrypt, dtlsEndpoint);
+            sentBytes = SendInternal(address, AZStd::move(buffer), encrypt, dtlsEndpoint);
 
             if (sentBytes < 0)
             {
@@ -160,7 +235,7 @@ namespace AzNetworking
                                       : AZ::TimeMs{ 1 });
             const AZ::TimeMs deferTimeMs = (connectionQuality.m_latencyMs) + jitterMs;
 
-            DeferredData deferred = DeferredData(address, data, size, encrypt, dtlsEndpoint);
+            DeferredData deferred = DeferredData(address, AZStd::move(buffer), encrypt, dtlsEndpoint);
             AZ::Interface<AZ::IEventScheduler>::Get()->AddCallback([&, deferredData = deferred]
                     { SendInternalDeferred(deferredData); }, AZ::Name("Deferred packet"), deferTimeMs);
         }
@@ -224,8 +299,273 @@ namespace AzNetworking
         return receivedBytes;
     }
 
-    int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
+    uint32_t UdpSocket::ReceiveBatch(ReceiveSlot* slots, uint32_t count) const
+    {
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        uint32_t receivedCount = 0;
+        while (receivedCount < count)
+        {
+            const uint32_t batchSize = AZStd::min(count - receivedCount, MaxDatagramBatchSize);
+            sockaddr_in addresses[MaxDatagramBatchSize];
+            iovec iovecs[MaxDatagramBatchSize];
+            mmsghdr messages[MaxDatagramBatchSize];
+            memset(messages, 0, sizeof(mmsghdr) * batchSize);
+            for (uint32_t i = 0; i < batchSize; ++i)
+            {
+                ReceiveSlot& slot = slots[receivedCount + i];
+                iovecs[i].iov_base = slot.m_buffer;
+                iovecs[i].iov_len = slot.m_capacity;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+                messages[i].msg_hdr.msg_iov = &iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t result = recvmmsg(static_cast<int32_t>(m_socketFd), messages, batchSize, MSG_DONTWAIT, nullptr);
+            if (result <= 0)
+            {
+                if (result < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                    {
+                        AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+                break;
+            }
+
+            for (int32_t i = 0; i < result; ++i)
+            {
+                ReceiveSlot& slot = slots[receivedCount + i];
+                slot.m_address = IpAddress(ByteOrder::Network, addresses[i].sin_addr.s_addr, addresses[i].sin_port);
+                slot.m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+                m_recvPackets++;
+                m_recvBytes += messages[i].msg_len;
+            }
+            receivedCount += static_cast<uint32_t>(result);
+
+            if (static_cast<uint32_t>(result) < batchSize)
+            {
+                // The socket has been drained
+                break;
+            }
+        }
+        return receivedCount;
+#else
+        uint32_t receivedCount = 0;
+        for (; receivedCount < count; ++receivedCount)
+        {
+            ReceiveSlot& slot = slots[receivedCount];
+            slot.m_receivedBytes = Receive(slot.m_address, slot.m_buffer, slot.m_capacity);
+            if (slot.m_receivedBytes <= 0)
+            {
+                break;
+            }
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::SetReusePort(bool enabled)
+    {
+        AZ_Assert(!IsOpen(), "SetReusePort has to be called before the socket is opened");
+        m_reusePort = enabled;
+    }
+
+    void UdpSocket::SetSendBatching(bool enabled)
+    {
+        if (enabled == IsSendBatchingEnabled())
+        {
+            return;
+        }
+
+        if (enabled)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+        }
+        else
+        {
+            FlushSends();
+            m_sendBatch.reset();
+        }
+    }
+
+    bool UdpSocket::IsSendBatchingEnabled() const
+    {
+        return m_sendBatch != nullptr;
+    }
+
+    void UdpSocket::FlushSends() const
+    {
+        if (m_sendBatch != nullptr)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatchMutex);
+            FlushSendsInternal();
+        }
+    }
+
+    void UdpSocket::FlushSendsInternal(uint32_t firstDatagram) const
+    {
+        SendBatch& batch = *m_sendBatch;
+        const uint32_t datagramCount = aznumeric_cast<uint32_t>(batch.m_datagrams.size());
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        sockaddr_in addresses[MaxDatagramBatchSize];
+        iovec iovecs[MaxDatagramBatchSize];
+        mmsghdr messages[MaxDatagramBatchSize];
+        uint32_t messageFirstDatagram[MaxDatagramBatchSize];
+        memset(messages, 0, sizeof(messages));
+#   if AZ_TRAIT_USE_SOCKET_UDP_GSO
+        alignas(cmsghdr) char control[MaxDatagramBatchSize][CMSG_SPACE(sizeof(uint16_t))];
+        const bool useGso = net_UdpUseGso && !batch.m_gsoUnsupported;
+#   endif
+
+        uint32_t messageCount = 0;
+        for (uint32_t i = firstDatagram; i < datagramCount;)
+        {
+            const SendBatch::Datagram& datagram = batch.m_datagrams[i];
+            uint32_t segmentCount = 1;
+#   if AZ_TRAIT_USE_SOCKET_UDP_GSO
+            if (useGso)
+            {
+                // Consecutive datagrams to the same endpoint with the same size are split up by the kernel or the network
+                // device. Only the last segment is allowed to be smaller.
+                uint32_t payloadSize = datagram.m_size;
+                while (i + segmentCount < datagramCount)
+                {
+                    const SendBatch::Datagram& next = batch.m_datagrams[i + segmentCount];
+                    if (next.m_address != datagram.m_address || next.m_size > datagram.m_size
+                     || payloadSize + next.m_size > MaxGsoPayloadSize)
+                    {
+                        break;
+                    }
+                    payloadSize += next.m_size;
+                    ++segmentCount;
+                    if (next.m_size < datagram.m_size)
+                    {
+                        break;
+                    }
+                }
+            }
+#   endif
+
+            sockaddr_in& destAddr = addresses[messageCount];
+            memset(&destAddr, 0, sizeof(destAddr));
+            destAddr.sin_family = AF_INET;
+            destAddr.sin_addr.s_addr = datagram.m_address.GetAddress(ByteOrder::Network);
+            destAddr.sin_port = datagram.m_address.GetPort(ByteOrder::Network);
+
+            for (uint32_t segment = i; segment < i + segmentCount; ++segment)
+            {
+                iovecs[segment].iov_base = batch.m_datagrams[segment].m_buffer->GetBuffer();
+                iovecs[segment].iov_len = batch.m_datagrams[segment].m_size;
+            }
+
+            msghdr& header = messages[messageCount].msg_hdr;
+            header.msg_name = &destAddr;
+            header.msg_namelen = sizeof(destAddr);
+            header.msg_iov = &iovecs[i];
+            header.msg_iovlen = segmentCount;
+#   if AZ_TRAIT_USE_SOCKET_UDP_GSO
+            if (segmentCount > 1)
+            {
+                header.msg_control = control[messageCount];
+                header.msg_controllen = sizeof(control[messageCount]);
+                cmsghdr* controlHeader = CMSG_FIRSTHDR(&header);
+                controlHeader->cmsg_level = IPPROTO_UDP;
+                controlHeader->cmsg_type = UDP_SEGMENT;
+                controlHeader->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segmentSize = aznumeric_cast<uint16_t>(datagram.m_size);
+                memcpy(CMSG_DATA(controlHeader), &segmentSize, sizeof(segmentSize));
+            }
+#   endif
+
+            messageFirstDatagram[messageCount] = i;
+            ++messageCount;
+            i += segmentCount;
+        }
+
+        uint32_t sentMessages = 0;
+        while (sentMessages < messageCount)
+        {
+            const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentMessages, messageCount - sentMessages, 0);
+            if (result > 0)
+            {
+                sentMessages += static_cast<uint32_t>(result);
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                // The send buffer is full, drop the remaining datagrams the same way individual sends would
+                break;
+            }
+
+#   if AZ_TRAIT_USE_SOCKET_UDP_GSO
+            if (messages[sentMessages].msg_hdr.msg_iovlen > 1)
+            {
+                AZLOG_WARN("UDP segmentation offload is not supported (%d:%s), sending datagrams individually", error, GetNetworkErrorDesc(error));
+                batch.m_gsoUnsupported = true;
+                FlushSendsInternal(messageFirstDatagram[sentMessages]);
+                return;
+            }
+#   endif
+
+            // Skip the datagram that failed and continue with the rest
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            ++sentMessages;
+        }
+#else
+        for (uint32_t i = firstDatagram; i < datagramCount; ++i)
+        {
+            const SendBatch::Datagram& datagram = batch.m_datagrams[i];
+            if (SendTo(datagram.m_address, datagram.m_buffer->GetBuffer(), datagram.m_size) < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+            }
+        }
+#endif
+
+        batch.m_datagrams.clear();
+    }
+
+    int32_t UdpSocket::SendInternal(const IpAddress& address, PooledPacketBuffer&& buffer,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        const uint32_t size = buffer->GetSize();
+        if (m_sendBatch != nullptr)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatchMutex);
+            if (size <= MaxUdpTransmissionUnit)
+            {
+                if (m_sendBatch->m_datagrams.full())
+                {
+                    FlushSendsInternal();
+                }
+
+                m_sendBatch->m_datagrams.emplace_back(SendBatch::Datagram{ address, size, AZStd::move(buffer) });
+                return static_cast<int32_t>(size);
+            }
+
+            // Send anything that's queued first to keep the datagrams in order
+            FlushSendsInternal();
+        }
+
+        return SendTo(address, buffer->GetBuffer(), size);
+    }
+
+    int32_t UdpSocket::SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
@@ -238,7 +578,7 @@ namespace AzNetworking
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
-        return SendInternal(data.m_address, data.m_dataBuffer.GetBuffer(), static_cast<uint32_t>(data.m_dataBuffer.GetSize()), data.m_encrypt, *data.m_dtlsEndpoint);
+        return SendInternal(data.m_address, AZStd::move(*data.m_buffer), data.m_encrypt, *data.m_dtlsEndpoint);
     }
 #endif
 }
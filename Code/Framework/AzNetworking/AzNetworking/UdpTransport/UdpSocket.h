@@ -12,8 +12,13 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,7 +47,19 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
-        UdpSocket() = default;
+        //! Maximum number of datagrams received or sent with a single system call.
+        static constexpr uint32_t MaxDatagramBatchSize = 64;
+
+        //! A buffer to receive a single datagram into with ReceiveBatch.
+        struct ReceiveSlot
+        {
+            IpAddress m_address;
+            uint8_t* m_buffer = nullptr;
+            uint32_t m_capacity = 0;
+            int32_t m_receivedBytes = 0;
+        };
+
+        UdpSocket();
         virtual ~UdpSocket();
 
         //! Returns true if this is an encrypted socket, false if not.
@@ -76,7 +93,12 @@ namespace AzNetworking
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
 
+        //! Acquires an empty packet buffer from this socket's pool, payloads written to it can be sent without being copied.
+        //! @return handle to the acquired buffer
+        PooledPacketBuffer AcquirePacketBuffer() const;
+
         //! Sends a single payload over the UDP socket to the connected endpoint.
+        //! The payload is copied into a pooled packet buffer, prefer the PooledPacketBuffer overload on hot paths.
         //! @param address           the address to send the payload to
         //! @param data              pointer to the data to send
         //! @param size              size of the payload in bytes
@@ -86,6 +108,16 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
 
+        //! Sends a single payload over the UDP socket to the connected endpoint, taking ownership of the buffer holding it.
+        //! The payload is queued and encrypted within the provided buffer, so it is not copied on its way to the system call.
+        //! @param address           the address to send the payload to
+        //! @param buffer            buffer holding the payload, acquired from AcquirePacketBuffer
+        //! @param encrypt           signals that the payload should be encrypted before transmitting if encryption is supported
+        //! @param dtlsEndpoint      data required for DTLS encryption
+        //! @param connectionQuality debug connection quality parameters
+        //! @return number of bytes sent, <= 0 on error
+        int32_t Send(const IpAddress& address, PooledPacketBuffer&& buffer, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
+
         //! Receives a payload from the UDP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -93,6 +125,30 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call per MaxDatagramBatchSize datagrams
+        //! on platforms that support it.
+        //! @param slots the buffers to receive into, m_buffer and m_capacity need to be set on every slot
+        //! @param count the number of slots
+        //! @return number of slots that received a datagram, these are always the first slots
+        uint32_t ReceiveBatch(ReceiveSlot* slots, uint32_t count) const;
+
+        //! Allows several sockets to bind to the same port, with the kernel spreading incoming datagrams over them.
+        //! This has to be set before Open and is ignored on platforms without SO_REUSEPORT load balancing.
+        //! @param enabled if true, the socket is opened with SO_REUSEPORT
+        void SetReusePort(bool enabled);
+
+        //! Enables or disables queuing of outgoing datagrams. Queued datagrams are sent by FlushSends, or as soon as the
+        //! queue is full. This should only be changed while no other threads are sending on the socket.
+        //! @param enabled if true, datagrams are queued, if false any queued datagrams are sent immediately
+        void SetSendBatching(bool enabled);
+
+        //! Returns true if outgoing datagrams are queued until FlushSends is called.
+        //! @return boolean true if outgoing datagrams are queued
+        bool IsSendBatchingEnabled() const;
+
+        //! Sends all queued datagrams, using as few system calls as the platform allows.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -113,6 +169,10 @@ namespace AzNetworking
         //! @return the total number of additional bytes sent on this socket due to SSL encryption
         uint32_t GetSentBytesEncryptionInflation() const;
 
+        //! Returns the total number of times outgoing packet data was copied between buffers on this socket.
+        //! @return the total number of times outgoing packet data was copied between buffers on this socket
+        uint32_t GetSentPacketCopies() const;
+
         //! Returns the total number of packets received on this socket.
         //! @return the total number of packets received on this socket
         uint32_t GetRecvPackets() const;
@@ -123,36 +183,49 @@ namespace AzNetworking
 
     protected:
 
-        mutable uint32_t m_sentPacketsEncrypted = 0;
-        mutable uint32_t m_sentBytesEncryptionInflation = 0;
+        // Send counters are atomic since connections can be updated, and send packets, in parallel
+        mutable AZStd::atomic<uint32_t> m_sentPacketsEncrypted{ 0 };
+        mutable AZStd::atomic<uint32_t> m_sentBytesEncryptionInflation{ 0 };
+        mutable AZStd::atomic<uint32_t> m_sentPacketCopies{ 0 };
 
-        virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
+        virtual int32_t SendInternal(const IpAddress& address, PooledPacketBuffer&& buffer, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
     private:
 
+        struct SendBatch;
+
+        int32_t SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+        void FlushSendsInternal(uint32_t firstDatagram = 0) const;
+
+        // Declared before the send batch, queued datagrams hold buffers from this pool
+        mutable PacketBufferPool m_packetBufferPool;
+        AZStd::unique_ptr<SendBatch> m_sendBatch;
+        mutable AZStd::mutex m_sendBatchMutex;
+
         SocketFd m_socketFd = InvalidSocketFd;
-        mutable uint32_t m_sentPackets = 0;
-        mutable uint32_t m_sentBytes = 0;
+        bool m_reusePort = false;
+        mutable AZStd::atomic<uint32_t> m_sentPackets{ 0 };
+        mutable AZStd::atomic<uint32_t> m_sentBytes{ 0 };
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
-            DeferredData(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint)
+            DeferredData(const IpAddress& address, PooledPacketBuffer&& buffer, bool encrypt, DtlsEndpoint& dtlsEndpoint)
                 : m_address(address)
                 , m_encrypt(encrypt)
                 , m_dtlsEndpoint(&dtlsEndpoint)
+                , m_buffer(AZStd::make_shared<PooledPacketBuffer>(AZStd::move(buffer)))
             {
-                m_dataBuffer.CopyValues(data, size);
             }
 
             bool m_encrypt;
             DtlsEndpoint* m_dtlsEndpoint = nullptr;
             AZ::ScheduledEvent* m_owningEvent = nullptr;
             IpAddress m_address;
-            // Deferred UDP packets should have gone through UDP Fragmentation already so ChunkBuffer is sufficient size
-            ChunkBuffer m_dataBuffer;
+            // Shared so the scheduled callback stays copyable, the buffer is handed to SendInternal without copying the payload
+            AZStd::shared_ptr<PooledPacketBuffer> m_buffer;
         };
 
         int32_t SendInternalDeferred(const DeferredData& data) const;
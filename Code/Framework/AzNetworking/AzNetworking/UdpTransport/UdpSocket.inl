@@ -40,6 +40,11 @@ namespace AzNetworking
         return m_sentBytesEncryptionInflation;
     }
 
+    inline uint32_t UdpSocket::GetSentPacketCopies() const
+    {
+        return m_sentPacketCopies;
+    }
+
     inline uint32_t UdpSocket::GetRecvPackets() const
     {
         return m_recvPackets;
@@ -34,6 +34,9 @@ set(FILES
     DataStructures/FixedSizeVectorBitset.h
     DataStructures/FixedSizeVectorBitset.inl
     DataStructures/IBitset.h
+    DataStructures/PacketBufferPool.cpp
+    DataStructures/PacketBufferPool.h
+    DataStructures/PacketBufferPool.inl
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
     DataStructures/TimeoutQueue.cpp
@@ -49,6 +52,8 @@ set(FILES
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
     Serialization/AzContainerSerializers.h
+    Serialization/BaselineDeltaSerializer.cpp
+    Serialization/BaselineDeltaSerializer.h
     Serialization/DeltaSerializer.cpp
     Serialization/DeltaSerializer.h
     Serialization/DeltaSerializer.inl
@@ -11,4 +11,22 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.AddBits(12);
+        rhs.AddBits(12);
+        lhs.SetBit(9, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(9, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Same bits set, but a different number of bits
+        rhs.AddBits(1);
+        EXPECT_TRUE(lhs != rhs);
+    }
 }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    using PacketBufferPoolTests = LeakDetectionFixture;
+
+    TEST_F(PacketBufferPoolTests, ReleasedBuffersAreReused)
+    {
+        PacketBufferPool pool;
+        PacketBuffer* firstBuffer = nullptr;
+        {
+            PooledPacketBuffer buffer = pool.Acquire();
+            ASSERT_TRUE(buffer.IsValid());
+            firstBuffer = &*buffer;
+            EXPECT_EQ(pool.GetAllocatedCount(), 1);
+            EXPECT_EQ(pool.GetAvailableCount(), 0);
+        }
+        EXPECT_EQ(pool.GetAvailableCount(), 1);
+
+        PooledPacketBuffer reused = pool.Acquire();
+        EXPECT_EQ(&*reused, firstBuffer);
+        EXPECT_EQ(pool.GetAllocatedCount(), 1);
+
+        PooledPacketBuffer second = pool.Acquire();
+        EXPECT_NE(&*second, firstBuffer);
+        EXPECT_EQ(pool.GetAllocatedCount(), 2);
+
+        // Moving a handle transfers ownership, the buffer is only returned once
+        PooledPacketBuffer moved = AZStd::move(second);
+        EXPECT_FALSE(second.IsValid());
+        moved.Release();
+        second.Release();
+        EXPECT_EQ(pool.GetAvailableCount(), 1);
+    }
+
+    TEST_F(PacketBufferPoolTests, AcquiredBuffersAreEmpty)
+    {
+        PacketBufferPool pool;
+        {
+            PooledPacketBuffer buffer = pool.Acquire();
+            buffer->Resize(16);
+            buffer->ClaimHeaderRoom(4);
+        }
+
+        PooledPacketBuffer buffer = pool.Acquire();
+        EXPECT_EQ(buffer->GetSize(), 0);
+        EXPECT_EQ(buffer->GetBuffer(), buffer->GetStorage() + PacketBuffer::HeaderRoom);
+    }
+
+    TEST_F(PacketBufferPoolTests, HeaderRoomDoesNotMovePayload)
+    {
+        PacketBufferPool pool;
+        PooledPacketBuffer buffer = pool.Acquire();
+        ASSERT_TRUE(buffer->Resize(4));
+        uint8_t* payload = buffer->GetBuffer();
+        memcpy(payload, "\x01\x02\x03\x04", 4);
+
+        uint8_t* header = buffer->ClaimHeaderRoom(2);
+        ASSERT_NE(header, nullptr);
+        EXPECT_EQ(header + 2, payload);
+        EXPECT_EQ(buffer->GetSize(), 6);
+        EXPECT_EQ(buffer->GetBuffer()[2], 0x01);
+        EXPECT_EQ(buffer->GetBuffer()[5], 0x04);
+
+        // Claiming more than the remaining header room fails and leaves the payload untouched
+        EXPECT_EQ(buffer->ClaimHeaderRoom(PacketBuffer::HeaderRoom), nullptr);
+        EXPECT_EQ(buffer->GetBuffer(), header);
+        EXPECT_EQ(buffer->GetSize(), 6);
+    }
+
+    TEST_F(PacketBufferPoolTests, PayloadIsBoundByStorage)
+    {
+        PacketBufferPool pool;
+        PooledPacketBuffer buffer = pool.Acquire();
+        EXPECT_TRUE(buffer->Resize(PacketBuffer::GetCapacity()));
+
+        // The trailer room is available behind a full size payload
+        EXPECT_TRUE(buffer->Resize(PacketBuffer::GetCapacity() + PacketBuffer::TrailerRoom));
+        EXPECT_FALSE(buffer->Resize(PacketBuffer::GetCapacity() + PacketBuffer::TrailerRoom + 1));
+
+        // A payload covering the whole storage, as written by in place encryption
+        EXPECT_TRUE(buffer->SetPayloadRange(0, PacketBuffer::StorageSize));
+        EXPECT_EQ(buffer->GetBuffer(), buffer->GetStorage());
+        EXPECT_FALSE(buffer->SetPayloadRange(1, PacketBuffer::StorageSize));
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BaselineDeltaSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <cmath>
+
+namespace UnitTest
+{
+    struct BaselineDataElement
+    {
+        bool m_isValid = true;
+        uint8_t m_health = 100;
+        int16_t m_offset = 0;
+        uint32_t m_id = 0;
+        int64_t m_sequence = 0;
+        float m_positionX = 0.0f;
+        float m_positionY = 0.0f;
+        double m_timeSeconds = 0.0;
+        AZStd::vector<int32_t> m_inventory;
+        AZStd::fixed_string<32> m_name = "BaselineElem";
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return serializer.Serialize(m_isValid, "Valid")
+                && serializer.Serialize(m_health, "Health")
+                && serializer.Serialize(m_offset, "Offset")
+                && serializer.Serialize(m_id, "Id")
+                && serializer.Serialize(m_sequence, "Sequence")
+                && serializer.Serialize(m_positionX, "PositionX")
+                && serializer.Serialize(m_positionY, "PositionY")
+                && serializer.Serialize(m_timeSeconds, "TimeSeconds")
+                && serializer.Serialize(m_inventory, "Inventory")
+                && serializer.Serialize(m_name, "Name");
+        }
+    };
+
+    class BaselineDeltaSerializerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        uint32_t Encode(const AzNetworking::SerializerBaseline& baseline, BaselineDataElement& element, AzNetworking::SerializerBaseline& outCurrent, float floatQuantum = 0.0f)
+        {
+            AzNetworking::BaselineDeltaSerializerCreate createSerializer(baseline, outCurrent, floatQuantum);
+            EXPECT_TRUE(element.Serialize(createSerializer));
+
+            uint32_t deltaSize = 0;
+            EXPECT_TRUE(createSerializer.WriteDelta(m_buffer, sizeof(m_buffer), deltaSize));
+            return deltaSize;
+        }
+
+        bool Decode(const AzNetworking::SerializerBaseline& baseline, uint32_t deltaSize, BaselineDataElement& element, AzNetworking::SerializerBaseline& outCurrent)
+        {
+            AzNetworking::BaselineDeltaSerializerApply applySerializer(baseline, m_buffer, deltaSize, outCurrent);
+            return element.Serialize(applySerializer) && applySerializer.IsComplete();
+        }
+
+        static void ExpectEqual(const BaselineDataElement& lhs, const BaselineDataElement& rhs)
+        {
+            EXPECT_EQ(lhs.m_isValid, rhs.m_isValid);
+            EXPECT_EQ(lhs.m_health, rhs.m_health);
+            EXPECT_EQ(lhs.m_offset, rhs.m_offset);
+            EXPECT_EQ(lhs.m_id, rhs.m_id);
+            EXPECT_EQ(lhs.m_sequence, rhs.m_sequence);
+            EXPECT_EQ(lhs.m_positionX, rhs.m_positionX);
+            EXPECT_EQ(lhs.m_positionY, rhs.m_positionY);
+            EXPECT_EQ(lhs.m_timeSeconds, rhs.m_timeSeconds);
+            EXPECT_EQ(lhs.m_inventory, rhs.m_inventory);
+            EXPECT_EQ(lhs.m_name, rhs.m_name);
+        }
+
+        uint8_t m_buffer[1024];
+    };
+
+    TEST_F(BaselineDeltaSerializerTests, RoundTripWithoutBaseline)
+    {
+        BaselineDataElement sent;
+        sent.m_id = 123456;
+        sent.m_sequence = -42;
+        sent.m_positionX = -0.0f;
+        sent.m_positionY = 1024.5f;
+        sent.m_timeSeconds = 3.25;
+        sent.m_inventory = { 1, 2, 3 };
+
+        AzNetworking::SerializerBaseline empty;
+        AzNetworking::SerializerBaseline sentValues;
+        const uint32_t deltaSize = Encode(empty, sent, sentValues);
+        EXPECT_GT(deltaSize, 0);
+
+        BaselineDataElement received;
+        received.m_isValid = false;
+        received.m_name = "";
+        AzNetworking::SerializerBaseline receivedValues;
+        EXPECT_TRUE(Decode(empty, deltaSize, received, receivedValues));
+        ExpectEqual(sent, received);
+        EXPECT_TRUE(std::signbit(received.m_positionX));
+        EXPECT_EQ(sentValues.GetValueCount(), receivedValues.GetValueCount());
+    }
+
+    TEST_F(BaselineDeltaSerializerTests, UnchangedObjectEncodesToHeaderOnly)
+    {
+        BaselineDataElement element;
+        element.m_id = 77;
+        element.m_positionY = 8.0f;
+
+        AzNetworking::SerializerBaseline empty;
+        AzNetworking::SerializerBaseline baseline;
+        const uint32_t fullSize = Encode(empty, element, baseline);
+
+        AzNetworking::SerializerBaseline current;
+        const uint32_t deltaSize = Encode(baseline, element, current);
+        EXPECT_LT(deltaSize, fullSize);
+        EXPECT_EQ(deltaSize, 2);
+
+        BaselineDataElement received = element;
+        AzNetworking::SerializerBaseline receivedValues;
+        AzNetworking::BaselineDeltaSerializerApply applySerializer(baseline, m_buffer, deltaSize, receivedValues);
+        EXPECT_TRUE(received.Serialize(applySerializer));
+        EXPECT_TRUE(applySerializer.IsComplete());
+        EXPECT_FALSE(applySerializer.GetTrackedChangesFlag());
+    }
+
+    TEST_F(BaselineDeltaSerializerTests, SmallChangesEncodeSmallDeltas)
+    {
+        BaselineDataElement element;
+        element.m_id = 1000000;
+        element.m_sequence = 5000000000;
+        element.m_positionX = 100.0f;
+
+        AzNetworking::SerializerBaseline empty;
+        AzNetworking::SerializerBaseline serverBaseline;
+        const uint32_t fullSize = Encode(empty, element, serverBaseline);
+
+        BaselineDataElement received;
+        AzNetworking::SerializerBaseline clientBaseline;
+        EXPECT_TRUE(Decode(empty, fullSize, received, clientBaseline));
+
+        element.m_isValid = false;
+        element.m_id += 1;
+        element.m_sequence -= 3;
+        element.m_positionX = 100.0f + 0.0001f;
+
+        AzNetworking::SerializerBaseline serverCurrent;
+        const uint32_t deltaSize = Encode(serverBaseline, element, serverCurrent);
+
+        // Header, four runs, two single byte integer deltas and a small float delta
+        EXPECT_LE(deltaSize, 10);
+
+        AzNetworking::SerializerBaseline clientCurrent;
+        EXPECT_TRUE(Decode(clientBaseline, deltaSize, received, clientCurrent));
+        ExpectEqual(element, received);
+    }
+
+    TEST_F(BaselineDeltaSerializerTests, QuantizedFloatsTrackReconstructedValues)
+    {
+        constexpr float Quantum = 0.01f;
+
+        BaselineDataElement element;
+        element.m_positionX = 10.0f;
+
+        AzNetworking::SerializerBaseline empty;
+        AzNetworking::SerializerBaseline serverBaseline;
+        uint32_t deltaSize = Encode(empty, element, serverBaseline, Quantum);
+
+        BaselineDataElement received;
+        AzNetworking::SerializerBaseline clientBaseline;
+        EXPECT_TRUE(Decode(empty, deltaSize, received, clientBaseline));
+
+        // Accumulate many sub-quantum moves, the error against the true value must stay bounded by the quantum
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            element.m_positionX += 0.0037f;
+
+            AzNetworking::SerializerBaseline serverCurrent;
+            deltaSize = Encode(serverBaseline, element, serverCurrent, Quantum);
+
+            AzNetworking::SerializerBaseline clientCurrent;
+            EXPECT_TRUE(Decode(clientBaseline, deltaSize, received, clientCurrent));
+            EXPECT_NEAR(received.m_positionX, element.m_positionX, Quantum);
+
+            serverBaseline = AZStd::move(serverCurrent);
+            clientBaseline = AZStd::move(clientCurrent);
+        }
+    }
+
+    TEST_F(BaselineDeltaSerializerTests, ChangingFootprintStillRoundTrips)
+    {
+        BaselineDataElement element;
+        element.m_inventory = { 1, 2, 3, 4 };
+
+        AzNetworking::SerializerBaseline empty;
+        AzNetworking::SerializerBaseline serverBaseline;
+        uint32_t deltaSize = Encode(empty, element, serverBaseline);
+
+        BaselineDataElement received;
+        AzNetworking::SerializerBaseline clientBaseline;
+        EXPECT_TRUE(Decode(empty, deltaSize, received, clientBaseline));
+
+        element.m_inventory = { 1 };
+        element.m_name = "Renamed";
+
+        AzNetworking::SerializerBaseline serverCurrent;
+        deltaSize = Encode(serverBaseline, element, serverCurrent);
+
+        AzNetworking::SerializerBaseline clientCurrent;
+        EXPECT_TRUE(Decode(clientBaseline, deltaSize, received, clientCurrent));
+        ExpectEqual(element, received);
+    }
+
+    TEST_F(BaselineDeltaSerializerTests, TruncatedDeltaFails)
+    {
+        BaselineDataElement element;
+        element.m_id = 99999;
+
+        AzNetworking::SerializerBaseline empty;
+        AzNetworking::SerializerBaseline sentValues;
+        const uint32_t deltaSize = Encode(empty, element, sentValues);
+
+        BaselineDataElement received;
+        AzNetworking::SerializerBaseline receivedValues;
+        EXPECT_FALSE(Decode(empty, deltaSize - 1, received, receivedValues));
+    }
+}
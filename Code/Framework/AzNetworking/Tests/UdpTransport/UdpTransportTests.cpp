@@ -9,13 +9,16 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace UnitTest
@@ -320,4 +323,337 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestParallelSendsOnDifferentConnections)
+    {
+        constexpr uint32_t NumTestClients = 8;
+        constexpr uint32_t NumPacketsPerClient = 200;
+
+        TestUdpServer testServer;
+        TestUdpClient testClient[NumTestClients];
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() < NumTestClients
+            && (AZ::GetElapsedTimeMs() - startTimeMs) < TotalIterationTimeMs)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+        }
+        ASSERT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+
+        AZStd::vector<IConnection*> connections;
+        testServer.m_serverNetworkInterface->GetConnectionSet().VisitConnections(
+            [&connections](IConnection& connection) { connections.push_back(&connection); });
+
+        m_networkingSystemComponent->OnSystemTick();
+        const uint64_t sentPacketsBefore = testServer.m_serverNetworkInterface->GetMetrics().m_sendPackets;
+
+        // Mirrors parallel multiplayer connection updates, each connection is sent on from its own thread
+        AZStd::vector<AZStd::thread> threads;
+        for (IConnection* connection : connections)
+        {
+            threads.emplace_back([connection]()
+            {
+                for (uint32_t i = 0; i < NumPacketsPerClient; ++i)
+                {
+                    EXPECT_NE(connection->SendUnreliablePacket(CorePackets::HeartbeatPacket()), InvalidPacketId);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        m_networkingSystemComponent->OnSystemTick();
+        EXPECT_GE(testServer.m_serverNetworkInterface->GetMetrics().m_sendPackets - sentPacketsBefore, NumTestClients * NumPacketsPerClient);
+    }
+
+    TEST_F(UdpTransportTests, TestMultipleClientsShardedListen)
+    {
+        constexpr uint32_t NumTestClients = 20;
+        constexpr uint32_t NumShards = 4;
+
+        AZ::Console console;
+        console.LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        AZ::Interface<AZ::IConsole>::Register(&console);
+        console.PerformCommand(AZStd::string::format("net_UdpListenShards %u", NumShards).c_str());
+
+        {
+            TestUdpServer testServer;
+            TestUdpClient testClient[NumTestClients];
+
+            UdpNetworkInterface* serverInterface = static_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface);
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+            EXPECT_EQ(serverInterface->GetShardCount(), NumShards);
+#else
+            EXPECT_EQ(serverInterface->GetShardCount(), 1);
+#endif
+
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnSystemTick();
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool canTerminate = serverInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+                for (uint32_t i = 0; i < NumTestClients; ++i)
+                {
+                    canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+                }
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            EXPECT_EQ(serverInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+            }
+
+            const NetworkInterfaceMetrics& metrics = serverInterface->GetMetrics();
+            EXPECT_EQ(metrics.m_shards.size(), serverInterface->GetShardCount() > 1 ? serverInterface->GetShardCount() : 0);
+            uint64_t shardRecvPackets = 0;
+            for (const NetworkInterfaceShardMetrics& shardMetrics : metrics.m_shards)
+            {
+                shardRecvPackets += shardMetrics.m_recvPackets;
+            }
+            if (!metrics.m_shards.empty())
+            {
+                EXPECT_EQ(shardRecvPackets, metrics.m_recvPackets);
+            }
+
+            EXPECT_TRUE(serverInterface->StopListening());
+            EXPECT_EQ(serverInterface->GetShardCount(), 1);
+        }
+
+        console.PerformCommand("net_UdpListenShards 1");
+        AZ::Interface<AZ::IConsole>::Unregister(&console);
+    }
+
+    //! Reads datagrams until the expected number have arrived or the timeout expires, loopback delivery is not synchronous.
+    static uint32_t ReceiveDatagrams(const UdpSocket& socket, UdpSocket::ReceiveSlot* slots, uint32_t count)
+    {
+        constexpr AZ::TimeMs TimeoutMs = AZ::TimeMs{ 1000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        uint32_t receivedCount = 0;
+        while (receivedCount < count && (AZ::GetElapsedTimeMs() - startTimeMs) < TimeoutMs)
+        {
+            const uint32_t batchCount = socket.ReceiveBatch(slots + receivedCount, count - receivedCount);
+            if (batchCount == 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            receivedCount += batchCount;
+        }
+        return receivedCount;
+    }
+
+    TEST_F(UdpTransportTests, BatchedSendsAreDeliveredOnFlush)
+    {
+        constexpr uint32_t DatagramCount = UdpSocket::MaxDatagramBatchSize / 2;
+        constexpr uint16_t ReceiverPort = 12346;
+
+        UdpSocket receiver;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        UdpSocket sender;
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        sender.SetSendBatching(true);
+
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        uint8_t sendBuffer[MaxUdpTransmissionUnit];
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            // Vary the sizes so datagrams can't be mixed up
+            const uint32_t size = 16 + i;
+            memset(sendBuffer, static_cast<int>(i), size);
+            EXPECT_EQ(static_cast<int32_t>(size), sender.Send(receiverAddress, sendBuffer, size, false, dtlsEndpoint, connectionQuality));
+        }
+
+        AZStd::vector<uint8_t> receiveBuffer(DatagramCount * MaxUdpTransmissionUnit);
+        UdpSocket::ReceiveSlot slots[DatagramCount];
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            slots[i].m_buffer = receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+            slots[i].m_capacity = MaxUdpTransmissionUnit;
+        }
+
+        // Nothing leaves the sender until the queue is flushed
+        EXPECT_EQ(0, receiver.ReceiveBatch(slots, DatagramCount));
+
+        sender.FlushSends();
+        ASSERT_EQ(DatagramCount, ReceiveDatagrams(receiver, slots, DatagramCount));
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            ASSERT_EQ(static_cast<int32_t>(16 + i), slots[i].m_receivedBytes);
+            EXPECT_EQ(static_cast<uint8_t>(i), slots[i].m_buffer[0]);
+            EXPECT_EQ(static_cast<uint8_t>(i), slots[i].m_buffer[slots[i].m_receivedBytes - 1]);
+        }
+        EXPECT_EQ(DatagramCount, receiver.GetRecvPackets());
+
+        receiver.Close();
+        sender.Close();
+    }
+
+    TEST_F(UdpTransportTests, PooledSendsAreNotCopied)
+    {
+        constexpr uint32_t DatagramCount = 4;
+        constexpr uint32_t DatagramSize = 64;
+        constexpr uint16_t ReceiverPort = 12348;
+
+        UdpSocket receiver;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        UdpSocket sender;
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        sender.SetSendBatching(true);
+
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            PooledPacketBuffer buffer = sender.AcquirePacketBuffer();
+            buffer->Resize(DatagramSize);
+            memset(buffer->GetBuffer(), static_cast<int>(i), DatagramSize);
+            EXPECT_EQ(static_cast<int32_t>(DatagramSize), sender.Send(receiverAddress, AZStd::move(buffer), false, dtlsEndpoint, connectionQuality));
+        }
+        EXPECT_EQ(0, sender.GetSentPacketCopies());
+
+        // Sending from a raw pointer has to copy the payload into a packet buffer
+        uint8_t sendBuffer[DatagramSize];
+        memset(sendBuffer, static_cast<int>(DatagramCount), DatagramSize);
+        EXPECT_EQ(static_cast<int32_t>(DatagramSize), sender.Send(receiverAddress, sendBuffer, DatagramSize, false, dtlsEndpoint, connectionQuality));
+        EXPECT_EQ(1, sender.GetSentPacketCopies());
+
+        AZStd::vector<uint8_t> receiveBuffer((DatagramCount + 1) * MaxUdpTransmissionUnit);
+        UdpSocket::ReceiveSlot slots[DatagramCount + 1];
+        for (uint32_t i = 0; i <= DatagramCount; ++i)
+        {
+            slots[i].m_buffer = receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+            slots[i].m_capacity = MaxUdpTransmissionUnit;
+        }
+
+        sender.FlushSends();
+        ASSERT_EQ(DatagramCount + 1, ReceiveDatagrams(receiver, slots, DatagramCount + 1));
+        for (uint32_t i = 0; i <= DatagramCount; ++i)
+        {
+            ASSERT_EQ(static_cast<int32_t>(DatagramSize), slots[i].m_receivedBytes);
+            EXPECT_EQ(static_cast<uint8_t>(i), slots[i].m_buffer[0]);
+            EXPECT_EQ(static_cast<uint8_t>(i), slots[i].m_buffer[DatagramSize - 1]);
+        }
+
+        receiver.Close();
+        sender.Close();
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    class UdpSocketLoopbackBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t DatagramsPerIteration = UdpSocket::MaxDatagramBatchSize;
+        static constexpr uint32_t DatagramSize = 256;
+        static constexpr uint16_t ReceiverPort = 12347;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SocketLayerInit();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_sender->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiveBuffer.resize(DatagramsPerIteration * MaxUdpTransmissionUnit);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_sender.reset();
+            m_receiver.reset();
+            m_receiveBuffer = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        //! Sends a full batch to the receiver and reads it back, either one datagram per system call or batched.
+        void Run(::benchmark::State& state, bool batched)
+        {
+            m_sender->SetSendBatching(batched);
+
+            const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+            DtlsEndpoint dtlsEndpoint;
+            ConnectionQuality connectionQuality;
+            uint8_t sendBuffer[DatagramSize] = {};
+            UdpSocket::ReceiveSlot slots[DatagramsPerIteration];
+            for (uint32_t i = 0; i < DatagramsPerIteration; ++i)
+            {
+                slots[i].m_buffer = m_receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+                slots[i].m_capacity = MaxUdpTransmissionUnit;
+            }
+
+            int64_t receivedPackets = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (uint32_t i = 0; i < DatagramsPerIteration; ++i)
+                {
+                    m_sender->Send(receiverAddress, sendBuffer, DatagramSize, false, dtlsEndpoint, connectionQuality);
+                }
+                m_sender->FlushSends();
+
+                // Loopback can drop datagrams if the receive buffer overflows, so give up on an empty socket
+                uint32_t receivedCount = 0;
+                for (uint32_t attempt = 0; receivedCount < DatagramsPerIteration && attempt < 100; ++attempt)
+                {
+                    if (batched)
+                    {
+                        receivedCount += m_receiver->ReceiveBatch(slots + receivedCount, DatagramsPerIteration - receivedCount);
+                    }
+                    else
+                    {
+                        IpAddress address;
+                        if (m_receiver->Receive(address, slots[receivedCount].m_buffer, MaxUdpTransmissionUnit) > 0)
+                        {
+                            ++receivedCount;
+                        }
+                    }
+                }
+                receivedPackets += receivedCount;
+            }
+            state.SetItemsProcessed(receivedPackets);
+        }
+
+    protected:
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::vector<uint8_t> m_receiveBuffer;
+    };
+
+    BENCHMARK_F(UdpSocketLoopbackBenchmark, PerDatagramSendReceive)(benchmark::State& state)
+    {
+        Run(state, false);
+    }
+
+    BENCHMARK_F(UdpSocketLoopbackBenchmark, BatchedSendReceive)(benchmark::State& state)
+    {
+        Run(state, true);
+    }
 }
+#endif // HAVE_BENCHMARK
@@ -13,8 +13,10 @@ set(FILES
     DataStructures/FixedSizeBitsetTests.cpp
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
+    DataStructures/PacketBufferPoolTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
+    Serialization/BaselineDeltaSerializerTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputOutputSerializerTests.cpp
@@ -14,6 +14,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Process/ProcessInfo.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
@@ -1026,6 +1027,19 @@ void AssetBuilderComponent::JobThread()
         AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.00f, AZ::ScriptTimePoint(AZStd::chrono::steady_clock::now()));
         AZ::AllocatorManager::Instance().GarbageCollect();
 
+        // Report how much memory this process holds on to, so the AssetProcessor can decide to recycle it.
+        if (AZ::ProcessMemInfo memInfo; AZ::QueryMemInfo(memInfo))
+        {
+            if (auto* createJobsResponse = azrtti_cast<AssetBuilder::CreateJobsNetResponse*>(job->m_netResponse.get()))
+            {
+                createJobsResponse->m_workingSetBytes = memInfo.m_workingSet;
+            }
+            else if (auto* processJobResponse = azrtti_cast<AssetBuilder::ProcessJobNetResponse*>(job->m_netResponse.get()))
+            {
+                processJobResponse->m_workingSetBytes = memInfo.m_workingSet;
+            }
+        }
+
         AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), job->m_requestSerial);
     }
 }
@@ -99,7 +99,10 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<CreateJobsNetResponse>()->Version(1)->Field("Response", &CreateJobsNetResponse::m_response);
+            serialize->Class<CreateJobsNetResponse>()
+                ->Version(2)
+                ->Field("Response", &CreateJobsNetResponse::m_response)
+                ->Field("WorkingSetBytes", &CreateJobsNetResponse::m_workingSetBytes);
         }
     }
 
@@ -134,7 +137,10 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<ProcessJobNetResponse>()->Version(1)->Field("Response", &ProcessJobNetResponse::m_response);
+            serialize->Class<ProcessJobNetResponse>()
+                ->Version(2)
+                ->Field("Response", &ProcessJobNetResponse::m_response)
+                ->Field("WorkingSetBytes", &ProcessJobNetResponse::m_workingSetBytes);
         }
     }
 
@@ -77,6 +77,9 @@ namespace AssetBuilder
         unsigned int GetMessageType() const override;
 
         AssetBuilderSDK::CreateJobsResponse m_response;
+
+        //! Working set of the builder process when the response was sent. Used by the AssetProcessor to recycle builders.
+        AZ::s64 m_workingSetBytes = 0;
     };
 
     class ProcessJobNetRequest : public AzFramework::AssetSystem::BaseAssetProcessorMessage
@@ -104,6 +107,9 @@ namespace AssetBuilder
         unsigned int GetMessageType() const override;
 
         AssetBuilderSDK::ProcessJobResponse m_response;
+
+        //! Working set of the builder process when the response was sent. Used by the AssetProcessor to recycle builders.
+        AZ::s64 m_workingSetBytes = 0;
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -12,11 +12,13 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/AssetRegistryBinary.h>
 #include <AzFramework/FileTag/FileTagBus.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
 #include <QElapsedTimer>
+#include <QFile>
 #include "PathDependencyManager.h"
 #include <utilities/UuidManager.h>
 
@@ -49,6 +51,16 @@ namespace AssetProcessor
 
         AssetUtilities::ComputeProjectPath();
 
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(m_writeBinaryCatalog, "/Amazon/AssetProcessor/Settings/BinaryAssetCatalog/Enabled");
+            AZ::u64 maxDeltaSegments = m_maxBinaryCatalogDeltaSegments;
+            if (settingsRegistry->Get(maxDeltaSegments, "/Amazon/AssetProcessor/Settings/BinaryAssetCatalog/MaxDeltaSegments"))
+            {
+                m_maxBinaryCatalogDeltaSegments = aznumeric_cast<AZ::u32>(maxDeltaSegments);
+            }
+        }
+
         if (!ConnectToDatabase())
         {
             AZ_Error("AssetCatalog", false, "Failed to connect to sqlite database");
@@ -91,6 +103,7 @@ namespace AssetProcessor
                 QMutexLocker locker(&m_registriesMutex);
                 m_registries[message.m_platform.c_str()].RegisterAsset(assetInfo.m_assetId, assetInfo);
                 m_registries[assetPlatform].SetAssetDependencies(message.m_assetId, message.m_dependencies);
+                TrackBinaryCatalogChange(assetPlatform, message.m_assetId, false);
 
                 using namespace AzFramework::FileTag;
 
@@ -134,6 +147,7 @@ namespace AssetProcessor
                 m_catalogIsDirty = true;
 
                 m_registries[assetPlatform].UnregisterAsset(message.m_assetId);
+                TrackBinaryCatalogChange(assetPlatform, message.m_assetId, true);
 
                 if (m_registryBuiltOnce)
                 {
@@ -352,6 +366,20 @@ namespace AssetProcessor
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Saved %s catalog containing %u assets in %fs\n", platform.toUtf8().constData(), m_registries[platform].m_assetIdToInfo.size(), timer.elapsed() / 1000.0f);
                         }
+
+                        if (m_writeBinaryCatalog)
+                        {
+                            allCatalogsSaved = SaveBinaryCatalog(platform, platformCacheDir) && allCatalogsSaved;
+                        }
+                        else
+                        {
+                            // don't leave a stale binary catalog around, the runtime would prefer it over the xml catalog.
+                            QString binaryRegistryFile = QString("%1/assetcatalog%2").arg(platformCacheDir).arg(AzFramework::AssetRegistryBinary::FileExtension);
+                            if (QFile::exists(binaryRegistryFile))
+                            {
+                                QFile::remove(binaryRegistryFile);
+                            }
+                        }
                     }
                     else
                     {
@@ -373,6 +401,127 @@ namespace AssetProcessor
         }
     }
 
+    bool AssetCatalog::SaveBinaryCatalog(const QString& platform, const QString& platformCacheDir)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        QString binaryRegistryFile = QString("%1/assetcatalog%2").arg(platformCacheDir).arg(AzFramework::AssetRegistryBinary::FileExtension);
+
+        // m_saveBuffer is free again at this point since the xml catalog has been written out.
+        m_saveBuffer.clear();
+        bool appendDelta = false;
+        {
+            QMutexLocker locker(&m_registriesMutex);
+            BinaryCatalogState& state = m_binaryCatalogStates[platform];
+
+            // Compact the catalog back into a single segment once the deltas make up a noticeable part of it,
+            // so that lookups don't have to search through many segments.
+            const bool needsCompaction = state.m_deltaSegmentCount >= m_maxBinaryCatalogDeltaSegments || state.m_deltaSize > state.m_baseSize / 2;
+            appendDelta = state.m_baseWritten && !needsCompaction && QFile::exists(binaryRegistryFile);
+            if (appendDelta)
+            {
+                if (state.m_changedAssets.empty() && state.m_removedAssets.empty())
+                {
+                    return true;
+                }
+                AzFramework::AssetRegistryBinaryWriter::WriteDeltaSegment(m_saveBuffer, m_registries[platform], state.m_changedAssets, state.m_removedAssets);
+            }
+            else
+            {
+                AzFramework::AssetRegistryBinaryWriter::WriteBaseSegment(m_saveBuffer, m_registries[platform]);
+            }
+            state.m_changedAssets.clear();
+            state.m_removedAssets.clear();
+        }
+
+        bool saved = false;
+        if (appendDelta)
+        {
+            AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+            if (AZ::IO::FileIOBase::GetInstance()->Open(binaryRegistryFile.toUtf8().constData(), AZ::IO::OpenMode::ModeAppend | AZ::IO::OpenMode::ModeBinary, fileHandle))
+            {
+                saved = AZ::IO::FileIOBase::GetInstance()->Write(fileHandle, m_saveBuffer.data(), m_saveBuffer.size());
+                AZ::IO::FileIOBase::GetInstance()->Close(fileHandle);
+            }
+        }
+        else
+        {
+            QString workSpace;
+            if (AssetUtilities::CreateTempWorkspace(workSpace))
+            {
+                QString tempRegistryFile = QString("%1/assetcatalog%2.tmp").arg(workSpace).arg(AzFramework::AssetRegistryBinary::FileExtension);
+                AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+                if (AZ::IO::FileIOBase::GetInstance()->Open(tempRegistryFile.toUtf8().constData(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+                {
+                    saved = AZ::IO::FileIOBase::GetInstance()->Write(fileHandle, m_saveBuffer.data(), m_saveBuffer.size());
+                    AZ::IO::FileIOBase::GetInstance()->Close(fileHandle);
+                    saved = saved && AssetUtilities::MoveFileWithTimeout(tempRegistryFile, binaryRegistryFile, 3);
+                }
+                AZ::IO::FileIOBase::GetInstance()->DestroyPath(workSpace.toUtf8().data());
+            }
+        }
+
+        {
+            QMutexLocker locker(&m_registriesMutex);
+            BinaryCatalogState& state = m_binaryCatalogStates[platform];
+            if (!saved)
+            {
+                // the changes that were taken out of the state are lost, so start over with a full catalog next time.
+                state.m_baseWritten = false;
+            }
+            else if (appendDelta)
+            {
+                state.m_deltaSize += m_saveBuffer.size();
+                ++state.m_deltaSegmentCount;
+            }
+            else
+            {
+                state.m_baseWritten = true;
+                state.m_baseSize = m_saveBuffer.size();
+                state.m_deltaSize = 0;
+                state.m_deltaSegmentCount = 0;
+            }
+        }
+
+        if (!saved)
+        {
+            // A partially appended or outdated binary catalog would be loaded instead of the xml catalog that was just saved,
+            // so remove it. The runtime uses the xml catalog until the next full binary write succeeds.
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to write binary catalog %s, removing it", binaryRegistryFile.toUtf8().constData());
+            if (QFile::exists(binaryRegistryFile) && !QFile::remove(binaryRegistryFile))
+            {
+                AZ_Error(AssetProcessor::ConsoleChannel, false, "Unable to remove stale binary catalog %s", binaryRegistryFile.toUtf8().constData());
+            }
+        }
+        else
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Saved %s binary catalog %s (%zu bytes) in %fs\n", platform.toUtf8().constData(),
+                appendDelta ? "delta" : "base", m_saveBuffer.size(), timer.elapsed() / 1000.0f);
+        }
+        return saved;
+    }
+
+    void AssetCatalog::TrackBinaryCatalogChange(const QString& platform, const AZ::Data::AssetId& assetId, bool removed)
+    {
+        if (!m_writeBinaryCatalog)
+        {
+            return;
+        }
+
+        BinaryCatalogState& state = m_binaryCatalogStates[platform];
+        if (removed)
+        {
+            state.m_changedAssets.erase(assetId);
+            state.m_removedAssets.insert(assetId);
+        }
+        else
+        {
+            state.m_removedAssets.erase(assetId);
+            state.m_changedAssets.insert(assetId);
+        }
+    }
+
     AzFramework::AssetSystem::GetUnresolvedDependencyCountsResponse AssetCatalog::HandleGetUnresolvedDependencyCountsRequest(MessageData<AzFramework::AssetSystem::GetUnresolvedDependencyCountsRequest> messageData)
     {
         AzFramework::AssetSystem::GetUnresolvedDependencyCountsResponse response;
@@ -461,6 +610,8 @@ namespace AssetProcessor
             for (QString platform : m_platforms)
             {
                 auto inserted = m_registries.insert(platform, AzFramework::AssetRegistry());
+                // the whole registry is rebuilt, so the next binary catalog is written from scratch.
+                m_binaryCatalogStates[platform] = {};
                 AzFramework::AssetRegistry& currentRegistry = inserted.value();
                 // list of source entries in the database that need to have their UUID updated
                 AZStd::vector<AzToolsFramework::AssetDatabase::SourceDatabaseEntry> sourceEntriesToUpdate;
@@ -658,6 +809,7 @@ namespace AssetProcessor
         {
             QMutexLocker locker(&m_registriesMutex);
             m_registries[platform].RegisterAssetDependency(assetId, newDependency);
+            TrackBinaryCatalogChange(platform, assetId, false);
             message.m_dependencies = AZStd::move(m_registries[platform].GetAssetDependencies(assetId));
         }
 
@@ -157,6 +157,12 @@ namespace AssetProcessor
 
         bool ConnectToDatabase();
 
+        //! Writes the binary catalog of the platform, either as a new file or by appending a delta segment to the existing one.
+        bool SaveBinaryCatalog(const QString& platform, const QString& platformCacheDir);
+
+        //! Records a product change for the next delta segment of the binary catalog. Requires m_registriesMutex to be locked.
+        void TrackBinaryCatalogChange(const QString& platform, const AZ::Data::AssetId& assetId, bool removed);
+
         bool CheckValidatedAssets(AZ::Data::AssetId assetId, const QString& platform);
 
         //! For lookups that don't provide a specific platform, provide a default platform to use.
@@ -210,5 +216,20 @@ namespace AssetProcessor
         AZStd::unordered_multimap<AZ::Data::AssetId, QString> m_cachedNoPreloadDependenyAssetList;
 
         AZStd::vector<char> m_saveBuffer; // so that we don't realloc all the time
+
+        //! Changes made to a platform registry since its binary catalog was last written.
+        struct BinaryCatalogState
+        {
+            AZStd::unordered_set<AZ::Data::AssetId> m_changedAssets;
+            AZStd::unordered_set<AZ::Data::AssetId> m_removedAssets;
+            AZ::u64 m_baseSize = 0;
+            AZ::u64 m_deltaSize = 0;
+            AZ::u32 m_deltaSegmentCount = 0;
+            //! The file on disk may be left over from a previous session, so it's always rewritten the first time.
+            bool m_baseWritten = false;
+        };
+        QHash<QString, BinaryCatalogState> m_binaryCatalogStates; // per platform, protected by m_registriesMutex.
+        bool m_writeBinaryCatalog = false;
+        AZ::u32 m_maxBinaryCatalogDeltaSegments = 16;
     };
 }
@@ -56,6 +56,44 @@ namespace UnitTests
         ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
     }
 
+    TEST_F(BuilderManagerTest, GetBuilderForJobType_PrefersWarmBuilder)
+    {
+        ConnectionManager cm{nullptr};
+        TestBuilderManager bm(&cm);
+
+        const AZ::Uuid jobTypeA = AZ::Uuid::CreateRandom();
+        const AZ::Uuid jobTypeB = AZ::Uuid::CreateRandom();
+
+        constexpr int NumberOfBuilders = 8;
+        AZStd::vector<AssetProcessor::BuilderRef> builders;
+
+        for (int i = 0; i < NumberOfBuilders; ++i)
+        {
+            builders.push_back(bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob));
+        }
+
+        const AZ::Uuid warmBuilderA = builders[3]->GetUuid();
+        const AZ::Uuid warmBuilderB = builders[5]->GetUuid();
+
+        // The first job of a type on a builder is cold, the next one is warm
+        EXPECT_FALSE(bm.ReportJobComplete(warmBuilderA, jobTypeA));
+        EXPECT_TRUE(bm.ReportJobComplete(warmBuilderA, jobTypeA));
+        EXPECT_FALSE(bm.ReportJobComplete(warmBuilderB, jobTypeB));
+
+        builders = {};
+
+        EXPECT_EQ(bm.GetBuilderForJobType(AssetProcessor::BuilderPurpose::ProcessJob, jobTypeA)->GetUuid(), warmBuilderA);
+        EXPECT_EQ(bm.GetBuilderForJobType(AssetProcessor::BuilderPurpose::ProcessJob, jobTypeB)->GetUuid(), warmBuilderB);
+
+        // Job types no builder has seen yet go to a builder that hasn't specialized
+        auto otherBuilder = bm.GetBuilderForJobType(AssetProcessor::BuilderPurpose::ProcessJob, AZ::Uuid::CreateRandom());
+        EXPECT_NE(otherBuilder->GetUuid(), warmBuilderA);
+        EXPECT_NE(otherBuilder->GetUuid(), warmBuilderB);
+
+        // No new builders should have been started
+        EXPECT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
+    }
+
     AZ::Outcome<void, AZStd::string> TestBuilder::Start(AssetProcessor::BuilderPurpose /*purpose*/)
     {
         return AZ::Success();
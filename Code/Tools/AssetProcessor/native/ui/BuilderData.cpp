@@ -178,4 +178,18 @@ namespace AssetProcessor
             Q_EMIT DurationChanged(item.get());
         }
     }
+
+    void BuilderData::OnBuilderJobLatency(AZ::Uuid builderBusId, bool warm, AZ::s64 durationMs)
+    {
+        if (m_builderGuidToIndex.contains(builderBusId))
+        {
+            auto builderItem = m_root->GetChild(m_builderGuidToIndex[builderBusId])->GetChild(0);
+            builderItem->AddJobLatency(warm, durationMs);
+            Q_EMIT DurationChanged(builderItem.get());
+
+            auto allBuildersItem = m_root->GetChild(0)->GetChild(0);
+            allBuildersItem->AddJobLatency(warm, durationMs);
+            Q_EMIT DurationChanged(allBuildersItem.get());
+        }
+    }
 }
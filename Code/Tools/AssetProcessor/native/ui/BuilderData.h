@@ -71,5 +71,6 @@ namespace AssetProcessor
     public Q_SLOTS:
         void OnProcessJobDurationChanged(JobEntry jobEntry, int value);
         void OnCreateJobsDurationChanged(QString sourceName, AZ::s64 scanFolderID);
+        void OnBuilderJobLatency(AZ::Uuid builderBusId, bool warm, AZ::s64 durationMs);
     };
 }
@@ -50,6 +50,45 @@ namespace AssetProcessor
         return m_itemType;
     }
 
+    AZ::s64 BuilderDataItem::GetWarmJobCount() const
+    {
+        return m_warmJobCount;
+    }
+
+    AZ::s64 BuilderDataItem::GetWarmTotalDuration() const
+    {
+        return m_warmTotalDuration;
+    }
+
+    AZ::s64 BuilderDataItem::GetColdJobCount() const
+    {
+        return m_coldJobCount;
+    }
+
+    AZ::s64 BuilderDataItem::GetColdTotalDuration() const
+    {
+        return m_coldTotalDuration;
+    }
+
+    void BuilderDataItem::AddJobLatency(bool warm, AZ::s64 duration)
+    {
+        if (m_itemType != ItemType::Builder)
+        {
+            return;
+        }
+
+        if (warm)
+        {
+            ++m_warmJobCount;
+            m_warmTotalDuration += duration;
+        }
+        else
+        {
+            ++m_coldJobCount;
+            m_coldTotalDuration += duration;
+        }
+    }
+
     AZStd::shared_ptr<BuilderDataItem> BuilderDataItem::GetChild(int row) const
     {
         if (row >= m_children.size())
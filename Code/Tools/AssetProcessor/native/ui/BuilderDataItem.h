@@ -44,6 +44,14 @@ namespace AssetProcessor
         AZ::s64 GetTotalDuration() const;
         ItemType GetItemType() const;
 
+        //! Latency of ProcessJob requests run in this session, split by whether the builder process was already warm for the job type
+        AZ::s64 GetWarmJobCount() const;
+        AZ::s64 GetWarmTotalDuration() const;
+        AZ::s64 GetColdJobCount() const;
+        AZ::s64 GetColdTotalDuration() const;
+        //! This method is only called on Builder: records the latency of a job run on a warm or cold builder process.
+        void AddJobLatency(bool warm, AZ::s64 duration);
+
         //! methods querying the tree structure
         int ChildCount() const;
         AZStd::shared_ptr<BuilderDataItem> GetChild(int row) const;
@@ -69,6 +77,10 @@ namespace AssetProcessor
         AZStd::string m_name;
         AZ::s64 m_jobCount = 0;
         AZ::s64 m_totalDuration = 0;
+        AZ::s64 m_warmJobCount = 0;
+        AZ::s64 m_warmTotalDuration = 0;
+        AZ::s64 m_coldJobCount = 0;
+        AZ::s64 m_coldTotalDuration = 0;
         ItemType m_itemType = ItemType::Max;
     };
 }
@@ -124,6 +124,18 @@ namespace AssetProcessor
                 return item->GetTotalDuration() / item->GetJobCount();
             case aznumeric_cast<int>(Column::TotalDuration):
                 return item->GetTotalDuration();
+            case aznumeric_cast<int>(Column::AverageWarmDuration):
+                if (item->GetWarmJobCount() == 0)
+                {
+                    return QVariant();
+                }
+                return item->GetWarmTotalDuration() / item->GetWarmJobCount();
+            case aznumeric_cast<int>(Column::AverageColdDuration):
+                if (item->GetColdJobCount() == 0)
+                {
+                    return QVariant();
+                }
+                return item->GetColdTotalDuration() / item->GetColdJobCount();
             // Other columns are sorted by Qt::DisplayRole immediately below
             }
         case Qt::DisplayRole:
@@ -141,6 +153,18 @@ namespace AssetProcessor
                 return DurationToQString(item->GetTotalDuration() / item->GetJobCount());
             case aznumeric_cast<int>(Column::TotalDuration):
                 return DurationToQString(item->GetTotalDuration());
+            case aznumeric_cast<int>(Column::AverageWarmDuration):
+                if (item->GetWarmJobCount() == 0)
+                {
+                    return QVariant();
+                }
+                return DurationToQString(item->GetWarmTotalDuration() / item->GetWarmJobCount());
+            case aznumeric_cast<int>(Column::AverageColdDuration):
+                if (item->GetColdJobCount() == 0)
+                {
+                    return QVariant();
+                }
+                return DurationToQString(item->GetColdTotalDuration() / item->GetColdJobCount());
             default:
                 break;
             }
@@ -168,6 +192,10 @@ namespace AssetProcessor
             return tr("Average Duration");
         case aznumeric_cast<int>(Column::TotalDuration):
             return tr("Total Duration");
+        case aznumeric_cast<int>(Column::AverageWarmDuration):
+            return tr("Average Warm Duration");
+        case aznumeric_cast<int>(Column::AverageColdDuration):
+            return tr("Average Cold Duration");
         default:
             AZ_Warning("Asset Processor", false, "Unhandled BuilderInfoMetricsModel header %d", section);
             break;
@@ -220,7 +248,7 @@ namespace AssetProcessor
 
             dataChanged(
                 createIndex(rowNum, aznumeric_cast<int>(Column::JobCount), item),
-                createIndex(rowNum, aznumeric_cast<int>(Column::AverageDuration), item));
+                createIndex(rowNum, aznumeric_cast<int>(Column::AverageColdDuration), item));
             item = item->GetParent().expired() ? nullptr : item->GetParent().lock().get();
         }
     }
@@ -35,6 +35,8 @@ namespace AssetProcessor
             JobCount,
             TotalDuration,
             AverageDuration,
+            AverageWarmDuration,
+            AverageColdDuration,
             Max
         };
 
@@ -563,6 +563,8 @@ void MainWindow::Activate()
     ui->builderInfoMetricsTreeView->setColumnWidth(1, 70);
     ui->builderInfoMetricsTreeView->setColumnWidth(2, 150);
     ui->builderInfoMetricsTreeView->setColumnWidth(3, 150);
+    ui->builderInfoMetricsTreeView->setColumnWidth(4, 150);
+    ui->builderInfoMetricsTreeView->setColumnWidth(5, 150);
     connect(ui->builderList->selectionModel(), &QItemSelectionModel::selectionChanged, this, &MainWindow::BuilderTabSelectionChanged);
     connect(m_guiApplicationManager, &GUIApplicationManager::OnBuildersRegistered, [this]()
     {
@@ -591,6 +593,7 @@ void MainWindow::Activate()
         &AssetProcessorManager::CreateJobsDurationChanged,
         m_builderData,
         &BuilderData::OnCreateJobsDurationChanged);
+    connect(m_guiApplicationManager, &GUIApplicationManager::BuilderJobLatency, m_builderData, &BuilderData::OnBuilderJobLatency);
     connect(m_builderData, &BuilderData::DurationChanged, m_builderInfoMetrics, &BuilderInfoMetricsModel::OnDurationChanged);
 
     // Settings tab:
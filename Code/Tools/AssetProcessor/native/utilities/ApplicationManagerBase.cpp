@@ -1812,8 +1812,11 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
         {
             AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
+            // Route the job to a builder which already ran jobs for this builder type so it can reuse its warm state
             AssetProcessor::BuilderRef builderRef;
-            AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder, AssetProcessor::BuilderPurpose::ProcessJob);
+            AssetProcessor::BuilderManagerBus::BroadcastResult(
+                builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilderForJobType, AssetProcessor::BuilderPurpose::ProcessJob,
+                request.m_builderGuid);
 
             if (builderRef)
             {
@@ -1825,7 +1828,9 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
                 }
 
                 int retryCount = 0;
-                AssetProcessor::BuilderRunJobOutcome result;
+                AssetProcessor::BuilderRunJobOutcome result = AssetProcessor::BuilderRunJobOutcome::JobCancelled;
+                QElapsedTimer jobTimer;
+                jobTimer.start();
 
                 do
                 {
@@ -1850,6 +1855,14 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
                 } while ((result == AssetProcessor::BuilderRunJobOutcome::LostConnection ||
                           result == AssetProcessor::BuilderRunJobOutcome::ProcessTerminated) &&
                           retryCount <= AssetProcessor::RetriesForJobLostConnection);
+
+                if (result == AssetProcessor::BuilderRunJobOutcome::Ok && builderRef)
+                {
+                    bool wasWarm = false;
+                    AssetProcessor::BuilderManagerBus::BroadcastResult(
+                        wasWarm, &AssetProcessor::BuilderManagerBusTraits::ReportJobComplete, builderRef->GetUuid(), request.m_builderGuid);
+                    Q_EMIT BuilderJobLatency(request.m_builderGuid, wasWarm, jobTimer.elapsed());
+                }
             }
             else
             {
@@ -149,6 +149,9 @@ Q_SIGNALS:
     void OnBuildersRegistered();
     void AssetProcesserManagerIdleStateChange(bool isIdle);
     void FullIdle(bool isIdle);
+    //! Emitted from the job threads when an external builder finishes a ProcessJob request.
+    //! warm is true if the builder process had already run jobs for this builder type.
+    void BuilderJobLatency(AZ::Uuid builderBusId, bool warm, AZ::s64 durationMs);
 public Q_SLOTS:
     void OnAssetProcessorManagerIdleState(bool isIdle);
 
@@ -109,6 +109,11 @@ namespace AssetProcessor
         return m_uuid.ToString<AZStd::string>(false, false);
     }
 
+    AZ::s64 Builder::GetLastWorkingSetBytes() const
+    {
+        return m_lastWorkingSetBytes;
+    }
+
     void Builder::PumpCommunicator() const
     {
         if (m_tracePrinter)
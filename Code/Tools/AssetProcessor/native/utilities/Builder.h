@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <utilities/assetUtils.h>
@@ -69,6 +70,9 @@ namespace AssetProcessor
         AZ::Uuid GetUuid() const;
         AZStd::string UuidString() const;
 
+        //! Returns the working set the builder process reported with its last job response, or 0 if it hasn't reported one yet
+        AZ::s64 GetLastWorkingSetBytes() const;
+
         void PumpCommunicator() const;
         void FlushCommunicator() const;
         void TerminateProcess(AZ::u32 exitCode) const;
@@ -136,6 +140,17 @@ namespace AssetProcessor
 
         //! Time to wait in seconds for a builder to startup before timing out.
         AZ::s64 m_startupWaitTimeS = 0;
+
+        //! Builder bus ids of the job types this builder has already run.  The builder keeps the state it built up for these
+        //! (loaded modules, serialize contexts, compilers, etc) so similar jobs are routed back to it.  Guarded by the BuilderList lock.
+        AZStd::unordered_set<AZ::Uuid> m_warmJobTypes;
+
+        //! Set when the builder should be shut down instead of being handed out again, i.e. it is holding on to too much memory.
+        //! Guarded by the BuilderList lock.
+        bool m_recycle = false;
+
+        //! Working set reported by the builder process with its last response
+        mutable AZStd::atomic<AZ::s64> m_lastWorkingSetBytes = 0;
     };
 
     //! Scoped reference to a builder. Destructor returns the builder to the free builders pool
@@ -42,7 +42,7 @@ namespace AssetProcessor
         return itr != m_builders.end() ? itr->second : nullptr;
     }
 
-    BuilderRef BuilderList::GetFirst(BuilderPurpose purpose)
+    BuilderRef BuilderList::GetFirst(BuilderPurpose purpose, const AZ::Uuid& jobTypeId)
     {
         if (purpose == BuilderPurpose::CreateJobs)
         {
@@ -52,7 +52,11 @@ namespace AssetProcessor
                 {
                     m_createJobsBuilder->PumpCommunicator();
 
-                    if (m_createJobsBuilder->IsValid())
+                    if (m_createJobsBuilder->m_recycle)
+                    {
+                        Recycle(m_createJobsBuilder);
+                    }
+                    else if (m_createJobsBuilder->IsValid())
                     {
                         return BuilderRef(m_createJobsBuilder);
                     }
@@ -72,6 +76,10 @@ namespace AssetProcessor
             return {};
         }
 
+        // Prefer a builder that is already warm for this job type.  Otherwise fall back to the idle builder that is warm for the
+        // fewest other job types, which keeps the builders that have specialized available for their own jobs.
+        AZStd::shared_ptr<Builder> fallback;
+
         for (auto itr = m_builders.begin(); itr != m_builders.end();)
         {
             auto& builder = itr->second;
@@ -80,9 +88,24 @@ namespace AssetProcessor
             {
                 builder->PumpCommunicator();
 
-                if (builder->IsValid())
+                if (builder->m_recycle)
+                {
+                    Recycle(builder);
+                }
+                else if (builder->IsValid())
                 {
-                    return BuilderRef(builder);
+                    if (!jobTypeId.IsNull() && builder->m_warmJobTypes.contains(jobTypeId))
+                    {
+                        return BuilderRef(builder);
+                    }
+
+                    if (!fallback || builder->m_warmJobTypes.size() < fallback->m_warmJobTypes.size())
+                    {
+                        fallback = builder;
+                    }
+
+                    ++itr;
+                    continue;
                 }
 
                 itr = m_builders.erase(itr);
@@ -93,7 +116,30 @@ namespace AssetProcessor
             }
         }
 
-        return {};
+        return fallback ? BuilderRef(fallback) : BuilderRef();
+    }
+
+    bool BuilderList::MarkWarm(const AZ::Uuid& builderUuid, const AZ::Uuid& jobTypeId)
+    {
+        auto builder = Find(builderUuid);
+
+        if (!builder || jobTypeId.IsNull())
+        {
+            return false;
+        }
+
+        return !builder->m_warmJobTypes.insert(jobTypeId).second;
+    }
+
+    void BuilderList::Recycle(const AZStd::shared_ptr<Builder>& builder)
+    {
+        AZ_TracePrintf(
+            "BuilderList", "Recycling builder %s, working set %.1f MB\n", builder->UuidString().c_str(),
+            aznumeric_cast<double>(builder->GetLastWorkingSetBytes()) / (1024.0 * 1024.0));
+
+        // Clear the connection first so the lost connection notification doesn't try to remove it again
+        builder->m_connectionId = 0;
+        builder->TerminateProcess(0);
     }
 
     AZStd::string BuilderList::RemoveByConnectionId(AZ::u32 connId)
@@ -150,16 +196,31 @@ namespace AssetProcessor
         if (m_createJobsBuilder && !m_createJobsBuilder->m_busy)
         {
             m_createJobsBuilder->PumpCommunicator();
+
+            if (m_createJobsBuilder->m_recycle)
+            {
+                Recycle(m_createJobsBuilder);
+                m_createJobsBuilder = nullptr;
+            }
         }
 
-        for (auto pair : m_builders)
+        for (auto itr = m_builders.begin(); itr != m_builders.end();)
         {
-            auto builder = pair.second;
+            auto& builder = itr->second;
 
             if (!builder->m_busy)
             {
                 builder->PumpCommunicator();
+
+                if (builder->m_recycle)
+                {
+                    Recycle(builder);
+                    itr = m_builders.erase(itr);
+                    continue;
+                }
             }
+
+            ++itr;
         }
     }
 }
@@ -21,14 +21,22 @@ namespace AssetProcessor
 
         void AddBuilder(AZStd::shared_ptr<Builder> builder, BuilderPurpose purpose);
         AZStd::shared_ptr<Builder> Find(AZ::Uuid uuid);
-        BuilderRef GetFirst(BuilderPurpose purpose);
+        //! Returns an idle builder for the purpose.  For ProcessJob builders, a builder which has already run jobs of type jobTypeId
+        //! is preferred so it can reuse the state it has built up.  Builders flagged for recycling are shut down instead of returned.
+        BuilderRef GetFirst(BuilderPurpose purpose, const AZ::Uuid& jobTypeId = AZ::Uuid::CreateNull());
         AZStd::string RemoveByConnectionId(AZ::u32 connId);
         void RemoveByUuid(AZ::Uuid uuid);
         void PumpIdleBuilders();
 
+        //! Marks the builder as warm for jobTypeId.  Returns true if it already was, meaning the job ran on a warm builder.
+        bool MarkWarm(const AZ::Uuid& builderUuid, const AZ::Uuid& jobTypeId);
+
         AZ_DISABLE_COPY_MOVE(BuilderList);
 
     protected:
+        //! Shuts down an idle builder which has been flagged for recycling
+        static void Recycle(const AZStd::shared_ptr<Builder>& builder);
+
         AZStd::unordered_map<AZ::Uuid, AZStd::shared_ptr<Builder>> m_builders;
         AZStd::shared_ptr<Builder> m_createJobsBuilder; // Special builder reserved for create jobs to ensure CreateJobs never waits for process startup
     };
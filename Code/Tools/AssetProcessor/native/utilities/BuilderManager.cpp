@@ -7,6 +7,7 @@
  */
 
 #include <utilities/BuilderManager.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -22,6 +23,13 @@ namespace AssetProcessor
 
     BuilderManager::BuilderManager(ConnectionManager* connectionManager)
     {
+        if (const auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            AZ::s64 recycleWorkingSetMB = 0;
+            settingsRegistry->Get(recycleWorkingSetMB, "/Amazon/AssetProcessor/Settings/BuilderManager/RecycleWorkingSetMB");
+            m_recycleWorkingSetBytes = recycleWorkingSetMB * 1024 * 1024;
+        }
+
         using namespace AZStd::placeholders;
         connectionManager->RegisterService(AssetBuilder::BuilderHelloRequest::MessageType(), AZStd::bind(&BuilderManager::IncomingBuilderPing, this, _1, _2, _3, _4, _5));
 
@@ -154,6 +162,11 @@ namespace AssetProcessor
     }
 
     BuilderRef BuilderManager::GetBuilder(BuilderPurpose purpose)
+    {
+        return GetBuilderForJobType(purpose, AZ::Uuid::CreateNull());
+    }
+
+    BuilderRef BuilderManager::GetBuilderForJobType(BuilderPurpose purpose, const AZ::Uuid& jobTypeId)
     {
         AZStd::shared_ptr<Builder> newBuilder;
         BuilderRef builderRef;
@@ -169,7 +182,7 @@ namespace AssetProcessor
 
             if (purpose != BuilderPurpose::Registration)
             {
-                auto builder = m_builderList.GetFirst(purpose);
+                auto builder = m_builderList.GetFirst(purpose, jobTypeId);
 
                 if (builder)
                 {
@@ -206,6 +219,24 @@ namespace AssetProcessor
         return builderRef;
     }
 
+    bool BuilderManager::ReportJobComplete(const AZ::Uuid& builderId, const AZ::Uuid& jobTypeId)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+
+        const bool wasWarm = m_builderList.MarkWarm(builderId, jobTypeId);
+
+        if (m_recycleWorkingSetBytes > 0)
+        {
+            if (auto builder = m_builderList.Find(builderId); builder && builder->GetLastWorkingSetBytes() > m_recycleWorkingSetBytes)
+            {
+                // The builder is still referenced by the caller, it will be shut down the next time it is idle
+                builder->m_recycle = true;
+            }
+        }
+
+        return wasWarm;
+    }
+
     void BuilderManager::PumpIdleBuilders()
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
@@ -38,6 +38,19 @@ namespace AssetProcessor
         //! Returns a builder for doing work
         virtual BuilderRef GetBuilder(BuilderPurpose purpose) = 0;
 
+        //! Returns a builder for doing work, preferring one that has already run jobs for the builder with bus id jobTypeId
+        virtual BuilderRef GetBuilderForJobType(BuilderPurpose purpose, [[maybe_unused]] const AZ::Uuid& jobTypeId)
+        {
+            return GetBuilder(purpose);
+        }
+
+        //! Called after a builder finished a job for the builder with bus id jobTypeId.
+        //! Returns true if the builder was already warm for that job type when the job started.
+        virtual bool ReportJobComplete(const AZ::Uuid& /*builderId*/, const AZ::Uuid& /*jobTypeId*/)
+        {
+            return false;
+        }
+
         virtual void AddAssetToBuilderProcessedList(const AZ::Uuid& /*builderId*/, const AZStd::string& /*sourceAsset*/)
         {
         }
@@ -66,6 +79,8 @@ namespace AssetProcessor
 
         //BuilderManagerBus
         BuilderRef GetBuilder(BuilderPurpose purpose) override;
+        BuilderRef GetBuilderForJobType(BuilderPurpose purpose, const AZ::Uuid& jobTypeId) override;
+        bool ReportJobComplete(const AZ::Uuid& builderId, const AZ::Uuid& jobTypeId) override;
         void AddAssetToBuilderProcessedList(const AZ::Uuid& builderId, const AZStd::string& sourceAsset) override;
 
     protected:
@@ -92,6 +107,9 @@ namespace AssetProcessor
         //! Indicates if we allow builders to connect that we haven't started up ourselves.  Useful for debugging
         bool m_allowUnmanagedBuilderConnections = false;
 
+        //! Builders reporting a working set above this are shut down once idle and replaced by a fresh process.  0 disables recycling
+        AZ::s64 m_recycleWorkingSetBytes = 0;
+
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
         AZStd::thread m_pollingThread;
 
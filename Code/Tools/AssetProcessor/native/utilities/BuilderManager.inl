@@ -84,6 +84,7 @@ namespace AssetProcessor
             }
         }
 
+        m_lastWorkingSetBytes = netResponse.m_workingSetBytes;
         response = AZStd::move(netResponse.m_response);
 
         return result;
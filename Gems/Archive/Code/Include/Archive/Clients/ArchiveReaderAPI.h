@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <Archive/Clients/ArchiveBaseAPI.h>
 #include <Archive/Clients/ArchiveInterfaceStructs.h>
@@ -81,6 +82,11 @@ namespace Archive
         //! Configures the maximum number of read task that can run in parallel
         //! For a value of 0 maps to a single read task
         AZ::u32 m_maxReadTasks{ 1 };
+
+        //! When set, an archive mounted from a file on disk is memory mapped on platforms which support it
+        //! This allows IArchiveReader::MapFileFromArchive to return views directly into the mapped archive
+        //! for files stored uncompressed, instead of copying their content into a buffer
+        bool m_memoryMapArchive{ true };
     };
 
     //! Settings for controlling how an individual file is extracted from an archive.
@@ -144,6 +150,40 @@ namespace Archive
         ResultOutcome m_resultOutcome;
     };
 
+    //! Returns result data around mapping the content of a file stored uncompressed within an archive
+    //! The file span is read-only and remains valid for as long as the file handle is alive,
+    //! even if the archive is unmounted
+    struct ArchiveMapFileResult
+    {
+        //! returns if the file has been successfully mapped
+        //! it does by checking that the ArchiveFileToken != InvalidArchiveFileToken
+        explicit operator bool() const;
+
+        //! The file path of the mapped file
+        AZ::IO::Path m_relativeFilePath;
+        //! Identifier token that allows for quicker lookup of the file in the mounted
+        //! archive TOC for the ArchiveReader instance the file was mapped from
+        ArchiveFileToken m_filePathToken{ InvalidArchiveFileToken };
+        //! The uncompressed size of the mapped file
+        AZ::u64 m_uncompressedSize{};
+        //! The raw offset of the file in the archive
+        ArchiveHeader::TocOffsetU64 m_offset{};
+        //! CRC32 checksum of the uncompressed file data
+        AZ::Crc32 m_crc32{};
+        //! Read-only view of the requested range of the file content
+        AZStd::span<const AZStd::byte> m_fileSpan;
+        //! Set to true if the file span is a view into the memory mapped archive
+        //! If false, the file content was read into a buffer owned by the file handle
+        //! This occurs when the archive isn't a file on disk or the platform doesn't support memory mapping
+        bool m_memoryMapped{};
+        //! Keeps the memory the file span views alive
+        //! Resetting the handle invalidates the file span
+        AZStd::shared_ptr<const void> m_fileHandle;
+
+        //! Stores any error messages related to mapping the file from the archive
+        ResultOutcome m_resultOutcome;
+    };
+
     //! Returns a result structure that indicates if removal of a content file from the
     //! archive was successful
     //! Metadata about the file is returned, such as its file path, compressed algorithm ID
@@ -248,6 +288,18 @@ namespace Archive
         virtual ArchiveExtractFileResult ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
             const ArchiveReaderFileSettings& fileSettings) = 0;
 
+        //! Provides a read-only view of the content of a file stored uncompressed in the archive
+        //! If the archive is memory mapped, the view references the mapping directly
+        //! and no copy of the file content is made.
+        //! This is useful for large uncompressed content such as audio banks or shader byte code
+        //! The file path identifier, start offset and bytes to read members of the file settings
+        //! are used to select the range of the file to view.
+        //! @param fileSettings settings used to locate the file and the range of the file to view
+        //! @return ArchiveMapFileResult which on success contains a view of the file content
+        //! and a handle which keeps the view alive.
+        //! Mapping a compressed file fails, ExtractFileFromArchive must be used for those files
+        virtual ArchiveMapFileResult MapFileFromArchive(const ArchiveReaderFileSettings& fileSettings) = 0;
+
         //! List the file metadata from the archive using the ArchiveFileToken
         //! @param filePathToken identifier token that can be used to quickly lookup
         //! metadata about the file
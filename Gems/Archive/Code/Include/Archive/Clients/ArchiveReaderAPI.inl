@@ -38,6 +38,14 @@ namespace Archive
             && m_resultOutcome.has_value();
     }
 
+    // A valid file path token indicates the file was found
+    // and the result outcome indicates if the file content could be mapped
+    inline ArchiveMapFileResult::operator bool() const
+    {
+        return m_filePathToken != InvalidArchiveFileToken
+            && m_resultOutcome.has_value();
+    }
+
     inline constexpr EnumerateArchiveResult::operator bool() const
     {
         return m_resultOutcome.has_value();
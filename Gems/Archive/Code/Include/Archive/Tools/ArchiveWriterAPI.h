@@ -11,6 +11,8 @@
 #include <AzCore/base.h>
 
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 
 #include <Archive/Clients/ArchiveBaseAPI.h>
@@ -81,6 +83,15 @@ namespace Archive
         //! If the value is 0, then a single compression task that will be run
         //! at a given moment
         AZ::u32 m_maxCompressTasks{ AZStd::thread::hardware_concurrency() };
+
+        //! When set, the content of each added file is hashed in 2 MiB blocks
+        //! and a file whose content and compression algorithm matches a file already written by this
+        //! ArchiveWriter instance is not written again.
+        //! Instead its table of contents entry references the same raw blocks and block line entries
+        //! as the existing file.
+        //! The shared blocks are only released once every file referencing them has been removed
+        //! NOTE: The first file added with a specific content determines the compression options used
+        bool m_deduplicateContent{};
     };
 
     enum class ArchiveWriterFileMode : bool
@@ -120,6 +131,16 @@ namespace Archive
     };
 
 
+    //! Pairs the content of a file with the settings used to add it to the archive
+    //! Used to add multiple files to an archive in a single call
+    struct ArchiveWriterFileEntry
+    {
+        //! view of the file content to write to the archive
+        //! The data it references must remain valid until the files have been added
+        AZStd::span<const AZStd::byte> m_fileContent;
+        ArchiveWriterFileSettings m_fileSettings;
+    };
+
     //! Returns result data around operation of adding a stream of content data
     //! to an archive file
     struct ArchiveAddFileResult
@@ -262,6 +283,16 @@ namespace Archive
         virtual ArchiveAddFileResult AddFileToArchive(AZStd::span<const AZStd::byte> inputSpan,
             const ArchiveWriterFileSettings& fileSettings) = 0;
 
+        //! Adds multiple files to the archive
+        //! The blocks of all the files are compressed in parallel using the AZ Task system
+        //! which is much faster than adding many small files one at a time,
+        //! since a small file only consist of a single block to compress.
+        //! The files are written to the archive in the order they are supplied
+        //! @param fileEntries span of file content and the settings to use for adding each file
+        //! @return vector of ArchiveAddFileResult with one entry per element of @fileEntries
+        //! in the same order
+        virtual AZStd::vector<ArchiveAddFileResult> AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry> fileEntries) = 0;
+
         //! Searches for a relative path within the archive
         //! @param relativePath Relative path within archive to search for
         //! @return A token that identifies the Archive file if it exist
@@ -10,4 +10,5 @@
 #      ../Include/Android/ArchiveAndroid.h
 
 set(FILES
+    ../Common/Default/Clients/ArchiveMemoryMap_Default.cpp
 )
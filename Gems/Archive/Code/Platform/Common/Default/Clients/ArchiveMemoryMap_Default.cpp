@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Clients/ArchiveMemoryMap.h>
+
+namespace Archive
+{
+    // Memory mapping isn't supported on this platform
+    // so the ArchiveReader reads file content into buffers instead
+    AZStd::shared_ptr<ArchiveMemoryMap> ArchiveMemoryMap::Create(AZ::IO::PathView)
+    {
+        return {};
+    }
+
+    ArchiveMemoryMap::~ArchiveMemoryMap() = default;
+
+    void ArchiveMemoryMap::Advise(AZ::u64, AZ::u64, AccessHint) const
+    {
+    }
+} // namespace Archive
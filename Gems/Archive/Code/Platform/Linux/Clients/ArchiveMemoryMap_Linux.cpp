@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Clients/ArchiveMemoryMap.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Archive
+{
+    AZStd::shared_ptr<ArchiveMemoryMap> ArchiveMemoryMap::Create(AZ::IO::PathView archivePath)
+    {
+        AZ::IO::FixedMaxPath mapPath{ archivePath };
+        int fileDescriptor = open(mapPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            return {};
+        }
+
+        struct stat fileStat {};
+        void* mappedAddress = MAP_FAILED;
+        if (fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            mappedAddress = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        }
+        // The mapping keeps a reference to the file, so the descriptor is no longer needed
+        close(fileDescriptor);
+
+        if (mappedAddress == MAP_FAILED)
+        {
+            return {};
+        }
+
+        auto memoryMap = AZStd::shared_ptr<ArchiveMemoryMap>(aznew ArchiveMemoryMap(
+            AZStd::span(static_cast<const AZStd::byte*>(mappedAddress), static_cast<size_t>(fileStat.st_size))));
+        // Files are looked up through the table of contents, so by default the archive is accessed randomly
+        memoryMap->Advise(0, memoryMap->GetMappedSpan().size(), AccessHint::Random);
+        return memoryMap;
+    }
+
+    ArchiveMemoryMap::~ArchiveMemoryMap()
+    {
+        if (!m_mappedSpan.empty())
+        {
+            munmap(const_cast<AZStd::byte*>(m_mappedSpan.data()), m_mappedSpan.size());
+        }
+    }
+
+    void ArchiveMemoryMap::Advise(AZ::u64 offset, AZ::u64 size, AccessHint accessHint) const
+    {
+        if (offset >= m_mappedSpan.size() || size == 0)
+        {
+            return;
+        }
+
+        // madvise requires the address to be aligned to a page boundary
+        const AZ::u64 pageSize = static_cast<AZ::u64>(sysconf(_SC_PAGESIZE));
+        const AZ::u64 alignedOffset = offset - (offset % pageSize);
+        const AZ::u64 alignedSize = AZStd::min<AZ::u64>(offset + size, m_mappedSpan.size()) - alignedOffset;
+
+        int advice = MADV_NORMAL;
+        switch (accessHint)
+        {
+        case AccessHint::Random:
+            advice = MADV_RANDOM;
+            break;
+        case AccessHint::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case AccessHint::WillNeed:
+            advice = MADV_WILLNEED;
+            break;
+        }
+
+        madvise(const_cast<AZStd::byte*>(m_mappedSpan.data() + alignedOffset), alignedSize, advice);
+    }
+} // namespace Archive
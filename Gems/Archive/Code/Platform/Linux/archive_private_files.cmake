@@ -10,4 +10,5 @@
 #      ../Include/Linux/ArchiveLinux.h
 
 set(FILES
+    Clients/ArchiveMemoryMap_Linux.cpp
 )
@@ -10,4 +10,5 @@
 #      ../Include/Mac/ArchiveMac.h
 
 set(FILES
+    ../Common/Default/Clients/ArchiveMemoryMap_Default.cpp
 )
@@ -10,4 +10,5 @@
 #      ../Include/Windows/ArchiveWindows.h
 
 set(FILES
+    ../Common/Default/Clients/ArchiveMemoryMap_Default.cpp
 )
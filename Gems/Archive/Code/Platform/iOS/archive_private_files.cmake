@@ -10,4 +10,5 @@
 #      ../Include/iOS/ArchiveiOS.h
 
 set(FILES
+    ../Common/Default/Clients/ArchiveMemoryMap_Default.cpp
 )
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace Archive
+{
+    //! Read-only memory mapping of an entire archive file
+    //! The mapping is used to hand out views of files stored uncompressed in the archive
+    //! without copying them into a caller supplied buffer
+    //! The platform specific implementation of the Create, Advise and destructor functions
+    //! is located in the Platform/<PlatformName>/Clients/ArchiveMemoryMap_<PlatformName>.cpp files
+    class ArchiveMemoryMap
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ArchiveMemoryMap, AZ::SystemAllocator);
+
+        //! Hints to the operating system on how a range of the mapping will be accessed
+        enum class AccessHint
+        {
+            //! Pages are accessed in random order, so read ahead should be reduced
+            Random,
+            //! Pages are accessed in sequential order, so aggressive read ahead is beneficial
+            Sequential,
+            //! Pages will be accessed soon, so they should be paged in ahead of time
+            WillNeed
+        };
+
+        //! Maps the archive file at the specified path into memory
+        //! @return shared pointer to the mapping or nullptr if the file could not be mapped
+        //! or the platform does not support memory mapping
+        static AZStd::shared_ptr<ArchiveMemoryMap> Create(AZ::IO::PathView archivePath);
+
+        ~ArchiveMemoryMap();
+        ArchiveMemoryMap(const ArchiveMemoryMap&) = delete;
+        ArchiveMemoryMap& operator=(const ArchiveMemoryMap&) = delete;
+
+        //! Returns a view of the entire mapped archive
+        AZStd::span<const AZStd::byte> GetMappedSpan() const
+        {
+            return m_mappedSpan;
+        }
+
+        //! Forwards an access hint for the range [offset, offset + size) of the mapping to the operating system
+        //! The hint is ignored on platforms which don't support it
+        void Advise(AZ::u64 offset, AZ::u64 size, AccessHint accessHint) const;
+
+    private:
+        explicit ArchiveMemoryMap(AZStd::span<const AZStd::byte> mappedSpan)
+            : m_mappedSpan(mappedSpan)
+        {}
+
+        AZStd::span<const AZStd::byte> m_mappedSpan;
+    };
+} // namespace Archive
@@ -12,6 +12,7 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/OpenMode.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Task/TaskGraph.h>
 
 #include <Archive/ArchiveTypeIds.h>
@@ -272,6 +273,22 @@ namespace Archive
             && ReadArchiveTOC(m_archiveToc, *m_archiveStream, m_archiveHeader)
             && BuildFilePathMap(m_archiveToc.m_tocView);
 
+        // Memory map the archive if the stream is backed by a file on disk
+        // The GenericStream API returns an empty file name for in-memory streams
+        if (mountResult && m_settings.m_memoryMapArchive)
+        {
+            if (AZ::IO::PathView archivePath = m_archiveStream->GetFilename();
+                !archivePath.empty())
+            {
+                m_memoryMap = ArchiveMemoryMap::Create(archivePath);
+                // Discard a mapping that doesn't match the archive stream contents
+                if (m_memoryMap != nullptr && m_memoryMap->GetMappedSpan().size() != m_archiveStream->GetLength())
+                {
+                    m_memoryMap.reset();
+                }
+            }
+        }
+
         return mountResult;
     }
 
@@ -288,6 +305,9 @@ namespace Archive
             m_archiveHeader = {};
         }
 
+        // Any file handles returned from MapFileFromArchive keep the mapping alive
+        m_memoryMap.reset();
+
         m_archiveStream.reset();
     }
 
@@ -296,24 +316,26 @@ namespace Archive
         return m_archiveStream != nullptr && m_archiveStream->IsOpen();
     }
 
-    ArchiveExtractFileResult ArchiveReader::ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
-        const ArchiveReaderFileSettings& fileSettings)
+    ArchiveListFileResult ArchiveReader::ListFileUsingIdentifier(const ArchiveReaderFileSettings& fileSettings) const
     {
-        ArchiveListFileResult listResult;
         if (auto filePathString = AZStd::get_if<AZ::IO::PathView>(&fileSettings.m_filePathIdentifier);
             filePathString != nullptr)
         {
-            listResult = ListFileInArchive(*filePathString);
-        }
-        else
-        {
-            // The only remaining alternative is the ArchiveFileToken
-            // so use AZStd::get is used on a reference to the variant
-            // Make sure the filePathToken points to file within the TOC
-            const ArchiveFileToken archiveFileToken = AZStd::get<ArchiveFileToken>(fileSettings.m_filePathIdentifier);
-            listResult = ListFileInArchive(archiveFileToken);
+            return ListFileInArchive(*filePathString);
         }
 
+        // The only remaining alternative is the ArchiveFileToken
+        // so use AZStd::get is used on a reference to the variant
+        // Make sure the filePathToken points to file within the TOC
+        const ArchiveFileToken archiveFileToken = AZStd::get<ArchiveFileToken>(fileSettings.m_filePathIdentifier);
+        return ListFileInArchive(archiveFileToken);
+    }
+
+    ArchiveExtractFileResult ArchiveReader::ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
+        const ArchiveReaderFileSettings& fileSettings)
+    {
+        ArchiveListFileResult listResult = ListFileUsingIdentifier(fileSettings);
+
         // Copy the result of listing the file in the archive to the extract result structure
         ArchiveExtractFileResult extractResult;
         extractResult.m_relativeFilePath = listResult.m_relativeFilePath;
@@ -386,6 +408,74 @@ namespace Archive
         return extractResult;
     }
 
+    ArchiveMapFileResult ArchiveReader::MapFileFromArchive(const ArchiveReaderFileSettings& fileSettings)
+    {
+        ArchiveListFileResult listResult = ListFileUsingIdentifier(fileSettings);
+
+        ArchiveMapFileResult mapResult;
+        mapResult.m_relativeFilePath = listResult.m_relativeFilePath;
+        mapResult.m_filePathToken = listResult.m_filePathToken;
+        mapResult.m_uncompressedSize = listResult.m_uncompressedSize;
+        mapResult.m_offset = listResult.m_offset;
+        mapResult.m_crc32 = listResult.m_crc32;
+        mapResult.m_resultOutcome = listResult.m_resultOutcome;
+
+        if (!mapResult)
+        {
+            return mapResult;
+        }
+
+        // Compressed content has to be decompressed into a buffer, so it can't be viewed in place
+        if (listResult.m_compressionAlgorithm != Compression::Uncompressed
+            && listResult.m_compressionAlgorithm != Compression::Invalid)
+        {
+            mapResult.m_resultOutcome = AZStd::unexpected(ResultString::format(R"(File "%s" is compressed with algorithm ID %x.)"
+                " Only files stored uncompressed can be mapped. Use ExtractFileFromArchive instead",
+                mapResult.m_relativeFilePath.c_str(), static_cast<AZ::u32>(listResult.m_compressionAlgorithm)));
+            return mapResult;
+        }
+
+        // Clamp the range to view to the uncompressed size of the file
+        const AZ::u64 fileSize = mapResult.m_uncompressedSize;
+        const AZ::u64 startOffset = AZStd::min(fileSettings.m_startOffset, fileSize);
+        const AZ::u64 bytesToMap = AZStd::min(fileSettings.m_bytesToRead, fileSize - startOffset);
+        const AZ::u64 mapOffset = mapResult.m_offset + startOffset;
+
+        if (m_memoryMap != nullptr && mapOffset + bytesToMap <= m_memoryMap->GetMappedSpan().size())
+        {
+            // The TOC provides the exact range the caller is about to read,
+            // so let the operating system page it in ahead of time
+            // Large files are expected to be consumed front to back, so read ahead is increased for them
+            if (bytesToMap >= ArchiveBlockSizeForCompression)
+            {
+                m_memoryMap->Advise(mapOffset, bytesToMap, ArchiveMemoryMap::AccessHint::Sequential);
+            }
+            m_memoryMap->Advise(mapOffset, bytesToMap, ArchiveMemoryMap::AccessHint::WillNeed);
+
+            mapResult.m_fileSpan = m_memoryMap->GetMappedSpan().subspan(mapOffset, bytesToMap);
+            mapResult.m_memoryMapped = true;
+            mapResult.m_fileHandle = m_memoryMap;
+            return mapResult;
+        }
+
+        // The archive isn't memory mapped, so read the file content into a buffer owned by the file handle
+        auto fileBuffer = AZStd::make_shared<AZStd::vector<AZStd::byte>>();
+        fileBuffer->resize_no_construct(bytesToMap);
+        if (ReadRawFileOutcome readFileOutcome = ReadRawFileIntoBuffer(*fileBuffer, mapResult.m_offset,
+            fileSize, fileSettings);
+            readFileOutcome)
+        {
+            mapResult.m_fileSpan = readFileOutcome.value();
+            mapResult.m_fileHandle = AZStd::move(fileBuffer);
+        }
+        else
+        {
+            mapResult.m_resultOutcome = AZStd::unexpected(AZStd::move(readFileOutcome.error()));
+        }
+
+        return mapResult;
+    }
+
     auto ArchiveReader::ReadRawFileIntoBuffer(AZStd::span<AZStd::byte> fileBuffer, AZ::u64 offset,
         AZ::u64 fileSize,
         const ArchiveReaderFileSettings& fileSettings)
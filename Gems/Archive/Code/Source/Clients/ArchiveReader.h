@@ -11,6 +11,7 @@
 #include <Archive/Clients/ArchiveBaseAPI.h>
 #include <Archive/Clients/ArchiveReaderAPI.h>
 
+#include <Clients/ArchiveMemoryMap.h>
 #include <Clients/ArchiveTOCView.h>
 
 #include <AzCore/Memory/Memory_fwd.h>
@@ -81,6 +82,14 @@ namespace Archive
         ArchiveExtractFileResult ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
             const ArchiveReaderFileSettings& fileSettings) override;
 
+        //! Provides a read-only view of the content of a file stored uncompressed in the archive
+        //! When the archive is memory mapped, the view references the mapping directly,
+        //! otherwise the file content is read into a buffer owned by the returned file handle
+        //! @param fileSettings settings used to locate the file and the range of the file to view
+        //! @return ArchiveMapFileResult which on success contains a view of the file content
+        //! and a handle which keeps the view alive.
+        ArchiveMapFileResult MapFileFromArchive(const ArchiveReaderFileSettings& fileSettings) override;
+
         //! List the file metadata from the archive using the ArchiveFileToken
         //! @param filePathToken identifier token that can be used to quickly lookup
         //! metadata about the file
@@ -135,6 +144,10 @@ namespace Archive
         //! ArchiveTocFilePathIndex, ArchiveTocFileMetadata and ArchiveFilePath vector structures
         bool BuildFilePathMap(const ArchiveTableOfContentsView& archiveToc);
 
+        //! Lists the file metadata using either the file path or the ArchiveFileToken
+        //! stored in the file path identifier of the file settings
+        ArchiveListFileResult ListFileUsingIdentifier(const ArchiveReaderFileSettings& fileSettings) const;
+
         //! Read data from offset within archive directly to span
         //! @param fileBuffer pre-allocated span to populate buffer with data
         //! @param offset absolute file within mounted archive to start reading data from
@@ -205,6 +218,13 @@ namespace Archive
         //! GenericStream pointer which stores the open archive
         ArchiveStreamPtr m_archiveStream;
 
+        //! Read-only memory mapping of the mounted archive
+        //! It is only created if the archive stream is a file on disk, the platform supports memory mapping
+        //! and the ArchiveReaderSettings::m_memoryMapArchive option is set
+        //! The mapping is shared with the file handles returned from MapFileFromArchive,
+        //! so it stays alive until all of those handles have been released
+        AZStd::shared_ptr<ArchiveMemoryMap> m_memoryMap;
+
         //! Protects reads within the archive stream
         //! NOTE: This does restrict read jobs to be done on one thread at a time
         //! if done using the AZ::IO::GenericStream API as it maintains a single seek position
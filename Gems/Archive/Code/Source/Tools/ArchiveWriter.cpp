@@ -12,7 +12,11 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/OpenMode.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Sha1.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Task/TaskGraph.h>
@@ -458,11 +462,14 @@ namespace Archive
 
             // Clear out the path map, the archive TOC and the archive header
             // deleted block size -> raw file offset
+            // the deduplicated content maps
             // and the removed file index into TOC vector set
             // on unmount
             m_pathMap.clear();
             m_removedFileIndices.clear();
             m_deletedBlockSizeToOffsetMap.clear();
+            m_deduplicatedContentMap.clear();
+            m_deduplicatedOffsetMap.clear();
             m_archiveToc = {};
             m_archiveHeader = {};
         }
@@ -819,231 +826,456 @@ namespace Archive
     ArchiveAddFileResult ArchiveWriter::AddFileToArchive(AZStd::span<const AZStd::byte> inputSpan,
         const ArchiveWriterFileSettings& fileSettings)
     {
-        if (fileSettings.m_relativeFilePath.empty())
+        const ArchiveWriterFileEntry fileEntry{ inputSpan, fileSettings };
+        AZStd::vector<ArchiveAddFileResult> results = AddFilesToArchive(AZStd::span(&fileEntry, 1));
+        return AZStd::move(results.front());
+    }
+
+    AZStd::vector<ArchiveAddFileResult> ArchiveWriter::AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry> fileEntries)
+    {
+        AZStd::vector<ArchiveAddFileResult> results(fileEntries.size());
+
+        // Stores the indices of the file entries which can be written to the archive
+        AZStd::vector<size_t> validEntryIndices;
+        validEntryIndices.reserve(fileEntries.size());
+        // Stores the file paths of this batch, in order to also detect duplicate paths
+        // within the batch when the ArchiveWriterFileMode is set to only add new files
+        AZStd::unordered_set<AZ::IO::Path> batchFilePaths;
+
+        for (size_t entryIndex = 0; entryIndex < fileEntries.size(); ++entryIndex)
         {
-            ArchiveAddFileResult errorResult;
-            errorResult.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
-            errorResult.m_resultOutcome = AZStd::unexpected(
-                ResultString(R"(The file path is empty. File will not be added to the archive.)"));
-            return errorResult;
+            const ArchiveWriterFileSettings& fileSettings = fileEntries[entryIndex].m_fileSettings;
+            ArchiveAddFileResult& result = results[entryIndex];
+            if (fileSettings.m_relativeFilePath.empty())
+            {
+                result.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
+                result.m_resultOutcome = AZStd::unexpected(
+                    ResultString(R"(The file path is empty. File will not be added to the archive.)"));
+                continue;
+            }
+
+            // Update the file case based on the ArchiveFilePathCase enum
+            AZ::IO::Path filePath(fileSettings.m_relativeFilePath);
+            switch (fileSettings.m_fileCase)
+            {
+            case ArchiveFilePathCase::Lowercase:
+                AZStd::to_lower(filePath.Native());
+                break;
+            case ArchiveFilePathCase::Uppercase:
+                AZStd::to_upper(filePath.Native());
+                break;
+            }
+
+            // Check if a file being added is already in the archive
+            // If the ArchiveWriterFileMode is set to only add new files
+            // return an ArchiveAddFileResult with an invalid file token
+            if (fileSettings.m_fileMode == ArchiveWriterFileMode::AddNew
+                && (ContainsFile(filePath) || batchFilePaths.contains(filePath)))
+            {
+                result.m_relativeFilePath = AZStd::move(filePath);
+                result.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
+                result.m_resultOutcome = AZStd::unexpected(
+                    ResultString::format(R"(The file with relative path "%s" already exist in the archive.)"
+                        " The FileMode::AddNew option was specified.",
+                        result.m_relativeFilePath.c_str()));
+                continue;
+            }
+
+            // Supply the file path with the case changed
+            result.m_relativeFilePath = AZStd::move(filePath);
+            batchFilePaths.emplace(result.m_relativeFilePath);
+            validEntryIndices.push_back(entryIndex);
         }
 
-        // Update the file case based on the ArchiveFilePathCase enum
-        AZ::IO::Path filePath(fileSettings.m_relativeFilePath);
-        switch (fileSettings.m_fileCase)
+        // Empty files have no raw blocks to share, so they are never deduplicated
+        auto IsDeduplicated = [this, fileEntries](size_t entryIndex)
         {
-        case ArchiveFilePathCase::Lowercase:
-            AZStd::to_lower(filePath.Native());
-            break;
-        case ArchiveFilePathCase::Uppercase:
-            AZStd::to_upper(filePath.Native());
-            break;
-        }
+            return m_settings.m_deduplicateContent && !fileEntries[entryIndex].m_fileContent.empty();
+        };
 
-        // Check if a file being added is already in the archive
-        // If the ArchiveWriterFileMode is set to only add new files
-        // return an ArchiveAddFileResult with an invalid file token
-        if (fileSettings.m_fileMode == ArchiveWriterFileMode::AddNew
-            && ContainsFile(filePath))
+        AZStd::vector<ContentDigest> contentDigests;
+        if (m_settings.m_deduplicateContent)
         {
-            ArchiveAddFileResult errorResult;
-            errorResult.m_relativeFilePath = AZStd::move(filePath);
-            errorResult.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
-            errorResult.m_resultOutcome = AZStd::unexpected(
-                ResultString::format(R"(The file with relative path "%s" already exist in the archive.)"
-                    " The FileMode::AddNew option was specified.",
-                    errorResult.m_relativeFilePath.c_str()));
-            return errorResult;
+            contentDigests = ComputeContentDigests(fileEntries, validEntryIndices);
         }
 
-        ArchiveAddFileResult result;
-        // Supply the file path with the case changed
-        result.m_relativeFilePath = AZStd::move(filePath);
-
-        // Storage buffer used to store the file data if it s compressed
-        // It's lifetime must outlive the CompressContentOutcome
-        AZStd::vector<AZStd::byte> compressionBuffer;
-
-        CompressContentOutcome compressOutcome = CompressContentFileAsync(compressionBuffer, fileSettings, inputSpan);
-        if (!compressOutcome)
+        // Gather the files which needs to be compressed
+        // A file whose content matches a file already written to the archive
+        // or an earlier file in this batch shares the raw blocks of that file, so it is not compressed
+        constexpr size_t NoCompressRequest = AZStd::numeric_limits<size_t>::max();
+        AZStd::vector<size_t> entryCompressRequestIndices(fileEntries.size(), NoCompressRequest);
+        AZStd::vector<CompressContentRequest> compressRequests;
+        compressRequests.reserve(validEntryIndices.size());
         {
-            result.m_compressionAlgorithm = fileSettings.m_compressionAlgorithm;
-            result.m_resultOutcome = AZStd::unexpected(AZStd::move(compressOutcome.error()));
-            return result;
+            AZStd::unordered_set<ContentDigest, ContentDigestHasher> batchContentDigests;
+            for (size_t entryIndex : validEntryIndices)
+            {
+                if (IsDeduplicated(entryIndex)
+                    && (m_deduplicatedContentMap.contains(contentDigests[entryIndex])
+                        || !batchContentDigests.emplace(contentDigests[entryIndex]).second))
+                {
+                    continue;
+                }
+
+                entryCompressRequestIndices[entryIndex] = compressRequests.size();
+                CompressContentRequest& compressRequest = compressRequests.emplace_back();
+                compressRequest.m_fileSettings = &fileEntries[entryIndex].m_fileSettings;
+                compressRequest.m_inputDataSpan = fileEntries[entryIndex].m_fileContent;
+            }
         }
 
-        // Populate the compression algorithm used in the result structure
-        if (compressOutcome->m_compressionAlgorithmIndex < m_archiveHeader.m_compressionAlgorithmsIds.size())
+        CompressContentFilesAsync(compressRequests);
+
+        // Write the files to the archive in the order they were supplied
+        for (size_t entryIndex : validEntryIndices)
         {
-            result.m_compressionAlgorithm = m_archiveHeader.m_compressionAlgorithmsIds[compressOutcome->m_compressionAlgorithmIndex];
+            const ArchiveWriterFileEntry& fileEntry = fileEntries[entryIndex];
+            ArchiveAddFileResult& result = results[entryIndex];
+
+            if (IsDeduplicated(entryIndex))
+            {
+                if (auto deduplicatedIt = m_deduplicatedContentMap.find(contentDigests[entryIndex]);
+                    deduplicatedIt != m_deduplicatedContentMap.end())
+                {
+                    const AZ::u8 compressionAlgorithmIndex = deduplicatedIt->second.m_fileMetadata.m_compressionAlgoIndex;
+                    if (compressionAlgorithmIndex < m_archiveHeader.m_compressionAlgorithmsIds.size())
+                    {
+                        result.m_compressionAlgorithm = m_archiveHeader.m_compressionAlgorithmsIds[compressionAlgorithmIndex];
+                    }
+                    result.m_filePathToken = WriteDeduplicatedFileToArchive(fileEntry.m_fileSettings,
+                        result.m_relativeFilePath, contentDigests[entryIndex]);
+                    continue;
+                }
+            }
+
+            // The file content is compressed now if it was skipped above,
+            // but the file it was expected to share content with could not be added
+            CompressContentRequest fallbackCompressRequest;
+            CompressContentRequest* compressRequest = &fallbackCompressRequest;
+            if (entryCompressRequestIndices[entryIndex] != NoCompressRequest)
+            {
+                compressRequest = &compressRequests[entryCompressRequestIndices[entryIndex]];
+            }
+            else
+            {
+                fallbackCompressRequest.m_fileSettings = &fileEntry.m_fileSettings;
+                fallbackCompressRequest.m_inputDataSpan = fileEntry.m_fileContent;
+                CompressContentFilesAsync(AZStd::span(&fallbackCompressRequest, 1));
+            }
+
+            CompressContentOutcome& compressOutcome = compressRequest->m_compressOutcome;
+            if (!compressOutcome)
+            {
+                result.m_compressionAlgorithm = fileEntry.m_fileSettings.m_compressionAlgorithm;
+                result.m_resultOutcome = AZStd::unexpected(AZStd::move(compressOutcome.error()));
+                continue;
+            }
+
+            // Populate the compression algorithm used in the result structure
+            if (compressOutcome->m_compressionAlgorithmIndex < m_archiveHeader.m_compressionAlgorithmsIds.size())
+            {
+                result.m_compressionAlgorithm = m_archiveHeader.m_compressionAlgorithmsIds[compressOutcome->m_compressionAlgorithmIndex];
+            }
+            // Update the archive stream
+            ContentFileData contentFileData;
+            contentFileData.m_relativeFilePath = result.m_relativeFilePath;
+            contentFileData.m_uncompressedSpan = fileEntry.m_fileContent;
+            contentFileData.m_contentFileBlocks = AZStd::move(*compressOutcome);
+
+            // Write the file content to the archive stream and store the archive file path token
+            // which is used to lookup the file for removal
+            result.m_filePathToken = WriteContentFileToArchive(fileEntry.m_fileSettings, contentFileData);
+
+            // Register the written content, so that later files with the same content can reference it
+            if (IsDeduplicated(entryIndex))
+            {
+                const ArchiveTocFileMetadata& fileMetadata =
+                    m_archiveToc.m_fileMetadataTable[static_cast<size_t>(result.m_filePathToken)];
+                m_deduplicatedContentMap[contentDigests[entryIndex]] = DeduplicatedContent{ fileMetadata, 1 };
+                m_deduplicatedOffsetMap[fileMetadata.m_offset] = contentDigests[entryIndex];
+            }
         }
-        // Update the archive stream
-        ContentFileData contentFileData;
-        contentFileData.m_relativeFilePath = result.m_relativeFilePath;
-        contentFileData.m_uncompressedSpan = inputSpan;
-        contentFileData.m_contentFileBlocks = AZStd::move(*compressOutcome);
 
-        // Write the file content to the archive stream and store the archive file path token
-        // which is used to lookup the file for removal
-        result.m_filePathToken = WriteContentFileToArchive(fileSettings, contentFileData);
-        return result;
+        return results;
     }
 
-
-    auto ArchiveWriter::CompressContentFileAsync(AZStd::vector<AZStd::byte>& compressionDataBuffer,
-        const ArchiveWriterFileSettings& fileSettings,
-        AZStd::span<const AZStd::byte> inputDataSpan) -> CompressContentOutcome
+    void ArchiveWriter::ExecuteParallelTasks(size_t taskCount, const AZStd::function<void(size_t)>& taskFunction)
     {
-        // If the file is empty, there is nothing to compress
-        if (inputDataSpan.empty())
+        // Make sure there is at least one task that runs to make sure that progress
+        // is always being made
+        const size_t maxParallelTasks = AZStd::max(1U, m_settings.m_maxCompressTasks);
+
+        for (size_t taskStartIndex = 0; taskStartIndex < taskCount; taskStartIndex += maxParallelTasks)
         {
-            return ContentFileBlocks{};
-        }
+            const size_t iterationTaskCount = AZStd::min(taskCount - taskStartIndex, maxParallelTasks);
 
-        // Try to register the compression algorithm id with the Archive Header compression algorithm id array
-        // if has not already been registered
-        AddCompressionAlgorithmId(fileSettings.m_compressionAlgorithm, m_archiveHeader);
+            // Task graph event used to block until all tasks of the iteration have completed
+            auto taskWriteGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Archive Writer Task Sync");
+            AZ::TaskGraph taskGraph{ "Archive Writer Tasks" };
+            AZ::TaskDescriptor taskDescriptor{ "Archive Writer Task", "Archive Content File Compression" };
 
-        // Now lookup the compression algorithm id to make sure it corresponds to a valid entry
-        // in the compression algorithm id array
-        size_t compressionAlgorithmIndex = FindCompressionAlgorithmId(fileSettings.m_compressionAlgorithm, m_archiveHeader);
+            for (size_t taskIndex = taskStartIndex; taskIndex < taskStartIndex + iterationTaskCount; ++taskIndex)
+            {
+                taskGraph.AddTask(taskDescriptor, [&taskFunction, taskIndex]()
+                {
+                    taskFunction(taskIndex);
+                });
+            }
 
-        // If a valid compression algorithm Id is not found in the compression algorithm id array
-        // then an invalid file token is returned
-        if (compressionAlgorithmIndex == InvalidAlgorithmIndex)
-        {
-            AZStd::unexpected<ResultString> errorString = AZStd::unexpected(
-                ResultString::format(R"(Unable to locate compression algorithm registered with id %u in the archive.)",
-                    static_cast<AZ::u32>(fileSettings.m_compressionAlgorithm)));
-            return errorString;
+            taskGraph.SubmitOnExecutor(m_taskWriteExecutor, taskWriteGraphEvent.get());
+            // Sync on the task completion
+            taskWriteGraphEvent->Wait();
         }
+    }
+
+    bool ArchiveWriter::ContentDigest::operator==(const ContentDigest& other) const
+    {
+        return AZStd::equal(AZStd::begin(m_sha1), AZStd::end(m_sha1), AZStd::begin(other.m_sha1))
+            && m_uncompressedSize == other.m_uncompressedSize
+            && m_compressionAlgorithmId == other.m_compressionAlgorithmId;
+    }
 
-        ContentFileBlocks contentFileBlocks;
-        contentFileBlocks.m_writeSpan = inputDataSpan;
+    bool ArchiveWriter::ContentDigest::operator!=(const ContentDigest& other) const
+    {
+        return !operator==(other);
+    }
 
-        if (compressionAlgorithmIndex >= UncompressedAlgorithmIndex)
+    size_t ArchiveWriter::ContentDigestHasher::operator()(const ContentDigest& contentDigest) const
+    {
+        size_t seed{};
+        AZStd::hash_combine(seed, contentDigest.m_sha1[0], contentDigest.m_sha1[1], contentDigest.m_uncompressedSize,
+            static_cast<AZ::u32>(contentDigest.m_compressionAlgorithmId));
+        return seed;
+    }
+
+    auto ArchiveWriter::ComputeContentDigests(AZStd::span<const ArchiveWriterFileEntry> fileEntries,
+        AZStd::span<const size_t> entryIndices) -> AZStd::vector<ContentDigest>
+    {
+        AZStd::vector<ContentDigest> contentDigests(fileEntries.size());
+
+        // Each 2 MiB block of each file is hashed in its own task
+        struct HashBlock
         {
-            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
-            return contentFileBlocks;
+            size_t m_entryIndex{};
+            size_t m_blockStartOffset{};
+            AZ::u32 m_sha1[5]{};
+        };
+        AZStd::vector<HashBlock> hashBlocks;
+        for (size_t entryIndex : entryIndices)
+        {
+            const size_t contentSize = fileEntries[entryIndex].m_fileContent.size();
+            for (size_t blockStartOffset = 0; blockStartOffset < contentSize; blockStartOffset += ArchiveBlockSizeForCompression)
+            {
+                hashBlocks.push_back({ entryIndex, blockStartOffset });
+            }
         }
 
-        auto compressionRegistrar = Compression::CompressionRegistrar::Get();
-        if (compressionRegistrar == nullptr)
+        ExecuteParallelTasks(hashBlocks.size(), [fileEntries, &hashBlocks](size_t blockIndex)
         {
-            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
-            return contentFileBlocks;
-        }
-        Compression::ICompressionInterface* compressionInterface =
-            compressionRegistrar->FindCompressionInterface(fileSettings.m_compressionAlgorithm);
-        if (compressionInterface == nullptr)
+            HashBlock& hashBlock = hashBlocks[blockIndex];
+            AZStd::span<const AZStd::byte> fileContent = fileEntries[hashBlock.m_entryIndex].m_fileContent;
+            const size_t blockSize = AZStd::min(fileContent.size() - hashBlock.m_blockStartOffset,
+                static_cast<size_t>(ArchiveBlockSizeForCompression));
+            AZ::Sha1 sha1;
+            sha1.ProcessBytes(fileContent.subspan(hashBlock.m_blockStartOffset, blockSize));
+            sha1.GetDigest(hashBlock.m_sha1);
+        });
+
+        // The block digests are stored in file order, so the digest of a file
+        // is calculated by hashing the digests of its blocks in sequence
+        for (size_t blockIndex = 0; blockIndex < hashBlocks.size();)
         {
-            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
-            return contentFileBlocks;
-        }
+            const size_t entryIndex = hashBlocks[blockIndex].m_entryIndex;
+            AZ::Sha1 fileSha1;
+            for (; blockIndex < hashBlocks.size() && hashBlocks[blockIndex].m_entryIndex == entryIndex; ++blockIndex)
+            {
+                fileSha1.ProcessBytes(AZStd::as_bytes(AZStd::span(hashBlocks[blockIndex].m_sha1)));
+            }
 
-        const Compression::CompressionOptions& compressionOptions = fileSettings.m_compressionOptions != nullptr
-            ? *fileSettings.m_compressionOptions
-            : Compression::CompressionOptions{};
+            ContentDigest& contentDigest = contentDigests[entryIndex];
+            fileSha1.GetDigest(contentDigest.m_sha1);
+            contentDigest.m_uncompressedSize = fileEntries[entryIndex].m_fileContent.size();
+            contentDigest.m_compressionAlgorithmId = fileEntries[entryIndex].m_fileSettings.m_compressionAlgorithm;
+        }
 
-        // Due to check earlier validating that the inputDataSpan is not empty,
-        // the compressedBlockCount will be at least 1 due to rounding up to the nearest block
-        AZ::u32 compressedBlockCount = GetBlockCountIfCompressed(inputDataSpan.size());
+        return contentDigests;
+    }
 
-        // Resize the compress block buffer to be be a multiple of ArchiveBlockSizeForCompression
-        // times the block count
-        AZStd::vector<AZStd::byte> compressBlocksBuffer;
-        compressBlocksBuffer.resize_no_construct(compressedBlockCount * ArchiveBlockSizeForCompression);
+    void ArchiveWriter::CompressContentFilesAsync(AZStd::span<CompressContentRequest> compressRequests)
+    {
+        // Stores the state for each file whose blocks are compressed
+        struct CompressFileState
+        {
+            CompressContentRequest* m_compressRequest{};
+            Compression::ICompressionInterface* m_compressionInterface{};
+            const Compression::CompressionOptions* m_compressionOptions{};
+            AZ::u8 m_compressionAlgorithmIndex{ UncompressedAlgorithmIndex };
+            //! Buffer where each block is compressed to before being copied into the
+            //! request compression buffer with padding
+            AZStd::vector<AZStd::byte> m_compressBlocksBuffer;
+            AZStd::vector<Compression::CompressionResultData> m_compressedBlockResults;
+        };
+        // Identifies a single 2 MiB block of a file to compress
+        struct CompressBlock
+        {
+            size_t m_fileStateIndex{};
+            size_t m_blockIndex{};
+            //! offset and size of the output span in the compress blocks buffer of the file
+            size_t m_compressBlockOffset{};
+            size_t m_compressBlockSize{};
+        };
 
-        // Make sure there is at least one task that runs to make sure that progress
-        // with compression is always being made
-        const AZ::u32 maxCompressTasks = AZStd::max(1U, m_settings.m_maxCompressTasks);
+        const Compression::CompressionOptions defaultCompressionOptions;
+        AZStd::vector<CompressFileState> compressFileStates;
+        AZStd::vector<CompressBlock> compressBlocks;
 
-        // Stores the compressed size for all blocks without alignment
-        size_t compressedBlockSizeForAllBlocks{};
-        // allocated slots for each blocks CompressionResultData
-        AZStd::vector<Compression::CompressionResultData> compressedBlockResults(maxCompressTasks);
-        while (compressedBlockCount > 0)
+        for (CompressContentRequest& compressRequest : compressRequests)
         {
-            const AZ::u32 compressionThresholdInBytes = m_archiveHeader.m_compressionThreshold;
-            const AZ::u32 iterationTaskCount = AZStd::min(compressedBlockCount, maxCompressTasks);
-            // decrease the compressedBlockCount by the number of compressed tasks to be executed
-            compressedBlockCount -= iterationTaskCount;
+            const ArchiveWriterFileSettings& fileSettings = *compressRequest.m_fileSettings;
+            AZStd::span<const AZStd::byte> inputDataSpan = compressRequest.m_inputDataSpan;
 
+            // If the file is empty, there is nothing to compress
+            if (inputDataSpan.empty())
             {
-                // Task graph event used to block when writing compressed blocks in parallel
-                auto taskWriteGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Content File Compress Sync");
-                AZ::TaskGraph taskGraph{ "Archive Compress Tasks" };
-                AZ::TaskDescriptor compressTaskDescriptor{"Compress Block", "Archive Content File Compression"};
+                compressRequest.m_compressOutcome = ContentFileBlocks{};
+                continue;
+            }
 
-                for (size_t compressedTaskSlot = 0; compressedTaskSlot < iterationTaskCount; ++compressedTaskSlot)
-                {
-                    AZStd::span compressBlocksSpan(compressBlocksBuffer);
-                    const size_t blockStartOffset = compressedTaskSlot * ArchiveBlockSizeForCompression;
-
-                    // Cap the input block span size to the minimum of the ArchiveBlockSizeForCompression(2 MiB) and the remaining size
-                    // left in the input buffer via subspan
-                    const size_t inputBlockSize = AZStd::min(
-                        inputDataSpan.size() - blockStartOffset,
-                        static_cast<size_t>(ArchiveBlockSizeForCompression));
-                    auto inputBlockSpan = inputDataSpan.subspan(blockStartOffset,
-                        inputBlockSize);
-
-                    // Span that is segmented in up to ArchiveBlockSize(2MiB) blocks to store compressed data
-                    const size_t compressBlockSize = AZStd::min(
-                        compressBlocksSpan.size() - blockStartOffset,
-                        static_cast<size_t>(ArchiveBlockSizeForCompression));
-                    auto compressBlockSpan = compressBlocksSpan.subspan(blockStartOffset,
-                        compressBlockSize);
-
-                    //! Compress Task to execute in task executor
-                    auto compressTask = [
-                        compressionInterface, &compressionOptions, inputBlockSpan, compressBlockSpan,
-                        &compressedBlockResult = compressedBlockResults[compressedTaskSlot]]()
-                    {
-                        // Run the input data through the compressor
-                        compressedBlockResult = compressionInterface->CompressBlock(
-                            compressBlockSpan, inputBlockSpan, compressionOptions);
-                    };
-                    taskGraph.AddTask(compressTaskDescriptor, AZStd::move(compressTask));
-                }
+            // Try to register the compression algorithm id with the Archive Header compression algorithm id array
+            // if has not already been registered
+            AddCompressionAlgorithmId(fileSettings.m_compressionAlgorithm, m_archiveHeader);
+
+            // Now lookup the compression algorithm id to make sure it corresponds to a valid entry
+            // in the compression algorithm id array
+            size_t compressionAlgorithmIndex = FindCompressionAlgorithmId(fileSettings.m_compressionAlgorithm, m_archiveHeader);
 
-                taskGraph.SubmitOnExecutor(m_taskWriteExecutor, taskWriteGraphEvent.get());
-                // Sync on the task completion
-                taskWriteGraphEvent->Wait();
+            // If a valid compression algorithm Id is not found in the compression algorithm id array
+            // then an invalid file token is returned
+            if (compressionAlgorithmIndex == InvalidAlgorithmIndex)
+            {
+                compressRequest.m_compressOutcome = AZStd::unexpected(
+                    ResultString::format(R"(Unable to locate compression algorithm registered with id %u in the archive.)",
+                        static_cast<AZ::u32>(fileSettings.m_compressionAlgorithm)));
+                continue;
             }
 
-            size_t alignedCompressedBlockSizeForAllBlocks{};
+            ContentFileBlocks contentFileBlocks;
+            contentFileBlocks.m_writeSpan = inputDataSpan;
+            contentFileBlocks.m_blockOffsetSizePairs = AZStd::vector<BlockOffsetSizePair>{ { 0, inputDataSpan.size() } };
+            compressRequest.m_compressOutcome = AZStd::move(contentFileBlocks);
+
+            if (compressionAlgorithmIndex >= UncompressedAlgorithmIndex)
+            {
+                continue;
+            }
+
+            auto compressionRegistrar = Compression::CompressionRegistrar::Get();
+            if (compressionRegistrar == nullptr)
+            {
+                continue;
+            }
+            Compression::ICompressionInterface* compressionInterface =
+                compressionRegistrar->FindCompressionInterface(fileSettings.m_compressionAlgorithm);
+            if (compressionInterface == nullptr)
+            {
+                continue;
+            }
 
-            for (size_t compressedTaskSlot = 0; compressedTaskSlot < iterationTaskCount; ++compressedTaskSlot)
+            CompressFileState& compressFileState = compressFileStates.emplace_back();
+            compressFileState.m_compressRequest = &compressRequest;
+            compressFileState.m_compressionInterface = compressionInterface;
+            compressFileState.m_compressionOptions = fileSettings.m_compressionOptions != nullptr
+                ? fileSettings.m_compressionOptions
+                : &defaultCompressionOptions;
+            compressFileState.m_compressionAlgorithmIndex = static_cast<AZ::u8>(compressionAlgorithmIndex);
+
+            // Due to check earlier validating that the inputDataSpan is not empty,
+            // the compressedBlockCount will be at least 1 due to rounding up to the nearest block
+            const AZ::u32 compressedBlockCount = GetBlockCountIfCompressed(inputDataSpan.size());
+            compressFileState.m_compressedBlockResults.resize(compressedBlockCount);
+
+            // The output span for each block is capped at the ArchiveBlockSizeForCompression(2 MiB)
+            // A block that doesn't compress into that size is above the compression threshold anyway
+            // Small files only reserve the bound of their compressed size, so that a batch of many small files
+            // doesn't allocate 2 MiB per file
+            size_t compressBlocksBufferSize{};
+            for (AZ::u32 blockIndex = 0; blockIndex < compressedBlockCount; ++blockIndex)
+            {
+                const size_t blockStartOffset = blockIndex * ArchiveBlockSizeForCompression;
+                const size_t inputBlockSize = AZStd::min(
+                    inputDataSpan.size() - blockStartOffset,
+                    static_cast<size_t>(ArchiveBlockSizeForCompression));
+                const size_t compressBlockSize = AZStd::min(compressionInterface->CompressBound(inputBlockSize),
+                    static_cast<size_t>(ArchiveBlockSizeForCompression));
+                compressBlocks.push_back({ compressFileStates.size() - 1, blockIndex, compressBlocksBufferSize, compressBlockSize });
+                compressBlocksBufferSize += compressBlockSize;
+            }
+            compressFileState.m_compressBlocksBuffer.resize_no_construct(compressBlocksBufferSize);
+        }
+
+        // Compress every block of every file in parallel
+        // The offset of each block in the input is determined by its index within the file
+        ExecuteParallelTasks(compressBlocks.size(), [&compressFileStates, &compressBlocks](size_t compressBlockIndex)
+        {
+            const CompressBlock& compressBlock = compressBlocks[compressBlockIndex];
+            CompressFileState& compressFileState = compressFileStates[compressBlock.m_fileStateIndex];
+            AZStd::span<const AZStd::byte> inputDataSpan = compressFileState.m_compressRequest->m_inputDataSpan;
+
+            // Cap the input block span size to the minimum of the ArchiveBlockSizeForCompression(2 MiB) and the remaining size
+            // left in the input buffer via subspan
+            const size_t blockStartOffset = compressBlock.m_blockIndex * ArchiveBlockSizeForCompression;
+            const size_t inputBlockSize = AZStd::min(
+                inputDataSpan.size() - blockStartOffset,
+                static_cast<size_t>(ArchiveBlockSizeForCompression));
+            auto inputBlockSpan = inputDataSpan.subspan(blockStartOffset, inputBlockSize);
+            auto compressBlockSpan = AZStd::span(compressFileState.m_compressBlocksBuffer).subspan(
+                compressBlock.m_compressBlockOffset, compressBlock.m_compressBlockSize);
+
+            // Run the input data through the compressor
+            compressFileState.m_compressedBlockResults[compressBlock.m_blockIndex] = compressFileState.m_compressionInterface->CompressBlock(
+                compressBlockSpan, inputBlockSpan, *compressFileState.m_compressionOptions);
+        });
+
+        const AZ::u32 compressionThresholdInBytes = m_archiveHeader.m_compressionThreshold;
+        for (CompressFileState& compressFileState : compressFileStates)
+        {
+            CompressContentRequest& compressRequest = *compressFileState.m_compressRequest;
+            ContentFileBlocks& contentFileBlocks = *compressRequest.m_compressOutcome;
+
+            // Stores the compressed size for all blocks without alignment
+            size_t compressedBlockSizeForAllBlocks{};
+            size_t alignedCompressedBlockSizeForAllBlocks{};
+            bool allBlocksCompressed = true;
+            for (const Compression::CompressionResultData& compressedBlockResult : compressFileState.m_compressedBlockResults)
             {
-                Compression::CompressionResultData& compressedBlockResult = compressedBlockResults[compressedTaskSlot];
                 if (!compressedBlockResult || compressedBlockResult.GetCompressedByteCount() > compressionThresholdInBytes)
                 {
-                    // If compression fails for a block or it is higher than the compression threshold
-                    // then return the contentFileData that has the compression algorithm set to uncompressed
-                    // and points to the input data span
-                    // The entire file is stored uncompressed in this scenario
-                    // Return a successful outcome with a single block offset size pair that references the entire
-                    // input buffer
-                    contentFileBlocks.m_blockOffsetSizePairs.assign({ BlockOffsetSizePair{0, inputDataSpan.size()} });
-                    contentFileBlocks.m_totalUnalignedSize = inputDataSpan.size();
-                    return contentFileBlocks;
-                }
-                else
-                {
-                    AZ::u64 compressedBlockSize = compressedBlockResult.GetCompressedByteCount();
-                    compressedBlockSizeForAllBlocks += compressedBlockSize;
-                    alignedCompressedBlockSizeForAllBlocks += AZ_SIZE_ALIGN_UP(compressedBlockSize, ArchiveDefaultBlockAlignment);
+                    allBlocksCompressed = false;
+                    break;
                 }
+
+                AZ::u64 compressedBlockSize = compressedBlockResult.GetCompressedByteCount();
+                compressedBlockSizeForAllBlocks += compressedBlockSize;
+                alignedCompressedBlockSizeForAllBlocks += AZ_SIZE_ALIGN_UP(compressedBlockSize, ArchiveDefaultBlockAlignment);
             }
 
-            // Determine the amount of additional bytes to resize the compression data output buffer
-            // This takes into account the alignment of blocks as how it would be written on disk
-            compressionDataBuffer.reserve(compressionDataBuffer.size() + alignedCompressedBlockSizeForAllBlocks);
-            for (size_t compressedTaskSlot = 0; compressedTaskSlot < iterationTaskCount; ++compressedTaskSlot)
+            if (!allBlocksCompressed)
             {
-                const Compression::CompressionResultData& compressedBlockResult = compressedBlockResults[compressedTaskSlot];
+                // If compression fails for a block or it is higher than the compression threshold
+                // then the content file blocks keep the compression algorithm set to uncompressed
+                // and a single block offset size pair that references the entire input buffer
+                // The entire file is stored uncompressed in this scenario
+                contentFileBlocks.m_totalUnalignedSize = compressRequest.m_inputDataSpan.size();
+                continue;
+            }
 
+            // Copy the compressed blocks into the request compression buffer
+            // This takes into account the alignment of blocks as how it would be written on disk
+            AZStd::vector<AZStd::byte>& compressionDataBuffer = compressRequest.m_compressionBuffer;
+            compressionDataBuffer.reserve(alignedCompressedBlockSizeForAllBlocks);
+            contentFileBlocks.m_blockOffsetSizePairs.clear();
+            for (const Compression::CompressionResultData& compressedBlockResult : compressFileState.m_compressedBlockResults)
+            {
                 // Calculated the number of additional bytes to store to pad the block to 512-byte alignment
                 const AZ::u64 alignmentBytes = AZ_SIZE_ALIGN_UP(compressedBlockResult.GetCompressedByteCount(), ArchiveDefaultBlockAlignment)
                     - compressedBlockResult.GetCompressedByteCount();
@@ -1060,21 +1292,18 @@ namespace Archive
                 contentFileBlocks.m_blockOffsetSizePairs.push_back({ compressedBlockStartOffset,
                     compressedBlockResult.GetCompressedByteCount() });
             }
-        }
 
-        // Set the compression algorithm index once compression has completed successfully for all blocks of the file
-        contentFileBlocks.m_compressionAlgorithmIndex = static_cast<AZ::u8>(compressionAlgorithmIndex);
-        // The file has been successfully compressed, so store a span to the buffer
-        contentFileBlocks.m_writeSpan = compressionDataBuffer;
-        // Store the compressed size of each block without taking any alignment into account
-        // This is the exact total compressed size of the "file" as stored in blocks
-        contentFileBlocks.m_totalUnalignedSize = compressedBlockSizeForAllBlocks;
-
-        return contentFileBlocks;
+            // Set the compression algorithm index once compression has completed successfully for all blocks of the file
+            contentFileBlocks.m_compressionAlgorithmIndex = compressFileState.m_compressionAlgorithmIndex;
+            // The file has been successfully compressed, so store a span to the buffer
+            contentFileBlocks.m_writeSpan = compressionDataBuffer;
+            // Store the compressed size of each block without taking any alignment into account
+            // This is the exact total compressed size of the "file" as stored in blocks
+            contentFileBlocks.m_totalUnalignedSize = compressedBlockSizeForAllBlocks;
+        }
     }
 
-    ArchiveFileToken ArchiveWriter::WriteContentFileToArchive(const ArchiveWriterFileSettings& fileSettings,
-        const ContentFileData& contentFileData)
+    size_t ArchiveWriter::AcquireFileIndex(const ArchiveWriterFileSettings& fileSettings, AZ::IO::PathView relativeFilePath)
     {
         if (fileSettings.m_fileMode == ArchiveWriterFileMode::AddNew)
         {
@@ -1082,14 +1311,9 @@ namespace Archive
             ++m_archiveHeader.m_fileCount;
         }
 
-        // Locate the location within the Archive to write the file data
-        // First any deleted blocks are located to see if the file data can be written to it
-        // otherwise the content data is written at the current table of contents offset
-        // and the table of contents offset is then shifted by that amount
-
-        // The m_relativeFilePath is guaranteed to not be empty due to the check at the top of AddFileToArchive
+        // The m_relativeFilePath is guaranteed to not be empty due to the check at the top of AddFilesToArchive
         // If the file path already exist in the archive locate it
-        auto findArchiveTokenIt = m_pathMap.find(contentFileData.m_relativeFilePath);
+        auto findArchiveTokenIt = m_pathMap.find(relativeFilePath);
 
         // Insert the file path to the end of the file path index table if the file path is not in the archive
         size_t archiveFileIndex{};
@@ -1097,6 +1321,9 @@ namespace Archive
         {
             // If the file exist in the archive, store its index
             archiveFileIndex = findArchiveTokenIt->second;
+            // The existing entry is about to be overwritten, so it no longer references
+            // any deduplicated content
+            ReleaseDeduplicatedContent(m_archiveToc.m_fileMetadataTable[archiveFileIndex]);
         }
         else if (!m_removedFileIndices.empty())
         {
@@ -1118,6 +1345,18 @@ namespace Archive
             m_archiveToc.m_filePaths.emplace_back();
         }
 
+        return archiveFileIndex;
+    }
+
+    ArchiveFileToken ArchiveWriter::WriteContentFileToArchive(const ArchiveWriterFileSettings& fileSettings,
+        const ContentFileData& contentFileData)
+    {
+        // Locate the location within the Archive to write the file data
+        // First any deleted blocks are located to see if the file data can be written to it
+        // otherwise the content data is written at the current table of contents offset
+        // and the table of contents offset is then shifted by that amount
+        const size_t archiveFileIndex = AcquireFileIndex(fileSettings, contentFileData.m_relativeFilePath);
+
         // Get reference to the FileMetadata entry in the Archive
         ArchiveTocFileMetadata& fileMetadata = m_archiveToc.m_fileMetadataTable[archiveFileIndex];
         fileMetadata.m_uncompressedSize = contentFileData.m_uncompressedSpan.size();
@@ -1149,6 +1388,82 @@ namespace Archive
         return static_cast<ArchiveFileToken>(archiveFileIndex);
     }
 
+    ArchiveFileToken ArchiveWriter::WriteDeduplicatedFileToArchive(const ArchiveWriterFileSettings& fileSettings,
+        AZ::IO::PathView relativeFilePath, const ContentDigest& contentDigest)
+    {
+        // Copy the file metadata of the deduplicated content before acquiring the file index
+        // Acquiring the index of an existing file path releases the content that file referenced,
+        // which could be the deduplicated content itself
+        const ArchiveTocFileMetadata sharedFileMetadata = m_deduplicatedContentMap[contentDigest].m_fileMetadata;
+
+        const size_t archiveFileIndex = AcquireFileIndex(fileSettings, relativeFilePath);
+
+        // The table of contents entry references the same raw blocks and block line entries
+        // as the file which was written with the content
+        m_archiveToc.m_fileMetadataTable[archiveFileIndex] = sharedFileMetadata;
+        ArchiveTableOfContents::Path& filePath = m_archiveToc.m_filePaths[archiveFileIndex];
+        filePath = relativeFilePath;
+
+        DeduplicatedContent& deduplicatedContent = m_deduplicatedContentMap[contentDigest];
+        if (deduplicatedContent.m_referenceCount++ == 0)
+        {
+            deduplicatedContent.m_fileMetadata = sharedFileMetadata;
+            m_deduplicatedOffsetMap[sharedFileMetadata.m_offset] = contentDigest;
+        }
+
+        m_pathMap[filePath] = archiveFileIndex;
+        return static_cast<ArchiveFileToken>(archiveFileIndex);
+    }
+
+    bool ArchiveWriter::ReleaseDeduplicatedContent(const ArchiveTocFileMetadata& fileMetadata)
+    {
+        // Empty files never reference deduplicated content
+        if (fileMetadata.m_uncompressedSize == 0)
+        {
+            return false;
+        }
+
+        auto offsetIt = m_deduplicatedOffsetMap.find(fileMetadata.m_offset);
+        if (offsetIt == m_deduplicatedOffsetMap.end())
+        {
+            return false;
+        }
+
+        auto deduplicatedIt = m_deduplicatedContentMap.find(offsetIt->second);
+        if (deduplicatedIt == m_deduplicatedContentMap.end()
+            || deduplicatedIt->second.m_fileMetadata.m_uncompressedSize != fileMetadata.m_uncompressedSize)
+        {
+            return false;
+        }
+
+        if (--deduplicatedIt->second.m_referenceCount > 0)
+        {
+            return true;
+        }
+
+        // No other files reference the content, so it can no longer be shared
+        m_deduplicatedContentMap.erase(deduplicatedIt);
+        m_deduplicatedOffsetMap.erase(offsetIt);
+        return false;
+    }
+
+    bool ArchiveWriter::IsRawBlockSharedWithOtherFile(size_t archiveFileIndex) const
+    {
+        const ArchiveTocFileMetadata& fileMetadata = m_archiveToc.m_fileMetadataTable[archiveFileIndex];
+        for (size_t fileIndex{}; fileIndex < m_archiveToc.m_fileMetadataTable.size(); ++fileIndex)
+        {
+            // Removed entries are cleared, so their uncompressed size is 0
+            const ArchiveTocFileMetadata& otherFileMetadata = m_archiveToc.m_fileMetadataTable[fileIndex];
+            if (fileIndex != archiveFileIndex && otherFileMetadata.m_uncompressedSize > 0
+                && otherFileMetadata.m_offset == fileMetadata.m_offset)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     AZ::u64 ArchiveWriter::UpdateBlockOffsetEntryForFile(const ContentFileData& contentFileData)
     {
         // Index into the block offset table first entry for the file
@@ -1440,7 +1755,11 @@ namespace Archive
 
             // If the new block size aligned down to nearest 512-byte boundary is 0
             // then there deleted blocks
-            if (alignedBlockSize > 0)
+            // Blocks which are still referenced by other files with the same content are not released
+            // The deduplicated content maps only track content written since the archive was mounted,
+            // so the table of contents is also checked for entries sharing the blocks of the file
+            if (alignedBlockSize > 0 && !ReleaseDeduplicatedContent(fileMetadata)
+                && !IsRawBlockSharedWithOtherFile(archiveFileIndex))
             {
                 auto& deletedBlockOffsetSet = m_deletedBlockSizeToOffsetMap[alignedBlockSize];
                 deletedBlockOffsetSet.emplace(alignedBlockOffset);
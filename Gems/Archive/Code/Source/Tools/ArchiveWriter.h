@@ -16,6 +16,7 @@
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/utility/to_underlying.h>
@@ -114,6 +115,13 @@ namespace Archive
         ArchiveAddFileResult AddFileToArchive(AZStd::span<const AZStd::byte> inputSpan,
             const ArchiveWriterFileSettings& fileSettings) override;
 
+        //! Adds multiple files to the archive
+        //! The 2 MiB blocks of every file are compressed in parallel using the AZ Task system
+        //! and then written to the archive in the order of the @fileEntries span
+        //! @param fileEntries span of file content and the settings to use for adding each file
+        //! @return vector of ArchiveAddFileResult with one entry per element of @fileEntries
+        AZStd::vector<ArchiveAddFileResult> AddFilesToArchive(AZStd::span<const ArchiveWriterFileEntry> fileEntries) override;
+
         //! Searches for a relative path within the archive
         //! @param relativePath Relative path within archive to search for
         //! @return A token that identifies the Archive file if it exist
@@ -179,16 +187,58 @@ namespace Archive
         };
         using CompressContentOutcome = AZStd::expected<ContentFileBlocks, ResultString>;
 
-        //! Uses the AZ Task system to compress 2 MiB blocks of a content file in parallel
-        //! @param compressionBuffer output buffer to write compressed content
-        //! @oaram fileSettings settings controlling how to write the content data into the archive stream
-        //! @param contentFileData input buffer of file content to write to as a file using the file path
-        //!        specified in the fileSettings
-        //! @return an outcome that contains a span if the content fileData was successfully compressed
-        //!         otherwise a failure string containing the error that occurs when attempting to compressed
-        //!         the asynchronous content
-        CompressContentOutcome CompressContentFileAsync(AZStd::vector<AZStd::byte>& compressionBuffer,
-            const ArchiveWriterFileSettings& fileSettings, AZStd::span<const AZStd::byte> inputDataSpan);
+        //! Stores the input and output of compressing a single content file
+        struct CompressContentRequest
+        {
+            //! settings controlling how to write the content data into the archive stream
+            const ArchiveWriterFileSettings* m_fileSettings{};
+            //! input buffer of file content to compress
+            AZStd::span<const AZStd::byte> m_inputDataSpan;
+            //! output buffer where the compressed blocks are written
+            //! The ContentFileBlocks::m_writeSpan of the outcome references this buffer
+            //! if the file was compressed
+            AZStd::vector<AZStd::byte> m_compressionBuffer;
+            //! contains the block data of the file if it was successfully compressed
+            //! otherwise a failure string containing the error that occurred
+            CompressContentOutcome m_compressOutcome{ ContentFileBlocks{} };
+        };
+
+        //! Uses the AZ Task system to compress the 2 MiB blocks of all the content files in parallel
+        //! All blocks of every request are scheduled together, so that a batch of small files
+        //! each consisting of a single block are compressed in parallel as well
+        //! @param compressRequests span of requests whose compression buffer and outcome are populated
+        void CompressContentFilesAsync(AZStd::span<CompressContentRequest> compressRequests);
+
+        //! Runs the task function for each index in the range [0, taskCount) on the task executor
+        //! At most ArchiveWriterSettings::m_maxCompressTasks tasks are run at once
+        //! The function blocks until all tasks have completed
+        void ExecuteParallelTasks(size_t taskCount, const AZStd::function<void(size_t)>& taskFunction);
+
+        //! Identifies the content of a file for deduplication
+        //! The compression algorithm is part of the digest, as a file is only shared
+        //! with a file that is stored using the same compression algorithm
+        struct ContentDigest
+        {
+            bool operator==(const ContentDigest& other) const;
+            bool operator!=(const ContentDigest& other) const;
+
+            //! SHA-1 digest over the SHA-1 digests of each 2 MiB block of the file
+            AZ::u32 m_sha1[5]{};
+            AZ::u64 m_uncompressedSize{};
+            Compression::CompressionAlgorithmId m_compressionAlgorithmId{ Compression::Uncompressed };
+        };
+        struct ContentDigestHasher
+        {
+            size_t operator()(const ContentDigest& contentDigest) const;
+        };
+
+        //! Uses the AZ Task system to hash the 2 MiB blocks of the specified file entries in parallel
+        //! @param fileEntries file entries to hash
+        //! @param entryIndices indices into @fileEntries of the files to hash
+        //! @return vector of content digest with one entry per element of @fileEntries
+        //! Only the elements at the entry indices are populated
+        AZStd::vector<ContentDigest> ComputeContentDigests(AZStd::span<const ArchiveWriterFileEntry> fileEntries,
+            AZStd::span<const size_t> entryIndices);
 
         //! In-memory structure which stores metadata about the file contents after being
         //! sent through any compression algorithm and path normalization
@@ -211,6 +261,28 @@ namespace Archive
         ArchiveFileToken WriteContentFileToArchive(const ArchiveWriterFileSettings& fileSettings,
             const ContentFileData& contentFileData);
 
+        //! Adds a table of contents entry for the file path which references the raw blocks
+        //! of a previously written file with the same content
+        //! @param contentDigest digest of the file content which must be in the deduplicated content map
+        ArchiveFileToken WriteDeduplicatedFileToArchive(const ArchiveWriterFileSettings& fileSettings,
+            AZ::IO::PathView relativeFilePath, const ContentDigest& contentDigest);
+
+        //! Returns the index within the table of contents where the file path should be stored
+        //! If the path is already in the archive, the index of the existing entry is returned
+        //! otherwise an index of a removed entry is re-used or a new entry is appended to the table of contents
+        size_t AcquireFileIndex(const ArchiveWriterFileSettings& fileSettings, AZ::IO::PathView relativeFilePath);
+
+        //! Decrements the reference count of the deduplicated content the file metadata references
+        //! @return true if other files still reference the raw blocks of the file metadata
+        //! If false is returned, the raw blocks are not shared and can be released
+        bool ReleaseDeduplicatedContent(const ArchiveTocFileMetadata& fileMetadata);
+
+        //! Returns true if another file in the table of contents references the raw blocks
+        //! of the file at the archive file index
+        //! This covers files which share content written before the archive was mounted
+        //! NOTE: This iterates over the entire table of contents
+        bool IsRawBlockSharedWithOtherFile(size_t archiveFileIndex) const;
+
         //! Helper function to update the TOC block offset table entries for the file
         //! being written
         //! @return Index into the block offset table where the compressed size
@@ -338,6 +410,21 @@ namespace Archive
         using DeletedBlockMap = AZStd::map<AZ::u64, AZStd::set<AZ::u64>>;
         DeletedBlockMap m_deletedBlockSizeToOffsetMap;
 
+        //! Table of contents file metadata of content written by this ArchiveWriter instance
+        //! along with the number of files referencing it
+        //! Only used when ArchiveWriterSettings::m_deduplicateContent is set
+        struct DeduplicatedContent
+        {
+            ArchiveTocFileMetadata m_fileMetadata;
+            AZ::u64 m_referenceCount{};
+        };
+        using DeduplicatedContentMap = AZStd::unordered_map<ContentDigest, DeduplicatedContent, ContentDigestHasher>;
+        DeduplicatedContentMap m_deduplicatedContentMap;
+        //! Maps the raw block offset of deduplicated content to its digest
+        //! This is used to find the deduplicated content of a file when it is removed
+        using DeduplicatedOffsetMap = AZStd::unordered_map<AZ::u64, ContentDigest>;
+        DeduplicatedOffsetMap m_deduplicatedOffsetMap;
+
         //! GenericStream pointer which stores the open archive
         ArchiveStreamPtr m_archiveStream;
 
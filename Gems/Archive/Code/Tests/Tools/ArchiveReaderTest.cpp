@@ -11,6 +11,8 @@
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 
+#include <AzTest/Utils.h>
+
 #include <Archive/Clients/ArchiveReaderAPI.h>
 #include <Archive/Tools/ArchiveWriterAPI.h>
 
@@ -970,4 +972,239 @@ namespace Archive::Test
             EXPECT_TRUE(AZStd::ranges::equal(requestedFileData, expectedResultData));
         }
     }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_ForFilesAddedInBatch_WithMoreBlocksThanCompressTasks_Succeeds)
+    {
+        using namespace Archive::literals;
+        // Generate a 5 MiB file with content that doesn't repeat every 2 MiB
+        // so that each compressed block is different
+        AZStd::vector<AZStd::byte> largeFileBuffer;
+        largeFileBuffer.resize_no_construct(5_mib);
+        auto NonRepeatingBlockGenerator = [currentValue = 0U]() mutable
+        {
+            return static_cast<AZStd::byte>((currentValue++ / 3) % 251);
+        };
+        AZStd::generate(largeFileBuffer.begin(), largeFileBuffer.end(), NonRepeatingBlockGenerator);
+        AZStd::string_view smallFileData = "My Prefab Data in an Archive";
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        {
+            // Only compress a single block at a time, so that the blocks
+            // of the files are compressed over multiple iterations
+            ArchiveWriterSettings writerSettings;
+            writerSettings.m_maxCompressTasks = 1;
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr), writerSettings);
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            AZStd::array<ArchiveWriterFileEntry, 2> fileEntries;
+            fileEntries[0].m_fileContent = largeFileBuffer;
+            fileEntries[0].m_fileSettings.m_relativeFilePath = "large.bin";
+            fileEntries[0].m_fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileEntries[1].m_fileContent = AZStd::as_bytes(AZStd::span(smallFileData));
+            fileEntries[1].m_fileSettings.m_relativeFilePath = "level.prefab";
+            fileEntries[1].m_fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+
+            for (const ArchiveAddFileResult& addFileResult : archiveWriter->AddFilesToArchive(fileEntries))
+            {
+                EXPECT_TRUE(addFileResult);
+                EXPECT_EQ(CompressionLZ4::GetLZ4CompressionAlgorithmId(), addFileResult.m_compressionAlgorithm);
+            }
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        // Set the ArchiveStreamDeleter to not delete the stack ByteContainerStream
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        EXPECT_TRUE(archiveReader->IsMounted());
+
+        auto ExtractFile = [&archiveReader](AZ::IO::PathView filePath, AZStd::vector<AZStd::byte>& fileBuffer)
+        {
+            const ArchiveListFileResult archiveListFileResult = archiveReader->ListFileInArchive(filePath);
+            EXPECT_TRUE(archiveListFileResult);
+            fileBuffer.resize_no_construct(archiveListFileResult.m_uncompressedSize);
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = archiveListFileResult.m_filePathToken;
+            return archiveReader->ExtractFileFromArchive(fileBuffer, fileSettings);
+        };
+
+        {
+            AZStd::vector<AZStd::byte> fileBuffer;
+            const ArchiveExtractFileResult archiveExtractFileResult = ExtractFile("large.bin", fileBuffer);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, largeFileBuffer));
+            EXPECT_EQ(archiveExtractFileResult.m_crc32, AZ::Crc32(archiveExtractFileResult.m_fileSpan));
+        }
+        {
+            AZStd::vector<AZStd::byte> fileBuffer;
+            const ArchiveExtractFileResult archiveExtractFileResult = ExtractFile("level.prefab", fileBuffer);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, AZStd::as_bytes(AZStd::span(smallFileData))));
+        }
+    }
+
+    TEST_F(ArchiveReaderFixture, MapFileFromArchive_ForInMemoryArchive_ReadsFileIntoHandle)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        AZStd::string_view fileData = "Hello World";
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_relativeFilePath = "foo.txt";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fileData)), fileSettings));
+            fileSettings.m_relativeFilePath = "compressed.txt";
+            fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fileData)), fileSettings));
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        // Set the ArchiveStreamDeleter to not delete the stack ByteContainerStream
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView("foo.txt");
+        fileSettings.m_startOffset = 6;
+        ArchiveMapFileResult mapFileResult = archiveReader->MapFileFromArchive(fileSettings);
+        ASSERT_TRUE(mapFileResult);
+        // An in-memory stream can't be memory mapped, so the file content is read into the handle
+        EXPECT_FALSE(mapFileResult.m_memoryMapped);
+        EXPECT_NE(nullptr, mapFileResult.m_fileHandle);
+        EXPECT_EQ(fileData.size(), mapFileResult.m_uncompressedSize);
+        EXPECT_TRUE(AZStd::ranges::equal(mapFileResult.m_fileSpan, AZStd::as_bytes(AZStd::span(fileData.substr(6)))));
+
+        // Compressed files can't be mapped
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView("compressed.txt");
+        fileSettings.m_startOffset = 0;
+        EXPECT_FALSE(archiveReader->MapFileFromArchive(fileSettings));
+    }
+
+    TEST_F(ArchiveReaderFixture, MapFileFromArchive_ForArchiveOnDisk_ViewOutlivesUnmount)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::Path archivePath = tempDirectory.GetDirectoryAsPath() / "mapped.o3ar";
+
+        // Generate a file larger than a single compression block to also exercise the sequential access hint
+        using namespace Archive::literals;
+        AZStd::vector<AZStd::byte> largeFileBuffer;
+        largeFileBuffer.resize_no_construct(3_mib);
+        auto RepeatingByteSequenceGenerator = [currentValue = 0U]() mutable
+        {
+            return static_cast<AZStd::byte>(currentValue++ % 256);
+        };
+        AZStd::generate(largeFileBuffer.begin(), largeFileBuffer.end(), RepeatingByteSequenceGenerator);
+
+        {
+            auto createArchiveWriterResult = CreateArchiveWriter(archivePath);
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_relativeFilePath = "sounds/bank.bnk";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(largeFileBuffer, fileSettings));
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        auto createArchiveReaderResult = CreateArchiveReader(archivePath);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView("sounds/bank.bnk");
+        ArchiveMapFileResult mapFileResult = archiveReader->MapFileFromArchive(fileSettings);
+        ASSERT_TRUE(mapFileResult);
+#if defined(AZ_PLATFORM_LINUX)
+        // The archive is a file on disk, so the file span is a view into the mapped archive
+        EXPECT_TRUE(mapFileResult.m_memoryMapped);
+#endif
+        EXPECT_EQ(mapFileResult.m_crc32, AZ::Crc32(mapFileResult.m_fileSpan));
+
+        // The file handle keeps the view valid after the archive is unmounted
+        archiveReader->UnmountArchive();
+        EXPECT_TRUE(AZStd::ranges::equal(mapFileResult.m_fileSpan, largeFileBuffer));
+    }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_ForDeduplicatedFile_AfterRemovingOtherFileOnRemount_Succeeds)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        constexpr AZStd::string_view sharedFileData = "Hello World";
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            ArchiveWriterSettings writerSettings;
+            writerSettings.m_deduplicateContent = true;
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr), writerSettings);
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            // Write two files with the same content, so that they share the same raw blocks
+            AZStd::array<ArchiveWriterFileEntry, 2> fileEntries;
+            fileEntries[0].m_fileContent = AZStd::as_bytes(AZStd::span(sharedFileData));
+            fileEntries[0].m_fileSettings.m_relativeFilePath = "first.txt";
+            fileEntries[0].m_fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileEntries[1] = fileEntries[0];
+            fileEntries[1].m_fileSettings.m_relativeFilePath = "second.txt";
+            for (const ArchiveAddFileResult& addFileResult : archiveWriter->AddFilesToArchive(fileEntries))
+            {
+                EXPECT_TRUE(addFileResult);
+            }
+
+            // Unmounting commits the archive and clears the in-memory deduplicated content maps
+            archiveWriter->UnmountArchive();
+
+            archiveStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+            archiveWriterStreamPtr.reset(&archiveStream);
+            ASSERT_TRUE(archiveWriter->MountArchive(AZStd::move(archiveWriterStreamPtr)));
+
+            // Removing the first file must not release the blocks still referenced by the second file
+            EXPECT_TRUE(archiveWriter->RemoveFileFromArchive(AZ::IO::PathView("first.txt")));
+
+            // Add a file with different content which would re-use the released blocks
+            constexpr AZStd::string_view otherFileData = "Box Box, Box Box";
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_relativeFilePath = "third.txt";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(otherFileData)), fileSettings));
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        AZStd::vector<AZStd::byte> fileBuffer;
+        fileBuffer.resize_no_construct(sharedFileData.size());
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView("second.txt");
+        const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+            fileBuffer, fileSettings);
+        ASSERT_TRUE(archiveExtractFileResult);
+
+        AZStd::string_view textFileSpan(reinterpret_cast<const char*>(archiveExtractFileResult.m_fileSpan.data()),
+            archiveExtractFileResult.m_fileSpan.size());
+        EXPECT_THAT(textFileSpan, ::testing::ContainerEq(sharedFileData));
+        EXPECT_EQ(archiveExtractFileResult.m_crc32, AZ::Crc32(archiveExtractFileResult.m_fileSpan));
+    }
 }
@@ -940,4 +940,65 @@ namespace Archive::Test
             EXPECT_EQ(sizeof(ArchiveBlockLineUnion), archiveHeader->m_tocBlockOffsetTableUncompressedSize);
         }
     }
+
+    TEST_F(ArchiveWriterFixture, AddFilesToArchive_WithDeduplication_SharesContentOfIdenticalFiles)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        // Set the ArchiveStreamDeleter to not delete the stack ByteContainerStream
+        IArchiveWriter::ArchiveStreamPtr archiveStreamPtr(&archiveStream, { false });
+        ArchiveWriterSettings writerSettings;
+        writerSettings.m_deduplicateContent = true;
+        auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveStreamPtr), writerSettings);
+        ASSERT_TRUE(createArchiveWriterResult);
+        AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+        // Add two files with the same content and compression algorithm in a single batch
+        AZStd::string_view fileContent = "Hello World";
+        AZStd::array<ArchiveWriterFileEntry, 2> fileEntries;
+        fileEntries[0].m_fileContent = StringToByteSpan(fileContent);
+        fileEntries[0].m_fileSettings.m_relativeFilePath = "Sanity/first.txt";
+        fileEntries[0].m_fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+        fileEntries[1] = fileEntries[0];
+        fileEntries[1].m_fileSettings.m_relativeFilePath = "Sanity/second.txt";
+
+        AZStd::vector<ArchiveAddFileResult> addFileResults = archiveWriter->AddFilesToArchive(fileEntries);
+        ASSERT_EQ(fileEntries.size(), addFileResults.size());
+        for (const ArchiveAddFileResult& addFileResult : addFileResults)
+        {
+            EXPECT_TRUE(addFileResult);
+            EXPECT_NE(InvalidArchiveFileToken, addFileResult.m_filePathToken);
+            EXPECT_EQ(CompressionLZ4::GetLZ4CompressionAlgorithmId(), addFileResult.m_compressionAlgorithm);
+        }
+        EXPECT_NE(addFileResults[0].m_filePathToken, addFileResults[1].m_filePathToken);
+
+        {
+            ASSERT_TRUE(archiveWriter->Commit());
+            auto archiveHeader = reinterpret_cast<ArchiveHeader*>(archiveBuffer.data());
+            EXPECT_EQ(2, archiveHeader->m_fileCount);
+            // Only a single 512-byte block is written for both files, so the table of contents
+            // starts right after the header(512) and that block(512)
+            EXPECT_EQ(ArchiveDefaultBlockAlignment * 2, archiveHeader->m_tocOffset);
+            // Both files share the same block line entry
+            EXPECT_EQ(sizeof(ArchiveBlockLineUnion), archiveHeader->m_tocBlockOffsetTableUncompressedSize);
+        }
+
+        // Removing one of the files should not release the block shared with the other file
+        EXPECT_TRUE(archiveWriter->RemoveFileFromArchive(addFileResults[0].m_filePathToken));
+        EXPECT_TRUE(archiveWriter->ContainsFile(addFileResults[1].m_relativeFilePath));
+
+        // Add a file with different content, it should be written after the shared block
+        // instead of overwriting it
+        ArchiveWriterFileSettings fileSettings;
+        fileSettings.m_relativeFilePath = "Sanity/third.txt";
+        EXPECT_TRUE(archiveWriter->AddFileToArchive(StringToByteSpan("Box Box, Box Box"), fileSettings));
+
+        {
+            ASSERT_TRUE(archiveWriter->Commit());
+            auto archiveHeader = reinterpret_cast<ArchiveHeader*>(archiveBuffer.data());
+            EXPECT_EQ(2, archiveHeader->m_fileCount);
+            EXPECT_EQ(ArchiveDefaultBlockAlignment * 3, archiveHeader->m_tocOffset);
+        }
+    }
 }
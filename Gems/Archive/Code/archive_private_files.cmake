@@ -7,6 +7,7 @@
 set(FILES
     Source/ArchiveModuleInterface.cpp
     Source/ArchiveModuleInterface.h
+    Source/Clients/ArchiveMemoryMap.h
     Source/Clients/ArchiveReader.cpp
     Source/Clients/ArchiveReader.h
     Source/Clients/ArchiveReaderFactory.cpp
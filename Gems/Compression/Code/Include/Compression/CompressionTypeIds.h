@@ -34,4 +34,9 @@ namespace Compression
     inline constexpr const char* CompressionOptionsTypeId = "{037B2A25-E195-4C5D-B402-6108CE978280}";
 
     inline constexpr const char* DecompressionOptionsTypeId = "{EA85CCE4-B630-47B8-892F-3A5B1C9ECD99}";
+
+    // Zstd TypeIds
+    inline constexpr const char* ZstdCompressionOptionsTypeId = "{5B0D6C1E-8F0A-4C52-9E3B-2A7D41C6E915}";
+    inline constexpr const char* ZstdDecompressionOptionsTypeId = "{C3E8A2F4-71B9-4D06-A5E2-98F1B0D7C462}";
+    inline constexpr const char* ZstdDictionaryRegistryInterfaceTypeId = "{8A41F7D2-3C5E-4B19-B7A0-E6D2C95F1384}";
 } // namespace Compression
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+#include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+namespace CompressionZstd
+{
+    //! Returns the CompressionAlgorithmId associated with the Zstd Compressor
+    //! @return Zstd Compression AlgorithmId
+    constexpr Compression::CompressionAlgorithmId GetZstdCompressionAlgorithmId();
+
+    //! Human readable name associated with the compression algorithm
+    constexpr AZStd::string_view GetZstdCompressionAlgorithmName()
+    {
+        return "Zstd";
+    }
+
+    constexpr Compression::CompressionAlgorithmId GetZstdCompressionAlgorithmId()
+    {
+        constexpr Compression::CompressionAlgorithmId AlgorithmId{ AZ::u32(AZStd::hash<AZStd::string_view>{}(GetZstdCompressionAlgorithmName())) };
+        return AlgorithmId;
+    }
+
+    //! Identifier stored in the header of a Zstd dictionary and in every frame compressed with it
+    //! A value of 0 indicates that no dictionary is used
+    using ZstdDictionaryId = AZ::u32;
+    inline constexpr ZstdDictionaryId NoDictionaryId = 0;
+
+    //! Compression options for the Zstd compressor
+    //! Supplying a dictionary allows small blocks of similar content(such as assets of the same type)
+    //! to compress well, as the dictionary provides the shared history that the block itself lacks.
+    //! The dictionary is typically trained once per asset type with `CompressorZstd::TrainDictionary`
+    //! and supplied for every block of that asset type.
+    struct ZstdCompressionOptions
+        : Compression::CompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(ZstdCompressionOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Compression level passed to Zstd. Values range from 1 to 22(ZSTD_maxCLevel)
+        int m_compressionLevel{ 3 };
+        //! View of a trained Zstd dictionary. The memory must remain valid for the duration of the CompressBlock call.
+        //! The compressor caches the digested dictionary by its dictionary id, so different dictionaries
+        //! must not share the same id.
+        AZStd::span<const AZStd::byte> m_dictionary;
+    };
+
+    //! Decompression options for the Zstd decompressor
+    //! The dictionary used to decompress a block is selected using the dictionary id stored in the block's frame header.
+    //! Dictionaries supplied here are searched first, followed by the dictionaries registered with
+    //! the ZstdDictionaryRegistryInterface
+    struct ZstdDecompressionOptions
+        : Compression::DecompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(ZstdDecompressionOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Views of trained Zstd dictionaries. The memory must remain valid for the duration of the DecompressBlock call.
+        AZStd::span<const AZStd::span<const AZStd::byte>> m_dictionaries;
+    };
+
+    //! Stores Zstd dictionaries for use when decompressing blocks without ZstdDecompressionOptions,
+    //! such as when reading compressed archive content through the Streamer DecompressorRegistrarEntry.
+    //! Dictionaries are normally stored as files within the archive they belong to and registered when it is mounted.
+    class ZstdDictionaryRegistryInterface
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL(ZstdDictionaryRegistryInterface);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        virtual ~ZstdDictionaryRegistryInterface() = default;
+
+        //! Registers a copy of a trained Zstd dictionary
+        //! @param dictionary content of the dictionary
+        //! @return the dictionary id read from the dictionary header or NoDictionaryId if the content
+        //! is not a Zstd dictionary or a different dictionary with the same id is already registered
+        virtual ZstdDictionaryId RegisterDictionary(AZStd::span<const AZStd::byte> dictionary) = 0;
+
+        //! Unregisters the dictionary with the specified id
+        //! @return true if a dictionary with the id was registered
+        virtual bool UnregisterDictionary(ZstdDictionaryId dictionaryId) = 0;
+
+        //! Returns true if a dictionary with the specified id is registered
+        [[nodiscard]] virtual bool IsDictionaryRegistered(ZstdDictionaryId dictionaryId) const = 0;
+    };
+
+    using ZstdDictionaryRegistry = AZ::Interface<ZstdDictionaryRegistryInterface>;
+} // namespace CompressionZstd
+
+#include "CompressionZstdAPI.inl"
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Compression/CompressionTypeIds.h>
+
+namespace CompressionZstd
+{
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(ZstdCompressionOptions, "ZstdCompressionOptions",
+        Compression::ZstdCompressionOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(ZstdCompressionOptions, Compression::CompressionOptions);
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(ZstdDecompressionOptions, "ZstdDecompressionOptions",
+        Compression::ZstdDecompressionOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(ZstdDecompressionOptions, Compression::DecompressionOptions);
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(ZstdDictionaryRegistryInterface, "ZstdDictionaryRegistryInterface",
+        Compression::ZstdDictionaryRegistryInterfaceTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(ZstdDictionaryRegistryInterface);
+} // namespace CompressionZstd
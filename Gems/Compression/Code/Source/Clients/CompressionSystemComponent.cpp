@@ -14,6 +14,8 @@
 #include <Compression/CompressionTypeIds.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 #include "DecompressorLZ4Impl.h"
+#include <Compression/CompressionZstdAPI.h>
+#include "DecompressorZstdImpl.h"
 
 #include <Clients/Streamer/DecompressorStackEntry.h>
 
@@ -51,6 +53,40 @@ namespace CompressionLZ4
     }
 }
 
+namespace CompressionZstd
+{
+    void RegisterDecompressorZstdInterface()
+    {
+        // Register the zstd decompressor with the decompression registrar
+        if (auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+            decompressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZstdCompressionAlgorithmId();
+            auto decompressorZstd = AZStd::make_unique<DecompressorZstd>();
+            [[maybe_unused]] auto registerOutcome = decompressionRegistrar->RegisterDecompressionInterface(
+                compressionAlgorithmId,
+                AZStd::move(decompressorZstd));
+
+            AZ_Error("Compression Zstd", bool{ registerOutcome }, "Registration of Zstd Decompressor with the DecompressionRegistrar"
+                " has failed with Id %u", compressionAlgorithmId);
+        }
+    }
+    void UnregisterDecompressorZstdInterface()
+    {
+        // Unregister the zstd decompressor using the zstd compression algorithm Id
+        if (auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+            decompressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZstdCompressionAlgorithmId();
+            [[maybe_unused]] bool unregisterOutcome = decompressionRegistrar->UnregisterDecompressionInterface(
+                compressionAlgorithmId);
+
+            AZ_Error("Compression Zstd", unregisterOutcome, "Zstd Decompressor with Id %u is not registered with"
+                " with DecompressionRegistrar", static_cast<AZ::u32>(compressionAlgorithmId));
+        }
+    }
+}
+
 namespace Compression
 {
     AZ_COMPONENT_IMPL(CompressionSystemComponent, "CompressionSystemComponent",
@@ -113,10 +149,12 @@ namespace Compression
     {
         CompressionRequestBus::Handler::BusConnect();
         CompressionLZ4::RegisterDecompressorLZ4Interface();
+        CompressionZstd::RegisterDecompressorZstdInterface();
     }
 
     void CompressionSystemComponent::Deactivate()
     {
+        CompressionZstd::UnregisterDecompressorZstdInterface();
         CompressionLZ4::UnregisterDecompressorLZ4Interface();
         CompressionRequestBus::Handler::BusDisconnect();
     }
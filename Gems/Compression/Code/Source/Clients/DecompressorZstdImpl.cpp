@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "DecompressorZstdImpl.h"
+
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <zstd.h>
+
+namespace CompressionZstd
+{
+    namespace Internal
+    {
+        struct DCtxDeleter
+        {
+            void operator()(ZSTD_DCtx* decompressionContext) const
+            {
+                ZSTD_freeDCtx(decompressionContext);
+            }
+        };
+
+        //! Decompression contexts are reused per thread to avoid reallocating the window buffer for every block
+        ZSTD_DCtx* GetThreadDecompressionContext()
+        {
+            thread_local AZStd::unique_ptr<ZSTD_DCtx, DCtxDeleter> decompressionContext{ ZSTD_createDCtx() };
+            return decompressionContext.get();
+        }
+    }
+
+    // Definitions for Zstd Decompressor
+    DecompressorZstd::DecompressorZstd()
+    {
+        if (ZstdDictionaryRegistry::Get() == nullptr)
+        {
+            ZstdDictionaryRegistry::Register(this);
+        }
+    }
+
+    DecompressorZstd::~DecompressorZstd()
+    {
+        if (ZstdDictionaryRegistry::Get() == this)
+        {
+            ZstdDictionaryRegistry::Unregister(this);
+        }
+    }
+
+    Compression::CompressionAlgorithmId DecompressorZstd::GetCompressionAlgorithmId() const
+    {
+        return GetZstdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view DecompressorZstd::GetCompressionAlgorithmName() const
+    {
+        return GetZstdCompressionAlgorithmName();
+    }
+
+    auto DecompressorZstd::CreateDecompressionDictionary(AZStd::span<const AZStd::byte> dictionary) -> DDictPtr
+    {
+        // ZSTD_createDDict copies the dictionary content, so the caller's memory doesn't need to outlive the DDict
+        ZSTD_DDict* decompressionDictionary = ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if (decompressionDictionary == nullptr)
+        {
+            return {};
+        }
+
+        return DDictPtr(decompressionDictionary, [](const ZSTD_DDict* ddict)
+        {
+            ZSTD_freeDDict(const_cast<ZSTD_DDict*>(ddict));
+        });
+    }
+
+    auto DecompressorZstd::AcquireDecompressionDictionary(
+        ZstdDictionaryId dictionaryId, AZStd::span<const AZStd::span<const AZStd::byte>> optionDictionaries) const -> DDictPtr
+    {
+        {
+            AZStd::shared_lock lock(m_decompressionDictionaryMutex);
+            if (auto dictionaryIter = m_decompressionDictionaries.find(dictionaryId);
+                dictionaryIter != m_decompressionDictionaries.end())
+            {
+                return dictionaryIter->second.m_decompressionDictionary;
+            }
+        }
+
+        for (const AZStd::span<const AZStd::byte>& optionDictionary : optionDictionaries)
+        {
+            if (ZSTD_getDictID_fromDict(optionDictionary.data(), optionDictionary.size()) == dictionaryId)
+            {
+                DDictPtr decompressionDictionary = CreateDecompressionDictionary(optionDictionary);
+                if (decompressionDictionary != nullptr)
+                {
+                    AZStd::scoped_lock lock(m_decompressionDictionaryMutex);
+                    // Another thread may have digested the same dictionary in the meantime, in which case its entry is used
+                    auto [dictionaryIter, inserted] = m_decompressionDictionaries.try_emplace(
+                        dictionaryId, DictionaryEntry{ AZStd::move(decompressionDictionary) });
+                    return dictionaryIter->second.m_decompressionDictionary;
+                }
+            }
+        }
+
+        return {};
+    }
+
+    Compression::DecompressionResultData DecompressorZstd::DecompressBlock(
+        AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+        const Compression::DecompressionOptions& decompressionOptions) const
+    {
+        Compression::DecompressionResultData resultData;
+
+        if (decompressionBuffer.empty())
+        {
+            resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString(
+                "Decompression buffer is empty, uncompressed content cannot be stored in it\n");
+            // Do not return, but hold on to result string in case an error occurs in decompression
+        }
+
+        ZSTD_DCtx* decompressionContext = Internal::GetThreadDecompressionContext();
+        if (decompressionContext == nullptr)
+        {
+            resultData.m_decompressionOutcome.m_resultString += "Unable to create a Zstd decompression context";
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        size_t decompressedSize;
+        if (const ZstdDictionaryId dictionaryId = ZSTD_getDictID_fromFrame(compressedData.data(), compressedData.size());
+            dictionaryId != NoDictionaryId)
+        {
+            AZStd::span<const AZStd::span<const AZStd::byte>> optionDictionaries;
+            if (auto zstdOptions = azrtti_cast<const ZstdDecompressionOptions*>(&decompressionOptions);
+                zstdOptions != nullptr)
+            {
+                optionDictionaries = zstdOptions->m_dictionaries;
+            }
+
+            DDictPtr decompressionDictionary = AcquireDecompressionDictionary(dictionaryId, optionDictionaries);
+            if (decompressionDictionary == nullptr)
+            {
+                resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                    "The Zstd compressed block requires dictionary %u, which is neither registered with the"
+                    " ZstdDictionaryRegistry nor supplied in the decompression options", dictionaryId);
+                resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+                return resultData;
+            }
+
+            decompressedSize = ZSTD_decompress_usingDDict(decompressionContext,
+                decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size(),
+                decompressionDictionary.get());
+        }
+        else
+        {
+            decompressedSize = ZSTD_decompressDCtx(decompressionContext,
+                decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size());
+        }
+
+        if (ZSTD_isError(decompressedSize))
+        {
+            resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                "Zstd decompression has failed with error \"%s\". Dest buffer capacity: %zu, source stream size: %zu",
+                ZSTD_getErrorName(decompressedSize), decompressionBuffer.size(), compressedData.size());
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the decompressed data and
+        // the correct decompressed size
+        resultData.m_uncompressedBuffer = decompressionBuffer.subspan(0, decompressedSize);
+        resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Complete;
+        return resultData;
+    }
+
+    ZstdDictionaryId DecompressorZstd::RegisterDictionary(AZStd::span<const AZStd::byte> dictionary)
+    {
+        const ZstdDictionaryId dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+        if (dictionaryId == NoDictionaryId)
+        {
+            AZ_Error("Compression Zstd", false, "Only trained Zstd dictionaries with a dictionary id can be registered");
+            return NoDictionaryId;
+        }
+
+        DDictPtr decompressionDictionary = CreateDecompressionDictionary(dictionary);
+        if (decompressionDictionary == nullptr)
+        {
+            AZ_Error("Compression Zstd", false, "Zstd dictionary %u could not be loaded", dictionaryId);
+            return NoDictionaryId;
+        }
+
+        AZStd::scoped_lock lock(m_decompressionDictionaryMutex);
+        DictionaryEntry& dictionaryEntry = m_decompressionDictionaries[dictionaryId];
+        if (dictionaryEntry.m_registered)
+        {
+            AZ_Error("Compression Zstd", false, "A Zstd dictionary with id %u is already registered", dictionaryId);
+            return NoDictionaryId;
+        }
+
+        dictionaryEntry.m_decompressionDictionary = AZStd::move(decompressionDictionary);
+        dictionaryEntry.m_registered = true;
+        return dictionaryId;
+    }
+
+    bool DecompressorZstd::UnregisterDictionary(ZstdDictionaryId dictionaryId)
+    {
+        AZStd::scoped_lock lock(m_decompressionDictionaryMutex);
+        if (auto dictionaryIter = m_decompressionDictionaries.find(dictionaryId);
+            dictionaryIter != m_decompressionDictionaries.end() && dictionaryIter->second.m_registered)
+        {
+            m_decompressionDictionaries.erase(dictionaryIter);
+            return true;
+        }
+
+        return false;
+    }
+
+    bool DecompressorZstd::IsDictionaryRegistered(ZstdDictionaryId dictionaryId) const
+    {
+        AZStd::shared_lock lock(m_decompressionDictionaryMutex);
+        auto dictionaryIter = m_decompressionDictionaries.find(dictionaryId);
+        return dictionaryIter != m_decompressionDictionaries.end() && dictionaryIter->second.m_registered;
+    }
+} // namespace CompressionZstd
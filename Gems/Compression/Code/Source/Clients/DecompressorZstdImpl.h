@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Compression/CompressionZstdAPI.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+struct ZSTD_DDict_s;
+
+namespace CompressionZstd
+{
+    //! Zstd decompressor which also acts as the ZstdDictionaryRegistry while it is alive
+    class DecompressorZstd
+        : public Compression::IDecompressionInterface
+        , public ZstdDictionaryRegistryInterface
+    {
+    public:
+        DecompressorZstd();
+        ~DecompressorZstd();
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the Zstd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Decompresses the compressed data into the decompression buffer
+        //! If the block was compressed with a dictionary, the dictionary is looked up
+        //! in the ZstdDecompressionOptions and then in the registered dictionaries
+        //! @return a DecompressionResultData instance to indicate if decompression operation has succeeded
+        [[nodiscard]] Compression::DecompressionResultData DecompressBlock(
+            AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+            const Compression::DecompressionOptions& decompressionOptions = {}) const override;
+
+        // ZstdDictionaryRegistryInterface overrides...
+        ZstdDictionaryId RegisterDictionary(AZStd::span<const AZStd::byte> dictionary) override;
+        bool UnregisterDictionary(ZstdDictionaryId dictionaryId) override;
+        [[nodiscard]] bool IsDictionaryRegistered(ZstdDictionaryId dictionaryId) const override;
+
+    private:
+        using DDictPtr = AZStd::shared_ptr<const ZSTD_DDict_s>;
+        static DDictPtr CreateDecompressionDictionary(AZStd::span<const AZStd::byte> dictionary);
+
+        //! Returns the digested dictionary with the specified id, digesting a matching dictionary
+        //! from the decompression options if it hasn't been seen yet
+        DDictPtr AcquireDecompressionDictionary(
+            ZstdDictionaryId dictionaryId, AZStd::span<const AZStd::span<const AZStd::byte>> optionDictionaries) const;
+
+        struct DictionaryEntry
+        {
+            DDictPtr m_decompressionDictionary;
+            //! Set when the dictionary was added through RegisterDictionary
+            //! instead of being cached from the decompression options
+            bool m_registered{};
+        };
+
+        //! Digested dictionaries keyed by dictionary id
+        //! Entries are shared pointers so that a dictionary can be unregistered while a block is decompressed with it
+        mutable AZStd::unordered_map<ZstdDictionaryId, DictionaryEntry> m_decompressionDictionaries;
+        mutable AZStd::shared_mutex m_decompressionDictionaryMutex;
+    };
+} // namespace CompressionZstd
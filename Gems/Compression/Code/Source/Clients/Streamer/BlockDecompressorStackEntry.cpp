@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "BlockDecompressorStackEntry.h"
+
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace Compression
+{
+    BlockDecompressorEntry::BlockDecompressorEntry(AZ::u32 maxNumBlocks, AZ::u32 alignment)
+        : AZ::IO::StreamStackEntry("Compression Gem block decompressor")
+        , m_maxNumBlocks(AZStd::max(maxNumBlocks, 1u))
+        , m_alignment(alignment)
+    {
+        m_slots = AZStd::make_unique<BlockSlot[]>(m_maxNumBlocks);
+        m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>(AZStd::min(m_maxNumBlocks, AZStd::thread::hardware_concurrency()));
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_bytesDecompressed.PushEntry(1);
+        m_decompressionDurationMicroSec.PushEntry(1);
+    }
+
+    void BlockDecompressorEntry::QueueRequest(AZ::IO::FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        auto QueueCommand = [this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, AZ::IO::Requests::CompressedReadData>)
+            {
+                if (args.m_compressionInfo.IsBlockCompressed())
+                {
+                    m_pendingReads.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, AZ::IO::Requests::ReportData>)
+            {
+                Report(args);
+            }
+            AZ::IO::StreamStackEntry::QueueRequest(request);
+        };
+
+        AZStd::visit(AZStd::move(QueueCommand), request->GetCommand());
+    }
+
+    bool BlockDecompressorEntry::ExecuteRequests()
+    {
+        // First queue decompression tasks for the blocks that have arrived.
+        bool result = StartDecompressions();
+
+        // Fill up the available slots with block reads. Blocks from older requests are read first so requests are
+        // completed in the order the scheduler queued them.
+        while (m_numBlocksInFlight < m_maxNumBlocks)
+        {
+            ActiveRead* activeRead = FindReadWithUnreadBlocks();
+            if (!activeRead)
+            {
+                if (m_pendingReads.empty())
+                {
+                    break;
+                }
+                AZ::IO::FileRequest* request = m_pendingReads.front();
+                m_pendingReads.pop_front();
+                result = true;
+                if (!ActivateRead(request))
+                {
+                    continue;
+                }
+                activeRead = &m_activeReads.back();
+            }
+
+            for (AZ::u32 slotIndex = 0; slotIndex < m_maxNumBlocks; ++slotIndex)
+            {
+                if (m_slots[slotIndex].m_status == BlockStatus::Unused)
+                {
+                    StartBlockRead(*activeRead, slotIndex);
+                    break;
+                }
+            }
+            result = true;
+        }
+
+        return AZ::IO::StreamStackEntry::ExecuteRequests() || result;
+    }
+
+    void BlockDecompressorEntry::UpdateStatus(Status& status) const
+    {
+        AZ::IO::StreamStackEntry::UpdateStatus(status);
+
+        // Blocks that still need to be read for active requests will claim the free slots first.
+        AZ::s64 numAvailableSlots = aznumeric_cast<AZ::s64>(m_maxNumBlocks - m_numBlocksInFlight);
+        for (const ActiveRead& activeRead : m_activeReads)
+        {
+            if (!activeRead.m_failed)
+            {
+                numAvailableSlots -= aznumeric_cast<AZ::s64>(activeRead.m_endBlock - activeRead.m_nextBlock);
+            }
+        }
+        numAvailableSlots -= aznumeric_cast<AZ::s64>(m_pendingReads.size());
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, aznumeric_cast<AZ::s32>(AZStd::max(numAvailableSlots, AZ::s64{ 0 })));
+        status.m_isIdle = status.m_isIdle && IsIdle();
+    }
+
+    void BlockDecompressorEntry::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<AZ::IO::FileRequest*>& internalPending, AZ::IO::StreamerContext::PreparedQueue::iterator pendingBegin,
+        AZ::IO::StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+
+        AZ::IO::StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        double totalBytesDecompressed = aznumeric_caster(m_bytesDecompressed.GetTotal());
+        double totalDecompressionDuration = aznumeric_caster(m_decompressionDurationMicroSec.GetTotal());
+        AZStd::chrono::microseconds decompressionDelay =
+            AZStd::chrono::microseconds(static_cast<AZ::u64>(m_decompressionJobDelayMicroSec.CalculateAverage()));
+
+        // Blocks are decompressed in parallel, so a block is done after its read completes and it has been decompressed.
+        // The compressed read completes with its last block.
+        AZStd::chrono::microseconds cumulativeDelay(0);
+        for (AZ::u32 slotIndex = 0; slotIndex < m_maxNumBlocks; ++slotIndex)
+        {
+            const BlockSlot& slot = m_slots[slotIndex];
+            if (slot.m_status == BlockStatus::Unused)
+            {
+                continue;
+            }
+
+            AZStd::chrono::steady_clock::time_point baseTime = now + decompressionDelay;
+            if (slot.m_status == BlockStatus::ReadInFlight)
+            {
+                // Internal read requests can start and complete but pending finalization before they're ever scheduled in which case
+                // the estimated time is not set.
+                baseTime = AZStd::max(slot.m_request->GetEstimatedCompletion(), now) + decompressionDelay;
+            }
+            else if (slot.m_status == BlockStatus::Decompressing)
+            {
+                baseTime = slot.m_jobStartTime;
+            }
+
+            auto decompressionDuration = AZStd::chrono::microseconds(static_cast<AZ::u64>(
+                (slot.m_bufferSize * totalDecompressionDuration) / totalBytesDecompressed));
+            AZStd::chrono::steady_clock::time_point completion = baseTime + decompressionDuration;
+            slot.m_request->SetEstimatedCompletion(completion);
+            if (completion > now)
+            {
+                cumulativeDelay = AZStd::max(cumulativeDelay,
+                    AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(completion - now));
+            }
+        }
+        for (const ActiveRead& activeRead : m_activeReads)
+        {
+            activeRead.m_holdRequest->SetEstimatedCompletion(now + cumulativeDelay);
+        }
+
+        // For all internally pending compressed reads add the decompression time. The read time will have already been added downstream.
+        // Because this call will go from the top of the stack to the bottom, but estimation is calculated from the bottom to the top, this
+        // list should be processed in reverse order.
+        for (auto pendingIt = internalPending.rbegin(); pendingIt != internalPending.rend(); ++pendingIt)
+        {
+            EstimateCompressedReadRequest(*pendingIt, cumulativeDelay, decompressionDelay,
+                totalDecompressionDuration, totalBytesDecompressed);
+        }
+
+        // Finally add a prediction for all the requests that are waiting to be queued.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompressedReadRequest(*requestIt, cumulativeDelay, decompressionDelay,
+                totalDecompressionDuration, totalBytesDecompressed);
+        }
+    }
+
+    void BlockDecompressorEntry::EstimateCompressedReadRequest(AZ::IO::FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+        AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const
+    {
+        auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&request->GetCommand());
+        if (data && data->m_compressionInfo.IsBlockCompressed() && data->m_readSize > 0)
+        {
+            // Only the last block needs to be decompressed after the read completes, as the other blocks are decompressed
+            // while later blocks are being read.
+            const AZ::IO::CompressionInfo& info = data->m_compressionInfo;
+            size_t lastBlock = aznumeric_cast<size_t>((data->m_readOffset + data->m_readSize - 1) / info.m_blockSize);
+            size_t bytesToDecompress = lastBlock + 1 < info.m_blockOffsets->size() ? GetCompressedBlockSize(*data, lastBlock) : 0;
+
+            AZStd::chrono::microseconds processingTime = decompressionDelay;
+            processingTime += AZStd::chrono::microseconds(
+                static_cast<AZ::u64>((bytesToDecompress * totalDecompressionDurationUs) / totalBytesDecompressed));
+
+            cumulativeDelay += processingTime;
+            request->SetEstimatedCompletion(request->GetEstimatedCompletion() + processingTime);
+        }
+    }
+
+    void BlockDecompressorEntry::CollectStatistics(AZStd::vector<AZ::IO::Statistic>& statistics) const
+    {
+        constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+        constexpr double usToMs = 1.0 / 1000.0;
+
+        if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+        {
+            statistics.push_back(AZ::IO::Statistic::CreateInteger(
+                m_name, "Available block slots", m_maxNumBlocks - m_numBlocksInFlight,
+                "The number of slots available for blocks to be read into and decompressed from. If this is frequently zero while "
+                "there are pending decompressions, decompressing is slower than reading."));
+            statistics.push_back(AZ::IO::Statistic::CreateInteger(
+                m_name, "Pending decompression", m_numPendingDecompression,
+                "The number of blocks that have completed reading and are waiting to be handed to the task system."));
+            statistics.push_back(AZ::IO::Statistic::CreateByteSize(
+                m_name, "Buffer memory", m_memoryUsage,
+                "The total amount of memory used by the block decompressor. This is bound by the number of block slots and the block size "
+                "as only blocks that are in flight need a buffer."));
+            statistics.push_back(AZ::IO::Statistic::CreateByteSize(
+                m_name, "Compressed bytes skipped", m_compressedBytesSkipped,
+                "The total amount of compressed data that didn't need to be read because it was outside of the range of partial reads.",
+                AZ::IO::Statistic::GraphType::None));
+
+            double averageJobStartDelay = m_decompressionJobDelayMicroSec.CalculateAverage() * usToMs;
+            statistics.push_back(AZ::IO::Statistic::CreateFloat(
+                m_name, "Decompression task delay (avg. ms)", averageJobStartDelay,
+                "The amount of time in milliseconds between queuing a block decompression task and it starting. If this is too long it "
+                "may indicate that the task system is too saturated to pick up decompression tasks."));
+
+            AZ::u64 totalBytesDecompressed = m_bytesDecompressed.GetTotal();
+            double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+            statistics.push_back(AZ::IO::Statistic::CreateBytesPerSecond(
+                m_name, "Decompression Speed per task", totalBytesDecompressed / totalDecompressionTimeSec,
+                "The average speed at which a single task decompresses blocks. Blocks are decompressed in parallel, so the total "
+                "decompression speed scales with the number of block slots and available task workers."));
+        }
+
+        AZ::IO::StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool BlockDecompressorEntry::IsIdle() const
+    {
+        return m_pendingReads.empty() && m_activeReads.empty() && m_numBlocksInFlight == 0;
+    }
+
+    bool BlockDecompressorEntry::ActivateRead(AZ::IO::FileRequest* request)
+    {
+        auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&request->GetCommand());
+        AZ_Assert(data, "Request queued in the BlockDecompressorEntry didn't contain compressed read data.");
+        const AZ::IO::CompressionInfo& info = data->m_compressionInfo;
+
+        const size_t numBlocks = info.GetNumBlocks();
+        const bool hasValidBlockTable = info.m_blockOffsets->size() == numBlocks + 1;
+        AZ_Error("Streamer", hasValidBlockTable,
+            "The block table for '%s' has %zu entries, but %zu are needed for %zu bytes in blocks of %zu bytes.",
+            info.m_archiveFilename.GetRelativePathCStr(), info.m_blockOffsets->size(), numBlocks + 1, info.m_uncompressedSize,
+            info.m_blockSize);
+        if (!m_next || !hasValidBlockTable || data->m_readOffset + data->m_readSize > info.m_uncompressedSize)
+        {
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return false;
+        }
+
+        if (data->m_readSize == 0)
+        {
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return false;
+        }
+
+        ActiveRead& activeRead = m_activeReads.emplace_back();
+        activeRead.m_request = request;
+        activeRead.m_nextBlock = aznumeric_cast<size_t>(data->m_readOffset / info.m_blockSize);
+        activeRead.m_endBlock = aznumeric_cast<size_t>((data->m_readOffset + data->m_readSize + info.m_blockSize - 1) / info.m_blockSize);
+        activeRead.m_holdRequest = m_context->GetNewInternalRequest();
+        activeRead.m_holdRequest->CreateWait(request);
+
+        const AZStd::vector<AZ::u64>& blockOffsets = *info.m_blockOffsets;
+        m_compressedBytesSkipped += blockOffsets.back() -
+            (blockOffsets[activeRead.m_endBlock] - blockOffsets[activeRead.m_nextBlock]);
+        return true;
+    }
+
+    auto BlockDecompressorEntry::FindReadWithUnreadBlocks() -> ActiveRead*
+    {
+        for (ActiveRead& activeRead : m_activeReads)
+        {
+            if (!activeRead.m_failed && activeRead.m_nextBlock < activeRead.m_endBlock)
+            {
+                return &activeRead;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t BlockDecompressorEntry::GetCompressedBlockSize(const AZ::IO::Requests::CompressedReadData& data, size_t blockIndex)
+    {
+        const AZStd::vector<AZ::u64>& blockOffsets = *data.m_compressionInfo.m_blockOffsets;
+        return aznumeric_cast<size_t>(blockOffsets[blockIndex + 1] - blockOffsets[blockIndex]);
+    }
+
+    void BlockDecompressorEntry::StartBlockRead(ActiveRead& activeRead, AZ::u32 slotIndex)
+    {
+        auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&activeRead.m_request->GetCommand());
+        AZ_Assert(data, "Compressed request that's starting a block read in BlockDecompressorEntry didn't contain compression read data.");
+        const AZ::IO::CompressionInfo& info = data->m_compressionInfo;
+
+        BlockSlot& slot = m_slots[slotIndex];
+        slot.m_activeRead = &activeRead;
+        slot.m_blockIndex = activeRead.m_nextBlock++;
+
+        // The buffer is aligned down but the offset is not corrected, so caches further down the stack can still detect
+        // reads to the same data. This does allow the reads in between the BlockCache's prolog and epilog to go into aligned memory.
+        size_t blockOffset = info.m_offset + aznumeric_cast<size_t>((*info.m_blockOffsets)[slot.m_blockIndex]);
+        size_t compressedSize = GetCompressedBlockSize(*data, slot.m_blockIndex);
+        slot.m_alignmentOffset = aznumeric_cast<AZ::u32>(blockOffset - AZ_SIZE_ALIGN_DOWN(blockOffset, aznumeric_cast<size_t>(m_alignment)));
+        slot.m_bufferSize = AZ_SIZE_ALIGN_UP(compressedSize + slot.m_alignmentOffset, aznumeric_cast<size_t>(m_alignment));
+        slot.m_compressedData = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+            slot.m_bufferSize, m_alignment));
+        m_memoryUsage += slot.m_bufferSize;
+
+        AZ::IO::FileRequest* readRequest = m_context->GetNewInternalRequest();
+        readRequest->CreateRead(activeRead.m_request, slot.m_compressedData + slot.m_alignmentOffset,
+            slot.m_bufferSize - slot.m_alignmentOffset, info.m_archiveFilename, blockOffset, compressedSize, info.m_isSharedPak);
+        readRequest->SetCompletionCallback([this, slotIndex](AZ::IO::FileRequest& request)
+            {
+                FinishBlockRead(&request, slotIndex);
+            });
+
+        slot.m_request = readRequest;
+        slot.m_status = BlockStatus::ReadInFlight;
+        activeRead.m_numBlocksInFlight++;
+        m_numBlocksInFlight++;
+
+        m_next->QueueRequest(readRequest);
+    }
+
+    void BlockDecompressorEntry::FinishBlockRead(AZ::IO::FileRequest* readRequest, AZ::u32 slotIndex)
+    {
+        BlockSlot& slot = m_slots[slotIndex];
+        AZ_Assert(slot.m_request == readRequest, "Request in the block slot isn't the same as request that's being completed.");
+
+        if (readRequest->GetStatus() == AZ::IO::IStreamerTypes::RequestStatus::Completed)
+        {
+            // Add this wait so the compressed request isn't completed if this was its last block. The task will
+            // finish this wait, which in turn will call FinishDecompression on the main streaming thread.
+            AZ::IO::FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(readRequest->GetParent());
+            slot.m_request = waitRequest;
+            slot.m_status = BlockStatus::PendingDecompression;
+            ++m_numPendingDecompression;
+        }
+        else
+        {
+            // The failed or canceled status has been forwarded to the compressed request, so stop reading blocks for it.
+            ActiveRead& activeRead = *slot.m_activeRead;
+            activeRead.m_failed = true;
+            ReleaseSlot(slot);
+            TryCompleteRead(activeRead);
+        }
+    }
+
+    bool BlockDecompressorEntry::StartDecompressions()
+    {
+        if (m_numPendingDecompression == 0)
+        {
+            return false;
+        }
+
+        AZ::TaskGraph taskGraph{ "Block Decompression Tasks" };
+        AZ::TaskDescriptor taskDescriptor{ "Decompress block", "Compression" };
+        auto now = AZStd::chrono::steady_clock::now();
+        for (AZ::u32 slotIndex = 0; slotIndex < m_maxNumBlocks; ++slotIndex)
+        {
+            BlockSlot& slot = m_slots[slotIndex];
+            if (slot.m_status != BlockStatus::PendingDecompression)
+            {
+                continue;
+            }
+
+            slot.m_request->SetCompletionCallback([this, slotIndex](AZ::IO::FileRequest& request)
+                {
+                    FinishDecompression(&request, slotIndex);
+                });
+
+            auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&slot.m_activeRead->m_request->GetCommand());
+            AZ_Assert(data, "Compressed request in BlockDecompressorEntry that's starting decompression didn't contain compression read data.");
+            const AZ::IO::CompressionInfo& info = data->m_compressionInfo;
+            size_t blockStart = slot.m_blockIndex * info.m_blockSize;
+            size_t blockSize = AZStd::min(info.m_blockSize, info.m_uncompressedSize - blockStart);
+            slot.m_isPartial = blockStart < data->m_readOffset || blockStart + blockSize > data->m_readOffset + data->m_readSize;
+            if (slot.m_isPartial)
+            {
+                m_memoryUsage += blockSize;
+            }
+
+            slot.m_queueStartTime = now;
+            slot.m_jobStartTime = now; // Set these to the same in case the scheduler requests an update before the task has started.
+            slot.m_status = BlockStatus::Decompressing;
+            --m_numPendingDecompression;
+            ++m_numRunningTasks;
+
+            taskGraph.AddTask(taskDescriptor, [this, &slot]()
+                {
+                    DecompressBlock(m_context, slot);
+                });
+        }
+
+        // The graph isn't kept around, so let the tasks clean up after themselves.
+        taskGraph.Detach();
+        taskGraph.SubmitOnExecutor(*m_taskExecutor);
+        return true;
+    }
+
+    void BlockDecompressorEntry::FinishDecompression(AZ::IO::FileRequest* waitRequest, AZ::u32 slotIndex)
+    {
+        BlockSlot& slot = m_slots[slotIndex];
+        AZ_Assert(slot.m_request == waitRequest, "Block slot didn't contain the expected wait request.");
+
+        auto endTime = AZStd::chrono::steady_clock::now();
+        m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            slot.m_jobStartTime - slot.m_queueStartTime).count());
+        m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            endTime - slot.m_jobStartTime).count());
+        m_bytesDecompressed.PushEntry(slot.m_bufferSize);
+
+        if (slot.m_isPartial)
+        {
+            auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&slot.m_activeRead->m_request->GetCommand());
+            AZ_Assert(data, "Compressed request in BlockDecompressorEntry that completed decompression didn't contain compression read data.");
+            size_t blockStart = slot.m_blockIndex * data->m_compressionInfo.m_blockSize;
+            m_memoryUsage -= AZStd::min(data->m_compressionInfo.m_blockSize, data->m_compressionInfo.m_uncompressedSize - blockStart);
+        }
+
+        AZ_Assert(m_numRunningTasks > 0, "About to complete a decompression task, but the internal count doesn't see a running task.");
+        --m_numRunningTasks;
+
+        ActiveRead& activeRead = *slot.m_activeRead;
+        activeRead.m_failed = activeRead.m_failed || waitRequest->GetStatus() != AZ::IO::IStreamerTypes::RequestStatus::Completed;
+        ReleaseSlot(slot);
+        TryCompleteRead(activeRead);
+    }
+
+    void BlockDecompressorEntry::ReleaseSlot(BlockSlot& slot)
+    {
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_compressedData, slot.m_bufferSize, m_alignment);
+        m_memoryUsage -= slot.m_bufferSize;
+
+        AZ_Assert(slot.m_activeRead->m_numBlocksInFlight > 0, "Block slot released for a compressed read without blocks in flight.");
+        slot.m_activeRead->m_numBlocksInFlight--;
+        AZ_Assert(m_numBlocksInFlight > 0, "Block slot released in BlockDecompressorEntry, but no blocks are supposed to be in flight.");
+        m_numBlocksInFlight--;
+
+        slot = BlockSlot{};
+    }
+
+    void BlockDecompressorEntry::TryCompleteRead(ActiveRead& activeRead)
+    {
+        if (activeRead.m_numBlocksInFlight > 0 || (!activeRead.m_failed && activeRead.m_nextBlock < activeRead.m_endBlock))
+        {
+            return;
+        }
+
+        // If a block failed, its status will already have been forwarded to the compressed read and won't be overwritten.
+        activeRead.m_holdRequest->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(activeRead.m_holdRequest);
+
+        auto it = AZStd::find_if(m_activeReads.begin(), m_activeReads.end(),
+            [&activeRead](const ActiveRead& entry)
+            {
+                return &entry == &activeRead;
+            });
+        AZ_Assert(it != m_activeReads.end(), "Completed compressed read wasn't found in the list of active reads.");
+        m_activeReads.erase(it);
+    }
+
+    void BlockDecompressorEntry::DecompressBlock(AZ::IO::StreamerContext* context, BlockSlot& slot)
+    {
+        slot.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&slot.m_activeRead->m_request->GetCommand());
+        AZ_Assert(data, "Compressed request in BlockDecompressorEntry that's decompressing a block didn't contain compression read data.");
+        const AZ::IO::CompressionInfo& info = data->m_compressionInfo;
+        AZ_Assert(info.m_decompressor, "Block decompression task started, but there's no decompressor callback assigned.");
+
+        size_t blockStart = slot.m_blockIndex * info.m_blockSize;
+        size_t blockSize = AZStd::min(info.m_blockSize, info.m_uncompressedSize - blockStart);
+        size_t copyStart = AZStd::max(blockStart, aznumeric_cast<size_t>(data->m_readOffset));
+        size_t copyEnd = AZStd::min(blockStart + blockSize, aznumeric_cast<size_t>(data->m_readOffset + data->m_readSize));
+        AZ::u8* output = reinterpret_cast<AZ::u8*>(data->m_output) + (copyStart - data->m_readOffset);
+        const AZ::u8* compressed = slot.m_compressedData + slot.m_alignmentOffset;
+        size_t compressedSize = GetCompressedBlockSize(*data, slot.m_blockIndex);
+
+        bool success = false;
+        if (!slot.m_isPartial)
+        {
+            success = info.m_decompressor(info, compressed, compressedSize, output, blockSize);
+        }
+        else
+        {
+            auto decompressionBuffer = AZStd::make_unique<AZ::u8[]>(blockSize);
+            success = info.m_decompressor(info, compressed, compressedSize, decompressionBuffer.get(), blockSize);
+            if (success)
+            {
+                memcpy(output, decompressionBuffer.get() + (copyStart - blockStart), copyEnd - copyStart);
+            }
+        }
+        slot.m_request->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
+
+        context->MarkRequestAsCompleted(slot.m_request);
+        context->WakeUpSchedulingThread();
+    }
+
+    void BlockDecompressorEntry::Report(const AZ::IO::Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case AZ::IO::IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(AZ::IO::Statistic::CreateInteger(
+                m_name, "Max number of blocks", m_maxNumBlocks,
+                "The maximum number of compressed blocks that are read or decompressed at the same time. Each block in flight needs a "
+                "buffer for its compressed data."));
+            data.m_output.push_back(AZ::IO::Statistic::CreateByteSize(
+                m_name, "Alignment", m_alignment,
+                "The alignment for block read buffers. This allows enough memory to be reserved in the read buffer to allow for alignment "
+                "to happen by later nodes without requiring additional temporary buffers."));
+            data.m_output.push_back(AZ::IO::Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        };
+    }
+} // namespace Compression
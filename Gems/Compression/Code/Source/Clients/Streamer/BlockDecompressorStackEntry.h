@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+namespace AZ::IO::Requests
+{
+    struct CompressedReadData;
+    struct ReportData;
+}
+
+namespace Compression
+{
+    //! Entry in the streamer stack that decompresses files that were compressed as a sequence of independently
+    //! compressed blocks (see AZ::IO::CompressionInfo::m_blockSize). Only the blocks that overlap with the requested
+    //! range are read and every block is decompressed as soon as its read completes, while the reads for the following
+    //! blocks are still in flight. Blocks that are fully covered by the request are decompressed directly into the
+    //! output buffer, so only the partially covered first and last block need temporary memory.
+    //! Decompression tasks are spread over the workers of a task executor with one worker per block slot, up to the
+    //! number of hardware threads.
+    //! Compressed reads for files that aren't block compressed are passed on to the next entry, which is normally
+    //! the DecompressorRegistrarEntry.
+    //! This entry is opt-in and only added when DecompressorRegistrarConfig::m_maxNumBlocks is set. No archive provider
+    //! supplies block tables yet, so until one does every read is passed on.
+    class BlockDecompressorEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        BlockDecompressorEntry(AZ::u32 maxNumBlocks, AZ::u32 alignment);
+        ~BlockDecompressorEntry() override = default;
+
+        void QueueRequest(AZ::IO::FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<AZ::IO::FileRequest*>& internalPending,
+            AZ::IO::StreamerContext::PreparedQueue::iterator pendingBegin, AZ::IO::StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<AZ::IO::Statistic>& statistics) const override;
+
+    private:
+        using Buffer = AZ::u8*;
+
+        enum class BlockStatus : uint8_t
+        {
+            Unused,
+            ReadInFlight,
+            PendingDecompression,
+            Decompressing
+        };
+
+        //! Progress of a compressed read that's being processed.
+        struct ActiveRead
+        {
+            //! The compressed read request from the previous entry.
+            AZ::IO::FileRequest* m_request{ nullptr };
+            //! Wait request that prevents the compressed read from completing in between blocks.
+            AZ::IO::FileRequest* m_holdRequest{ nullptr };
+            size_t m_nextBlock{ 0 };
+            size_t m_endBlock{ 0 };
+            AZ::u32 m_numBlocksInFlight{ 0 };
+            bool m_failed{ false };
+        };
+
+        struct BlockSlot
+        {
+            AZStd::chrono::steady_clock::time_point m_queueStartTime;
+            AZStd::chrono::steady_clock::time_point m_jobStartTime;
+            ActiveRead* m_activeRead{ nullptr };
+            //! The read request while reading and the wait request while decompressing.
+            AZ::IO::FileRequest* m_request{ nullptr };
+            Buffer m_compressedData{ nullptr };
+            size_t m_bufferSize{ 0 };
+            size_t m_blockIndex{ 0 };
+            AZ::u32 m_alignmentOffset{ 0 };
+            BlockStatus m_status{ BlockStatus::Unused };
+            bool m_isPartial{ false };
+        };
+
+        bool IsIdle() const;
+
+        bool ActivateRead(AZ::IO::FileRequest* request);
+        ActiveRead* FindReadWithUnreadBlocks();
+        void StartBlockRead(ActiveRead& activeRead, AZ::u32 slotIndex);
+        void FinishBlockRead(AZ::IO::FileRequest* readRequest, AZ::u32 slotIndex);
+        bool StartDecompressions();
+        void FinishDecompression(AZ::IO::FileRequest* waitRequest, AZ::u32 slotIndex);
+        void ReleaseSlot(BlockSlot& slot);
+        void TryCompleteRead(ActiveRead& activeRead);
+
+        static void DecompressBlock(AZ::IO::StreamerContext* context, BlockSlot& slot);
+        static size_t GetCompressedBlockSize(const AZ::IO::Requests::CompressedReadData& data, size_t blockIndex);
+
+        void EstimateCompressedReadRequest(AZ::IO::FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+            AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
+
+        void Report(const AZ::IO::Requests::ReportData& data) const;
+
+        AZStd::deque<AZ::IO::FileRequest*> m_pendingReads;
+        AZStd::list<ActiveRead> m_activeReads;
+
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_decompressionDurationMicroSec;
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_bytesDecompressed;
+
+        AZStd::unique_ptr<BlockSlot[]> m_slots;
+        //! Declared after the slots so the workers are stopped before the slots they reference are released.
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+
+        size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+        AZ::u64 m_compressedBytesSkipped{ 0 }; //!< Compressed bytes that didn't need to be read because they were outside the requested range.
+        AZ::u32 m_maxNumBlocks{ 8 };
+        AZ::u32 m_numBlocksInFlight{ 0 };
+        AZ::u32 m_numPendingDecompression{ 0 };
+        AZ::u32 m_numRunningTasks{ 0 };
+        AZ::u32 m_alignment{ 0 };
+    };
+} // namespace Compression
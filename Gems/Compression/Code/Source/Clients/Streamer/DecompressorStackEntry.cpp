@@ -7,6 +7,7 @@
  */
 
 #include "DecompressorStackEntry.h"
+#include "BlockDecompressorStackEntry.h"
 
 #include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
@@ -30,7 +31,16 @@ namespace Compression
         auto stackEntry = AZStd::make_shared<DecompressorRegistrarEntry>(
             m_maxNumReads, m_maxNumTasks, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
         stackEntry->SetNext(AZStd::move(parent));
-        return stackEntry;
+        if (m_maxNumBlocks == 0)
+        {
+            return stackEntry;
+        }
+
+        // The block decompressor is placed in front of the registrar so it receives the compressed reads for block compressed
+        // files before the registrar does, while all other compressed reads continue on to the registrar.
+        auto blockEntry = AZStd::make_shared<BlockDecompressorEntry>(m_maxNumBlocks, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+        blockEntry->SetNext(AZStd::move(stackEntry));
+        return blockEntry;
     }
 
     void DecompressorRegistrarConfig::Reflect(AZ::ReflectContext* context)
@@ -41,6 +51,7 @@ namespace Compression
             serializeContext->Class<DecompressorRegistrarConfig, IStreamerStackConfig>()
                 ->Field("MaxNumReads", &DecompressorRegistrarConfig::m_maxNumReads)
                 ->Field("MaxNumTasks", &DecompressorRegistrarConfig::m_maxNumTasks)
+                ->Field("MaxNumBlocks", &DecompressorRegistrarConfig::m_maxNumBlocks)
                 ;
         }
     }
@@ -753,7 +764,7 @@ namespace Compression
             "DecompressorRegistrarEntry is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
             request->m_readSize, compressionInfo.m_uncompressedSize);
 
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+        bool success = AZ::IO::CompressionUtils::Decompress(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
             compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
 
@@ -773,7 +784,7 @@ namespace Compression
         AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
         auto decompressionBuffer = AZStd::make_unique<AZStd::byte[]>(compressionInfo.m_uncompressedSize);
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+        bool success = AZ::IO::CompressionUtils::Decompress(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
             compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
 
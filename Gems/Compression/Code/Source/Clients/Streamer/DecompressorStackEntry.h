@@ -54,6 +54,11 @@ namespace Compression
         AZ::u32 m_maxNumReads{ 2 };
         //! Maximum number of decompression tasks that can run simultaneously.
         AZ::u32 m_maxNumTasks{ 2 };
+        //! Maximum number of blocks of block compressed files that are read or decompressed simultaneously.
+        //! If 0, block compressed files are read and decompressed as a whole by the DecompressorRegistrarEntry.
+        //! The block entry is opt-in scaffolding: none of the archive providers fill in the block tables of CompressionInfo yet,
+        //! so this defaults to 0 and setting "MaxNumBlocks" in the streamer profile only has an effect once a provider does.
+        AZ::u32 m_maxNumBlocks{ 0 };
     };
 
     //! Decompression Entry in the streamer stack that is used to look up registered compression interfaces
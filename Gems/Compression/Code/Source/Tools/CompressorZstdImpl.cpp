@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressorZstdImpl.h"
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <Compression/CompressionZstdAPI.h>
+
+#include <zstd.h>
+#include <zdict.h>
+
+namespace CompressionZstd
+{
+    namespace Internal
+    {
+        struct CCtxDeleter
+        {
+            void operator()(ZSTD_CCtx* compressionContext) const
+            {
+                ZSTD_freeCCtx(compressionContext);
+            }
+        };
+
+        //! Compression contexts hold roughly a megabyte of state for the default levels,
+        //! so one is kept per thread and reused for every block compressed on that thread
+        ZSTD_CCtx* GetThreadCompressionContext()
+        {
+            thread_local AZStd::unique_ptr<ZSTD_CCtx, CCtxDeleter> compressionContext{ ZSTD_createCCtx() };
+            return compressionContext.get();
+        }
+    }
+
+    void CompressorZstd::CDictDeleter::operator()(ZSTD_CDict_s* compressionDictionary) const
+    {
+        ZSTD_freeCDict(compressionDictionary);
+    }
+
+    // Definitions for Zstd Compressor
+    CompressorZstd::CompressorZstd() = default;
+    CompressorZstd::~CompressorZstd() = default;
+
+    Compression::CompressionAlgorithmId CompressorZstd::GetCompressionAlgorithmId() const
+    {
+        return GetZstdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view CompressorZstd::GetCompressionAlgorithmName() const
+    {
+        return GetZstdCompressionAlgorithmName();
+    }
+
+    [[nodiscard]] size_t CompressorZstd::CompressBound(size_t uncompressedBufferSize) const
+    {
+        return ZSTD_compressBound(uncompressedBufferSize);
+    }
+
+    const ZSTD_CDict_s* CompressorZstd::AcquireCompressionDictionary(
+        AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const
+    {
+        const unsigned dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+        if (dictionaryId == NoDictionaryId)
+        {
+            // Raw content dictionaries do not have an id, so they can't be cached
+            return nullptr;
+        }
+
+        AZStd::scoped_lock lock(m_compressionDictionaryMutex);
+        auto [dictionaryIter, inserted] = m_compressionDictionaries.try_emplace(
+            AZStd::pair<AZ::u32, int>{ dictionaryId, compressionLevel });
+        if (inserted)
+        {
+            dictionaryIter->second.reset(ZSTD_createCDict(dictionary.data(), dictionary.size(), compressionLevel));
+        }
+
+        return dictionaryIter->second.get();
+    }
+
+    Compression::CompressionResultData CompressorZstd::CompressBlock(
+        AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+        const Compression::CompressionOptions& compressionOptions) const
+    {
+        Compression::CompressionResultData resultData;
+
+        int compressionLevel = ZSTD_CLEVEL_DEFAULT;
+        AZStd::span<const AZStd::byte> dictionary;
+        if (auto zstdOptions = azrtti_cast<const ZstdCompressionOptions*>(&compressionOptions);
+            zstdOptions != nullptr)
+        {
+            compressionLevel = AZStd::clamp(zstdOptions->m_compressionLevel, ZSTD_minCLevel(), ZSTD_maxCLevel());
+            dictionary = zstdOptions->m_dictionary;
+        }
+
+        ZSTD_CCtx* compressionContext = Internal::GetThreadCompressionContext();
+        if (compressionContext == nullptr)
+        {
+            resultData.m_compressionOutcome.m_resultString = "Unable to create a Zstd compression context";
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        size_t compressedSize;
+        if (dictionary.empty())
+        {
+            compressedSize = ZSTD_compressCCtx(compressionContext,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                compressionLevel);
+        }
+        else if (const ZSTD_CDict* compressionDictionary = AcquireCompressionDictionary(dictionary, compressionLevel);
+            compressionDictionary != nullptr)
+        {
+            compressedSize = ZSTD_compress_usingCDict(compressionContext,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                compressionDictionary);
+        }
+        else
+        {
+            compressedSize = ZSTD_compress_usingDict(compressionContext,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                dictionary.data(), dictionary.size(),
+                compressionLevel);
+        }
+
+        if (ZSTD_isError(compressedSize))
+        {
+            resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                "Zstd compression has failed with error \"%s\". The source buffer size is %zu and the output buffer"
+                " has capacity of %zu", ZSTD_getErrorName(compressedSize), uncompressedData.size(), compressionBuffer.size());
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the compressed data and
+        // the correct compressed size
+        resultData.m_compressedBuffer = compressionBuffer.subspan(0, compressedSize);
+        resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Complete;
+        return resultData;
+    }
+
+    TrainDictionaryOutcome CompressorZstd::TrainDictionary(
+        AZStd::span<const AZStd::span<const AZStd::byte>> samples, size_t maxDictionarySize)
+    {
+        // The Zstd trainer expects the samples to be stored contiguously
+        AZStd::vector<AZStd::byte> sampleBuffer;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const AZStd::span<const AZStd::byte>& sample : samples)
+        {
+            if (!sample.empty())
+            {
+                sampleBuffer.insert(sampleBuffer.end(), sample.begin(), sample.end());
+                sampleSizes.push_back(sample.size());
+            }
+        }
+
+        if (sampleSizes.empty())
+        {
+            return AZStd::unexpected(Compression::CompressionResultString(
+                "Unable to train a Zstd dictionary without sample data"));
+        }
+
+        AZStd::vector<AZStd::byte> dictionary;
+        dictionary.resize_no_construct(maxDictionarySize);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+            sampleBuffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            return AZStd::unexpected(Compression::CompressionResultString::format(
+                "Zstd dictionary training has failed with error \"%s\". %zu samples with a total size of %zu were provided",
+                ZDICT_getErrorName(dictionarySize), sampleSizes.size(), sampleBuffer.size()));
+        }
+
+        dictionary.resize_no_construct(dictionarySize);
+        return dictionary;
+    }
+} // namespace CompressionZstd
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/utility/expected.h>
+#include <AzCore/std/utils.h>
+#include <Compression/CompressionInterfaceAPI.h>
+
+struct ZSTD_CDict_s;
+
+namespace CompressionZstd
+{
+    using TrainDictionaryOutcome = AZStd::expected<AZStd::vector<AZStd::byte>, Compression::CompressionResultString>;
+
+    class CompressorZstd
+        : public Compression::ICompressionInterface
+    {
+    public:
+        CompressorZstd();
+        ~CompressorZstd();
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the Zstd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Compresses the uncompressed data into the compressed buffer
+        //! If ZstdCompressionOptions are supplied, the compression level and dictionary are read from it
+        //! @return a CompressionResultData instance to indicate if compression operation has succeeded
+        [[nodiscard]] Compression::CompressionResultData CompressBlock(
+            AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+            const Compression::CompressionOptions& compressionOptions = {}) const override;
+
+        [[nodiscard]] size_t CompressBound(size_t uncompressedBufferSize) const override;
+
+        //! Trains a Zstd dictionary from a set of samples.
+        //! Samples should be representative of the blocks the dictionary will be used with,
+        //! i.e. the content of assets of a single asset type, split at the archive block size.
+        //! Zstd recommends providing roughly 100 times more sample data than the dictionary capacity.
+        //! @param samples content to train the dictionary on
+        //! @param maxDictionarySize capacity of the dictionary in bytes. Zstd recommends around 100 KiB
+        //! @return the dictionary on success or an error message on failure
+        static TrainDictionaryOutcome TrainDictionary(
+            AZStd::span<const AZStd::span<const AZStd::byte>> samples, size_t maxDictionarySize);
+
+    private:
+        struct CDictDeleter
+        {
+            void operator()(ZSTD_CDict_s* compressionDictionary) const;
+        };
+        using CDictPtr = AZStd::unique_ptr<ZSTD_CDict_s, CDictDeleter>;
+
+        //! Returns the digested dictionary for the dictionary and compression level,
+        //! creating it on first use so that it is shared by every block compressed with the same dictionary
+        const ZSTD_CDict_s* AcquireCompressionDictionary(AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const;
+
+        //! Digested dictionaries keyed by the pair of dictionary id and compression level
+        mutable AZStd::unordered_map<AZStd::pair<AZ::u32, int>, CDictPtr> m_compressionDictionaries;
+        mutable AZStd::mutex m_compressionDictionaryMutex;
+    };
+} // namespace CompressionZstd
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+
+#include <Clients/Streamer/BlockDecompressorStackEntry.h>
+
+namespace CompressionTest
+{
+    //! Stream stack entry that serves reads from an archive in memory and immediately completes them.
+    class InMemoryArchiveEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        InMemoryArchiveEntry(const AZStd::vector<AZ::u8>& archive)
+            : AZ::IO::StreamStackEntry("In-memory archive")
+            , m_archive(archive)
+        {
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::ReadData>(&request->GetCommand()); data != nullptr)
+            {
+                m_readOffsets.push_back(data->m_offset);
+                if (data->m_offset + data->m_size <= m_archive.size())
+                {
+                    memcpy(data->m_output, m_archive.data() + data->m_offset, data->m_size);
+                    request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                }
+                else
+                {
+                    request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Failed);
+                }
+            }
+            else
+            {
+                m_numOtherRequests++;
+                request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            }
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        bool ExecuteRequests() override
+        {
+            return false;
+        }
+
+        const AZStd::vector<AZ::u8>& m_archive;
+        AZStd::vector<AZ::u64> m_readOffsets;
+        AZ::u32 m_numOtherRequests{ 0 };
+    };
+
+    class BlockDecompressorFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t BlockSize = 1024;
+        static constexpr size_t NumBlocks = 10;
+        static constexpr size_t UncompressedSize = NumBlocks * BlockSize - 300;
+        static constexpr size_t ArchiveOffset = 100;
+
+        void SetUp() override
+        {
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            m_archiveEntry = AZStd::make_shared<InMemoryArchiveEntry>(m_archive);
+            m_blockEntry = AZStd::make_shared<Compression::BlockDecompressorEntry>(4, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_blockEntry->SetNext(m_archiveEntry);
+            m_blockEntry->SetContext(*m_context);
+
+            m_uncompressed.resize(UncompressedSize);
+            for (size_t i = 0; i < UncompressedSize; ++i)
+            {
+                m_uncompressed[i] = aznumeric_cast<AZ::u8>((i * 7) % 251);
+            }
+
+            // "Compress" every block by storing its size followed by the scrambled bytes. Every block gets a different amount
+            // of padding so the compressed blocks have different sizes.
+            m_archive.resize(ArchiveOffset, 0);
+            AZStd::vector<AZ::u64> blockOffsets;
+            for (size_t block = 0; block < NumBlocks; ++block)
+            {
+                blockOffsets.push_back(m_archive.size() - ArchiveOffset);
+                AZ::u32 blockSize = aznumeric_cast<AZ::u32>(AZStd::min(BlockSize, UncompressedSize - block * BlockSize));
+                const AZ::u8* size = reinterpret_cast<const AZ::u8*>(&blockSize);
+                m_archive.insert(m_archive.end(), size, size + sizeof(blockSize));
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                    m_archive.push_back(m_uncompressed[block * BlockSize + i] ^ 0x5A);
+                }
+                m_archive.insert(m_archive.end(), block % 3, 0);
+            }
+            blockOffsets.push_back(m_archive.size() - ArchiveOffset);
+
+            m_info.m_archiveFilename = "Archive";
+            m_info.m_decompressor = [](const AZ::IO::CompressionInfo&, const void* compressed, size_t compressedSize,
+                void* uncompressed, size_t uncompressedBufferSize) -> bool
+            {
+                AZ::u32 blockSize = 0;
+                if (compressedSize < sizeof(blockSize))
+                {
+                    return false;
+                }
+                memcpy(&blockSize, compressed, sizeof(blockSize));
+                if (blockSize != uncompressedBufferSize || compressedSize < sizeof(blockSize) + blockSize)
+                {
+                    return false;
+                }
+                const AZ::u8* source = reinterpret_cast<const AZ::u8*>(compressed) + sizeof(blockSize);
+                AZ::u8* target = reinterpret_cast<AZ::u8*>(uncompressed);
+                for (size_t i = 0; i < blockSize; ++i)
+                {
+                    target[i] = source[i] ^ 0x5A;
+                }
+                return true;
+            };
+            m_info.m_offset = ArchiveOffset;
+            m_info.m_compressedSize = m_archive.size() - ArchiveOffset;
+            m_info.m_uncompressedSize = UncompressedSize;
+            m_info.m_blockSize = BlockSize;
+            m_info.m_blockOffsets = AZStd::make_shared<const AZStd::vector<AZ::u64>>(AZStd::move(blockOffsets));
+            m_info.m_isCompressed = true;
+        }
+
+        void TearDown() override
+        {
+            m_blockEntry.reset();
+            m_archiveEntry.reset();
+            m_context.reset();
+            m_info = {};
+            m_archive = {};
+            m_uncompressed = {};
+        }
+
+        AZ::IO::IStreamerTypes::RequestStatus ProcessRead(AZ::IO::CompressionInfo info, void* output, AZ::u64 offset, AZ::u64 size)
+        {
+            AZ::IO::IStreamerTypes::RequestStatus result = AZ::IO::IStreamerTypes::RequestStatus::Pending;
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(info), output, offset, size);
+            request->SetCompletionCallback([&result](const AZ::IO::FileRequest& request)
+                {
+                    // Capture result before internal request is recycled.
+                    result = request.GetStatus();
+                });
+            m_blockEntry->QueueRequest(request);
+
+            // Decompression runs on other threads, so keep processing until the request has been completed.
+            auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(10);
+            while (result == AZ::IO::IStreamerTypes::RequestStatus::Pending && AZStd::chrono::steady_clock::now() < timeout)
+            {
+                bool hasWork = false;
+                while (m_context->FinalizeCompletedRequests())
+                {
+                    hasWork = true;
+                }
+                hasWork = m_blockEntry->ExecuteRequests() || hasWork;
+                if (!hasWork)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+            return result;
+        }
+
+        AZStd::vector<AZ::u8> m_archive;
+        AZStd::vector<AZ::u8> m_uncompressed;
+        AZ::IO::CompressionInfo m_info;
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::shared_ptr<InMemoryArchiveEntry> m_archiveEntry;
+        AZStd::shared_ptr<Compression::BlockDecompressorEntry> m_blockEntry;
+    };
+
+    TEST_F(BlockDecompressorFixture, ReadFile_EntireFile_AllBlocksAreDecompressed)
+    {
+        AZStd::vector<AZ::u8> output(UncompressedSize);
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessRead(m_info, output.data(), 0, UncompressedSize));
+        EXPECT_EQ(m_uncompressed, output);
+        EXPECT_EQ(NumBlocks, m_archiveEntry->m_readOffsets.size());
+    }
+
+    TEST_F(BlockDecompressorFixture, ReadFile_PartialRange_OnlyOverlappingBlocksAreRead)
+    {
+        constexpr AZ::u64 offset = 3 * BlockSize + 100;
+        constexpr AZ::u64 size = 2 * BlockSize + 50;
+        AZStd::vector<AZ::u8> output(size);
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessRead(m_info, output.data(), offset, size));
+        EXPECT_TRUE(AZStd::equal(output.begin(), output.end(), m_uncompressed.begin() + offset));
+
+        AZStd::sort(m_archiveEntry->m_readOffsets.begin(), m_archiveEntry->m_readOffsets.end());
+        const AZStd::vector<AZ::u64>& blockOffsets = *m_info.m_blockOffsets;
+        AZStd::vector<AZ::u64> expectedOffsets{ ArchiveOffset + blockOffsets[3], ArchiveOffset + blockOffsets[4],
+            ArchiveOffset + blockOffsets[5] };
+        EXPECT_EQ(expectedOffsets, m_archiveEntry->m_readOffsets);
+    }
+
+    TEST_F(BlockDecompressorFixture, ReadFile_TailOfLastBlock_ReadsOnlyLastBlock)
+    {
+        constexpr AZ::u64 offset = UncompressedSize - 10;
+        AZStd::vector<AZ::u8> output(10);
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessRead(m_info, output.data(), offset, 10));
+        EXPECT_TRUE(AZStd::equal(output.begin(), output.end(), m_uncompressed.begin() + offset));
+        EXPECT_EQ(1, m_archiveEntry->m_readOffsets.size());
+    }
+
+    TEST_F(BlockDecompressorFixture, ReadFile_CorruptBlock_ReadFails)
+    {
+        // Corrupt the stored size of the third block.
+        m_archive[ArchiveOffset + (*m_info.m_blockOffsets)[2]] ^= 0xFF;
+
+        AZStd::vector<AZ::u8> output(UncompressedSize);
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, ProcessRead(m_info, output.data(), 0, UncompressedSize));
+    }
+
+    TEST_F(BlockDecompressorFixture, ReadFile_InvalidBlockTable_ReadFails)
+    {
+        m_info.m_blockOffsets = AZStd::make_shared<const AZStd::vector<AZ::u64>>(AZStd::vector<AZ::u64>{ 0, 10 });
+
+        AZStd::vector<AZ::u8> output(UncompressedSize);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, ProcessRead(m_info, output.data(), 0, UncompressedSize));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(m_archiveEntry->m_readOffsets.empty());
+    }
+
+    TEST_F(BlockDecompressorFixture, ReadFile_NotBlockCompressed_RequestIsPassedToNextEntry)
+    {
+        m_info.m_blockSize = 0;
+        m_info.m_blockOffsets.reset();
+
+        AZStd::vector<AZ::u8> output(UncompressedSize);
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessRead(m_info, output.data(), 0, UncompressedSize));
+        EXPECT_EQ(1, m_archiveEntry->m_numOtherRequests);
+        EXPECT_TRUE(m_archiveEntry->m_readOffsets.empty());
+    }
+
+    TEST_F(BlockDecompressorFixture, Decompress_BlockCompressedFile_DecompressesAllBlocks)
+    {
+        // Entries that don't stream blocks decompress block compressed files as a whole through CompressionUtils.
+        AZStd::vector<AZ::u8> output(UncompressedSize);
+        EXPECT_TRUE(AZ::IO::CompressionUtils::Decompress(m_info, m_archive.data() + ArchiveOffset, m_info.m_compressedSize,
+            output.data(), output.size()));
+        EXPECT_EQ(m_uncompressed, output);
+    }
+} // namespace CompressionTest
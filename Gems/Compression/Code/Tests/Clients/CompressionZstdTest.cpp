@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Compression/CompressionZstdAPI.h>
+#include <Clients/DecompressorZstdImpl.h>
+
+#include <zstd.h>
+
+namespace CompressionZstdTest
+{
+    class DecompressionZstdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        DecompressionZstdFixture() = default;
+
+        ~DecompressionZstdFixture() = default;
+
+    protected:
+        //! Compresses the text using the zstd library directly, as the compressor is only available in tools
+        static AZStd::vector<AZStd::byte> CompressText(AZStd::string_view text)
+        {
+            AZStd::vector<AZStd::byte> compressedData;
+            compressedData.resize_no_construct(ZSTD_compressBound(text.size()));
+            size_t compressedSize = ZSTD_compress(compressedData.data(), compressedData.size(), text.data(), text.size(),
+                ZSTD_CLEVEL_DEFAULT);
+            EXPECT_FALSE(ZSTD_isError(compressedSize));
+            compressedData.resize_no_construct(ZSTD_isError(compressedSize) ? 0 : compressedSize);
+            return compressedData;
+        }
+    };
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZstd::GetZstdCompressionAlgorithmId();
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        EXPECT_EQ(compressionAlgorithmId, decompressorZstd->GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        AZStd::vector<AZStd::byte> compressedData = CompressText(dataToCompress);
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(dataToCompress.size());
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+
+        EXPECT_EQ("Hello World", uncompressedString);
+    }
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        AZStd::vector<AZStd::byte> compressedData = CompressText(R"(Hello World)");
+
+        // The decompression output buffer has a size of zero, so decompression should fail
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        EXPECT_EQ(0, decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(nullptr, decompressionResultData.GetUncompressedByteData());
+    }
+
+    TEST_F(DecompressionZstdFixture, ZstdDictionaryRegistry_RegisterNonDictionaryContent_Fails)
+    {
+        CompressionZstd::DecompressorZstd decompressorZstd;
+        auto dictionaryRegistry = CompressionZstd::ZstdDictionaryRegistry::Get();
+        ASSERT_NE(nullptr, dictionaryRegistry);
+
+        constexpr AZStd::string_view notADictionary = R"(Hello World)";
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(CompressionZstd::NoDictionaryId, dictionaryRegistry->RegisterDictionary(
+            AZStd::span(reinterpret_cast<const AZStd::byte*>(notADictionary.data()), notADictionary.size())));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(dictionaryRegistry->UnregisterDictionary(CompressionZstd::NoDictionaryId));
+    }
+} // namespace CompressionZstdTest
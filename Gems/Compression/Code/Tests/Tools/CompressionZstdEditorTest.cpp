@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/string/string.h>
+
+#include <Compression/CompressionZstdAPI.h>
+#include <Clients/DecompressorLZ4Impl.h>
+#include <Clients/DecompressorZstdImpl.h>
+#include <Tools/CompressorLZ4Impl.h>
+#include <Tools/CompressorZstdImpl.h>
+
+namespace CompressionZstdTest
+{
+    //! Generates small json documents which share most of their structure,
+    //! which is representative of the product assets of a single asset type
+    static AZStd::vector<AZStd::string> GenerateSampleDocuments(size_t documentCount)
+    {
+        AZStd::vector<AZStd::string> documents;
+        documents.reserve(documentCount);
+        for (size_t index = 0; index < documentCount; ++index)
+        {
+            documents.push_back(AZStd::string::format(R"({
+    "Type": "JsonSerialization",
+    "Version": 1,
+    "ClassName": "MaterialSourceData",
+    "ClassData": {
+        "materialType": "@gemroot:Atom_Feature_Common@/Assets/Materials/Types/StandardPBR.materialtype",
+        "materialTypeVersion": %zu,
+        "propertyValues": {
+            "baseColor.color": [ %zu.0, %zu.5, 0.25 ],
+            "metallic.factor": 0.%zu,
+            "roughness.factor": 0.%zu,
+            "baseColor.textureMap": "Textures/sample_%zu_basecolor.png"
+        }
+    }
+})", index % 5, index % 3, index % 7, index % 10, (index * 7) % 10, index));
+        }
+        return documents;
+    }
+
+    static AZStd::span<const AZStd::byte> AsBytes(AZStd::string_view text)
+    {
+        return { reinterpret_cast<const AZStd::byte*>(text.data()), text.size() };
+    }
+
+    class CompressionZstdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        CompressionZstdFixture() = default;
+
+        ~CompressionZstdFixture() = default;
+
+    protected:
+        //! Compresses each document on its own and returns the total compressed size
+        static size_t CompressDocuments(const Compression::ICompressionInterface& compressor,
+            const AZStd::vector<AZStd::string>& documents, const Compression::CompressionOptions& compressionOptions)
+        {
+            size_t totalCompressedSize = 0;
+            AZStd::vector<AZStd::byte> compressionBuffer;
+            for (const AZStd::string& document : documents)
+            {
+                compressionBuffer.resize_no_construct(compressor.CompressBound(document.size()));
+                Compression::CompressionResultData compressionResultData = compressor.CompressBlock(
+                    compressionBuffer, AsBytes(document), compressionOptions);
+                EXPECT_TRUE(compressionResultData);
+                totalCompressedSize += compressionResultData.GetCompressedByteCount();
+            }
+            return totalCompressedSize;
+        }
+    };
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_RoundTrip_Succeeds)
+    {
+        auto compressorZstd = AZStd::make_unique<CompressionZstd::CompressorZstd>();
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        EXPECT_EQ(CompressionZstd::GetZstdCompressionAlgorithmId(), compressorZstd->GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(compressorZstd->CompressBound(dataToCompress.size()));
+
+        Compression::CompressionResultData compressionResultData = compressorZstd->CompressBlock(
+            compressionBuffer, AsBytes(dataToCompress));
+        ASSERT_TRUE(compressionResultData);
+        EXPECT_GT(compressionResultData.GetCompressedByteCount(), 0);
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(dataToCompress.size());
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressionResultData.m_compressedBuffer);
+        ASSERT_TRUE(decompressionResultData);
+
+        AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(dataToCompress, uncompressedString);
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto compressorZstd = AZStd::make_unique<CompressionZstd::CompressorZstd>();
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+
+        // The compression output buffer has a size of zero, so compression should fail
+        AZStd::vector<AZStd::byte> compressionBuffer;
+
+        Compression::CompressionResultData compressionResultData = compressorZstd->CompressBlock(
+            compressionBuffer, AsBytes(dataToCompress));
+
+        EXPECT_FALSE(static_cast<bool>(compressionResultData));
+        EXPECT_FALSE(compressionResultData.m_compressionOutcome.m_resultString.empty());
+        EXPECT_EQ(0, compressionResultData.GetCompressedByteCount());
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_WithTrainedDictionary_CompressesSmallBlocksBetterThanLZ4)
+    {
+        AZStd::vector<AZStd::string> documents = GenerateSampleDocuments(512);
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        for (const AZStd::string& document : documents)
+        {
+            samples.push_back(AsBytes(document));
+        }
+
+        constexpr size_t MaxDictionarySize = 8 * 1024;
+        CompressionZstd::TrainDictionaryOutcome trainOutcome = CompressionZstd::CompressorZstd::TrainDictionary(
+            samples, MaxDictionarySize);
+        ASSERT_TRUE(trainOutcome) << trainOutcome.error().c_str();
+        const AZStd::vector<AZStd::byte>& dictionary = trainOutcome.value();
+        EXPECT_LE(dictionary.size(), MaxDictionarySize);
+
+        CompressionZstd::CompressorZstd compressorZstd;
+        CompressionLZ4::CompressorLZ4 compressorLz4;
+
+        CompressionZstd::ZstdCompressionOptions dictionaryOptions;
+        dictionaryOptions.m_dictionary = dictionary;
+
+        const size_t uncompressedSize = AZStd::accumulate(documents.begin(), documents.end(), size_t{},
+            [](size_t total, const AZStd::string& document) { return total + document.size(); });
+        const size_t lz4Size = CompressDocuments(compressorLz4, documents, Compression::CompressionOptions{});
+        const size_t zstdSize = CompressDocuments(compressorZstd, documents, CompressionZstd::ZstdCompressionOptions{});
+        const size_t zstdDictionarySize = CompressDocuments(compressorZstd, documents, dictionaryOptions);
+
+        EXPECT_LT(lz4Size, uncompressedSize);
+        EXPECT_LT(zstdDictionarySize, zstdSize);
+        EXPECT_LT(zstdDictionarySize, lz4Size);
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdDecompressor_DictionaryBlocks_DecompressWithOptionsOrRegistry)
+    {
+        AZStd::vector<AZStd::string> documents = GenerateSampleDocuments(512);
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        for (const AZStd::string& document : documents)
+        {
+            samples.push_back(AsBytes(document));
+        }
+        CompressionZstd::TrainDictionaryOutcome trainOutcome = CompressionZstd::CompressorZstd::TrainDictionary(samples, 8 * 1024);
+        ASSERT_TRUE(trainOutcome);
+        const AZStd::vector<AZStd::byte>& dictionary = trainOutcome.value();
+
+        CompressionZstd::CompressorZstd compressorZstd;
+        CompressionZstd::ZstdCompressionOptions compressionOptions;
+        compressionOptions.m_dictionary = dictionary;
+
+        const AZStd::string& document = documents.front();
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(compressorZstd.CompressBound(document.size()));
+        Compression::CompressionResultData compressionResultData = compressorZstd.CompressBlock(
+            compressionBuffer, AsBytes(document), compressionOptions);
+        ASSERT_TRUE(compressionResultData);
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(document.size());
+
+        {
+            // Without the dictionary the block can't be decompressed
+            CompressionZstd::DecompressorZstd decompressorZstd;
+            Compression::DecompressionResultData decompressionResultData = decompressorZstd.DecompressBlock(
+                decompressionBuffer, compressionResultData.m_compressedBuffer);
+            EXPECT_FALSE(decompressionResultData);
+        }
+
+        {
+            CompressionZstd::DecompressorZstd decompressorZstd;
+            const AZStd::span<const AZStd::byte> optionDictionaries[] = { dictionary };
+            CompressionZstd::ZstdDecompressionOptions decompressionOptions;
+            decompressionOptions.m_dictionaries = optionDictionaries;
+            Compression::DecompressionResultData decompressionResultData = decompressorZstd.DecompressBlock(
+                decompressionBuffer, compressionResultData.m_compressedBuffer, decompressionOptions);
+            ASSERT_TRUE(decompressionResultData);
+            EXPECT_EQ(document.size(), decompressionResultData.GetUncompressedByteCount());
+            EXPECT_EQ(0, memcmp(document.data(), decompressionResultData.GetUncompressedByteData(), document.size()));
+        }
+
+        {
+            CompressionZstd::DecompressorZstd decompressorZstd;
+            auto dictionaryRegistry = CompressionZstd::ZstdDictionaryRegistry::Get();
+            ASSERT_EQ(&decompressorZstd, dictionaryRegistry);
+            const CompressionZstd::ZstdDictionaryId dictionaryId = dictionaryRegistry->RegisterDictionary(dictionary);
+            EXPECT_NE(CompressionZstd::NoDictionaryId, dictionaryId);
+            EXPECT_TRUE(dictionaryRegistry->IsDictionaryRegistered(dictionaryId));
+
+            Compression::DecompressionResultData decompressionResultData = decompressorZstd.DecompressBlock(
+                decompressionBuffer, compressionResultData.m_compressedBuffer);
+            ASSERT_TRUE(decompressionResultData);
+            EXPECT_EQ(0, memcmp(document.data(), decompressionResultData.GetUncompressedByteData(), document.size()));
+
+            EXPECT_TRUE(dictionaryRegistry->UnregisterDictionary(dictionaryId));
+            EXPECT_FALSE(dictionaryRegistry->IsDictionaryRegistered(dictionaryId));
+        }
+        EXPECT_EQ(nullptr, CompressionZstd::ZstdDictionaryRegistry::Get());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Compares the decompression throughput of LZ4 and Zstd with a dictionary for small asset sized blocks
+    class CompressionZstdBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    protected:
+        void SetUp(const ::benchmark::State&) override
+        {
+            m_documents = GenerateSampleDocuments(512);
+            AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+            for (const AZStd::string& document : m_documents)
+            {
+                samples.push_back(AsBytes(document));
+            }
+            m_dictionary = CompressionZstd::CompressorZstd::TrainDictionary(samples, 8 * 1024).value_or(AZStd::vector<AZStd::byte>{});
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            m_documents = {};
+            m_dictionary = {};
+            m_compressedBlocks = {};
+        }
+
+        void CompressDocuments(const Compression::ICompressionInterface& compressor, const Compression::CompressionOptions& options)
+        {
+            for (const AZStd::string& document : m_documents)
+            {
+                AZStd::vector<AZStd::byte> compressionBuffer;
+                compressionBuffer.resize_no_construct(compressor.CompressBound(document.size()));
+                Compression::CompressionResultData compressionResultData = compressor.CompressBlock(
+                    compressionBuffer, AsBytes(document), options);
+                compressionBuffer.resize_no_construct(compressionResultData.GetCompressedByteCount());
+                m_compressedBlocks.push_back(AZStd::move(compressionBuffer));
+            }
+        }
+
+        void RunDecompressionBenchmark(::benchmark::State& state, const Compression::IDecompressionInterface& decompressor,
+            const Compression::DecompressionOptions& options)
+        {
+            size_t uncompressedSize = 0;
+            size_t compressedSize = 0;
+            AZStd::vector<AZStd::byte> decompressionBuffer;
+            decompressionBuffer.resize_no_construct(4096);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const AZStd::vector<AZStd::byte>& compressedBlock : m_compressedBlocks)
+                {
+                    Compression::DecompressionResultData decompressionResultData = decompressor.DecompressBlock(
+                        decompressionBuffer, compressedBlock, options);
+                    uncompressedSize += decompressionResultData.GetUncompressedByteCount();
+                    compressedSize += compressedBlock.size();
+                }
+            }
+            state.SetBytesProcessed(uncompressedSize);
+            state.counters["Ratio"] = compressedSize > 0 ? double(uncompressedSize) / double(compressedSize) : 0.0;
+        }
+
+        AZStd::vector<AZStd::string> m_documents;
+        AZStd::vector<AZStd::byte> m_dictionary;
+        AZStd::vector<AZStd::vector<AZStd::byte>> m_compressedBlocks;
+    };
+
+    BENCHMARK_F(CompressionZstdBenchmarkFixture, BM_LZ4_DecompressSmallBlocks)(benchmark::State& state)
+    {
+        CompressDocuments(CompressionLZ4::CompressorLZ4{}, Compression::CompressionOptions{});
+        RunDecompressionBenchmark(state, CompressionLZ4::DecompressorLZ4{}, Compression::DecompressionOptions{});
+    }
+
+    BENCHMARK_F(CompressionZstdBenchmarkFixture, BM_Zstd_DecompressSmallBlocks)(benchmark::State& state)
+    {
+        CompressDocuments(CompressionZstd::CompressorZstd{}, CompressionZstd::ZstdCompressionOptions{});
+        RunDecompressionBenchmark(state, CompressionZstd::DecompressorZstd{}, Compression::DecompressionOptions{});
+    }
+
+    BENCHMARK_F(CompressionZstdBenchmarkFixture, BM_ZstdDictionary_DecompressSmallBlocks)(benchmark::State& state)
+    {
+        CompressionZstd::ZstdCompressionOptions compressionOptions;
+        compressionOptions.m_dictionary = m_dictionary;
+        CompressDocuments(CompressionZstd::CompressorZstd{}, compressionOptions);
+
+        const AZStd::span<const AZStd::byte> optionDictionaries[] = { m_dictionary };
+        CompressionZstd::ZstdDecompressionOptions decompressionOptions;
+        decompressionOptions.m_dictionaries = optionDictionaries;
+        RunDecompressionBenchmark(state, CompressionZstd::DecompressorZstd{}, decompressionOptions);
+    }
+#endif
+} // namespace CompressionZstdTest
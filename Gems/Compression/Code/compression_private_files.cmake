@@ -13,6 +13,10 @@ set(FILES
     Source/Clients/DecompressionRegistrarImpl.h
     Source/Clients/DecompressorLZ4Impl.cpp
     Source/Clients/DecompressorLZ4Impl.h
+    Source/Clients/DecompressorZstdImpl.cpp
+    Source/Clients/DecompressorZstdImpl.h
+    Source/Clients/Streamer/BlockDecompressorStackEntry.cpp
+    Source/Clients/Streamer/BlockDecompressorStackEntry.h
     Source/Clients/Streamer/DecompressorStackEntry.cpp
     Source/Clients/Streamer/DecompressorStackEntry.h
 )
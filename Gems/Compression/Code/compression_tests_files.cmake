@@ -5,6 +5,8 @@
 #
 
 set(FILES
+    Tests/Clients/BlockDecompressorStackEntryTest.cpp
     Tests/Clients/CompressionTest.cpp
     Tests/Clients/CompressionLZ4Test.cpp
+    Tests/Clients/CompressionZstdTest.cpp
 )
@@ -36,6 +36,8 @@
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/FileIOAsync.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/time.h>
 #include <AzCore/std/string/conversions.h>
@@ -200,41 +202,25 @@ namespace
     LyShine::CanvasId s_lastCanvasId = 0;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // test if the given text file starts with the given text string
-    bool TestFileStartString(const AZStd::string& pathname, const char* expectedStart)
+    // test if the given file contents start with the given text string
+    bool TestFileStartString(const AZStd::vector<AZ::u8>& fileContents, const char* expectedStart)
     {
-        // Open the file using CCryFile, this supports it being in the pak file or a standalone file
-        CCryFile file;
-        if (!file.Open(pathname.c_str(), "r"))
-        {
-            return false;
-        }
-
-        // get the size of the file and the length of the expected start string
-        size_t fileSize = file.GetLength();
-        size_t expectedStartLen = strlen(expectedStart);
-
         // if the file is smaller than the expected start string then it is not a valid file
-        if (fileSize < expectedStartLen)
+        size_t expectedStartLen = strlen(expectedStart);
+        if (fileContents.size() < expectedStartLen)
         {
             return false;
         }
 
-        // read in the length of the expected start string
-        char* buffer = new char[expectedStartLen];
-        file.ReadRaw(buffer, expectedStartLen);
-
-        // match is true if the string read from the file matches the expected start string
-        bool match = strncmp(expectedStart, buffer, expectedStartLen) == 0;
-        delete [] buffer;
-        return match;
+        // match is true if the start of the file matches the expected start string
+        return strncmp(expectedStart, reinterpret_cast<const char*>(fileContents.data()), expectedStartLen) == 0;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Check if the given file was saved using AZ serialization
-    bool IsValidAzSerializedFile(const AZStd::string& pathname)
+    // Check if the given file contents were saved using AZ serialization
+    bool IsValidAzSerializedFile(const AZStd::vector<AZ::u8>& fileContents)
     {
-        return TestFileStartString(pathname, "<ObjectStream");
+        return TestFileStartString(fileContents, "<ObjectStream");
     }
 
     template<class T, class MapType>
@@ -4086,65 +4072,79 @@ UiCanvasComponent* UiCanvasComponent::CreateCanvasInternal(UiEntityContext* enti
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-UiCanvasComponent*  UiCanvasComponent::LoadCanvasInternal(const AZStd::string& pathnameToOpen, bool forEditor, const AZStd::string& assetIdPathname, UiEntityContext* entityContext,
+AZ::IO::FileReadFuture UiCanvasComponent::ReadCanvasFileAsync(const AZStd::string& pathToOpen)
+{
+    // Read the whole file with a single request through the streamer instead of the many small reads
+    // the object stream would do on a file stream.
+    AZ::IO::FileReadRequest readRequest;
+    readRequest.m_path = pathToOpen;
+    readRequest.m_deadline = AZ::IO::IStreamerTypes::s_deadlineNow;
+    readRequest.m_priority = AZ::IO::IStreamerTypes::s_priorityHigh;
+    readRequest.m_callSite = "LyShine.LoadCanvas";
+    return AZ::IO::FileIOBase::GetInstance()->ReadAsync(readRequest);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiCanvasComponent*  UiCanvasComponent::LoadCanvasInternal(const AZStd::string& pathnameToOpen, const AZ::IO::FileReadFuture& canvasRead,
+    bool forEditor, const AZStd::string& assetIdPathname, UiEntityContext* entityContext,
     const AZ::SliceComponent::EntityIdToEntityIdMap* previousRemapTable, AZ::EntityId previousCanvasId)
 {
     UiCanvasComponent* canvasComponent = nullptr;
 
+    // The read is shared when the same canvas is loaded more than once, so the contents are only borrowed
+    const AZStd::vector<AZ::u8>& fileContents = canvasRead.GetData();
+
     // Currently LoadObjectFromFile will hang if the file cannot be parsed
     // (LMBR-10078). So first check that it is in the right format
-    if (IsValidAzSerializedFile(pathnameToOpen))
+    if (canvasRead.GetResult() != AZ::IO::ResultCode::Success)
     {
-        // Open a stream on the input path
-        AZ::IO::FileIOStream stream(pathnameToOpen.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
-        if (!stream.IsOpen())
-        {
-            AZ_Warning("UI", false, "Cannot open UI canvas file \"%s\".", pathnameToOpen.c_str());
-        }
-        else
+        AZ_Warning("UI", false, "Cannot open UI canvas file \"%s\".", pathnameToOpen.c_str());
+    }
+    else if (IsValidAzSerializedFile(fileContents))
+    {
+        AZ::IO::ByteContainerStream<const AZStd::vector<AZ::u8>> stream(&fileContents);
+
+        // Read in the canvas from the stream
+        UiCanvasFileObject* canvasFileObject = UiCanvasFileObject::LoadCanvasFromStream(stream);
+        AZ_Assert(canvasFileObject, "Failed to load canvas");
+
+        if (canvasFileObject)
         {
-            // Read in the canvas from the stream
-            UiCanvasFileObject* canvasFileObject = UiCanvasFileObject::LoadCanvasFromStream(stream);
-            AZ_Assert(canvasFileObject, "Failed to load canvas");
+            AZ::Entity* canvasEntity = canvasFileObject->m_canvasEntity;
+            AZ::Entity* rootSliceEntity = canvasFileObject->m_rootSliceEntity;
+            AZ_Assert(canvasEntity && rootSliceEntity, "Failed to load canvas");
 
-            if (canvasFileObject)
+            if (canvasEntity && rootSliceEntity)
             {
-                AZ::Entity* canvasEntity = canvasFileObject->m_canvasEntity;
-                AZ::Entity* rootSliceEntity = canvasFileObject->m_rootSliceEntity;
-                AZ_Assert(canvasEntity && rootSliceEntity, "Failed to load canvas");
-
-                if (canvasEntity && rootSliceEntity)
-                {
-                    // file loaded OK
+                // file loaded OK
 
-                    // no need to check if a canvas with this EntityId is already loaded since we are going
-                    // to generate new entity IDs for all entities loaded from the file.
+                // no need to check if a canvas with this EntityId is already loaded since we are going
+                // to generate new entity IDs for all entities loaded from the file.
 
-                    // complete initialization of loaded entities
-                    canvasComponent = FixupPostLoad(canvasEntity, rootSliceEntity, forEditor, entityContext, nullptr, previousRemapTable, previousCanvasId);
-                    if (canvasComponent)
-                    {
-                        // The canvas size may get reset on the first call to RenderCanvas to set the size to
-                        // viewport size. So we'll recompute again on first render.
-                        UiTransformBus::Event(
-                            canvasComponent->GetRootElement()->GetId(),
-                            &UiTransformBus::Events::SetRecomputeFlags,
-                            UiTransformInterface::Recompute::RectAndTransform);
-
-                        canvasComponent->m_pathname = assetIdPathname;
-                        canvasComponent->m_isLoadedInGame = !forEditor;
-                    }
-                    else
-                    {
-                        // cleanup, don't delete rootSliceEntity, deleting the canvasEntity cleans up the EntityContext and root slice
-                        delete canvasEntity;
-                    }
+                // complete initialization of loaded entities
+                canvasComponent = FixupPostLoad(canvasEntity, rootSliceEntity, forEditor, entityContext, nullptr, previousRemapTable, previousCanvasId);
+                if (canvasComponent)
+                {
+                    // The canvas size may get reset on the first call to RenderCanvas to set the size to
+                    // viewport size. So we'll recompute again on first render.
+                    UiTransformBus::Event(
+                        canvasComponent->GetRootElement()->GetId(),
+                        &UiTransformBus::Events::SetRecomputeFlags,
+                        UiTransformInterface::Recompute::RectAndTransform);
+
+                    canvasComponent->m_pathname = assetIdPathname;
+                    canvasComponent->m_isLoadedInGame = !forEditor;
+                }
+                else
+                {
+                    // cleanup, don't delete rootSliceEntity, deleting the canvasEntity cleans up the EntityContext and root slice
+                    delete canvasEntity;
                 }
-
-                // UiCanvasFileObject is a simple container for the canvas pointers, its destructor
-                // doesn't destroy the canvas, but we need to delete it nonetheless to avoid leaking.
-                delete canvasFileObject;
             }
+
+            // UiCanvasFileObject is a simple container for the canvas pointers, its destructor
+            // doesn't destroy the canvas, but we need to delete it nonetheless to avoid leaking.
+            delete canvasFileObject;
         }
     }
     else
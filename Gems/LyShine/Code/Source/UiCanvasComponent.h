@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
+#include <AzCore/IO/FileIOAsync.h>
 #include <AzCore/RTTI/TypeInfo.h>
 
 #include <LyShine/Bus/UiCanvasBus.h>
@@ -316,7 +317,10 @@ public: // static member functions
     static void Shutdown();
 
     static UiCanvasComponent* CreateCanvasInternal(UiEntityContext* entityContext, bool forEditor);
-    static UiCanvasComponent* LoadCanvasInternal(const AZStd::string& pathToOpen, bool forEditor, const AZStd::string& assetIdPathname, UiEntityContext* entityContext,
+    // Starts reading a canvas file, the returned read is passed to LoadCanvasInternal once the canvas is needed
+    static AZ::IO::FileReadFuture ReadCanvasFileAsync(const AZStd::string& pathToOpen);
+    static UiCanvasComponent* LoadCanvasInternal(const AZStd::string& pathToOpen, const AZ::IO::FileReadFuture& canvasRead, bool forEditor,
+        const AZStd::string& assetIdPathname, UiEntityContext* entityContext,
         const AZ::SliceComponent::EntityIdToEntityIdMap* previousRemapTable = nullptr, AZ::EntityId previousCanvasId = AZ::EntityId());
     static UiCanvasComponent* FixupReloadedCanvasForEditorInternal(AZ::Entity* newCanvasEntity,
         AZ::Entity* rootSliceEntity, UiEntityContext* entityContext,
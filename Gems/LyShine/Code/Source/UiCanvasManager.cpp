@@ -333,6 +333,11 @@ void UiCanvasManager::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
     CanvasList reloadedCanvases;  // keep track of the reloaded canvases and add them to m_loadedCanvases after the loop
     AZStd::vector<AZ::EntityId> unloadedCanvases;  // also keep track of any canvases that fail to reload and are unloaded
 
+    // the canvas file is read once for all canvases loaded from it, and the read is in flight while the existing canvases
+    // are unloaded
+    AZStd::string pathname(assetPath.c_str());
+    AZ::IO::FileReadFuture canvasRead;
+
     // loop over all canvases loaded in game and reload any canvases loaded from this canvas asset
     // NOTE: this could be improved by using AssetId for the comparison rather than pathnames
     auto iter = m_loadedCanvases.begin();
@@ -341,6 +346,11 @@ void UiCanvasManager::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
         UiCanvasComponent* canvasComponent = *iter;
         if (assetPath == canvasComponent->GetPathname())
         {
+            if (!canvasRead.IsValid())
+            {
+                canvasRead = UiCanvasComponent::ReadCanvasFileAsync(pathname);
+            }
+
             AZ::EntityId existingCanvasEntityId = canvasComponent->GetEntityId();
 
             //Before unloading the existing canvas, make a copy of its mapping table
@@ -355,8 +365,7 @@ void UiCanvasManager::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
 
             // reload canvas with the same entity IDs (except for new entities, deleted entities etc)
             UiGameEntityContext* entityContext = new UiGameEntityContext();
-            AZStd::string pathname(assetPath.c_str());
-            UiCanvasComponent* newCanvasComponent = UiCanvasComponent::LoadCanvasInternal(pathname, false, "", entityContext, &existingRemapTable, existingCanvasEntityId);
+            UiCanvasComponent* newCanvasComponent = UiCanvasComponent::LoadCanvasInternal(pathname, canvasRead, false, "", entityContext, &existingRemapTable, existingCanvasEntityId);
 
             if (!newCanvasComponent)
             {
@@ -946,7 +955,9 @@ AZ::EntityId UiCanvasManager::LoadCanvasInternal(const AZStd::string& assetIdPat
     else
     {
         // not already loaded in editor, attempt to load...
-        canvasComponent = UiCanvasComponent::LoadCanvasInternal(pathToOpen.c_str(), forEditor, assetIdPath.c_str(), entityContext, previousRemapTable, previousCanvasId);
+        // the loaded canvas is returned to the caller, so there is nothing to do while the file is read
+        AZ::IO::FileReadFuture canvasRead = UiCanvasComponent::ReadCanvasFileAsync(pathToOpen);
+        canvasComponent = UiCanvasComponent::LoadCanvasInternal(pathToOpen.c_str(), canvasRead, forEditor, assetIdPath.c_str(), entityContext, previousRemapTable, previousCanvasId);
     }
 
     if (canvasComponent)
@@ -28,6 +28,8 @@ namespace Multiplayer
             PropertyNameLookupFunction m_componentPropertyNameLookupFunction;
             RpcNameLookupFunction m_componentRpcNameLookupFunction;
             AllocComponentInputFunction m_allocComponentInputFunction;
+            //! Scales how quickly entities with this component accumulate replication priority, see EntityReplicationScheduler.
+            float m_replicationPriority = 1.0f;
             bool m_includeInVersionCheck = true;
         };
 
@@ -81,6 +83,11 @@ namespace Multiplayer
         //! @return True if we found the multiplayer component and filled out the hash value; otherwise false.
         bool FindComponentVersionHashByName(const AZ::Name& multiplayerComponentName, AZ::HashValue64& hash) const;
 
+        //! Finds the NetComponentId of a multiplayer component by name.
+        //! @param  componentName the name of the multiplayer component to find
+        //! @return the NetComponentId of the component, or InvalidNetComponentId if no component with that name is registered
+        NetComponentId FindNetComponentId(const AZ::Name& componentName) const;
+
         //! This releases all owned memory, should only be called during multiplayer shutdown.
         void Reset();
 
@@ -87,6 +87,11 @@ namespace Multiplayer
         //! @return EntityMigration::Enabled if the entity is allowed to migrate, EntityMigration::Disabled otherwise
         EntityMigration GetAllowEntityMigration() const;
 
+        //! Retrieves how quickly this entity accumulates replication priority relative to other entities.
+        //! This is the product of the ReplicationPriority attributes of all multiplayer components on the entity.
+        //! @return the replication priority scale of the entity
+        float GetReplicationPriority() const;
+
         //! This is a helper that validates the owning entity is in the correct role to read from a network property that matches the relicateFrom and replicateTo parameters.
         //! @param propertyName  the name of the property, for logging and debugging purposes
         //! @param replicateFrom the network entity role that the property replicates from
@@ -262,6 +267,7 @@ namespace Multiplayer
         NetEntityRole         m_netEntityRole   = NetEntityRole::InvalidRole;
         NetEntityId           m_netEntityId     = InvalidNetEntityId;
         EntityMigration       m_netEntityMigration = EntityMigration::Enabled;
+        float                 m_replicationPriority = 1.0f;
 
         AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
 
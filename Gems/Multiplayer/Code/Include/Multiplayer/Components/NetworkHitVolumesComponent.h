@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -33,7 +34,6 @@ namespace Multiplayer
         {
             AnimatedHitVolume
             (
-                AzNetworking::ConnectionId connectionId,
                 Physics::CharacterRequests* character,
                 const char* hitVolumeName,
                 const Physics::ColliderConfiguration* colliderConfig,
@@ -44,9 +44,8 @@ namespace Multiplayer
             ~AnimatedHitVolume() = default;
 
             void UpdateTransform(const AZ::Transform& transform);
-            void SyncToCurrentTransform();
+            void SyncToTransform(const AZ::Transform& rewoundTransform);
 
-            Multiplayer::RewindableObject<AZ::Transform, Multiplayer::RewindHistorySize> m_transform;
             AZStd::shared_ptr<Physics::Shape> m_physicsShape;
 
             // Cached so we don't have to do subsequent lookups by name
@@ -94,6 +93,11 @@ namespace Multiplayer
 
         AZStd::vector<AnimatedHitVolume> m_animatedHitVolumes;
 
+        //! Transform history of m_animatedHitVolumes, in the same order, kept in the shared rewind history store
+        RewindVolumeRange m_rewindVolumes;
+        AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
+        AZStd::vector<AZ::Transform> m_rewoundTransforms;
+
         Multiplayer::EntitySyncRewindEvent::Handler m_syncRewindHandler;
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderHandler;
         AZ::TransformChangedEvent::Handler m_transformChangedHandler;
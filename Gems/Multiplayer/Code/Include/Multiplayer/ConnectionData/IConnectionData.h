@@ -39,7 +39,12 @@ namespace Multiplayer
         //! @return reference to the EntityReplicationManager for this connection data instance
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
+        //! Performs the part of the connection update that modifies entity state, such as activating newly replicated entities.
+        //! This is always called on the main thread, for every connection, before any connection is updated.
+        virtual void PreUpdate() = 0;
+
         //! Creates and manages sending updates to the remote endpoint.
+        //! Entity state is only read during this call, so different connections may be updated in parallel.
         virtual void Update() = 0;
 
         //! Returns whether update messages can be sent to the connection.
@@ -18,7 +18,10 @@
 #include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityDeltaCache.h>
+#include <Multiplayer/ReplicationWindows/EntityInterestGrid.h>
 #include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
 #include <Multiplayer/MultiplayerStats.h>
 
 namespace AzNetworking
@@ -237,8 +240,23 @@ namespace Multiplayer
         //! @return the stats object bound to this multiplayer instance
         MultiplayerStats& GetStats() { return m_stats; }
 
+        //! Retrieve the entity delta cache shared by all connections of this multiplayer instance.
+        //! @return the entity delta cache bound to this multiplayer instance
+        EntityDeltaCache& GetEntityDeltaCache() { return m_entityDeltaCache; }
+
+        //! Retrieve the entity interest grid shared by all replication windows of this multiplayer instance.
+        //! @return the entity interest grid bound to this multiplayer instance
+        EntityInterestGrid& GetEntityInterestGrid() { return m_entityInterestGrid; }
+
+        //! Retrieve the rewind history store shared by all rewindable volumes of this multiplayer instance.
+        //! @return the rewind history store bound to this multiplayer instance
+        RewindHistoryStore& GetRewindHistoryStore() { return m_rewindHistoryStore; }
+
     private:
         MultiplayerStats m_stats;
+        EntityDeltaCache m_entityDeltaCache;
+        EntityInterestGrid m_entityInterestGrid;
+        RewindHistoryStore m_rewindHistoryStore;
     };
 
     // Convenience helpers
@@ -37,6 +37,8 @@ namespace Multiplayer
         MultiplayerStat_TotalReceivedBytesAfterCompression,
         MultiplayerStat_TotalReceivedBytesBeforeCompression,
         MultiplayerStat_TotalPacketsDiscardedDueToLoad,
+        MultiplayerStat_EntityUpdatesSent,          // Entity update messages sent during the last tick
+        MultiplayerStat_EntityUpdateBytesPerEntity, // Average size of the entity update messages sent during the last tick
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
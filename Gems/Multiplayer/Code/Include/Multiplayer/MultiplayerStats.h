@@ -49,6 +49,14 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Entity update messages sent to all connections, including their headers
+        Metric m_entityUpdatesSent;
+
+        //! Most recent network frame times, used to report tick time percentiles while load testing
+        static const uint32_t FrameTimeSamples = 1024;
+        AZStd::array<AZ::TimeUs, FrameTimeSamples> m_frameTimeHistory{};
+        uint32_t m_frameTimeSampleCount = 0;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -57,6 +65,7 @@ namespace Multiplayer
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordEntityUpdateSent(uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
@@ -69,6 +78,11 @@ namespace Multiplayer
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
 
+        //! Returns the network frame time at the requested percentile of the recorded frame time history.
+        //! @param percentile the percentile to return, in the range [0, 1]
+        //! @return the frame time at the requested percentile, or zero if no frame times have been recorded
+        AZ::TimeUs CalculateFrameTimePercentile(float percentile) const;
+
         struct Events
         {
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*> m_entitySerializeStart;
@@ -94,5 +108,46 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! A Record call made while a ScopedDeferredRecords is active on the calling thread.
+        struct DeferredRecord
+        {
+            enum class Type : uint8_t
+            {
+                EntitySerializeStart,
+                ComponentSerializeEnd,
+                EntitySerializeStop,
+                PropertySent,
+                PropertyReceived,
+                RpcSent,
+                RpcReceived,
+                EntityUpdateSent
+            };
+
+            Type m_type = Type::EntityUpdateSent;
+            AzNetworking::SerializerMode m_mode = AzNetworking::SerializerMode::ReadFromObject;
+            AZ::EntityId m_entityId;
+            const char* m_entityName = nullptr;
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            uint16_t m_index = 0; //< Property or rpc index
+            uint32_t m_totalBytes = 0;
+        };
+        using DeferredRecords = AZStd::vector<DeferredRecord>;
+
+        //! Defers the Record calls made on the calling thread into a buffer while in scope.
+        //! Connections updated in parallel each record into their own buffer, and the buffers are replayed one after the other once
+        //! all updates have finished. This keeps the entity serialize start and stop events of each connection in sequence.
+        class ScopedDeferredRecords
+        {
+        public:
+            explicit ScopedDeferredRecords(DeferredRecords& records);
+            ~ScopedDeferredRecords();
+
+        private:
+            DeferredRecords* m_previousRecords = nullptr;
+        };
+
+        //! Applies deferred records in the order they were made and clears the buffer, must be called from the thread that owns the stats.
+        void ReplayDeferredRecords(DeferredRecords& records);
     };
 }
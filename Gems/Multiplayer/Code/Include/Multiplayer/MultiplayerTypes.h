@@ -24,6 +24,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
 #include <Multiplayer/MultiplayerConstants.h>
 
 namespace Multiplayer
@@ -43,6 +44,9 @@ namespace Multiplayer
     //! The maximum number of netEntityIds we can stuff into a single reset packet
     static constexpr uint32_t MaxAggregateEntityResets = 2048;
 
+    //! The maximum number of baseline acks we can stuff into a single ack packet
+    static constexpr uint32_t MaxAggregateBaselineAcks = 256;
+
     using HostId = AzNetworking::IpAddress;
     static const HostId InvalidHostId = HostId();
 
@@ -53,6 +57,8 @@ namespace Multiplayer
 
     using NetEntityIdsForReset = AZStd::fixed_vector<NetEntityId, MaxAggregateEntityResets>;
 
+    using BaselineAckPacketIds = AZStd::fixed_vector<AzNetworking::PacketId, MaxAggregateBaselineAcks>;
+
     using ComponentVersionMap = AZStd::unordered_map<AZ::Name, AZ::HashValue64>;
 
     AZ_TYPE_SAFE_INTEGRAL(NetComponentId, uint16_t);
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzNetworking/Serialization/BaselineDeltaSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! @class BaselineAckSet
+    //! @brief Packet ids of entity updates the remote endpoint confirmed it stored the baselines of.
+    //! The transport also acknowledges packets the receiver dropped as stale or couldn't decode, so baseline deltas are only ever
+    //! encoded against updates the receiver confirmed with an application level ack.
+    class BaselineAckSet
+    {
+    public:
+        //! The number of most recent acks that are remembered.
+        static constexpr uint32_t MaxTrackedAcks = 1024;
+
+        BaselineAckSet() = default;
+        ~BaselineAckSet() = default;
+
+        //! Records packet ids the remote endpoint confirmed.
+        //! @param packetIds the confirmed packet ids
+        void AddAcks(const BaselineAckPacketIds& packetIds);
+
+        //! Returns true if the remote endpoint confirmed it stored the baselines of the provided packet.
+        //! @param packetId the packet id to check
+        //! @return boolean true if the packet was confirmed
+        bool IsAcked(AzNetworking::PacketId packetId) const;
+
+        //! Forgets all acks.
+        void Clear();
+
+    private:
+        AZStd::unordered_set<AzNetworking::PacketId> m_ackedPacketIds;
+        AZStd::deque<AzNetworking::PacketId> m_ackOrder;
+    };
+
+    //! @class SentBaselineHistory
+    //! @brief Property values of the baseline deltas a publisher sent for a single entity, from the most to the least recent.
+    class SentBaselineHistory
+    {
+    public:
+        SentBaselineHistory() = default;
+        ~SentBaselineHistory() = default;
+
+        //! Returns the most recent baseline the remote endpoint confirmed, older baselines are discarded since they are never used again.
+        //! @param acks the baseline acks of the connection
+        //! @param outPacketId receives the packet id of the returned baseline, InvalidPacketId if nothing was confirmed yet
+        //! @return the confirmed baseline, or an empty baseline if nothing was confirmed yet
+        const AzNetworking::SerializerBaseline& FindNewestAcked(const BaselineAckSet& acks, AzNetworking::PacketId& outPacketId);
+
+        //! Records the values of a sent baseline delta.
+        //! @param packetId the packet id the delta was sent in
+        //! @param values   the property values the receiver reconstructs from the delta
+        //! @param maxCount the maximum number of baselines to keep
+        void AddSent(AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& values, uint32_t maxCount);
+
+        //! Discards all baselines.
+        void Clear();
+
+    private:
+        struct SentBaseline
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AzNetworking::SerializerBaseline m_values;
+            bool m_acked = false;
+        };
+
+        AZStd::deque<SentBaseline> m_sentBaselines;
+    };
+
+    //! @class ReceivedBaselineHistory
+    //! @brief Property values a subscriber reconstructed from received baseline deltas for a single entity, from the least to the most recent.
+    class ReceivedBaselineHistory
+    {
+    public:
+        ReceivedBaselineHistory() = default;
+        ~ReceivedBaselineHistory() = default;
+
+        //! Returns the property values received in the provided packet, or nullptr if they are no longer available.
+        //! InvalidPacketId refers to the empty baseline used by deltas that were encoded before any baseline was confirmed.
+        //! @param packetId the packet id the baseline was received in
+        //! @return the baseline, or nullptr if it is not available
+        const AzNetworking::SerializerBaseline* Find(AzNetworking::PacketId packetId) const;
+
+        //! Stores the property values received in a baseline delta.
+        //! The remote endpoint never encodes against an older baseline than the one it last used, so older baselines are discarded.
+        //! @param baselinePacketId the packet id of the baseline the delta was encoded against
+        //! @param packetId         the packet id the delta was received in
+        //! @param values           the reconstructed property values
+        //! @param maxCount         the maximum number of baselines to keep
+        void Store(AzNetworking::PacketId baselinePacketId, AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& values, uint32_t maxCount);
+
+    private:
+        struct ReceivedBaseline
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AzNetworking::SerializerBaseline m_values;
+        };
+
+        AZStd::deque<ReceivedBaseline> m_receivedBaselines;
+    };
+}
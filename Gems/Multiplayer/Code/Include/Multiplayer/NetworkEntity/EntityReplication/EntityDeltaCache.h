@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+
+namespace Multiplayer
+{
+    //! @class EntityDeltaCache
+    //! @brief Shares serialized entity deltas between connections during a single network tick.
+    //! Every connection replicating an entity serializes the entity's state against its own pending replication record. Connections
+    //! that are caught up to the same baseline end up with identical records, and therefore identical serialized deltas, since the
+    //! entity state doesn't change while connections are being updated. This cache lets the first connection serialize the delta and
+    //! every other connection with a matching record reuse the bytes.
+    //! The cache is only active between BeginTick and EndTick, and it is safe to use from multiple connection update threads.
+    class EntityDeltaCache
+    {
+    public:
+        //! Maximum number of distinct replication records cached for a single entity in a tick.
+        static constexpr uint32_t MaxDeltasPerEntity = 8;
+
+        EntityDeltaCache() = default;
+        ~EntityDeltaCache() = default;
+
+        //! Invalidates all deltas cached during the previous tick and activates the cache.
+        //! @param enabled if false the cache stays inactive for this tick and all lookups miss
+        void BeginTick(bool enabled);
+
+        //! Deactivates the cache, must be called once the entity state is allowed to change again.
+        void EndTick();
+
+        //! Returns true if deltas are currently being cached.
+        //! @return boolean true if deltas are currently being cached
+        bool IsActive() const;
+
+        //! Retrieves the serialized delta for an entity that was generated from a matching replication record this tick.
+        //! @param netEntityId the entity the delta was generated for
+        //! @param record      the replication record the caller would serialize
+        //! @param outData     buffer to copy the serialized delta into
+        //! @return boolean true if a matching delta was found and copied into outData
+        bool TryGet(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData);
+
+        //! Stores the serialized delta for an entity so other connections with a matching replication record can reuse it.
+        //! @param netEntityId the entity the delta was generated for
+        //! @param record      the replication record the delta was serialized from
+        //! @param data        the serialized delta
+        void Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data);
+
+        //! Returns the number of lookups that were served from the cache.
+        uint64_t GetHitCount() const;
+
+        //! Returns the number of lookups that required the caller to serialize the delta.
+        uint64_t GetMissCount() const;
+
+    private:
+        struct CachedDelta
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        struct EntityDeltas
+        {
+            uint32_t m_tick = 0;
+            uint32_t m_deltaCount = 0;
+            AZStd::vector<CachedDelta> m_deltas;
+        };
+
+        static bool RecordsMatch(const ReplicationRecord& lhs, const ReplicationRecord& rhs);
+        const CachedDelta* FindDelta(const EntityDeltas& entityDeltas, const ReplicationRecord& record) const;
+
+        AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<NetEntityId, EntityDeltas> m_entityDeltas;
+        uint32_t m_tick = 0;
+        bool m_active = false;
+
+        AZStd::atomic<uint64_t> m_hitCount{ 0 };
+        AZStd::atomic<uint64_t> m_missCount{ 0 };
+    };
+}
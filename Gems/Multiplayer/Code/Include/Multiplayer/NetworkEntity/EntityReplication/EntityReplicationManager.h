@@ -9,6 +9,8 @@
 #pragma once
 
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
@@ -89,6 +91,13 @@ namespace Multiplayer
         bool HandleEntityUpdateMessage(AzNetworking::IConnection* invokingConnection, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateMessage& updateMessage);
         bool HandleEntityRpcMessages(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcVector& rpcVector);
         bool HandleEntityResetMessages(AzNetworking::IConnection* invokingConnection, const NetEntityIdsForReset& resetIds);
+        bool HandleEntityBaselineAcks(AzNetworking::IConnection* invokingConnection, const BaselineAckPacketIds& packetIds);
+
+        //! Called once all entity updates of a received packet have been handled.
+        //! If every baseline delta in the packet was decoded and stored, the packet is confirmed to the remote endpoint so it can
+        //! encode against these baselines.
+        //! @param packetId the packet id of the handled entity updates
+        void AcknowledgeBaselineDeltas(AzNetworking::PacketId packetId);
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
@@ -125,6 +134,7 @@ namespace Multiplayer
         void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
+        void SendBaselineAcks();
 
         void MigrateEntityInternal(NetEntityId entityId);
         void OnEntityExitDomain(const ConstNetworkEntityHandle& entityHandle);
@@ -191,6 +201,14 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        //! Packets whose baseline deltas were all stored, waiting to be confirmed to the remote endpoint
+        AZStd::vector<AzNetworking::PacketId> m_baselineAcksPending;
+        //! Packets the remote endpoint confirmed it stored the baseline deltas of
+        BaselineAckSet m_baselineAcks;
+        //! Tracks the baseline deltas of the packet currently being handled
+        bool m_storedBaselineDelta = false;
+        bool m_rejectedBaselineDelta = false;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -209,6 +227,7 @@ namespace Multiplayer
         AzNetworking::IConnection& m_connection;
         AZStd::unique_ptr<IReplicationWindow> m_replicationWindow;
         AZStd::unique_ptr<IEntityDomain> m_remoteEntityDomain;
+        EntityReplicationScheduler m_replicationScheduler;
 
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_entityPendingRemovalMs = AZ::Time::ZeroTimeMs;
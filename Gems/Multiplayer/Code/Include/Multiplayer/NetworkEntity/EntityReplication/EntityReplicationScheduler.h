@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    class EntityReplicator;
+
+    //! @class EntityReplicationScheduler
+    //! @brief Decides which proxy entities a connection sends updates for, and in what order.
+    //! Every entity with pending changes accumulates priority each send, scaled by its distance to the remote player (taken from the
+    //! replication window) and by its entity type (the product of the ReplicationPriority attributes of its multiplayer components).
+    //! Sending an entity resets its accumulated priority, so entities that have been waiting the longest eventually outrank closer
+    //! entities and nothing starves.
+    //! Optionally the scheduler also tracks a bandwidth budget in bytes per second, which limits how many updates are sent each tick.
+    class EntityReplicationScheduler
+    {
+    public:
+        //! Estimated size of an entity update that has never been sent before.
+        static constexpr uint32_t DefaultEstimatedUpdateSize = 128;
+
+        //! A proxy entity with pending changes that competes for the send budget.
+        struct ProxyCandidate
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_priority = 0.0f;
+            EntityReplicator* m_replicator = nullptr;
+        };
+        using ProxyCandidateList = AZStd::vector<ProxyCandidate>;
+
+        EntityReplicationScheduler() = default;
+        ~EntityReplicationScheduler() = default;
+
+        //! Refills the bandwidth budget for the time elapsed since the previous send.
+        //! @param currentTimeMs  the current time
+        //! @param bytesPerSecond the bandwidth budget of the connection, 0 disables the budget
+        //! @param maxBurstMs     the maximum amount of unused budget that can be saved up, in milliseconds worth of bandwidth
+        void BeginSend(AZ::TimeMs currentTimeMs, uint32_t bytesPerSecond, AZ::TimeMs maxBurstMs);
+
+        //! Returns true if sends are limited by a bandwidth budget.
+        bool IsBudgetLimited() const;
+
+        //! Returns the number of bytes that can still be sent this tick, this can be negative if the budget was overspent.
+        int64_t GetAvailableBytes() const;
+
+        //! Sets the priority the replication window assigned to an entity.
+        //! @param netEntityId    the entity to set the priority for
+        //! @param windowPriority inverse squared distance to the remote player, or 0 if unknown
+        void SetWindowPriority(NetEntityId netEntityId, float windowPriority);
+
+        //! Accumulates the priority of an entity with pending changes and returns its total accumulated priority.
+        //! @param netEntityId  the entity to accumulate priority for
+        //! @param typePriority the priority scale of the entity's type
+        //! @return the total accumulated priority of the entity
+        float AccumulatePriority(NetEntityId netEntityId, float typePriority);
+
+        //! Selects the proxies to send this tick, in order of their accumulated priority.
+        //! Selection stops at the first candidate that doesn't fit into the remaining budget, so the budget is saved up for it. Once
+        //! the budget is full and nothing has been selected yet, that candidate is selected anyway, otherwise an update larger than
+        //! the burst size, or one that doesn't fit next to the autonomous updates, would block every other proxy forever.
+        //! @param candidates    the proxies with pending changes, sorted by descending priority so the selected proxies come first
+        //! @param reservedBytes the estimated size of updates that are sent regardless of the budget, such as autonomous entities
+        //! @param maxSendCount  the maximum number of proxies to select
+        //! @return the number of selected proxies at the front of candidates
+        uint32_t SelectProxies(ProxyCandidateList& candidates, int64_t reservedBytes, uint32_t maxSendCount) const;
+
+        //! Returns the expected size of the next update for an entity, based on the size of its last sent update.
+        uint32_t GetEstimatedUpdateSize(NetEntityId netEntityId) const;
+
+        //! Records that an update was sent for an entity, resetting its accumulated priority and consuming the update size from the budget.
+        //! @param netEntityId the entity the update was sent for
+        //! @param updateSize  the serialized size of the update in bytes
+        void OnEntitySent(NetEntityId netEntityId, uint32_t updateSize);
+
+        //! Releases all state for an entity.
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Releases all state and resets the budget.
+        void Clear();
+
+        //! Sets the distance within which entities accumulate priority at the full rate of their type.
+        void SetReferenceDistance(float referenceDistance);
+
+        //! Sets the lowest fraction of its type rate that a far away entity accumulates priority at.
+        void SetMinDistanceFactor(float minDistanceFactor);
+
+    private:
+        float CalculateDistanceFactor(float windowPriority) const;
+
+        struct EntityState
+        {
+            float m_windowPriority = 0.0f;
+            float m_accumulatedPriority = 0.0f;
+            uint32_t m_estimatedUpdateSize = DefaultEstimatedUpdateSize;
+        };
+
+        AZStd::unordered_map<NetEntityId, EntityState> m_entityStates;
+        AZ::TimeMs m_lastSendTimeMs = AZ::Time::ZeroTimeMs;
+        int64_t m_availableBytes = 0;
+        int64_t m_burstBytes = 0;
+        uint32_t m_bytesPerSecond = 0;
+        float m_referenceDistanceSq = 400.0f;
+        float m_minDistanceFactor = 0.05f;
+        bool m_hasSent = false;
+    };
+}
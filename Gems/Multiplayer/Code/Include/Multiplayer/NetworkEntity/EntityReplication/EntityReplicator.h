@@ -20,6 +20,7 @@
 namespace AzNetworking
 {
     class IConnection;
+    class SerializerBaseline;
 }
 
 namespace Multiplayer
@@ -92,6 +93,8 @@ namespace Multiplayer
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges);
         bool IsPacketIdValid(AzNetworking::PacketId packetId) const;
         AzNetworking::PacketId GetLastReceivedPacketId() const;
+        const AzNetworking::SerializerBaseline* FindReceivedBaseline(AzNetworking::PacketId packetId) const;
+        void StoreReceivedBaseline(AzNetworking::PacketId baselinePacketId, AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& baseline);
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
@@ -10,6 +10,7 @@
 
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Name/Name.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -73,6 +74,18 @@ namespace Multiplayer
         //! @return the current value of PrefabEntityId
         const PrefabEntityId& GetPrefabEntityId() const;
 
+        //! Marks the data as a baseline delta, encoded against the values of a previously received update.
+        //! @param baselinePacketId the packet id of the update the data was encoded against, InvalidPacketId if it has no baseline
+        void SetBaselinePacketId(AzNetworking::PacketId baselinePacketId);
+
+        //! Returns true if the data is a baseline delta, which needs to be decoded with BaselineDeltaSerializerApply.
+        //! @return true if the data is a baseline delta
+        bool GetIsBaselineDelta() const;
+
+        //! Gets the packet id of the update the data was encoded against.
+        //! @return the baseline packet id, InvalidPacketId if the data has no baseline
+        AzNetworking::PacketId GetBaselinePacketId() const;
+
         //! Sets the current value for Data
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
@@ -97,7 +110,9 @@ namespace Multiplayer
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_isBaselineDelta = false;
         PrefabEntityId m_prefabEntityId;
+        AzNetworking::PacketId m_baselinePacketId = AzNetworking::InvalidPacketId;
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! A contiguous block of volumes allocated from a RewindHistoryStore, generally all the volumes of a single entity.
+    struct RewindVolumeRange
+    {
+        uint32_t m_start = 0;
+        uint32_t m_count = 0;
+    };
+
+    //! @class RewindHistoryStore
+    //! @brief Keeps the rewind history of rigid volumes, such as hit volumes, for all entities in a structure-of-arrays layout.
+    //! A RewindableObject keeps a separate history ring per value, so rewinding thousands of hit volumes touches thousands of scattered
+    //! rings. This store instead keeps a column of translations and a column of rotations per history frame, and allocates the volumes of
+    //! an entity as a contiguous range, so rewinding or restoring all volumes of an entity reads a couple of contiguous runs of memory.
+    //! History frames follow the same rules as RewindableObject: writes older than the latest value of a volume are ignored, frames a
+    //! volume wasn't written for repeat its previous value, and reads older than the history return the oldest value available.
+    //! NOTE: The store is not thread safe. Allocating and freeing volumes resizes the shared columns and must happen on the main thread,
+    //! never while entities are updated from job threads. Writing the volumes of different ranges only touches those ranges.
+    class RewindHistoryStore
+    {
+    public:
+        RewindHistoryStore() = default;
+        ~RewindHistoryStore() = default;
+
+        //! Allocates a contiguous range of volumes with no history.
+        //! @param count the number of volumes to allocate
+        //! @return the allocated range, empty if count is 0
+        RewindVolumeRange AllocateVolumes(uint32_t count);
+
+        //! Releases a range of volumes so it can be reused, and clears the provided range.
+        //! @param range the range to free, as returned by AllocateVolumes
+        void FreeVolumes(RewindVolumeRange& range);
+
+        //! Records the transform of a volume for the provided frame.
+        //! @param range       the range the volume belongs to
+        //! @param volumeIndex the index of the volume within the range
+        //! @param frameId     the frame to record the transform for
+        //! @param transform   the transform of the volume, scale is not recorded
+        void SetTransform(const RewindVolumeRange& range, uint32_t volumeIndex, HostFrameId frameId, const AZ::Transform& transform);
+
+        //! Retrieves the transforms of all volumes in a range at the provided frame.
+        //! Volumes that have never been written return an identity transform.
+        //! @param range          the range of volumes to retrieve
+        //! @param frameId        the frame to retrieve transforms for
+        //! @param blendFactor    if less than 1, transforms are interpolated from the preceding frame by this factor
+        //! @param outTransforms  receives one transform per volume in the range
+        void GetTransforms(const RewindVolumeRange& range, HostFrameId frameId, float blendFactor, AZStd::vector<AZ::Transform>& outTransforms) const;
+
+        //! Returns the number of volumes currently allocated.
+        uint32_t GetAllocatedVolumeCount() const;
+
+        //! Returns the number of volumes the store has storage for.
+        uint32_t GetCapacity() const;
+
+    private:
+        struct FrameColumn
+        {
+            AZStd::vector<AZ::Vector3> m_translations;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+        };
+
+        //! Returns the column index holding the value of a volume at the requested frame, clamped to the history of the volume.
+        uint32_t GetColumnIndex(HostFrameId lastWrittenFrameId, HostFrameId frameId) const;
+
+        AZStd::array<FrameColumn, RewindHistorySize> m_columns;
+        AZStd::vector<HostFrameId> m_lastWrittenFrameIds;
+
+        //! Free ranges, sorted by start and never adjacent to each other
+        AZStd::vector<RewindVolumeRange> m_freeRanges;
+        uint32_t m_capacity = 0;
+        uint32_t m_allocatedCount = 0;
+    };
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace AZ
+{
+    class Entity;
+}
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+
+    //! @class EntityInterestGrid
+    //! @brief Uniform grid on the XY plane that buckets every active network entity by position.
+    //! The grid is shared by all server to client replication windows and rebuilt incrementally once per network tick, so windows
+    //! only need to look at the cells overlapping their awareness radius instead of querying the visibility system per connection.
+    //! Every cell is stamped with the grid tick it last changed on, which lets windows skip cells that are unchanged since their last
+    //! update. Cells that stay empty are pruned, windows treat a missing cell the same as a changed one.
+    class EntityInterestGrid
+    {
+    public:
+        using CellKey = uint64_t;
+
+        //! Inclusive range of cell coordinates.
+        struct CellRect
+        {
+            bool Contains(int32_t cellX, int32_t cellY) const;
+            bool IsEmpty() const;
+            bool operator==(const CellRect& rhs) const;
+            bool operator!=(const CellRect& rhs) const;
+
+            int32_t m_minX = 0;
+            int32_t m_minY = 0;
+            int32_t m_maxX = -1;
+            int32_t m_maxY = -1;
+        };
+
+        struct Cell
+        {
+            AZStd::vector<NetEntityId> m_entities;
+            uint32_t m_changedTick = 0;
+        };
+
+        struct EntityRecord
+        {
+            AZ::Entity* m_entity = nullptr;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            CellKey m_cellKey = 0;
+            uint32_t m_seenTick = 0;
+        };
+
+        EntityInterestGrid() = default;
+        ~EntityInterestGrid() = default;
+
+        //! Re-buckets all active entities in the tracker, entities only move between cells when their cell changes.
+        //! @param networkEntityTracker the tracker holding all entities to bucket
+        //! @param cellSize             edge length of a grid cell, changing the cell size rebuilds the grid
+        void Update(const NetworkEntityTracker& networkEntityTracker, float cellSize);
+
+        //! Removes all entities and cells from the grid.
+        void Clear();
+
+        //! Returns the number of times the grid has been updated since it was last cleared, zero if the grid is empty.
+        uint32_t GetUpdateTick() const;
+
+        //! Returns a number that changes every time the grid is cleared or rebuilt.
+        //! Cell ticks restart after a rebuild, so windows compare generations to tell whether their candidates refer to a previous grid.
+        uint32_t GetGeneration() const;
+
+        //! Returns the edge length of a grid cell.
+        float GetCellSize() const;
+
+        //! Returns the range of cells overlapping the square bounding a sphere.
+        //! @param center center of the sphere
+        //! @param radius radius of the sphere
+        //! @return the range of overlapping cells
+        CellRect GetCellRect(const AZ::Vector3& center, float radius) const;
+
+        //! Returns the key of the cell with the provided cell coordinates.
+        static CellKey GetCellKey(int32_t cellX, int32_t cellY);
+
+        //! Returns the cell coordinates of a cell key.
+        static void GetCellCoordinates(CellKey cellKey, int32_t& outCellX, int32_t& outCellY);
+
+        //! Returns the cell with the provided key, nullptr if the cell has no entities and was pruned or never created.
+        const Cell* FindCell(CellKey cellKey) const;
+
+        //! Returns the record of an entity bucketed into the grid, nullptr if the entity is not in the grid.
+        const EntityRecord* FindEntity(NetEntityId netEntityId) const;
+
+        //! Returns the number of entities bucketed into the grid.
+        uint32_t GetEntityCount() const;
+
+    private:
+        int32_t GetCellCoordinate(float position) const;
+        void RemoveFromCell(CellKey cellKey, NetEntityId netEntityId);
+        void AddToCell(CellKey cellKey, NetEntityId netEntityId);
+        void PruneEmptyCells();
+
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        AZStd::unordered_map<NetEntityId, EntityRecord> m_entities;
+        float m_cellSize = 0.0f;
+        uint32_t m_tick = 0;
+        uint32_t m_generation = 0;
+    };
+}
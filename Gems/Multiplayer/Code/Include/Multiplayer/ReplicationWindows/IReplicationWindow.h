@@ -13,6 +13,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Multiplayer
 {
@@ -77,6 +78,11 @@ namespace Multiplayer
         //! @param resetIds the set of netEntityIds to refresh
         virtual void SendEntityResets(const NetEntityIdSet& resetIds) = 0;
 
+        //! This sends an EntityBaselineAcks message on the associated network interface and connection.
+        //! This confirms to the remote endpoint that all baseline deltas in the provided packets were stored
+        //! @param packetIds the packet ids of the confirmed entity updates
+        virtual void SendBaselineAcks(const AZStd::vector<AzNetworking::PacketId>& packetIds) = 0;
+
         //! This causes the replication window to perform debug-draw overlays.
         virtual void DebugDraw() const = 0;
     };
@@ -0,0 +1,577 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/BotClients/MultiplayerBotClients.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Time/ITime.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(AZ::CVarFixedString, bot_serverAddr, AZ::CVarFixedString(LocalHost), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The address of the server that bot clients connect to");
+    AZ_CVAR(uint16_t, bot_serverPort, DefaultServerPort, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The port of the server that bot clients connect to");
+    AZ_CVAR(AZ::TimeMs, bot_inputRateMs, AZ::TimeMs{ 33 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Rate at which bot clients send synthetic inputs, should match cl_InputRateMs on the server");
+    AZ_CVAR(uint32_t, bot_maxClients, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Maximum number of bot clients that can be connected at the same time");
+
+    // Bots identify themselves with temporary user ids in this range, which can't collide with the ids of real clients rejoining a server
+    static constexpr uint64_t BotTemporaryUserIdBase = 0xB070000000000000ull;
+
+    // Bots drive the same input rpc a LocalPredictionPlayerInputComponent on a real client does
+    static constexpr const char* ClientInputComponentName = "LocalPredictionPlayerInputComponent";
+    static constexpr const char* ClientInputRpcName = "SendClientInput";
+    static constexpr uint16_t MaxRpcSearchCount = 256;
+
+    //! Mirrors the parameters of the LocalPredictionPlayerInputComponent SendClientInput rpc.
+    struct BotClientInputRpcParams
+        : public IRpcParamStruct
+    {
+        BotClientInputRpcParams(NetworkInputArray& inputArray)
+            : m_inputArray(inputArray)
+        {
+            ;
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_inputArray, "InputArray")
+                && serializer.Serialize(m_stateHash, "StateHash");
+        }
+
+        NetworkInputArray& m_inputArray;
+        AZ::HashValue32 m_stateHash = AZ::HashValue32{ 0 };
+    };
+
+    static bool FindClientInputRpc(NetComponentId& outNetComponentId, RpcIndex& outRpcIndex)
+    {
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        if (componentRegistry == nullptr)
+        {
+            return false;
+        }
+
+        outNetComponentId = componentRegistry->FindNetComponentId(AZ::Name(ClientInputComponentName));
+        if (outNetComponentId == InvalidNetComponentId)
+        {
+            return false;
+        }
+
+        for (uint16_t rpcIndex = 0; rpcIndex < MaxRpcSearchCount; ++rpcIndex)
+        {
+            if (azstricmp(componentRegistry->GetComponentRpcName(outNetComponentId, RpcIndex{ rpcIndex }), ClientInputRpcName) == 0)
+            {
+                outRpcIndex = RpcIndex{ rpcIndex };
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename VALUE_TYPE>
+    static VALUE_TYPE GetPercentile(const AZStd::vector<VALUE_TYPE>& sortedValues, float percentile)
+    {
+        if (sortedValues.empty())
+        {
+            return VALUE_TYPE{ 0 };
+        }
+        const AZStd::size_t index = static_cast<AZStd::size_t>(percentile * static_cast<float>(sortedValues.size() - 1) + 0.5f);
+        return sortedValues[AZStd::min(index, sortedValues.size() - 1)];
+    }
+
+    MultiplayerBotClient::MultiplayerBotClient(uint32_t botIndex, uint64_t temporaryUserId)
+        : m_interfaceName(AZStd::string::format("MultiplayerBotClient%u", botIndex))
+        , m_temporaryUserId(temporaryUserId)
+    {
+        // Bots don't own any entities, so their inputs have no component inputs to serialize
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            m_inputArray[i].AttachNetBindComponent(nullptr);
+        }
+        m_clockOffsetSamplesMs.reserve(MaxLatencySamples);
+    }
+
+    MultiplayerBotClient::~MultiplayerBotClient()
+    {
+        Disconnect();
+    }
+
+    bool MultiplayerBotClient::Connect(const AzNetworking::IpAddress& serverAddress)
+    {
+        AzNetworking::INetworking* networking = AZ::Interface<AzNetworking::INetworking>::Get();
+        if (networking == nullptr)
+        {
+            return false;
+        }
+
+        m_networkInterface = networking->CreateNetworkInterface(
+            m_interfaceName, AzNetworking::ProtocolType::Udp, AzNetworking::TrustZone::ExternalClientToServer, *this);
+        if (m_networkInterface == nullptr)
+        {
+            AZLOG_WARN("Failed to create network interface %s", m_interfaceName.GetCStr());
+            return false;
+        }
+
+        m_connectTimeMs = AZ::GetElapsedTimeMs();
+        if (m_networkInterface->Connect(serverAddress) == AzNetworking::InvalidConnectionId)
+        {
+            AZLOG_WARN("Bot client %s failed to connect to %s", m_interfaceName.GetCStr(), serverAddress.GetString().c_str());
+            Disconnect();
+            return false;
+        }
+        return true;
+    }
+
+    void MultiplayerBotClient::Disconnect()
+    {
+        if (m_networkInterface == nullptr)
+        {
+            return;
+        }
+
+        if (m_connection != nullptr)
+        {
+            m_networkInterface->Disconnect(m_connection->GetConnectionId(), AzNetworking::DisconnectReason::TerminatedByClient);
+            m_connection = nullptr;
+        }
+        AZ::Interface<AzNetworking::INetworking>::Get()->DestroyNetworkInterface(m_interfaceName);
+        m_networkInterface = nullptr;
+        m_handshakeComplete = false;
+        m_autonomousEntityId = InvalidNetEntityId;
+    }
+
+    void MultiplayerBotClient::SendInput(NetComponentId netComponentId, RpcIndex rpcIndex)
+    {
+        if (!m_handshakeComplete || (m_autonomousEntityId == InvalidNetEntityId))
+        {
+            return;
+        }
+
+        // Shift the input history, the server uses older inputs to recover from lost input packets
+        for (uint32_t i = NetworkInputArray::MaxElements - 1; i > 0; --i)
+        {
+            m_inputArray[i] = m_inputArray[i - 1];
+        }
+
+        ++m_clientInputId;
+        NetworkInput& input = m_inputArray[0];
+        input.SetClientInputId(m_clientInputId);
+        input.SetHostFrameId(m_lastHostFrameId);
+        input.SetHostTimeMs(m_lastHostTimeMs);
+        input.SetHostBlendFactor(1.0f);
+
+        NetworkEntityRpcMessage rpcMessage(
+            RpcDeliveryType::AutonomousToAuthority, m_autonomousEntityId, netComponentId, rpcIndex, AzNetworking::ReliabilityType::Unreliable);
+        BotClientInputRpcParams rpcParams(m_inputArray);
+        if (!rpcMessage.SetRpcParams(rpcParams))
+        {
+            return;
+        }
+
+        MultiplayerPackets::EntityRpcs rpcsPacket;
+        rpcsPacket.ModifyEntityRpcs().push_back(AZStd::move(rpcMessage));
+        m_connection->SendUnreliablePacket(rpcsPacket);
+        m_networkInterface->FlushSends();
+        ++m_inputsSent;
+    }
+
+    bool MultiplayerBotClient::IsConnected() const
+    {
+        return m_handshakeComplete;
+    }
+
+    uint64_t MultiplayerBotClient::GetBytesReceived() const
+    {
+        return m_bytesReceived;
+    }
+
+    uint64_t MultiplayerBotClient::GetEntityUpdatesReceived() const
+    {
+        return m_entityUpdatesReceived;
+    }
+
+    uint64_t MultiplayerBotClient::GetInputsSent() const
+    {
+        return m_inputsSent;
+    }
+
+    AZ::TimeMs MultiplayerBotClient::GetConnectedTimeMs() const
+    {
+        return (m_networkInterface != nullptr) ? AZ::GetElapsedTimeMs() - m_connectTimeMs : AZ::Time::ZeroTimeMs;
+    }
+
+    void MultiplayerBotClient::GatherLatencies(AZStd::vector<AZ::TimeMs>& outLatenciesMs) const
+    {
+        const AZ::TimeMs halfRoundTripMs = (m_connection != nullptr)
+            ? AZ::SecondsToTimeMs(m_connection->GetMetrics().m_connectionRtt.GetRoundTripTimeSeconds() * 0.5f)
+            : AZ::Time::ZeroTimeMs;
+        for (AZ::TimeMs clockOffsetMs : m_clockOffsetSamplesMs)
+        {
+            outLatenciesMs.push_back(clockOffsetMs - m_minClockOffsetMs + halfRoundTripMs);
+        }
+    }
+
+    bool MultiplayerBotClient::IsHandshakeComplete([[maybe_unused]] AzNetworking::IConnection* connection) const
+    {
+        return m_handshakeComplete;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Bots never accept connections
+        return false;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        // Bots don't load the server level, they are immediately ready for entity updates
+        m_handshakeComplete = true;
+        return connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Bots share the console of the process they run in, don't let the server change it
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        const AzNetworking::IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        m_lastHostFrameId = packet.GetHostFrameId();
+        m_lastHostTimeMs = packet.GetHostTimeMs();
+
+        const AZ::TimeMs clockOffsetMs = AZ::GetElapsedTimeMs() - packet.GetHostTimeMs();
+        m_minClockOffsetMs = AZStd::min(m_minClockOffsetMs, clockOffsetMs);
+        if (m_clockOffsetSamplesMs.size() < MaxLatencySamples)
+        {
+            m_clockOffsetSamplesMs.push_back(clockOffsetMs);
+        }
+        else
+        {
+            m_clockOffsetSamplesMs[m_nextClockOffsetSample] = clockOffsetMs;
+            m_nextClockOffsetSample = (m_nextClockOffsetSample + 1) % MaxLatencySamples;
+        }
+
+        bool hasBaselineDeltas = false;
+        for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+        {
+            ++m_entityUpdatesReceived;
+            hasBaselineDeltas |= updateMessage.GetIsBaselineDelta();
+            if (updateMessage.GetIsDelete())
+            {
+                if (updateMessage.GetEntityId() == m_autonomousEntityId)
+                {
+                    m_autonomousEntityId = InvalidNetEntityId;
+                }
+            }
+            else if (updateMessage.GetNetworkRole() == NetEntityRole::Autonomous)
+            {
+                m_autonomousEntityId = updateMessage.GetEntityId();
+            }
+        }
+
+        // Confirm baseline deltas like a real client would, so the server encodes against baselines instead of sending full values
+        if (hasBaselineDeltas)
+        {
+            MultiplayerPackets::EntityBaselineAcks baselineAcksPacket;
+            baselineAcksPacket.ModifyPacketIds().push_back(packetHeader.GetPacketId());
+            connection->SendUnreliablePacket(baselineAcksPacket);
+        }
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Rpcs, including input corrections, are consumed without being applied
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::RequestReplicatorReset& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        AZLOG_WARN("Bot client %s doesn't support client migration, ignoring", m_interfaceName.GetCStr());
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::VersionMismatch& packet
+    )
+    {
+        AZLOG_ERROR("Bot client %s has a multiplayer component version mismatch with the server, disconnecting", m_interfaceName.GetCStr());
+        connection->Disconnect(AzNetworking::DisconnectReason::VersionMismatch, AzNetworking::TerminationEndpoint::Local);
+        return true;
+    }
+
+    bool MultiplayerBotClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityBaselineAcks& packet
+    )
+    {
+        // Bots never publish entity updates
+        return true;
+    }
+
+    AzNetworking::ConnectResult MultiplayerBotClient::ValidateConnect
+    (
+        [[maybe_unused]] const AzNetworking::IpAddress& remoteAddress,
+        [[maybe_unused]] const AzNetworking::IPacketHeader& packetHeader,
+        [[maybe_unused]] AzNetworking::ISerializer& serializer
+    )
+    {
+        return AzNetworking::ConnectResult::Accepted;
+    }
+
+    void MultiplayerBotClient::OnConnect(AzNetworking::IConnection* connection)
+    {
+        m_connection = connection;
+
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        connection->SendReliablePacket(MultiplayerPackets::Connect(
+            0,
+            m_temporaryUserId,
+            "",
+            (componentRegistry != nullptr) ? componentRegistry->GetSystemVersionHash() : AZ::HashValue64{ 0 }));
+    }
+
+    AzNetworking::PacketDispatchResult MultiplayerBotClient::OnPacketReceived
+    (
+        AzNetworking::IConnection* connection,
+        const AzNetworking::IPacketHeader& packetHeader,
+        AzNetworking::ISerializer& serializer
+    )
+    {
+        m_bytesReceived += serializer.GetCapacity();
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void MultiplayerBotClient::OnPacketLost([[maybe_unused]] AzNetworking::IConnection* connection, [[maybe_unused]] AzNetworking::PacketId packetId)
+    {
+        ;
+    }
+
+    void MultiplayerBotClient::OnDisconnect
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        AzNetworking::DisconnectReason reason,
+        [[maybe_unused]] AzNetworking::TerminationEndpoint endpoint
+    )
+    {
+        const AZStd::string reasonString = ToString(reason);
+        AZLOG_INFO("Bot client %s disconnected due to %s", m_interfaceName.GetCStr(), reasonString.c_str());
+        m_connection = nullptr;
+        m_handshakeComplete = false;
+        m_autonomousEntityId = InvalidNetEntityId;
+    }
+
+    MultiplayerBotClients::~MultiplayerBotClients()
+    {
+        DisconnectBots();
+    }
+
+    uint32_t MultiplayerBotClients::ConnectBots(uint32_t botCount, const AzNetworking::IpAddress& serverAddress)
+    {
+        if ((m_clientInputNetComponentId == InvalidNetComponentId) && !FindClientInputRpc(m_clientInputNetComponentId, m_clientInputRpcIndex))
+        {
+            m_clientInputNetComponentId = InvalidNetComponentId;
+            AZLOG_WARN("Bot clients could not find the %s rpc, bots will not send inputs", ClientInputRpcName);
+        }
+
+        uint32_t connectedCount = 0;
+        for (uint32_t i = 0; (i < botCount) && (m_bots.size() < bot_maxClients); ++i)
+        {
+            const uint32_t botIndex = m_nextBotIndex++;
+            AZStd::unique_ptr<MultiplayerBotClient> bot = AZStd::make_unique<MultiplayerBotClient>(botIndex, BotTemporaryUserIdBase + botIndex);
+            if (!bot->Connect(serverAddress))
+            {
+                break;
+            }
+            m_bots.push_back(AZStd::move(bot));
+            ++connectedCount;
+        }
+
+        if (!m_bots.empty() && !m_sendInputsEvent.IsScheduled())
+        {
+            m_sendInputsEvent.Enqueue(bot_inputRateMs, true);
+        }
+        return connectedCount;
+    }
+
+    void MultiplayerBotClients::DisconnectBots()
+    {
+        m_sendInputsEvent.RemoveFromQueue();
+        m_bots.clear();
+    }
+
+    void MultiplayerBotClients::LogReport() const
+    {
+        uint32_t connectedCount = 0;
+        uint64_t totalBytesReceived = 0;
+        uint64_t totalEntityUpdates = 0;
+        uint64_t totalInputsSent = 0;
+        AZStd::vector<uint64_t> bytesPerSecond;
+        AZStd::vector<AZ::TimeMs> latenciesMs;
+        for (const AZStd::unique_ptr<MultiplayerBotClient>& bot : m_bots)
+        {
+            connectedCount += bot->IsConnected() ? 1 : 0;
+            totalBytesReceived += bot->GetBytesReceived();
+            totalEntityUpdates += bot->GetEntityUpdatesReceived();
+            totalInputsSent += bot->GetInputsSent();
+
+            const AZ::TimeMs connectedTimeMs = bot->GetConnectedTimeMs();
+            if (connectedTimeMs > AZ::Time::ZeroTimeMs)
+            {
+                bytesPerSecond.push_back(bot->GetBytesReceived() * 1000 / aznumeric_cast<uint64_t>(connectedTimeMs));
+            }
+            bot->GatherLatencies(latenciesMs);
+        }
+
+        AZStd::sort(bytesPerSecond.begin(), bytesPerSecond.end());
+        AZStd::sort(latenciesMs.begin(), latenciesMs.end());
+
+        AZLOG_INFO("Bot clients connected: %u of %u", connectedCount, aznumeric_cast<uint32_t>(m_bots.size()));
+        AZLOG_INFO("Bot client total bytes received: %llu", aznumeric_cast<AZ::u64>(totalBytesReceived));
+        AZLOG_INFO("Bot client total entity updates received: %llu", aznumeric_cast<AZ::u64>(totalEntityUpdates));
+        AZLOG_INFO("Bot client total inputs sent: %llu", aznumeric_cast<AZ::u64>(totalInputsSent));
+        AZLOG_INFO("Bot client bytes received per second: p50 %llu, p90 %llu, max %llu",
+            aznumeric_cast<AZ::u64>(GetPercentile(bytesPerSecond, 0.5f)),
+            aznumeric_cast<AZ::u64>(GetPercentile(bytesPerSecond, 0.9f)),
+            aznumeric_cast<AZ::u64>(GetPercentile(bytesPerSecond, 1.0f)));
+        AZLOG_INFO("Bot client replication latency ms: p50 %lld, p90 %lld, p99 %lld, max %lld (%u samples)",
+            aznumeric_cast<int64_t>(GetPercentile(latenciesMs, 0.5f)),
+            aznumeric_cast<int64_t>(GetPercentile(latenciesMs, 0.9f)),
+            aznumeric_cast<int64_t>(GetPercentile(latenciesMs, 0.99f)),
+            aznumeric_cast<int64_t>(GetPercentile(latenciesMs, 1.0f)),
+            aznumeric_cast<uint32_t>(latenciesMs.size()));
+    }
+
+    void MultiplayerBotClients::BotConnect(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() > 1)
+        {
+            AZ_Warning("MultiplayerBotClients", false, "BotConnect takes at most one argument, the number of bot clients to connect");
+            return;
+        }
+
+        uint32_t botCount = 1;
+        if (!arguments.empty())
+        {
+            const AZStd::string_view countArgument = arguments.front();
+            const bool isNumeric = !countArgument.empty()
+                && AZStd::all_of(countArgument.begin(), countArgument.end(), [](char c) { return c >= '0' && c <= '9'; });
+            if (!isNumeric || !AZ::ConsoleTypeHelpers::StringToValue(botCount, countArgument) || (botCount == 0))
+            {
+                AZ_Warning("MultiplayerBotClients", false, "Invalid bot count '%.*s', expected a positive number",
+                    AZ_STRING_ARG(countArgument));
+                return;
+            }
+        }
+
+        const AzNetworking::IpAddress serverAddress(
+            static_cast<AZ::CVarFixedString>(bot_serverAddr).c_str(), bot_serverPort, AzNetworking::ProtocolType::Udp);
+        const uint32_t connectedCount = ConnectBots(botCount, serverAddress);
+        AZLOG_INFO("Connected %u bot clients to %s, %u bot clients total",
+            connectedCount, serverAddress.GetString().c_str(), aznumeric_cast<uint32_t>(m_bots.size()));
+    }
+
+    void MultiplayerBotClients::BotDisconnect([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        DisconnectBots();
+    }
+
+    void MultiplayerBotClients::BotReport([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        LogReport();
+    }
+
+    void MultiplayerBotClients::SendInputs()
+    {
+        if (m_clientInputNetComponentId == InvalidNetComponentId)
+        {
+            return;
+        }
+
+        for (AZStd::unique_ptr<MultiplayerBotClient>& bot : m_bots)
+        {
+            bot->SendInput(m_clientInputNetComponentId, m_clientInputRpcIndex);
+        }
+    }
+}
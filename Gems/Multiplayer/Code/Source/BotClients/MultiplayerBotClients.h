@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    //! @class MultiplayerBotClient
+    //! @brief A headless client that connects to a multiplayer server over its own UDP network interface.
+    //! Bots perform the client handshake, send synthetic NetworkInput streams for the entity they are given autonomous control of,
+    //! and consume entity updates without spawning any entities. They record the bytes they receive and the replication latency
+    //! of every entity update packet so a server's capacity can be measured without real game clients.
+    class MultiplayerBotClient final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        MultiplayerBotClient(uint32_t botIndex, uint64_t temporaryUserId);
+        ~MultiplayerBotClient() override;
+
+        //! Creates the network interface of this bot and connects it to the provided server.
+        //! @return false if the connection could not be opened
+        bool Connect(const AzNetworking::IpAddress& serverAddress);
+
+        //! Disconnects the bot and destroys its network interface.
+        void Disconnect();
+
+        //! Sends the next synthetic input if this bot controls an autonomous entity.
+        //! @param netComponentId the NetComponentId of the component receiving client inputs
+        //! @param rpcIndex       the index of the client input rpc on that component
+        void SendInput(NetComponentId netComponentId, RpcIndex rpcIndex);
+
+        bool IsConnected() const;
+        uint64_t GetBytesReceived() const;
+        uint64_t GetEntityUpdatesReceived() const;
+        uint64_t GetInputsSent() const;
+        AZ::TimeMs GetConnectedTimeMs() const;
+
+        //! Appends the replication latency of every recorded entity update packet to outLatenciesMs.
+        //! Server and bot clocks are unrelated, so latencies are measured relative to the fastest packet received and offset by half the
+        //! round trip time. They include network transit and any queuing on either endpoint, but not the server time to simulate a tick.
+        void GatherLatencies(AZStd::vector<AZ::TimeMs>& outLatenciesMs) const;
+
+        bool IsHandshakeComplete(AzNetworking::IConnection* connection) const;
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityBaselineAcks& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+        //! Maximum number of latency samples kept per bot, older samples are overwritten
+        static constexpr uint32_t MaxLatencySamples = 4096;
+
+        AZ::Name m_interfaceName;
+        uint64_t m_temporaryUserId = 0;
+        AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+        AzNetworking::IConnection* m_connection = nullptr;
+        bool m_handshakeComplete = false;
+
+        NetEntityId m_autonomousEntityId = InvalidNetEntityId;
+        NetworkInputArray m_inputArray;
+        ClientInputId m_clientInputId = ClientInputId{ 0 };
+        HostFrameId m_lastHostFrameId = InvalidHostFrameId;
+        AZ::TimeMs m_lastHostTimeMs = AZ::Time::ZeroTimeMs;
+
+        AZ::TimeMs m_connectTimeMs = AZ::Time::ZeroTimeMs;
+        uint64_t m_bytesReceived = 0;
+        uint64_t m_entityUpdatesReceived = 0;
+        uint64_t m_inputsSent = 0;
+
+        //! Difference between the local time an entity update packet was received and the host time it was sent at
+        AZStd::vector<AZ::TimeMs> m_clockOffsetSamplesMs;
+        uint32_t m_nextClockOffsetSample = 0;
+        AZ::TimeMs m_minClockOffsetMs = AZ::TimeMs{ AZStd::numeric_limits<int64_t>::max() };
+    };
+
+    //! @class MultiplayerBotClients
+    //! @brief Spawns and drives headless bot clients to load test a multiplayer server.
+    //! Use MultiplayerBotClients.BotConnect <count> to open bot connections to bot_serverAddr:bot_serverPort, MultiplayerBotClients.BotReport
+    //! to log the bytes received per client and replication latency percentiles, and MultiplayerBotClients.BotDisconnect to close all
+    //! bot connections. Server tick times are reported by MultiplayerSystemComponent.DumpStats on the server being tested.
+    class MultiplayerBotClients
+    {
+    public:
+        MultiplayerBotClients() = default;
+        ~MultiplayerBotClients();
+
+        //! Opens the requested number of additional bot connections.
+        //! @return the number of bots that were connected
+        uint32_t ConnectBots(uint32_t botCount, const AzNetworking::IpAddress& serverAddress);
+
+        //! Disconnects and destroys all bots.
+        void DisconnectBots();
+
+        //! Logs the traffic and replication latency recorded by all bots.
+        void LogReport() const;
+
+        //! Console commands.
+        //! @{
+        void BotConnect(const AZ::ConsoleCommandContainer& arguments);
+        void BotDisconnect(const AZ::ConsoleCommandContainer& arguments);
+        void BotReport(const AZ::ConsoleCommandContainer& arguments);
+        //! @}
+
+    private:
+        AZ_CONSOLEFUNC(MultiplayerBotClients, BotConnect, AZ::ConsoleFunctorFlags::DontReplicate, "Connects the provided number of headless bot clients to bot_serverAddr:bot_serverPort");
+        AZ_CONSOLEFUNC(MultiplayerBotClients, BotDisconnect, AZ::ConsoleFunctorFlags::DontReplicate, "Disconnects all headless bot clients");
+        AZ_CONSOLEFUNC(MultiplayerBotClients, BotReport, AZ::ConsoleFunctorFlags::DontReplicate, "Logs bytes received per bot client and replication latency percentiles");
+
+        void SendInputs();
+
+        AZStd::vector<AZStd::unique_ptr<MultiplayerBotClient>> m_bots;
+        uint32_t m_nextBotIndex = 0;
+
+        //! The client input rpc, resolved once when bots are connected
+        NetComponentId m_clientInputNetComponentId = InvalidNetComponentId;
+        RpcIndex m_clientInputRpcIndex = RpcIndex{ 0 };
+
+        AZ::ScheduledEvent m_sendInputsEvent{ [this]()
+        {
+            SendInputs();
+        }, AZ::Name("MultiplayerBotClients SendInputs") };
+    };
+}
@@ -95,6 +95,18 @@ namespace Multiplayer
         return false;
     }
 
+    NetComponentId MultiplayerComponentRegistry::FindNetComponentId(const AZ::Name& componentName) const
+    {
+        for (const auto& [netComponentId, componentData] : m_componentData)
+        {
+            if (componentData.m_componentName == componentName)
+            {
+                return netComponentId;
+            }
+        }
+        return InvalidNetComponentId;
+    }
+
     const Multiplayer::ComponentVersionMap& MultiplayerComponentRegistry::GetMultiplayerComponentVersionHashes() const
     {
         return m_componentVersionHashes;
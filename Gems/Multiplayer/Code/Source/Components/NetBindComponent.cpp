@@ -301,6 +301,11 @@ namespace Multiplayer
         return m_netEntityMigration;
     }
 
+    float NetBindComponent::GetReplicationPriority() const
+    {
+        return m_replicationPriority;
+    }
+
     bool NetBindComponent::ValidatePropertyRead(const char* propertyName, NetEntityRole replicateFrom, NetEntityRole replicateTo) const
     {
         bool isValid(false);
@@ -734,9 +739,15 @@ namespace Multiplayer
 
         // Populate the component vector using component map ordering, since it's ordered by component type
         // It is absolutely essential that the ordering of this vector be consistent between client and server
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        m_replicationPriority = 1.0f;
         for (auto iter : m_multiplayerComponentMap)
         {
             m_multiplayerSerializationComponentVector.push_back(iter.second);
+            if (componentRegistry != nullptr)
+            {
+                m_replicationPriority *= componentRegistry->GetMultiplayerComponentData(iter.first).m_replicationPriority;
+            }
         }
 
         NetworkAttach();
@@ -7,6 +7,7 @@
  */
 
 #include <Multiplayer/Components/NetworkHitVolumesComponent.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 #include <AzFramework/Physics/CharacterBus.h>
@@ -25,7 +26,6 @@ namespace Multiplayer
 
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
     (
-        AzNetworking::ConnectionId connectionId,
         Physics::CharacterRequests* character,
         const char* hitVolumeName,
         const Physics::ColliderConfiguration* colliderConfig,
@@ -36,8 +36,6 @@ namespace Multiplayer
         , m_shapeConfig(shapeConfig)
         , m_jointIndex(jointIndex)
     {
-        m_transform.SetOwningConnectionId(connectionId);
-
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
         if (m_colliderConfig->m_isExclusive)
@@ -62,28 +60,11 @@ namespace Multiplayer
 
     void NetworkHitVolumesComponent::AnimatedHitVolume::UpdateTransform(const AZ::Transform& transform)
     {
-        m_transform = transform;
         m_physicsShape->SetLocalPose(transform.GetTranslation(), transform.GetRotation());
     }
 
-    void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform()
+    void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToTransform(const AZ::Transform& rewoundTransform)
     {
-        AZ::Transform rewoundTransform;
-        const AZ::Transform& targetTransform = m_transform.Get();
-        const float blendFactor = Multiplayer::GetNetworkTime()->GetHostBlendFactor();
-        if (blendFactor < 1.f)
-        {
-            // If a blend factor was supplied, interpolate the transform appropriately
-            const AZ::Transform& previousTransform = m_transform.GetPrevious();
-            rewoundTransform.SetRotation(previousTransform.GetRotation().Slerp(targetTransform.GetRotation(), blendFactor));
-            rewoundTransform.SetTranslation(previousTransform.GetTranslation().Lerp(targetTransform.GetTranslation(), blendFactor));
-            rewoundTransform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), targetTransform.GetUniformScale(), blendFactor));
-        }
-        else
-        {
-            rewoundTransform = m_transform.Get();
-        }
-
         const AZ::Transform  physicsTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_physicsShape->GetLocalPose().second, m_physicsShape->GetLocalPose().first);
 
         // Don't call SetLocalPose unless the transforms are actually different
@@ -136,6 +117,7 @@ namespace Multiplayer
     void NetworkHitVolumesComponent::OnCharacterActivated([[maybe_unused]] const AZ::EntityId& entityId)
     {
         m_physicsCharacter = Physics::CharacterRequestBus::FindFirstHandler(GetEntityId());
+        CreateHitVolumes();
     }
 
     void NetworkHitVolumesComponent::OnCharacterDeactivated([[maybe_unused]] const AZ::EntityId& entityId)
@@ -157,17 +139,24 @@ namespace Multiplayer
 
     void NetworkHitVolumesComponent::OnPreRender([[maybe_unused]] float deltaTime)
     {
+        // Hit volumes are created on the main thread once both the character and the actor exist, pre render may run on job threads
         if (m_animatedHitVolumes.empty())
         {
-            CreateHitVolumes();
+            return;
         }
 
+        RewindHistoryStore& rewindHistoryStore = GetMultiplayer()->GetRewindHistoryStore();
+        const HostFrameId frameId = GetNetworkTime()->GetHostFrameId();
+
         AZ::Vector3 position, scale;
         AZ::Quaternion rotation;
-        for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        for (uint32_t index = 0; index < m_animatedHitVolumes.size(); ++index)
         {
+            AnimatedHitVolume& hitVolume = m_animatedHitVolumes[index];
             m_actorComponent->GetJointTransformComponents(hitVolume.m_jointIndex, EMotionFX::Integration::Space::ModelSpace, position, rotation, scale);
-            hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform;
+            rewindHistoryStore.SetTransform(m_rewindVolumes, index, frameId, transform);
+            hitVolume.UpdateTransform(transform);
         }
 
         if (bg_DrawArticulatedHitVolumes)
@@ -189,15 +178,32 @@ namespace Multiplayer
             m_physicsCharacter->GetCharacter()->SetFrameId(frameId);
         }
 
-        for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        if (m_animatedHitVolumes.empty())
+        {
+            return;
+        }
+
+        // Don't rewind the hit volumes of the connection performing the rewind
+        INetworkTime* networkTime = GetNetworkTime();
+        HostFrameId frameId = networkTime->GetHostFrameId();
+        float blendFactor = networkTime->GetHostBlendFactor();
+        if (networkTime->IsTimeRewound() && (m_owningConnectionId == networkTime->GetRewindingConnectionId()))
+        {
+            frameId = networkTime->GetUnalteredHostFrameId();
+            blendFactor = 1.0f;
+        }
+
+        // Fetch the transforms of all hit volumes in a single pass over the shared history columns
+        GetMultiplayer()->GetRewindHistoryStore().GetTransforms(m_rewindVolumes, frameId, blendFactor, m_rewoundTransforms);
+        for (uint32_t index = 0; index < m_animatedHitVolumes.size(); ++index)
         {
-            hitVolume.SyncToCurrentTransform();
+            m_animatedHitVolumes[index].SyncToTransform(m_rewoundTransforms[index]);
         }
     }
 
     void NetworkHitVolumesComponent::CreateHitVolumes()
     {
-        if (m_physicsCharacter == nullptr || m_actorComponent == nullptr)
+        if (!m_animatedHitVolumes.empty() || m_physicsCharacter == nullptr || m_actorComponent == nullptr)
         {
             return;
         }
@@ -209,7 +215,7 @@ namespace Multiplayer
         }
 
         m_hitDetectionConfig = &physicsConfig->m_hitDetectionConfig;
-        const AzNetworking::ConnectionId owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
+        m_owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
 
         m_animatedHitVolumes.reserve(m_hitDetectionConfig->m_nodes.size());
         for (const Physics::CharacterColliderNodeConfiguration& nodeConfig : m_hitDetectionConfig->m_nodes)
@@ -224,19 +230,27 @@ namespace Multiplayer
             {
                 const Physics::ColliderConfiguration* colliderConfig = coliderPair.first.get();
                 Physics::ShapeConfiguration* shapeConfig = coliderPair.second.get();
-                m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
+                m_animatedHitVolumes.emplace_back(m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
             }
         }
+
+        m_rewindVolumes = GetMultiplayer()->GetRewindHistoryStore().AllocateVolumes(aznumeric_cast<uint32_t>(m_animatedHitVolumes.size()));
     }
 
     void NetworkHitVolumesComponent::DestroyHitVolumes()
     {
         m_animatedHitVolumes.clear();
+        if (IMultiplayer* multiplayer = GetMultiplayer())
+        {
+            multiplayer->GetRewindHistoryStore().FreeVolumes(m_rewindVolumes);
+        }
+        m_rewindVolumes = RewindVolumeRange();
     }
 
     void NetworkHitVolumesComponent::OnActorInstanceCreated([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
     {
         m_actorComponent = EMotionFX::Integration::ActorComponentRequestBus::FindFirstHandler(GetEntity()->GetId());
+        CreateHitVolumes();
     }
 
     void NetworkHitVolumesComponent::OnActorInstanceDestroyed([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
@@ -50,9 +50,13 @@ namespace Multiplayer
         return m_entityReplicationManager;
     }
 
-    void ClientToServerConnectionData::Update()
+    void ClientToServerConnectionData::PreUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+    }
+
+    void ClientToServerConnectionData::Update()
+    {
         m_entityReplicationManager.SendUpdates();
     }
 }
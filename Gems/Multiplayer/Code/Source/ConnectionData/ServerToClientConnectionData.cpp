@@ -71,10 +71,13 @@ namespace Multiplayer
         return m_entityReplicationManager;
     }
 
-    void ServerToClientConnectionData::Update()
+    void ServerToClientConnectionData::PreUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+    }
 
+    void ServerToClientConnectionData::Update()
+    {
         if (CanSendUpdates())
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
@@ -105,6 +105,10 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total sent packet copies");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_sendPacketCopies));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets resent");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
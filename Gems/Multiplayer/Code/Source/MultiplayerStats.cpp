@@ -9,9 +9,13 @@
 #include <Multiplayer/MultiplayerMetrics.h>
 #include <Multiplayer/MultiplayerPerformanceStats.h>
 #include <Multiplayer/MultiplayerStats.h>
+#include <AzCore/std/sort.h>
 
 namespace Multiplayer
 {
+    // Set while the calling thread defers its records, see MultiplayerStats::ScopedDeferredRecords
+    static thread_local MultiplayerStats::DeferredRecords* s_deferredRecords = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -33,21 +37,46 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::EntitySerializeStart, mode, entityId, entityName });
+            return;
+        }
+
         m_events.m_entitySerializeStart.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::ComponentSerializeEnd, mode, AZ::EntityId(), nullptr, netComponentId });
+            return;
+        }
+
         m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
     }
 
     void MultiplayerStats::RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::EntitySerializeStop, mode, entityId, entityName });
+            return;
+        }
+
         m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::PropertySent, AzNetworking::SerializerMode::ReadFromObject, AZ::EntityId(), nullptr, netComponentId,
+                aznumeric_cast<uint16_t>(propertyId), totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
@@ -68,6 +97,13 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::PropertyReceived, AzNetworking::SerializerMode::WriteToObject, AZ::EntityId(), nullptr, netComponentId,
+                aznumeric_cast<uint16_t>(propertyId), totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesRecv.size() > propertyIndex)
@@ -88,6 +124,13 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::RpcSent, AzNetworking::SerializerMode::ReadFromObject, entityId, entityName, netComponentId,
+                aznumeric_cast<uint16_t>(rpcId), totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
 
@@ -109,6 +152,13 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::RpcReceived, AzNetworking::SerializerMode::WriteToObject, entityId, entityName, netComponentId,
+                aznumeric_cast<uint16_t>(rpcId), totalBytes });
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         if (m_componentStats[netComponentIndex].m_rpcsRecv.size() > rpcIndex)
@@ -127,13 +177,37 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::RecordEntityUpdateSent(uint32_t totalBytes)
+    {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back({ DeferredRecord::Type::EntityUpdateSent, AzNetworking::SerializerMode::ReadFromObject, AZ::EntityId(), nullptr, InvalidNetComponentId,
+                0, totalBytes });
+            return;
+        }
+
+        m_entityUpdatesSent.m_totalCalls++;
+        m_entityUpdatesSent.m_totalBytes += totalBytes;
+        m_entityUpdatesSent.m_callHistory[m_recordMetricIndex]++;
+        m_entityUpdatesSent.m_byteHistory[m_recordMetricIndex] += totalBytes;
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_EntityCount, m_entityCount);
         SET_PERFORMANCE_STAT(MultiplayerStat_ClientConnectionCount, m_clientConnectionCount);
 
+        // Report the entity updates of the tick that just finished, before its history slot is recycled below
+        const uint64_t entityUpdateCount = m_entityUpdatesSent.m_callHistory[m_recordMetricIndex];
+        SET_PERFORMANCE_STAT(MultiplayerStat_EntityUpdatesSent, entityUpdateCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_EntityUpdateBytesPerEntity, (entityUpdateCount > 0)
+            ? aznumeric_cast<double>(m_entityUpdatesSent.m_byteHistory[m_recordMetricIndex]) / aznumeric_cast<double>(entityUpdateCount)
+            : 0.0);
+
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
+        m_entityUpdatesSent.m_callHistory[m_recordMetricIndex] = 0;
+        m_entityUpdatesSent.m_byteHistory[m_recordMetricIndex] = 0;
         for (ComponentStats& componentStats : m_componentStats)
         {
             for (Metric& metric : componentStats.m_propertyUpdatesSent)
@@ -259,8 +333,72 @@ namespace Multiplayer
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
 
+    MultiplayerStats::ScopedDeferredRecords::ScopedDeferredRecords(DeferredRecords& records)
+        : m_previousRecords(s_deferredRecords)
+    {
+        s_deferredRecords = &records;
+    }
+
+    MultiplayerStats::ScopedDeferredRecords::~ScopedDeferredRecords()
+    {
+        s_deferredRecords = m_previousRecords;
+    }
+
+    void MultiplayerStats::ReplayDeferredRecords(DeferredRecords& records)
+    {
+        AZ_Assert(s_deferredRecords == nullptr, "Deferred records must be replayed outside of a ScopedDeferredRecords");
+        for (const DeferredRecord& record : records)
+        {
+            switch (record.m_type)
+            {
+            case DeferredRecord::Type::EntitySerializeStart:
+                RecordEntitySerializeStart(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::ComponentSerializeEnd:
+                RecordComponentSerializeEnd(record.m_mode, record.m_netComponentId);
+                break;
+            case DeferredRecord::Type::EntitySerializeStop:
+                RecordEntitySerializeStop(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::PropertySent:
+                RecordPropertySent(record.m_netComponentId, aznumeric_cast<PropertyIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::PropertyReceived:
+                RecordPropertyReceived(record.m_netComponentId, aznumeric_cast<PropertyIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::RpcSent:
+                RecordRpcSent(record.m_entityId, record.m_entityName, record.m_netComponentId, aznumeric_cast<RpcIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::RpcReceived:
+                RecordRpcReceived(record.m_entityId, record.m_entityName, record.m_netComponentId, aznumeric_cast<RpcIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::EntityUpdateSent:
+                RecordEntityUpdateSent(record.m_totalBytes);
+                break;
+            }
+        }
+        records.clear();
+    }
+
     void MultiplayerStats::RecordFrameTime(AZ::TimeUs networkFrameTime)
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
+
+        m_frameTimeHistory[m_frameTimeSampleCount % FrameTimeSamples] = networkFrameTime;
+        ++m_frameTimeSampleCount;
+    }
+
+    AZ::TimeUs MultiplayerStats::CalculateFrameTimePercentile(float percentile) const
+    {
+        const uint32_t sampleCount = AZStd::min(m_frameTimeSampleCount, FrameTimeSamples);
+        if (sampleCount == 0)
+        {
+            return AZ::Time::ZeroTimeUs;
+        }
+
+        AZStd::array<AZ::TimeUs, FrameTimeSamples> sortedFrameTimes = m_frameTimeHistory;
+        AZStd::sort(sortedFrameTimes.begin(), sortedFrameTimes.begin() + sampleCount);
+        const uint32_t index = aznumeric_cast<uint32_t>(AZStd::clamp(percentile, 0.0f, 1.0f) * aznumeric_cast<float>(sampleCount - 1) + 0.5f);
+        return sortedFrameTimes[index];
     }
 } // namespace Multiplayer
@@ -43,6 +43,7 @@
 #include <cmath>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <System/PhysXSystem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
@@ -130,6 +131,12 @@ namespace Multiplayer
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+    AZ_CVAR(bool, sv_entityDeltaCache, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, connections replicating an entity from the same baseline share a single serialized delta each network tick");
+    AZ_CVAR(bool, sv_entityInterestGrid, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, server to client replication windows gather entities from a grid shared by all connections instead of querying the visibility system");
+    AZ_CVAR(float, sv_entityInterestGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The edge length in meters of a cell in the entity interest grid");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
     
@@ -357,6 +364,8 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalReceivedBytesAfterCompression, "TotalReceivedBytesAfterCompression");
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalReceivedBytesBeforeCompression, "TotalReceivedBytesBeforeCompression");
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_EntityUpdatesSent, "EntityUpdatesSent");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_EntityUpdateBytesPerEntity, "EntityUpdateBytesPerEntity");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
     }
@@ -368,6 +377,7 @@ namespace Multiplayer
         m_postSimulateHandler.Disconnect();
 
         m_metricsEvent.RemoveFromQueue();
+        m_botClients.DisconnectBots();
         AZ::Interface<ISessionHandlingClientRequests>::Unregister(this);
         m_consoleCommandHandler.Disconnect();
         const AZ::Name interfaceName = AZ::Name(MpNetworkInterfaceName);
@@ -601,8 +611,26 @@ namespace Multiplayer
         // Metrics calculation, as update calls are threaded.
         UpdatedMetricsConnectionCount();
 
+        if (GetAgentType() == MultiplayerAgentType::ClientServer
+         || GetAgentType() == MultiplayerAgentType::DedicatedServer)
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - UpdateEntityInterestGrid");
+            if (sv_entityInterestGrid)
+            {
+                GetEntityInterestGrid().Update(*m_networkEntityManager.GetNetworkEntityTracker(), sv_entityInterestGridCellSize);
+            }
+            else if (GetEntityInterestGrid().GetUpdateTick() != 0)
+            {
+                // Replication windows fall back to the visibility system while the grid is empty
+                GetEntityInterestGrid().Clear();
+            }
+        }
+
         // Send out the game state update to all connections
+        // Entity state is not modified while connections are updating, so serialized deltas can be shared between connections
+        GetEntityDeltaCache().BeginTick(sv_entityDeltaCache);
         UpdateConnections();
+        GetEntityDeltaCache().EndTick();
 
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
@@ -633,6 +661,9 @@ namespace Multiplayer
             m_networkInterface->GetConnectionSet().VisitConnections(visitor);
         }
 
+        // The network interface is updated before the game tick, so send anything batched this tick now rather than on the next update
+        m_networkInterface->FlushSends();
+
         const auto duration =
             AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startMultiplayerTickTime);
         stats.RecordFrameTime(AZ::TimeUs{ duration.count() });
@@ -661,31 +692,95 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
+        {
+            // Activating pending entities modifies entity state, so it's done for every connection before any updates are sent
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections - PreUpdate");
+
+            auto preUpdateConnections = [](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
+                    connectionData->PreUpdate();
+                }
+            };
+
+            m_networkInterface->GetConnectionSet().VisitConnections(preUpdateConnections);
+        }
+
         if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
                                                   GetAgentType() == MultiplayerAgentType::DedicatedServer))
         {
             // Threaded update calls.
+            // Entity state is read-only until every connection has been updated. Each connection generates its update list, serializes
+            // its entities and assembles its packets independently, and the network interface serializes access to its shared send state.
+            // Stats are recorded into a buffer per connection and replayed once all connections are updated.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
 
-            AZ::JobCompletion jobCompletion;
+            // Sized up front, jobs start while connections are still being visited
+            if (m_deferredStatsRecords.size() < m_networkInterface->GetConnectionSet().GetConnectionCount())
+            {
+                m_deferredStatsRecords.resize(m_networkInterface->GetConnectionSet().GetConnectionCount());
+            }
+            uint32_t connectionIndex = 0;
 
-            auto sendNetworkUpdates = [&jobCompletion](IConnection& connection)
+            AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+            if (useTaskGraph)
             {
-                AZ::Job* job = AZ::CreateJobFunction([&connection]()
+                static const AZ::TaskDescriptor updateConnectionTaskDescriptor{ "MultiplayerSystemComponent::UpdateConnections", "Multiplayer" };
+                AZ::TaskGraph updateConnectionsTG{ "Multiplayer UpdateConnections" };
+
+                auto sendNetworkUpdates = [this, &updateConnectionsTG, &connectionIndex](IConnection& connection)
+                {
+                    if (connection.GetUserData() != nullptr)
                     {
-                        if (connection.GetUserData() != nullptr)
+                        IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
+                        MultiplayerStats::DeferredRecords* statsRecords = &m_deferredStatsRecords[connectionIndex++];
+                        updateConnectionsTG.AddTask(updateConnectionTaskDescriptor, [connectionData, statsRecords]()
+                            {
+                                MultiplayerStats::ScopedDeferredRecords deferStats(*statsRecords);
+                                connectionData->Update();
+                            });
+                    }
+                };
+
+                m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+
+                AZ::TaskGraphEvent updateConnectionsTGEvent{ "Multiplayer UpdateConnections Wait" };
+                updateConnectionsTG.Submit(&updateConnectionsTGEvent);
+                updateConnectionsTGEvent.Wait();
+            }
+            else // job system
+            {
+                AZ::JobCompletion jobCompletion;
+
+                auto sendNetworkUpdates = [this, &jobCompletion, &connectionIndex](IConnection& connection)
+                {
+                    MultiplayerStats::DeferredRecords* statsRecords = &m_deferredStatsRecords[connectionIndex++];
+                    AZ::Job* job = AZ::CreateJobFunction([&connection, statsRecords]()
                         {
-                            IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
-                            connectionData->Update();
-                        }
-                    }, true /*auto delete*/, nullptr);
+                            if (connection.GetUserData() != nullptr)
+                            {
+                                MultiplayerStats::ScopedDeferredRecords deferStats(*statsRecords);
+                                IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
+                                connectionData->Update();
+                            }
+                        }, true /*auto delete*/, nullptr);
 
-                job->SetDependent(&jobCompletion);
-                job->Start();
-            };
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
-            jobCompletion.StartAndWaitForCompletion();
+                m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            MultiplayerStats& stats = GetStats();
+            for (uint32_t index = 0; index < connectionIndex; ++index)
+            {
+                stats.ReplayDeferredRecords(m_deferredStatsRecords[index]);
+            }
         }
         else // On clients (including the Editor) run in a single threaded mode to avoid issues in UI asset loading
         {
@@ -993,6 +1088,7 @@ namespace Multiplayer
             handledAll &= replicationManager.HandleEntityUpdateMessage(connection, packetHeader, updateMessage);
             AZ_Assert(handledAll, "EntityUpdates did not handle all update messages");
         }
+        replicationManager.AcknowledgeBaselineDeltas(packetHeader.GetPacketId());
 
         return handledAll;
     }
@@ -1060,6 +1156,23 @@ namespace Multiplayer
         return true;
     }
 
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityBaselineAcks& packet
+    )
+    {
+        if (connection->GetUserData() == nullptr)
+        {
+            AZLOG_WARN("Missing connection data, likely due to a connection in the process of closing, baseline acks size %u", aznumeric_cast<uint32_t>(packet.GetPacketIds().size()));
+            return true;
+        }
+
+        EntityReplicationManager& replicationManager = reinterpret_cast<IConnectionData*>(connection->GetUserData())->GetReplicationManager();
+        return replicationManager.HandleEntityBaselineAcks(connection, packet.GetPacketIds());
+    }
+
     bool MultiplayerSystemComponent::HandleRequest(
         IConnection* connection,
         [[maybe_unused]] const IPacketHeader& packetHeader,
@@ -1563,6 +1676,18 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Total entity updates sent: %llu", aznumeric_cast<AZ::u64>(stats.m_entityUpdatesSent.m_totalCalls));
+        AZLOG_INFO("Total entity updates sent bytes: %llu", aznumeric_cast<AZ::u64>(stats.m_entityUpdatesSent.m_totalBytes));
+        if (stats.m_entityUpdatesSent.m_totalCalls > 0)
+        {
+            AZLOG_INFO("Average entity update bytes: %.2f",
+                aznumeric_cast<double>(stats.m_entityUpdatesSent.m_totalBytes) / aznumeric_cast<double>(stats.m_entityUpdatesSent.m_totalCalls));
+        }
+        AZLOG_INFO("Network frame time us: p50 %lld, p95 %lld, p99 %lld, max %lld",
+            aznumeric_cast<int64_t>(stats.CalculateFrameTimePercentile(0.5f)),
+            aznumeric_cast<int64_t>(stats.CalculateFrameTimePercentile(0.95f)),
+            aznumeric_cast<int64_t>(stats.CalculateFrameTimePercentile(0.99f)),
+            aznumeric_cast<int64_t>(stats.CalculateFrameTimePercentile(1.0f)));
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -12,6 +12,7 @@
 #include <Multiplayer/Session/ISessionHandlingRequests.h>
 #include <Multiplayer/Session/SessionNotifications.h>
 #include <Editor/MultiplayerEditorConnection.h>
+#include <BotClients/MultiplayerBotClients.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
@@ -101,6 +102,7 @@ namespace Multiplayer
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::RequestReplicatorReset& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityBaselineAcks& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::VersionMismatch& packet);
 
         //! IConnectionListener interface
@@ -199,7 +201,9 @@ namespace Multiplayer
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
         NetworkEntityManager m_networkEntityManager;
+        AZStd::vector<MultiplayerStats::DeferredRecords> m_deferredStatsRecords;
         NetworkTime m_networkTime;
+        MultiplayerBotClients m_botClients;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
+
+namespace Multiplayer
+{
+    void BaselineAckSet::AddAcks(const BaselineAckPacketIds& packetIds)
+    {
+        for (AzNetworking::PacketId packetId : packetIds)
+        {
+            if (!m_ackedPacketIds.insert(packetId).second)
+            {
+                continue;
+            }
+
+            m_ackOrder.push_back(packetId);
+            if (m_ackOrder.size() > MaxTrackedAcks)
+            {
+                m_ackedPacketIds.erase(m_ackOrder.front());
+                m_ackOrder.pop_front();
+            }
+        }
+    }
+
+    bool BaselineAckSet::IsAcked(AzNetworking::PacketId packetId) const
+    {
+        return m_ackedPacketIds.find(packetId) != m_ackedPacketIds.end();
+    }
+
+    void BaselineAckSet::Clear()
+    {
+        m_ackedPacketIds.clear();
+        m_ackOrder.clear();
+    }
+
+    const AzNetworking::SerializerBaseline& SentBaselineHistory::FindNewestAcked(const BaselineAckSet& acks, AzNetworking::PacketId& outPacketId)
+    {
+        static const AzNetworking::SerializerBaseline EmptyBaseline;
+        for (auto iter = m_sentBaselines.begin(); iter != m_sentBaselines.end(); ++iter)
+        {
+            // Once a baseline is found confirmed it stays usable, even after its ack is no longer tracked
+            if (iter->m_acked || acks.IsAcked(iter->m_packetId))
+            {
+                iter->m_acked = true;
+                m_sentBaselines.erase(iter + 1, m_sentBaselines.end());
+                outPacketId = m_sentBaselines.back().m_packetId;
+                return m_sentBaselines.back().m_values;
+            }
+        }
+
+        outPacketId = AzNetworking::InvalidPacketId;
+        return EmptyBaseline;
+    }
+
+    void SentBaselineHistory::AddSent(AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& values, uint32_t maxCount)
+    {
+        while (!m_sentBaselines.empty() && (m_sentBaselines.size() >= maxCount))
+        {
+            m_sentBaselines.pop_back();
+        }
+        m_sentBaselines.push_front(SentBaseline{ packetId, AZStd::move(values) });
+    }
+
+    void SentBaselineHistory::Clear()
+    {
+        m_sentBaselines.clear();
+    }
+
+    const AzNetworking::SerializerBaseline* ReceivedBaselineHistory::Find(AzNetworking::PacketId packetId) const
+    {
+        static const AzNetworking::SerializerBaseline EmptyBaseline;
+        if (packetId == AzNetworking::InvalidPacketId)
+        {
+            return &EmptyBaseline;
+        }
+
+        for (const ReceivedBaseline& receivedBaseline : m_receivedBaselines)
+        {
+            if (receivedBaseline.m_packetId == packetId)
+            {
+                return &receivedBaseline.m_values;
+            }
+        }
+        return nullptr;
+    }
+
+    void ReceivedBaselineHistory::Store(
+        AzNetworking::PacketId baselinePacketId, AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& values, uint32_t maxCount)
+    {
+        if (baselinePacketId != AzNetworking::InvalidPacketId)
+        {
+            while (!m_receivedBaselines.empty() && (baselinePacketId > m_receivedBaselines.front().m_packetId))
+            {
+                m_receivedBaselines.pop_front();
+            }
+        }
+
+        while (!m_receivedBaselines.empty() && (m_receivedBaselines.size() >= maxCount))
+        {
+            m_receivedBaselines.pop_front();
+        }
+        m_receivedBaselines.push_back(ReceivedBaseline{ packetId, AZStd::move(values) });
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityDeltaCache.h>
+
+namespace Multiplayer
+{
+    void EntityDeltaCache::BeginTick(bool enabled)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_active = enabled;
+        if (!enabled)
+        {
+            m_entityDeltas.clear();
+            return;
+        }
+
+        ++m_tick;
+
+        // Entities that weren't replicated last tick have most likely gone out of relevancy or been deleted, release their deltas.
+        // Entities that were replicated keep their allocations around so they can be reused this tick.
+        for (auto iter = m_entityDeltas.begin(); iter != m_entityDeltas.end();)
+        {
+            if (iter->second.m_tick + 1 < m_tick)
+            {
+                iter = m_entityDeltas.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    void EntityDeltaCache::EndTick()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_active = false;
+    }
+
+    bool EntityDeltaCache::IsActive() const
+    {
+        return m_active;
+    }
+
+    bool EntityDeltaCache::TryGet(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData)
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (!m_active)
+        {
+            return false;
+        }
+
+        auto iter = m_entityDeltas.find(netEntityId);
+        if (iter != m_entityDeltas.end() && iter->second.m_tick == m_tick)
+        {
+            if (const CachedDelta* delta = FindDelta(iter->second, record))
+            {
+                outData.CopyValues(delta->m_data.data(), delta->m_data.size());
+                m_hitCount.fetch_add(1, AZStd::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        m_missCount.fetch_add(1, AZStd::memory_order_relaxed);
+        return false;
+    }
+
+    void EntityDeltaCache::Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (!m_active)
+        {
+            return;
+        }
+
+        EntityDeltas& entityDeltas = m_entityDeltas[netEntityId];
+        if (entityDeltas.m_tick != m_tick)
+        {
+            entityDeltas.m_tick = m_tick;
+            entityDeltas.m_deltaCount = 0;
+        }
+
+        // Another connection update thread may have stored the same delta while we were serializing
+        if ((entityDeltas.m_deltaCount >= MaxDeltasPerEntity) || (FindDelta(entityDeltas, record) != nullptr))
+        {
+            return;
+        }
+
+        if (entityDeltas.m_deltaCount == entityDeltas.m_deltas.size())
+        {
+            entityDeltas.m_deltas.emplace_back();
+        }
+
+        CachedDelta& delta = entityDeltas.m_deltas[entityDeltas.m_deltaCount++];
+        delta.m_record = record;
+        delta.m_data.assign(data.GetBuffer(), data.GetBufferEnd());
+    }
+
+    uint64_t EntityDeltaCache::GetHitCount() const
+    {
+        return m_hitCount.load(AZStd::memory_order_relaxed);
+    }
+
+    uint64_t EntityDeltaCache::GetMissCount() const
+    {
+        return m_missCount.load(AZStd::memory_order_relaxed);
+    }
+
+    bool EntityDeltaCache::RecordsMatch(const ReplicationRecord& lhs, const ReplicationRecord& rhs)
+    {
+        // Consumed bit counters and the sent packet id don't contribute to the serialized delta, so they are ignored
+        return (lhs.GetRemoteNetworkRole() == rhs.GetRemoteNetworkRole())
+            && (lhs.m_authorityToClient == rhs.m_authorityToClient)
+            && (lhs.m_authorityToServer == rhs.m_authorityToServer)
+            && (lhs.m_authorityToAutonomous == rhs.m_authorityToAutonomous)
+            && (lhs.m_autonomousToAuthority == rhs.m_autonomousToAuthority);
+    }
+
+    const EntityDeltaCache::CachedDelta* EntityDeltaCache::FindDelta(const EntityDeltas& entityDeltas, const ReplicationRecord& record) const
+    {
+        for (uint32_t i = 0; i < entityDeltas.m_deltaCount; ++i)
+        {
+            if (RecordsMatch(entityDeltas.m_deltas[i].m_record, record))
+            {
+                return &entityDeltas.m_deltas[i];
+            }
+        }
+        return nullptr;
+    }
+}
@@ -18,11 +18,13 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/BaselineDeltaSerializer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -35,6 +37,14 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(uint32_t, sv_ReplicationBandwidthBytesPerSecond, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Bandwidth budget in bytes per second for entity updates to each client, 0 disables the budget. Autonomous entity updates are always sent.");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationBandwidthBurstMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many milliseconds worth of unused bandwidth budget a client connection can save up for bursts.");
+    AZ_CVAR(float, sv_ReplicationPriorityDistance, 20.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Entities closer than this distance to a client accumulate replication priority at the full rate of their type.");
+    AZ_CVAR(float, sv_ReplicationMinDistancePriority, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The lowest fraction of the full replication priority rate that far away entities accumulate priority at.");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -121,6 +131,12 @@ namespace Multiplayer
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
+        // Only client connections are bandwidth limited, server to server traffic needs to stay consistent
+        const uint32_t bytesPerSecond = (m_updateMode == Mode::LocalServerToRemoteClient) ? static_cast<uint32_t>(sv_ReplicationBandwidthBytesPerSecond) : 0;
+        m_replicationScheduler.SetReferenceDistance(sv_ReplicationPriorityDistance);
+        m_replicationScheduler.SetMinDistanceFactor(sv_ReplicationMinDistancePriority);
+        m_replicationScheduler.BeginSend(m_frameTimeMs, bytesPerSecond, sv_ReplicationBandwidthBurstMs);
+
         {
             EntityReplicatorList toSendList = GenerateEntityUpdateList();
 
@@ -158,6 +174,7 @@ namespace Multiplayer
         m_orphanedEntityRpcs.Update();
 
         SendEntityResets();
+        SendBaselineAcks();
 
         AZLOG
         (
@@ -184,7 +201,10 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
+        // Autonomous entities are always sent, proxies are sent in order of their accumulated priority
+        EntityReplicationScheduler::ProxyCandidateList proxyCandidates;
+        int64_t estimatedSendSize = 0;
+
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -221,11 +241,13 @@ namespace Multiplayer
                             replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous)
                         {
                             toSendList.push_back(replicator);
+                            estimatedSendSize += m_replicationScheduler.GetEstimatedUpdateSize(entityId);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            NetBindComponent* netBindComponent = replicator->GetNetBindComponent();
+                            const float typePriority = (netBindComponent != nullptr) ? netBindComponent->GetReplicationPriority() : 1.0f;
+                            proxyCandidates.push_back({ entityId, m_replicationScheduler.AccumulatePriority(entityId, typePriority), replicator });
                         }
                     }
                 }
@@ -242,6 +264,14 @@ namespace Multiplayer
             }
         }
 
+        // Fill the remaining budget with the highest priority proxies, anything left over keeps accumulating priority for the next send
+        const uint32_t proxySendCount = m_replicationScheduler.SelectProxies(
+            proxyCandidates, estimatedSendSize, m_replicationWindow->GetMaxProxyEntityReplicatorSendCount());
+        for (uint32_t index = 0; index < proxySendCount; ++index)
+        {
+            toSendList.push_back(proxyCandidates[index].m_replicator);
+        }
+
         return toSendList;
     }
 
@@ -271,6 +301,8 @@ namespace Multiplayer
             entityUpdates.push_back(updateMessage);
             replicatorUpdatedList.push_back(replicator);
             replicatorList.pop_front();
+            m_replicationScheduler.OnEntitySent(replicator->GetEntityHandle().GetNetEntityId(), nextMessageSize);
+            GetMultiplayer()->GetStats().RecordEntityUpdateSent(nextMessageSize);
 
             if (largeEntityDetected)
             {
@@ -357,6 +389,15 @@ namespace Multiplayer
         m_replicatorsPendingReset.clear();
     }
 
+    void EntityReplicationManager::SendBaselineAcks()
+    {
+        if (m_replicationWindow && !m_baselineAcksPending.empty())
+        {
+            m_replicationWindow->SendBaselineAcks(m_baselineAcksPending);
+        }
+        m_baselineAcksPending.clear();
+    }
+
     void EntityReplicationManager::Clear(bool forMigration)
     {
         if (forMigration)
@@ -377,6 +418,9 @@ namespace Multiplayer
         }
 
         m_entityReplicatorMap.clear();
+        m_replicationScheduler.Clear();
+        m_baselineAcksPending.clear();
+        m_baselineAcks.Clear();
     }
 
     bool EntityReplicationManager::SetEntityRebasing(NetworkEntityHandle& entityHandle)
@@ -906,6 +950,8 @@ namespace Multiplayer
         case UpdateValidationResult::HandleMessage:
             break;
         case UpdateValidationResult::DropMessage:
+            // The transport acks this packet even though we never store its baseline
+            m_rejectedBaselineDelta |= updateMessage.GetIsBaselineDelta();
             return true;
         case UpdateValidationResult::DropMessageAndDisconnect:
             return false;
@@ -931,6 +977,7 @@ namespace Multiplayer
                 // If a client migrates and we receive a property update message out-of-order, this would re-create a replicator which would be bad
                 AZLOG_ERROR("Unable to process NetworkEntityUpdateMessage without a prefabEntityId, our local EntityReplicator is not set up or is configured incorrectly");
                 m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                m_rejectedBaselineDelta |= updateMessage.GetIsBaselineDelta();
                 return true;
             }
 
@@ -940,8 +987,48 @@ namespace Multiplayer
 
         bool handled = true;
 
+        if (updateMessage.GetIsBaselineDelta())
+        {
+            // Baseline deltas can only be decoded against the property values we received in the packet they reference
+            const AzNetworking::SerializerBaseline* baseline = (entityReplicator != nullptr)
+                ? entityReplicator->FindReceivedBaseline(updateMessage.GetBaselinePacketId())
+                : nullptr;
+            if (baseline == nullptr)
+            {
+                AZLOG_WARN("Baseline %u for entity %llu is not available, requesting a reset",
+                    aznumeric_cast<uint32_t>(updateMessage.GetBaselinePacketId()), aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()));
+                m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                m_rejectedBaselineDelta = true;
+                return true;
+            }
+
+            AzNetworking::SerializerBaseline receivedBaseline;
+            AzNetworking::BaselineDeltaSerializerApply applySerializer(
+                *baseline, updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()), receivedBaseline);
+            handled = HandlePropertyChangeMessage(
+                invokingConnection,
+                entityReplicator,
+                packetHeader.GetPacketId(),
+                updateMessage.GetEntityId(),
+                updateMessage.GetNetworkRole(),
+                applySerializer,
+                prefabEntityId,
+                updateMessage.GetIsDelete()) && applySerializer.IsComplete();
+            AZ_Assert(handled, "Failed to handle baseline delta NetworkEntityUpdateMessage message");
+
+            entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
+            if (handled && (entityReplicator != nullptr))
+            {
+                entityReplicator->StoreReceivedBaseline(updateMessage.GetBaselinePacketId(), packetHeader.GetPacketId(), AZStd::move(receivedBaseline));
+                m_storedBaselineDelta = true;
+            }
+            else
+            {
+                m_rejectedBaselineDelta = true;
+            }
+        }
         // This may implicitly create a replicator for us
-        if (updateMessage.GetData()->GetSize() != 0)
+        else if (updateMessage.GetData()->GetSize() != 0)
         {
             handled = HandlePropertyChangeMessage(
                           invokingConnection,
@@ -1008,6 +1095,25 @@ namespace Multiplayer
         return true;
     }
 
+    bool EntityReplicationManager::HandleEntityBaselineAcks(
+        [[maybe_unused]] AzNetworking::IConnection* invokingConnection, const BaselineAckPacketIds& packetIds)
+    {
+        m_baselineAcks.AddAcks(packetIds);
+        return true;
+    }
+
+    void EntityReplicationManager::AcknowledgeBaselineDeltas(AzNetworking::PacketId packetId)
+    {
+        // A single baseline delta we couldn't store means the remote endpoint can't use this packet as a baseline for any entity,
+        // entities that did store their baseline keep being encoded against an older confirmed baseline which they still have
+        if (m_storedBaselineDelta && !m_rejectedBaselineDelta)
+        {
+            m_baselineAcksPending.push_back(packetId);
+        }
+        m_storedBaselineDelta = false;
+        m_rejectedBaselineDelta = false;
+    }
+
     bool EntityReplicationManager::DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator)
     {
         if (entityReplicator == nullptr)
@@ -1163,7 +1269,10 @@ namespace Multiplayer
             {
                 if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
                 {
-                    AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                    if (AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole) != nullptr)
+                    {
+                        m_replicationScheduler.SetWindowPriority(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
+                    }
                     ++newWindowIter;
                 }
                 else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
@@ -1184,6 +1293,7 @@ namespace Multiplayer
                         currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                     }
                     currReplicator->ClearPendingRemoval();
+                    m_replicationScheduler.SetWindowPriority(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
                     ++newWindowIter;
                     ++currWindowIter;
                 }
@@ -1192,7 +1302,10 @@ namespace Multiplayer
             // Do remaining adds
             while (newWindowIter != newWindow.end())
             {
-                AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                if (AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole) != nullptr)
+                {
+                    m_replicationScheduler.SetWindowPriority(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
+                }
                 ++newWindowIter;
             }
 
@@ -1448,6 +1561,7 @@ namespace Multiplayer
                         static_cast<AZ::u64>(replicator->GetEntityHandle().GetNetEntityId()),
                         GetRemoteHostId().GetString().c_str());
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
+                    m_replicationScheduler.RemoveEntity(*iter);
                     m_entityReplicatorMap.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
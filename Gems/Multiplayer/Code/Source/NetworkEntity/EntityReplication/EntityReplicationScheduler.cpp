@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    void EntityReplicationScheduler::BeginSend(AZ::TimeMs currentTimeMs, uint32_t bytesPerSecond, AZ::TimeMs maxBurstMs)
+    {
+        const int64_t burstBytes = static_cast<int64_t>(bytesPerSecond) * static_cast<int64_t>(maxBurstMs) / 1000;
+        if (!m_hasSent || (bytesPerSecond != m_bytesPerSecond))
+        {
+            // Start out with a full burst so the first ticks of a connection aren't starved
+            m_availableBytes = burstBytes;
+        }
+        else
+        {
+            const int64_t elapsedMs = AZStd::max<int64_t>(static_cast<int64_t>(currentTimeMs - m_lastSendTimeMs), 0);
+            m_availableBytes += static_cast<int64_t>(bytesPerSecond) * elapsedMs / 1000;
+            m_availableBytes = AZStd::min(m_availableBytes, burstBytes);
+        }
+
+        m_bytesPerSecond = bytesPerSecond;
+        m_burstBytes = burstBytes;
+        m_lastSendTimeMs = currentTimeMs;
+        m_hasSent = true;
+    }
+
+    bool EntityReplicationScheduler::IsBudgetLimited() const
+    {
+        return m_bytesPerSecond > 0;
+    }
+
+    int64_t EntityReplicationScheduler::GetAvailableBytes() const
+    {
+        return m_availableBytes;
+    }
+
+    void EntityReplicationScheduler::SetWindowPriority(NetEntityId netEntityId, float windowPriority)
+    {
+        m_entityStates[netEntityId].m_windowPriority = windowPriority;
+    }
+
+    float EntityReplicationScheduler::AccumulatePriority(NetEntityId netEntityId, float typePriority)
+    {
+        EntityState& entityState = m_entityStates[netEntityId];
+        entityState.m_accumulatedPriority += typePriority * CalculateDistanceFactor(entityState.m_windowPriority);
+        return entityState.m_accumulatedPriority;
+    }
+
+    uint32_t EntityReplicationScheduler::SelectProxies(ProxyCandidateList& candidates, int64_t reservedBytes, uint32_t maxSendCount) const
+    {
+        AZStd::sort(candidates.begin(), candidates.end(),
+            [](const ProxyCandidate& lhs, const ProxyCandidate& rhs)
+            {
+                return lhs.m_priority > rhs.m_priority;
+            });
+
+        uint32_t selectedCount = 0;
+        int64_t estimatedSendSize = reservedBytes;
+        while ((selectedCount < candidates.size()) && (selectedCount < maxSendCount))
+        {
+            const uint32_t estimatedSize = GetEstimatedUpdateSize(candidates[selectedCount].m_netEntityId);
+            const bool fitsBudget = !IsBudgetLimited() || (estimatedSendSize + estimatedSize <= m_availableBytes);
+            if (!fitsBudget && ((selectedCount > 0) || (m_availableBytes < m_burstBytes)))
+            {
+                break;
+            }
+
+            estimatedSendSize += estimatedSize;
+            ++selectedCount;
+        }
+        return selectedCount;
+    }
+
+    uint32_t EntityReplicationScheduler::GetEstimatedUpdateSize(NetEntityId netEntityId) const
+    {
+        auto iter = m_entityStates.find(netEntityId);
+        return (iter != m_entityStates.end()) ? iter->second.m_estimatedUpdateSize : DefaultEstimatedUpdateSize;
+    }
+
+    void EntityReplicationScheduler::OnEntitySent(NetEntityId netEntityId, uint32_t updateSize)
+    {
+        EntityState& entityState = m_entityStates[netEntityId];
+        entityState.m_accumulatedPriority = 0.0f;
+        entityState.m_estimatedUpdateSize = updateSize;
+        if (IsBudgetLimited())
+        {
+            m_availableBytes -= updateSize;
+        }
+    }
+
+    void EntityReplicationScheduler::RemoveEntity(NetEntityId netEntityId)
+    {
+        m_entityStates.erase(netEntityId);
+    }
+
+    void EntityReplicationScheduler::Clear()
+    {
+        m_entityStates.clear();
+        m_availableBytes = 0;
+        m_burstBytes = 0;
+        m_bytesPerSecond = 0;
+        m_hasSent = false;
+    }
+
+    void EntityReplicationScheduler::SetReferenceDistance(float referenceDistance)
+    {
+        m_referenceDistanceSq = referenceDistance * referenceDistance;
+    }
+
+    void EntityReplicationScheduler::SetMinDistanceFactor(float minDistanceFactor)
+    {
+        m_minDistanceFactor = AZStd::clamp(minDistanceFactor, 0.0f, 1.0f);
+    }
+
+    float EntityReplicationScheduler::CalculateDistanceFactor(float windowPriority) const
+    {
+        if (windowPriority <= 0.0f)
+        {
+            // The window doesn't know the distance of this entity, don't penalize it
+            return 1.0f;
+        }
+
+        // Window priorities are inverse squared distances, so this is (referenceDistance / distance)^2
+        return AZStd::clamp(windowPriority * m_referenceDistanceSq, m_minDistanceFactor, 1.0f);
+    }
+}
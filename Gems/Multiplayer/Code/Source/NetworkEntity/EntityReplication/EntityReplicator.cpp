@@ -147,7 +147,8 @@ namespace Multiplayer
                 (
                     GetRemoteNetworkRole(),
                     !RemoteManagerOwnsEntityLifetime() ? PropertyPublisher::OwnsLifetime::True : PropertyPublisher::OwnsLifetime::False,
-                    *m_connection
+                    *m_connection,
+                    m_replicationManager.m_baselineAcks
                 );
             m_onEntityDirtiedHandler.Disconnect();
             m_netBindComponent->AddEntityDirtiedEventHandler(m_onEntityDirtiedHandler);
@@ -597,6 +598,21 @@ namespace Multiplayer
         return m_propertySubscriber ? m_propertySubscriber->GetLastReceivedPacketId() : AzNetworking::InvalidPacketId;
     }
 
+    const AzNetworking::SerializerBaseline* EntityReplicator::FindReceivedBaseline(AzNetworking::PacketId packetId) const
+    {
+        return m_propertySubscriber ? m_propertySubscriber->FindReceivedBaseline(packetId) : nullptr;
+    }
+
+    void EntityReplicator::StoreReceivedBaseline(
+        AzNetworking::PacketId baselinePacketId, AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& baseline)
+    {
+        AZ_Assert(m_propertySubscriber, "Expected to have a property subscriber.");
+        if (m_propertySubscriber)
+        {
+            m_propertySubscriber->StoreReceivedBaseline(baselinePacketId, packetId, AZStd::move(baseline));
+        }
+    }
+
     bool EntityReplicator::HandlePropertyChangeMessage(
         AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges)
     {
@@ -15,10 +15,16 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_EntityReplicatorBaselineDeltas, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates are encoded against the most recent update the remote endpoint confirmed instead of sending raw changed properties");
+    AZ_CVAR(float, net_EntityReplicatorBaselineFloatQuantum, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Step that float deltas in baseline deltas are quantized to, 0 encodes floats losslessly");
 
-    PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
+    PropertyPublisher::PropertyPublisher(
+        NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection, const BaselineAckSet& baselineAcks)
         : m_ownsLifetime(ownsLifetime)
         , m_connection(connection)
+        , m_baselineAcks(baselineAcks)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
     {
@@ -123,6 +129,7 @@ namespace Multiplayer
         // On initial entity replication or after too many unacknowledged updates,
         // create a change record that contains all the serialized fields for the entity.
         m_sentRecords.clear();
+        m_sentBaselines.Clear();
         netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         m_sentRecords.push_front(m_pendingRecord);
     }
@@ -133,6 +140,7 @@ namespace Multiplayer
 
         // This is basically an Add record, but we don't want to send back predictable values
         m_sentRecords.clear();
+        m_sentBaselines.Clear();
         netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         // Don't send predictable properties back to the Autonomous unless we correct them
         if (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
@@ -203,6 +211,42 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeBaselineDelta(NetBindComponent* netBindComponent, NetworkEntityUpdateMessage& updateMessage)
+    {
+        AZ_Assert(netBindComponent, "NetBindComponent is nullptr");
+
+        // Find the most recent baseline the remote endpoint confirmed it stored. A transport ack isn't enough, the receiver may have
+        // dropped the update as stale or failed to decode it.
+        AzNetworking::PacketId baselinePacketId = AzNetworking::InvalidPacketId;
+        const AzNetworking::SerializerBaseline& ackedBaseline = m_sentBaselines.FindNewestAcked(m_baselineAcks, baselinePacketId);
+
+        // Baseline deltas carry every replicated property, unchanged properties only cost a run length
+        ReplicationRecord baselineRecord(m_pendingRecord.GetRemoteNetworkRole());
+        netBindComponent->FillTotalReplicationRecord(baselineRecord);
+        if (baselineRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
+        {
+            baselineRecord.Subtract(netBindComponent->GetPredictableRecord());
+        }
+
+        AzNetworking::BaselineDeltaSerializerCreate createSerializer(ackedBaseline, m_pendingBaseline, net_EntityReplicatorBaselineFloatQuantum);
+        baselineRecord.Serialize(createSerializer);
+        netBindComponent->SerializeStateDeltaMessage(baselineRecord, createSerializer);
+
+        AzNetworking::PacketEncodingBuffer& data = updateMessage.ModifyData();
+        uint32_t deltaSize = 0;
+        m_hasPendingBaseline = createSerializer.IsValid()
+            && createSerializer.WriteDelta(data.GetBuffer(), static_cast<uint32_t>(data.GetCapacity()), deltaSize);
+        data.Resize(deltaSize);
+        updateMessage.SetBaselinePacketId(baselinePacketId);
+
+        if (!m_hasPendingBaseline)
+        {
+            AZLOG_ERROR("EntityReplicator: Baseline delta serialization failed");
+            AZ_Assert(false, "EntityReplicator: Baseline delta serialization failed");
+        }
+        return m_hasPendingBaseline;
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
         // Fill in the packet id for the last sent update
@@ -214,9 +258,17 @@ namespace Multiplayer
         {
             // The packet failed to be generated, pop off the failed sent record
             m_sentRecords.pop_front();
+            m_hasPendingBaseline = false;
             return;
         }
         m_pendingRecord.Clear();
+
+        if (m_hasPendingBaseline)
+        {
+            m_sentBaselines.AddSent(packetId, AZStd::move(m_pendingBaseline), net_EntityReplicatorRecordsMax);
+            m_pendingBaseline.Clear();
+            m_hasPendingBaseline = false;
+        }
     }
 
     void PropertyPublisher::FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId)
@@ -372,11 +424,31 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        // Baseline deltas depend on what this connection has acknowledged, so they can't be shared with other connections.
+        // Deletes may be cached and sent much later, so they always use a regular delta.
+        if (net_EntityReplicatorBaselineDeltas && IsRemoteReplicatorEstablished() && !isDeleted)
+        {
+            SerializeBaselineDelta(netBindComponent, updateMessage);
+            return updateMessage;
+        }
+
+        // Other connections replicating this entity from the same baseline may have already serialized this delta during this tick
+        EntityDeltaCache& deltaCache = GetMultiplayer()->GetEntityDeltaCache();
+        if (deltaCache.TryGet(netBindComponent->GetNetEntityId(), m_pendingRecord, updateMessage.ModifyData()))
+        {
+            return updateMessage;
+        }
+
         InputSerializer inputSerializer(
             updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
+        const bool serialized = SerializeEntityRecord(inputSerializer, netBindComponent);
         updateMessage.ModifyData().Resize(inputSerializer.GetSize());
 
+        if (serialized && deltaCache.IsActive())
+        {
+            deltaCache.Store(netBindComponent->GetNetEntityId(), m_pendingRecord, updateMessage.ModifyData());
+        }
+
         return updateMessage;
     }
 
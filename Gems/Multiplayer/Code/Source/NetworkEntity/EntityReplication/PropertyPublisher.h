@@ -10,6 +10,7 @@
 
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <AzCore/std/containers/ring_buffer.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 
 namespace AzNetworking
@@ -26,6 +27,8 @@ namespace Multiplayer
     //! changes for any updates or deletes that occur before previous records have been acknowledged.
     //! This also tracks whether or not it has *ever* received an acknowledgement and stores it in IsRemoteReplicatorEstablished
     //! as a way to know if the receiver has created the replicated entity.
+    //! When baseline deltas are enabled, updates to an established remote replicator encode every replicated property against the
+    //! values of the most recent update the receiver confirmed it stored, instead of sending the raw values of the changed properties.
     class PropertyPublisher
     {
     public:
@@ -35,7 +38,8 @@ namespace Multiplayer
             False,
         };
 
-        PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection);
+        PropertyPublisher(
+            NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection, const BaselineAckSet& baselineAcks);
 
         //! Set the publishing state to "rebasing". The next record sent will be a rebase record.
         //! Rebase records send the full replication state for Autonomous entities minus the predictable properties.
@@ -117,6 +121,9 @@ namespace Multiplayer
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
 
+        //! Phase 2, alternative serialization that encodes all replicated properties against the most recent confirmed baseline
+        bool SerializeBaselineDelta(NetBindComponent* netBindComponent, NetworkEntityUpdateMessage& updateMessage);
+
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
@@ -129,12 +136,20 @@ namespace Multiplayer
         OwnsLifetime m_ownsLifetime = OwnsLifetime::False;
         //! Reference to the connection, used for checking for packet acknowledgements.
         AzNetworking::IConnection& m_connection;
+        //! Reference to the baseline acks of the connection, used to pick the baseline for baseline deltas.
+        const BaselineAckSet& m_baselineAcks;
 
         //! Aggregate changes that we need to serialize (currentRecord + outstanding m_sentRecords)
         ReplicationRecord m_pendingRecord;
 
         //! List of sent records
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
+
+        //! Property values of sent baseline deltas
+        SentBaselineHistory m_sentBaselines;
+        //! Property values of the baseline delta generated for the pending record, stored in m_sentBaselines once it has been sent
+        AzNetworking::SerializerBaseline m_pendingBaseline;
+        bool m_hasPendingBaseline = false;
         //! List of sent delete packets, tracked separately as a way to look for acknowledged deletes.
         //! (This could potentially get merged into m_sentRecords as an optimization)
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
@@ -9,9 +9,12 @@
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace Multiplayer
 {
+    AZ_CVAR_EXTERNED(uint32_t, net_EntityReplicatorRecordsMax);
+
     PropertySubscriber::PropertySubscriber(EntityReplicationManager& replicationManager, NetBindComponent* netBindComponent)
         : m_replicationManager(replicationManager)
         , m_netBindComponent(netBindComponent)
@@ -50,4 +53,14 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    const AzNetworking::SerializerBaseline* PropertySubscriber::FindReceivedBaseline(AzNetworking::PacketId packetId) const
+    {
+        return m_receivedBaselines.Find(packetId);
+    }
+
+    void PropertySubscriber::StoreReceivedBaseline(AzNetworking::PacketId baselinePacketId, AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& baseline)
+    {
+        m_receivedBaselines.Store(baselinePacketId, packetId, AZStd::move(baseline), net_EntityReplicatorRecordsMax);
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
 
 namespace AzNetworking
 {
@@ -36,6 +37,12 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Returns the property values received in the provided packet, or nullptr if they are no longer available.
+        //! InvalidPacketId refers to the empty baseline used by the first baseline delta of an entity.
+        const AzNetworking::SerializerBaseline* FindReceivedBaseline(AzNetworking::PacketId packetId) const;
+        //! Stores the property values received in a baseline delta, baselines older than the one the delta was encoded against are discarded.
+        void StoreReceivedBaseline(AzNetworking::PacketId baselinePacketId, AzNetworking::PacketId packetId, AzNetworking::SerializerBaseline&& baseline);
+
     private:
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
@@ -43,5 +50,8 @@ namespace Multiplayer
         // The last packet to have been received about this entity
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_markForRemovalTimeMs = AZ::Time::ZeroTimeMs;
+
+        //! Property values of received baseline deltas
+        ReceivedBaselineHistory m_receivedBaselines;
     };
 }
@@ -17,7 +17,9 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isBaselineDelta(rhs.m_isBaselineDelta)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_baselinePacketId(rhs.m_baselinePacketId)
         , m_data(AZStd::move(rhs.m_data))
     {
         ;
@@ -29,7 +31,9 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isBaselineDelta(rhs.m_isBaselineDelta)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_baselinePacketId(rhs.m_baselinePacketId)
     {
         if (rhs.m_data != nullptr)
         {
@@ -54,7 +58,9 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isBaselineDelta = rhs.m_isBaselineDelta;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_baselinePacketId = rhs.m_baselinePacketId;
         m_data = AZStd::move(rhs.m_data);
         return *this;
     }
@@ -66,7 +72,9 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isBaselineDelta = rhs.m_isBaselineDelta;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_baselinePacketId = rhs.m_baselinePacketId;
         if (rhs.m_data != nullptr)
         {
             m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
@@ -83,7 +91,9 @@ namespace Multiplayer
              && (m_isDelete == rhs.m_isDelete)
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
-             && (m_prefabEntityId == rhs.m_prefabEntityId));
+             && (m_isBaselineDelta == rhs.m_isBaselineDelta)
+             && (m_prefabEntityId == rhs.m_prefabEntityId)
+             && (m_baselinePacketId == rhs.m_baselinePacketId));
     }
 
     bool NetworkEntityUpdateMessage::operator !=(const NetworkEntityUpdateMessage& rhs) const
@@ -98,18 +108,20 @@ namespace Multiplayer
         static const uint32_t sizeOfFlags = 1;
         static const uint32_t sizeOfEntityId = sizeof(NetEntityId);
         static const uint32_t sizeOfSliceId = 6;
+        static const uint32_t sizeOfBaselinePacketId = sizeof(AzNetworking::PacketId);
 
         // 2-byte size header + the actual blob payload itself
         const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0);
+        const uint32_t sizeOfBaseline = m_isBaselineDelta ? sizeOfBaselinePacketId : 0;
 
         if (m_hasValidPrefabId)
         {
             // sliceId is transmitted
-            return sizeOfFlags + sizeOfEntityId + sizeOfSliceId + sizeOfBlob;
+            return sizeOfFlags + sizeOfEntityId + sizeOfSliceId + sizeOfBaseline + sizeOfBlob;
         }
 
         // No sliceId, remote replicator already exists so we don't need to know what type of entity this is
-        return sizeOfFlags + sizeOfEntityId + sizeOfBlob;
+        return sizeOfFlags + sizeOfEntityId + sizeOfBaseline + sizeOfBlob;
     }
 
     NetEntityRole NetworkEntityUpdateMessage::GetNetworkRole() const
@@ -148,6 +160,22 @@ namespace Multiplayer
         return m_prefabEntityId;
     }
 
+    void NetworkEntityUpdateMessage::SetBaselinePacketId(AzNetworking::PacketId baselinePacketId)
+    {
+        m_isBaselineDelta = true;
+        m_baselinePacketId = baselinePacketId;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsBaselineDelta() const
+    {
+        return m_isBaselineDelta;
+    }
+
+    AzNetworking::PacketId NetworkEntityUpdateMessage::GetBaselinePacketId() const
+    {
+        return m_baselinePacketId;
+    }
+
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
         if (m_data == nullptr)
@@ -177,13 +205,15 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
 
         // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
-        uint8_t networkTypeAndFlags = (m_isDelete ? 0x40 : 0x00)
+        uint8_t networkTypeAndFlags = (m_isBaselineDelta ? 0x80 : 0x00)
+                                    | (m_isDelete ? 0x40 : 0x00)
                                     | (m_wasMigrated ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
         {
+            m_isBaselineDelta = (networkTypeAndFlags & 0x80) == 0x80;
             m_isDelete = (networkTypeAndFlags & 0x40) == 0x40;
             m_wasMigrated = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
@@ -201,6 +231,12 @@ namespace Multiplayer
             serializer.Serialize(m_prefabEntityId, "PrefabEntityId");
         }
 
+        if (m_isBaselineDelta)
+        {
+            // Baseline deltas can only be decoded against the values of the update they were encoded against
+            serializer.Serialize(m_baselinePacketId, "BaselinePacketId");
+        }
+
         // m_data should never be nullptr
         if (m_data == nullptr)
         {
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    RewindVolumeRange RewindHistoryStore::AllocateVolumes(uint32_t count)
+    {
+        if (count == 0)
+        {
+            return RewindVolumeRange();
+        }
+
+        for (auto iter = m_freeRanges.begin(); iter != m_freeRanges.end(); ++iter)
+        {
+            if (iter->m_count >= count)
+            {
+                const RewindVolumeRange range{ iter->m_start, count };
+                iter->m_start += count;
+                iter->m_count -= count;
+                if (iter->m_count == 0)
+                {
+                    m_freeRanges.erase(iter);
+                }
+                m_allocatedCount += count;
+                return range;
+            }
+        }
+
+        // No free range is large enough, grow the store, reusing a free range at the end of the store if there is one
+        uint32_t start = m_capacity;
+        if (!m_freeRanges.empty() && (m_freeRanges.back().m_start + m_freeRanges.back().m_count == m_capacity))
+        {
+            start = m_freeRanges.back().m_start;
+            m_freeRanges.pop_back();
+        }
+
+        const uint32_t capacity = start + count;
+        const uint32_t reserveCapacity = AZStd::max(capacity, m_capacity * 2);
+        for (FrameColumn& column : m_columns)
+        {
+            column.m_translations.reserve(reserveCapacity);
+            column.m_rotations.reserve(reserveCapacity);
+            column.m_translations.resize(capacity, AZ::Vector3::CreateZero());
+            column.m_rotations.resize(capacity, AZ::Quaternion::CreateIdentity());
+        }
+        m_lastWrittenFrameIds.reserve(reserveCapacity);
+        m_lastWrittenFrameIds.resize(capacity, InvalidHostFrameId);
+        m_capacity = capacity;
+
+        m_allocatedCount += count;
+        return RewindVolumeRange{ start, count };
+    }
+
+    void RewindHistoryStore::FreeVolumes(RewindVolumeRange& range)
+    {
+        if (range.m_count == 0)
+        {
+            return;
+        }
+
+        AZ_Assert(range.m_start + range.m_count <= m_capacity, "Freeing a rewind volume range that was not allocated from this store");
+        AZStd::fill(m_lastWrittenFrameIds.begin() + range.m_start, m_lastWrittenFrameIds.begin() + range.m_start + range.m_count, InvalidHostFrameId);
+
+        auto insertIter = AZStd::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), range,
+            [](const RewindVolumeRange& lhs, const RewindVolumeRange& rhs) { return lhs.m_start < rhs.m_start; });
+        insertIter = m_freeRanges.insert(insertIter, range);
+
+        // Coalesce with neighbouring free ranges so large allocations can reuse the space
+        auto nextIter = insertIter + 1;
+        if ((nextIter != m_freeRanges.end()) && (insertIter->m_start + insertIter->m_count == nextIter->m_start))
+        {
+            insertIter->m_count += nextIter->m_count;
+            m_freeRanges.erase(nextIter);
+        }
+        if (insertIter != m_freeRanges.begin())
+        {
+            auto prevIter = insertIter - 1;
+            if (prevIter->m_start + prevIter->m_count == insertIter->m_start)
+            {
+                prevIter->m_count += insertIter->m_count;
+                m_freeRanges.erase(insertIter);
+            }
+        }
+
+        m_allocatedCount -= range.m_count;
+        range = RewindVolumeRange();
+    }
+
+    void RewindHistoryStore::SetTransform(const RewindVolumeRange& range, uint32_t volumeIndex, HostFrameId frameId, const AZ::Transform& transform)
+    {
+        AZ_Assert(volumeIndex < range.m_count, "Rewind volume index %u is out of range", volumeIndex);
+        const uint32_t volume = range.m_start + volumeIndex;
+        const AZ::Vector3 translation = transform.GetTranslation();
+        const AZ::Quaternion rotation = transform.GetRotation();
+
+        HostFrameId& lastWrittenFrameId = m_lastWrittenFrameIds[volume];
+        if ((lastWrittenFrameId == InvalidHostFrameId) || (frameId > lastWrittenFrameId && static_cast<uint32_t>(frameId - lastWrittenFrameId) >= RewindHistorySize))
+        {
+            // First write, or a large enough time delta that we'll just flush the whole history with the new value
+            for (FrameColumn& column : m_columns)
+            {
+                column.m_translations[volume] = translation;
+                column.m_rotations[volume] = rotation;
+            }
+            lastWrittenFrameId = frameId;
+            return;
+        }
+
+        if (frameId < lastWrittenFrameId)
+        {
+            // Don't try and set values older than the current head value
+            return;
+        }
+
+        // Repeat the previous value for any frames this volume wasn't written for
+        const uint32_t lastColumnIndex = static_cast<uint32_t>(lastWrittenFrameId) % RewindHistorySize;
+        for (HostFrameId skippedFrameId = lastWrittenFrameId + HostFrameId{ 1 }; skippedFrameId < frameId; ++skippedFrameId)
+        {
+            FrameColumn& column = m_columns[static_cast<uint32_t>(skippedFrameId) % RewindHistorySize];
+            column.m_translations[volume] = m_columns[lastColumnIndex].m_translations[volume];
+            column.m_rotations[volume] = m_columns[lastColumnIndex].m_rotations[volume];
+        }
+
+        FrameColumn& column = m_columns[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        column.m_translations[volume] = translation;
+        column.m_rotations[volume] = rotation;
+        lastWrittenFrameId = frameId;
+    }
+
+    void RewindHistoryStore::GetTransforms(const RewindVolumeRange& range, HostFrameId frameId, float blendFactor, AZStd::vector<AZ::Transform>& outTransforms) const
+    {
+        AZ_Assert(range.m_start + range.m_count <= m_capacity, "Rewind volume range was not allocated from this store");
+        outTransforms.resize(range.m_count);
+
+        const bool shouldBlend = (blendFactor < 1.0f);
+        const HostFrameId previousFrameId = frameId - HostFrameId{ 1 };
+        for (uint32_t index = 0; index < range.m_count; ++index)
+        {
+            const uint32_t volume = range.m_start + index;
+            const HostFrameId lastWrittenFrameId = m_lastWrittenFrameIds[volume];
+            if (lastWrittenFrameId == InvalidHostFrameId)
+            {
+                outTransforms[index] = AZ::Transform::CreateIdentity();
+                continue;
+            }
+
+            const FrameColumn& column = m_columns[GetColumnIndex(lastWrittenFrameId, frameId)];
+            AZ::Vector3 translation = column.m_translations[volume];
+            AZ::Quaternion rotation = column.m_rotations[volume];
+            if (shouldBlend)
+            {
+                // If a blend factor was supplied, interpolate from the preceding frame
+                const FrameColumn& previousColumn = m_columns[GetColumnIndex(lastWrittenFrameId, previousFrameId)];
+                translation = previousColumn.m_translations[volume].Lerp(translation, blendFactor);
+                rotation = previousColumn.m_rotations[volume].Slerp(rotation, blendFactor);
+            }
+            outTransforms[index] = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, translation);
+        }
+    }
+
+    uint32_t RewindHistoryStore::GetAllocatedVolumeCount() const
+    {
+        return m_allocatedCount;
+    }
+
+    uint32_t RewindHistoryStore::GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    uint32_t RewindHistoryStore::GetColumnIndex(HostFrameId lastWrittenFrameId, HostFrameId frameId) const
+    {
+        if (frameId > lastWrittenFrameId)
+        {
+            frameId = lastWrittenFrameId;
+        }
+        else if (static_cast<uint32_t>(lastWrittenFrameId - frameId) >= RewindHistorySize)
+        {
+            AZLOG(NET_Rewind, "Request for value which is too old");
+            frameId = lastWrittenFrameId - HostFrameId{ RewindHistorySize - 1 };
+        }
+        return static_cast<uint32_t>(frameId) % RewindHistorySize;
+    }
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/ReplicationWindows/EntityInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    // Keeps cell coordinates well inside the int32 range so that rect arithmetic can't overflow
+    static constexpr float MaxCellCoordinate = 1.0e9f;
+    static constexpr float MinCellSize = 1.0f;
+    // Empty cells are kept for this many ticks so that entities moving back and forth across a cell border don't reallocate them
+    static constexpr uint32_t EmptyCellRetentionTicks = 64;
+
+    bool EntityInterestGrid::CellRect::Contains(int32_t cellX, int32_t cellY) const
+    {
+        return (cellX >= m_minX) && (cellX <= m_maxX) && (cellY >= m_minY) && (cellY <= m_maxY);
+    }
+
+    bool EntityInterestGrid::CellRect::IsEmpty() const
+    {
+        return (m_maxX < m_minX) || (m_maxY < m_minY);
+    }
+
+    bool EntityInterestGrid::CellRect::operator==(const CellRect& rhs) const
+    {
+        return (m_minX == rhs.m_minX) && (m_minY == rhs.m_minY) && (m_maxX == rhs.m_maxX) && (m_maxY == rhs.m_maxY);
+    }
+
+    bool EntityInterestGrid::CellRect::operator!=(const CellRect& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    void EntityInterestGrid::Update(const NetworkEntityTracker& networkEntityTracker, float cellSize)
+    {
+        cellSize = AZStd::max(cellSize, MinCellSize);
+        if (cellSize != m_cellSize)
+        {
+            // Every entity changes cells, start from scratch
+            Clear();
+            m_cellSize = cellSize;
+        }
+
+        ++m_tick;
+
+        for (const auto& [netEntityId, entity] : networkEntityTracker)
+        {
+            if ((entity == nullptr) || (entity->GetState() != AZ::Entity::State::Active))
+            {
+                continue;
+            }
+
+            AZ::TransformInterface* transformInterface = entity->GetTransform();
+            if (transformInterface == nullptr)
+            {
+                continue;
+            }
+
+            const AZ::Vector3 position = transformInterface->GetWorldTranslation();
+            const CellKey cellKey = GetCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()));
+
+            auto result = m_entities.emplace(netEntityId, EntityRecord());
+            EntityRecord& record = result.first->second;
+            if (result.second)
+            {
+                AddToCell(cellKey, netEntityId);
+            }
+            else if (record.m_cellKey != cellKey)
+            {
+                RemoveFromCell(record.m_cellKey, netEntityId);
+                AddToCell(cellKey, netEntityId);
+            }
+            else if (record.m_entity != entity)
+            {
+                // The net entity id was reused by a different entity, windows need to re-evaluate it
+                m_cells[cellKey].m_changedTick = m_tick;
+            }
+
+            record.m_entity = entity;
+            record.m_position = position;
+            record.m_cellKey = cellKey;
+            record.m_seenTick = m_tick;
+        }
+
+        // Sweep entities that were removed from the tracker or deactivated since the last update
+        for (auto iter = m_entities.begin(); iter != m_entities.end();)
+        {
+            if (iter->second.m_seenTick != m_tick)
+            {
+                RemoveFromCell(iter->second.m_cellKey, iter->first);
+                iter = m_entities.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        if ((m_tick % EmptyCellRetentionTicks) == 0)
+        {
+            PruneEmptyCells();
+        }
+    }
+
+    void EntityInterestGrid::Clear()
+    {
+        m_cells.clear();
+        m_entities.clear();
+        m_cellSize = 0.0f;
+        m_tick = 0;
+        ++m_generation;
+    }
+
+    uint32_t EntityInterestGrid::GetUpdateTick() const
+    {
+        return m_tick;
+    }
+
+    uint32_t EntityInterestGrid::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    float EntityInterestGrid::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    EntityInterestGrid::CellRect EntityInterestGrid::GetCellRect(const AZ::Vector3& center, float radius) const
+    {
+        CellRect result;
+        if (m_cellSize > 0.0f)
+        {
+            result.m_minX = GetCellCoordinate(center.GetX() - radius);
+            result.m_minY = GetCellCoordinate(center.GetY() - radius);
+            result.m_maxX = GetCellCoordinate(center.GetX() + radius);
+            result.m_maxY = GetCellCoordinate(center.GetY() + radius);
+        }
+        return result;
+    }
+
+    EntityInterestGrid::CellKey EntityInterestGrid::GetCellKey(int32_t cellX, int32_t cellY)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellX)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(cellY));
+    }
+
+    void EntityInterestGrid::GetCellCoordinates(CellKey cellKey, int32_t& outCellX, int32_t& outCellY)
+    {
+        outCellX = static_cast<int32_t>(static_cast<uint32_t>(cellKey >> 32));
+        outCellY = static_cast<int32_t>(static_cast<uint32_t>(cellKey));
+    }
+
+    const EntityInterestGrid::Cell* EntityInterestGrid::FindCell(CellKey cellKey) const
+    {
+        auto iter = m_cells.find(cellKey);
+        return (iter != m_cells.end()) ? &iter->second : nullptr;
+    }
+
+    const EntityInterestGrid::EntityRecord* EntityInterestGrid::FindEntity(NetEntityId netEntityId) const
+    {
+        auto iter = m_entities.find(netEntityId);
+        return (iter != m_entities.end()) ? &iter->second : nullptr;
+    }
+
+    uint32_t EntityInterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entities.size());
+    }
+
+    int32_t EntityInterestGrid::GetCellCoordinate(float position) const
+    {
+        const float cell = AZStd::floor(position / m_cellSize);
+        return static_cast<int32_t>(AZStd::clamp(cell, -MaxCellCoordinate, MaxCellCoordinate));
+    }
+
+    void EntityInterestGrid::RemoveFromCell(CellKey cellKey, NetEntityId netEntityId)
+    {
+        auto cellIter = m_cells.find(cellKey);
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        // Emptied cells stay around until PruneEmptyCells, windows handle both an emptied and a pruned cell as changed
+        Cell& cell = cellIter->second;
+        auto entityIter = AZStd::find(cell.m_entities.begin(), cell.m_entities.end(), netEntityId);
+        if (entityIter != cell.m_entities.end())
+        {
+            *entityIter = cell.m_entities.back();
+            cell.m_entities.pop_back();
+            cell.m_changedTick = m_tick;
+        }
+    }
+
+    void EntityInterestGrid::AddToCell(CellKey cellKey, NetEntityId netEntityId)
+    {
+        Cell& cell = m_cells[cellKey];
+        cell.m_entities.push_back(netEntityId);
+        cell.m_changedTick = m_tick;
+    }
+
+    void EntityInterestGrid::PruneEmptyCells()
+    {
+        for (auto iter = m_cells.begin(); iter != m_cells.end();)
+        {
+            const Cell& cell = iter->second;
+            if (cell.m_entities.empty() && ((m_tick - cell.m_changedTick) >= EmptyCellRetentionTicks))
+            {
+                iter = m_cells.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+}
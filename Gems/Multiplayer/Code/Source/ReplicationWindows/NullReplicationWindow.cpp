@@ -95,6 +95,25 @@ namespace Multiplayer
         }
     }
 
+    void NullReplicationWindow::SendBaselineAcks(const AZStd::vector<AzNetworking::PacketId>& packetIds)
+    {
+        MultiplayerPackets::EntityBaselineAcks baselineAcksPacket;
+        for (AzNetworking::PacketId packetId : packetIds)
+        {
+            if (baselineAcksPacket.GetPacketIds().full())
+            {
+                m_connection->SendUnreliablePacket(baselineAcksPacket);
+                baselineAcksPacket.ModifyPacketIds().clear();
+            }
+            baselineAcksPacket.ModifyPacketIds().push_back(packetId);
+        }
+
+        if (!baselineAcksPacket.GetPacketIds().empty())
+        {
+            m_connection->SendUnreliablePacket(baselineAcksPacket);
+        }
+    }
+
     void NullReplicationWindow::DebugDraw() const
     {
         // Nothing to draw
@@ -31,6 +31,7 @@ namespace Multiplayer
         AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
         void SendEntityRpcs(NetworkEntityRpcVector& entityRpcVector, bool reliable) override;
         void SendEntityResets(const NetEntityIdSet& resetIds) override;
+        void SendBaselineAcks(const AZStd::vector<AzNetworking::PacketId>& packetIds) override;
         void DebugDraw() const override;
         //! @}
 
@@ -10,9 +10,12 @@
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 
 namespace Multiplayer
@@ -112,52 +115,17 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
-        if (visibilitySystem)
+        // The interest grid is shared by all connections and updated once per network tick, it's empty until the first server tick
+        // or if it has been disabled, in which case the visibility system is queried directly
+        IMultiplayer* multiplayer = GetMultiplayer();
+        if ((multiplayer != nullptr) && (multiplayer->GetEntityInterestGrid().GetUpdateTick() != 0))
         {
-            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
-                awarenessSphere,
-                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-                {
-                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                    {
-                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                        {
-                            gatheredEntries.push_back(visEntry);
-                        }
-                    }
-                });
+            GatherInterestGridEntities(multiplayer->GetEntityInterestGrid(), controlledEntityPosition);
         }
-
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
-        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
-
-        // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        else
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
-            {
-                // Entity does not have netbinding, skip this entity
-                continue;
-            }
-
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
-            {
-                continue;
-            }
-
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+            ResetInterestGridCandidates();
+            GatherVisibilitySceneEntities(controlledEntityPosition);
         }
 
         // Add in all entities that have forced relevancy
@@ -224,6 +192,25 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::SendBaselineAcks(const AZStd::vector<AzNetworking::PacketId>& packetIds)
+    {
+        MultiplayerPackets::EntityBaselineAcks baselineAcksPacket;
+        for (AzNetworking::PacketId packetId : packetIds)
+        {
+            if (baselineAcksPacket.GetPacketIds().full())
+            {
+                m_connection->SendUnreliablePacket(baselineAcksPacket);
+                baselineAcksPacket.ModifyPacketIds().clear();
+            }
+            baselineAcksPacket.ModifyPacketIds().push_back(packetId);
+        }
+
+        if (!baselineAcksPacket.GetPacketIds().empty())
+        {
+            m_connection->SendUnreliablePacket(baselineAcksPacket);
+        }
+    }
+
     void ServerToClientReplicationWindow::DebugDraw() const
     {
         //static const float   BoundaryStripeHeight = 1.0f;
@@ -314,6 +301,167 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::GatherVisibilitySceneEntities(const AZ::Vector3& controlledEntityPosition)
+    {
+        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem)
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+                awarenessSphere,
+                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
+                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                    {
+                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                        {
+                            gatheredEntries.push_back(visEntry);
+                        }
+                    }
+                });
+        }
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+
+        // Add all the neighbours
+        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        {
+            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
+            if (entityHandle.GetNetBindComponent() == nullptr)
+            {
+                // Entity does not have netbinding, skip this entity
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            // We want to find the closest extent to the player and prioritize using that distance
+            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
+            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
+            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+
+            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherInterestGridEntities(const EntityInterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition)
+    {
+        if (interestGrid.GetGeneration() != m_interestGridGeneration)
+        {
+            // The grid has been rebuilt since our last update, none of our candidates can be trusted
+            ResetInterestGridCandidates();
+            m_interestGridGeneration = interestGrid.GetGeneration();
+        }
+
+        const EntityInterestGrid::CellRect cellRect = interestGrid.GetCellRect(controlledEntityPosition, sv_ClientAwarenessRadius);
+
+        // Drop candidates in cells that left our awareness radius, changed or were pruned since our last update, the order of the
+        // remaining candidates is preserved so that they stay mostly sorted
+        auto isStaleCandidate = [this, &interestGrid, &cellRect](const InterestGridCandidate& candidate)
+        {
+            int32_t cellX = 0;
+            int32_t cellY = 0;
+            EntityInterestGrid::GetCellCoordinates(candidate.m_cellKey, cellX, cellY);
+            if (!cellRect.Contains(cellX, cellY))
+            {
+                return true;
+            }
+            const EntityInterestGrid::Cell* cell = interestGrid.FindCell(candidate.m_cellKey);
+            return (cell == nullptr) || (cell->m_changedTick > m_interestGridTick);
+        };
+        m_interestGridCandidates.erase(
+            AZStd::remove_if(m_interestGridCandidates.begin(), m_interestGridCandidates.end(), isStaleCandidate),
+            m_interestGridCandidates.end());
+
+        // Gather the entities of cells that entered our awareness radius or changed since our last update
+        for (int32_t cellY = cellRect.m_minY; cellY <= cellRect.m_maxY; ++cellY)
+        {
+            for (int32_t cellX = cellRect.m_minX; cellX <= cellRect.m_maxX; ++cellX)
+            {
+                const EntityInterestGrid::CellKey cellKey = EntityInterestGrid::GetCellKey(cellX, cellY);
+                const EntityInterestGrid::Cell* cell = interestGrid.FindCell(cellKey);
+                if ((cell == nullptr)
+                    || (m_interestGridCellRect.Contains(cellX, cellY) && (cell->m_changedTick <= m_interestGridTick)))
+                {
+                    continue;
+                }
+
+                for (NetEntityId netEntityId : cell->m_entities)
+                {
+                    InterestGridCandidate& candidate = m_interestGridCandidates.emplace_back();
+                    candidate.m_netEntityId = netEntityId;
+                    candidate.m_cellKey = cellKey;
+                }
+            }
+        }
+
+        m_interestGridCellRect = cellRect;
+        m_interestGridTick = interestGrid.GetUpdateTick();
+
+        // Entities only move a little between updates, so priorities mostly keep their order and insertion sort is close to linear
+        for (InterestGridCandidate& candidate : m_interestGridCandidates)
+        {
+            const EntityInterestGrid::EntityRecord* record = interestGrid.FindEntity(candidate.m_netEntityId);
+            AZ_Assert(record != nullptr, "Interest grid candidate is missing from the grid, its cell should have been marked as changed");
+            candidate.m_distanceSquared = (record != nullptr)
+                ? controlledEntityPosition.GetDistanceSq(record->m_position)
+                : AZStd::numeric_limits<float>::max();
+            candidate.m_priority = (candidate.m_distanceSquared > 0.0f) ? 1.0f / candidate.m_distanceSquared : 0.0f;
+        }
+        AZStd::insertion_sort(m_interestGridCandidates.begin(), m_interestGridCandidates.end(),
+            [](const InterestGridCandidate& lhs, const InterestGridCandidate& rhs)
+            {
+                return lhs.m_priority > rhs.m_priority;
+            });
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const float awarenessRadiusSquared = sv_ClientAwarenessRadius * sv_ClientAwarenessRadius;
+
+        // Candidates are visited highest priority first, so the tracked entity limit never has to evict anything
+        for (const InterestGridCandidate& candidate : m_interestGridCandidates)
+        {
+            if (m_candidateQueue.size() >= sv_MaxEntitiesToTrackReplication)
+            {
+                break;
+            }
+
+            if (candidate.m_distanceSquared > awarenessRadiusSquared)
+            {
+                continue;
+            }
+
+            // The grid is updated ahead of the window, so resolve the entity through the tracker in case it has since been removed
+            NetworkEntityHandle entityHandle = networkEntityTracker->Get(candidate.m_netEntityId);
+            if (!entityHandle.Exists() || (entityHandle.GetNetBindComponent() == nullptr))
+            {
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            AddEntityToReplicationSet(entityHandle, candidate.m_priority, candidate.m_distanceSquared);
+        }
+    }
+
+    void ServerToClientReplicationWindow::ResetInterestGridCandidates()
+    {
+        m_interestGridCandidates.clear();
+        m_interestGridCellRect = EntityInterestGrid::CellRect();
+        m_interestGridTick = 0;
+    }
+
     void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
@@ -53,6 +53,7 @@ namespace Multiplayer
         AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
         void SendEntityRpcs(NetworkEntityRpcVector& entityRpcVector, bool reliable) override;
         void SendEntityResets(const NetEntityIdSet& resetIds) override;
+        void SendBaselineAcks(const AZStd::vector<AzNetworking::PacketId>& packetIds) override;
         void DebugDraw() const override;
         //! @}
 
@@ -61,6 +62,9 @@ namespace Multiplayer
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
+        void GatherVisibilitySceneEntities(const AZ::Vector3& controlledEntityPosition);
+        void GatherInterestGridEntities(const EntityInterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition);
+        void ResetInterestGridCandidates();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
@@ -69,6 +73,20 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
+        // Candidates gathered from the entity interest grid, sorted highest priority first
+        // These persist between updates so that only grid cells entering the awareness radius or changing need to be gathered again
+        struct InterestGridCandidate
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            EntityInterestGrid::CellKey m_cellKey = 0;
+            float m_priority = 0.0f;
+            float m_distanceSquared = 0.0f;
+        };
+        AZStd::vector<InterestGridCandidate> m_interestGridCandidates;
+        EntityInterestGrid::CellRect m_interestGridCellRect;
+        uint32_t m_interestGridTick = 0;
+        uint32_t m_interestGridGeneration = 0;
+
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
 
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    struct BaselineTestState
+    {
+        int32_t m_health = 100;
+        uint16_t m_ammo = 30;
+        float m_positionX = 0.0f;
+        float m_positionY = 0.0f;
+        bool m_crouching = false;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return serializer.Serialize(m_health, "Health")
+                && serializer.Serialize(m_ammo, "Ammo")
+                && serializer.Serialize(m_positionX, "PositionX")
+                && serializer.Serialize(m_positionY, "PositionY")
+                && serializer.Serialize(m_crouching, "Crouching");
+        }
+
+        bool operator==(const BaselineTestState& rhs) const
+        {
+            return (m_health == rhs.m_health) && (m_ammo == rhs.m_ammo) && (m_positionX == rhs.m_positionX)
+                && (m_positionY == rhs.m_positionY) && (m_crouching == rhs.m_crouching);
+        }
+    };
+
+    class EntityBaselineHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint32_t MaxBaselines = 45;
+
+        static AzNetworking::SerializerBaseline MakeBaseline(BaselineTestState state)
+        {
+            AzNetworking::SerializerBaseline empty;
+            AzNetworking::SerializerBaseline baseline;
+            AzNetworking::BaselineDeltaSerializerCreate createSerializer(empty, baseline);
+            state.Serialize(createSerializer);
+            return baseline;
+        }
+    };
+
+    TEST_F(EntityBaselineHistoryTests, OnlyConfirmedBaselinesAreUsed)
+    {
+        BaselineAckSet acks;
+        SentBaselineHistory sentBaselines;
+        sentBaselines.AddSent(AzNetworking::PacketId{ 1 }, MakeBaseline(BaselineTestState{ 1 }), MaxBaselines);
+        sentBaselines.AddSent(AzNetworking::PacketId{ 2 }, MakeBaseline(BaselineTestState{ 2 }), MaxBaselines);
+
+        AzNetworking::PacketId baselinePacketId = AzNetworking::PacketId{ 0 };
+        EXPECT_TRUE(sentBaselines.FindNewestAcked(acks, baselinePacketId).IsEmpty());
+        EXPECT_EQ(baselinePacketId, AzNetworking::InvalidPacketId);
+
+        acks.AddAcks(BaselineAckPacketIds{ AzNetworking::PacketId{ 1 } });
+        EXPECT_FALSE(sentBaselines.FindNewestAcked(acks, baselinePacketId).IsEmpty());
+        EXPECT_EQ(baselinePacketId, AzNetworking::PacketId{ 1 });
+
+        // A confirmed baseline stays usable once its ack is no longer tracked
+        acks.Clear();
+        sentBaselines.FindNewestAcked(acks, baselinePacketId);
+        EXPECT_EQ(baselinePacketId, AzNetworking::PacketId{ 1 });
+
+        acks.AddAcks(BaselineAckPacketIds{ AzNetworking::PacketId{ 2 } });
+        sentBaselines.FindNewestAcked(acks, baselinePacketId);
+        EXPECT_EQ(baselinePacketId, AzNetworking::PacketId{ 2 });
+    }
+
+    TEST_F(EntityBaselineHistoryTests, ReceivedBaselinesOlderThanTheUsedBaselineAreDiscarded)
+    {
+        ReceivedBaselineHistory receivedBaselines;
+        EXPECT_NE(receivedBaselines.Find(AzNetworking::InvalidPacketId), nullptr);
+        EXPECT_EQ(receivedBaselines.Find(AzNetworking::PacketId{ 1 }), nullptr);
+
+        receivedBaselines.Store(AzNetworking::InvalidPacketId, AzNetworking::PacketId{ 1 }, MakeBaseline(BaselineTestState{ 1 }), MaxBaselines);
+        receivedBaselines.Store(AzNetworking::InvalidPacketId, AzNetworking::PacketId{ 2 }, MakeBaseline(BaselineTestState{ 2 }), MaxBaselines);
+        EXPECT_NE(receivedBaselines.Find(AzNetworking::PacketId{ 1 }), nullptr);
+
+        receivedBaselines.Store(AzNetworking::PacketId{ 2 }, AzNetworking::PacketId{ 3 }, MakeBaseline(BaselineTestState{ 3 }), MaxBaselines);
+        EXPECT_EQ(receivedBaselines.Find(AzNetworking::PacketId{ 1 }), nullptr);
+        EXPECT_NE(receivedBaselines.Find(AzNetworking::PacketId{ 2 }), nullptr);
+        EXPECT_NE(receivedBaselines.Find(AzNetworking::PacketId{ 3 }), nullptr);
+    }
+
+    TEST_F(EntityBaselineHistoryTests, RoundTripWithReorderingAndLoss)
+    {
+        struct InFlightUpdate
+        {
+            uint32_t m_deliveryTick = 0;
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AzNetworking::PacketId m_baselinePacketId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        struct InFlightAcks
+        {
+            uint32_t m_deliveryTick = 0;
+            BaselineAckPacketIds m_packetIds;
+        };
+
+        // Publisher
+        BaselineAckSet acks;
+        SentBaselineHistory sentBaselines;
+        BaselineTestState publishedState;
+        AZStd::unordered_map<AzNetworking::PacketId, BaselineTestState> publishedStates;
+
+        // Subscriber
+        ReceivedBaselineHistory receivedBaselines;
+        AzNetworking::PacketId lastReceivedPacketId = AzNetworking::InvalidPacketId;
+
+        AZStd::vector<InFlightUpdate> inFlightUpdates;
+        AZStd::vector<InFlightAcks> inFlightAcks;
+        uint32_t deltasAgainstBaseline = 0;
+        uint32_t staleUpdates = 0;
+        uint32_t missingBaselines = 0;
+        uint32_t decodedUpdates = 0;
+
+        for (uint32_t tick = 1; tick <= 300; ++tick)
+        {
+            // The publisher receives the acks that arrived this tick
+            for (auto iter = inFlightAcks.begin(); iter != inFlightAcks.end();)
+            {
+                if (iter->m_deliveryTick == tick)
+                {
+                    acks.AddAcks(iter->m_packetIds);
+                    iter = inFlightAcks.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+
+            // The publisher encodes the current state against the newest confirmed baseline
+            publishedState.m_health = 100 - static_cast<int32_t>(tick % 50);
+            publishedState.m_ammo = static_cast<uint16_t>((tick / 7) % 30);
+            publishedState.m_positionX += 0.25f;
+            publishedState.m_positionY = (tick % 3 == 0) ? publishedState.m_positionY : publishedState.m_positionY - 0.5f;
+            publishedState.m_crouching = (tick % 11) < 4;
+
+            InFlightUpdate update;
+            update.m_packetId = AzNetworking::PacketId{ tick };
+            const AzNetworking::SerializerBaseline& baseline = sentBaselines.FindNewestAcked(acks, update.m_baselinePacketId);
+            deltasAgainstBaseline += (update.m_baselinePacketId != AzNetworking::InvalidPacketId) ? 1 : 0;
+
+            AzNetworking::SerializerBaseline sentValues;
+            AzNetworking::BaselineDeltaSerializerCreate createSerializer(baseline, sentValues);
+            EXPECT_TRUE(publishedState.Serialize(createSerializer));
+            update.m_data.resize(256);
+            uint32_t deltaSize = 0;
+            EXPECT_TRUE(createSerializer.WriteDelta(update.m_data.data(), static_cast<uint32_t>(update.m_data.size()), deltaSize));
+            update.m_data.resize(deltaSize);
+            sentBaselines.AddSent(update.m_packetId, AZStd::move(sentValues), MaxBaselines);
+            publishedStates[update.m_packetId] = publishedState;
+
+            // Every fifth update is lost and every seventh update arrives three ticks late, after newer updates
+            if (tick % 5 != 3)
+            {
+                update.m_deliveryTick = tick + ((tick % 7 == 2) ? 3 : 1);
+                inFlightUpdates.push_back(AZStd::move(update));
+            }
+
+            // The subscriber handles the updates that arrived this tick and confirms the ones it stored
+            BaselineAckPacketIds storedPacketIds;
+            for (auto iter = inFlightUpdates.begin(); iter != inFlightUpdates.end();)
+            {
+                if (iter->m_deliveryTick != tick)
+                {
+                    ++iter;
+                    continue;
+                }
+
+                if ((lastReceivedPacketId != AzNetworking::InvalidPacketId) && (iter->m_packetId <= lastReceivedPacketId))
+                {
+                    // Stale updates are dropped, the transport still acks them but the subscriber doesn't
+                    ++staleUpdates;
+                }
+                else if (const AzNetworking::SerializerBaseline* receivedBaseline = receivedBaselines.Find(iter->m_baselinePacketId))
+                {
+                    BaselineTestState receivedState;
+                    AzNetworking::SerializerBaseline receivedValues;
+                    AzNetworking::BaselineDeltaSerializerApply applySerializer(
+                        *receivedBaseline, iter->m_data.data(), static_cast<uint32_t>(iter->m_data.size()), receivedValues);
+                    EXPECT_TRUE(receivedState.Serialize(applySerializer));
+                    EXPECT_TRUE(applySerializer.IsComplete());
+                    EXPECT_TRUE(receivedState == publishedStates[iter->m_packetId]);
+
+                    receivedBaselines.Store(iter->m_baselinePacketId, iter->m_packetId, AZStd::move(receivedValues), MaxBaselines);
+                    lastReceivedPacketId = iter->m_packetId;
+                    storedPacketIds.push_back(iter->m_packetId);
+                    ++decodedUpdates;
+                }
+                else
+                {
+                    ++missingBaselines;
+                }
+                iter = inFlightUpdates.erase(iter);
+            }
+
+            // Every fourth ack packet is lost, the others arrive two ticks later
+            if (!storedPacketIds.empty() && (tick % 4 != 1))
+            {
+                inFlightAcks.push_back(InFlightAcks{ tick + 2, storedPacketIds });
+            }
+        }
+
+        EXPECT_EQ(missingBaselines, 0);
+        EXPECT_GT(staleUpdates, 0);
+        EXPECT_GT(decodedUpdates, 200);
+        EXPECT_GT(deltasAgainstBaseline, 250);
+    }
+}
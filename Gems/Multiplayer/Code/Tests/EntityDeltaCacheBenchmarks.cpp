@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+
+namespace Multiplayer
+{
+    /*
+     * A single entity replicated to many connections that are all caught up to the same baseline.
+     * Measures the server cost of generating the entity update for every connection in a tick.
+     */
+    class ServerEntityDeltaCacheBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr int64_t MaxConnections = 64;
+        const NetEntityId ReplicatedNetEntityId = NetEntityId{ 1 };
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            m_entity = AZStd::make_unique<EntityInfo>(1, "replicated", ReplicatedNetEntityId, EntityInfo::Role::Root);
+            CreateParent(*m_entity);
+
+            const NetworkEntityHandle handle(m_entity->m_entity.get(), m_NetworkEntityManager->GetNetworkEntityTracker());
+            for (int64_t i = 0; i < MaxConnections; ++i)
+            {
+                auto replicator = AZStd::make_unique<EntityReplicator>(*m_entityReplicationManager, m_Connection.get(), NetEntityRole::Client, handle);
+                replicator->Initialize(handle);
+                replicator->PrepareToGenerateUpdatePacket();
+                m_replicators.push_back(AZStd::move(replicator));
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_replicators.clear();
+            m_replicators.shrink_to_fit();
+            m_entity.reset();
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        void GenerateUpdatesForConnections(benchmark::State& state, bool useCache)
+        {
+            const int64_t connectionCount = state.range(0);
+            EntityDeltaCache& deltaCache = GetMultiplayer()->GetEntityDeltaCache();
+            for ([[maybe_unused]] auto value : state)
+            {
+                deltaCache.BeginTick(useCache);
+                for (int64_t i = 0; i < connectionCount; ++i)
+                {
+                    NetworkEntityUpdateMessage message = m_replicators[i]->GenerateUpdatePacket();
+                    benchmark::DoNotOptimize(message);
+                }
+                deltaCache.EndTick();
+            }
+            deltaCache.BeginTick(false);
+            deltaCache.EndTick();
+
+            // Items are replicated entities, so the reported rate reflects the cost per entity per connection
+            state.SetItemsProcessed(state.iterations() * connectionCount);
+        }
+
+        AZStd::unique_ptr<EntityInfo> m_entity;
+        AZStd::vector<AZStd::unique_ptr<EntityReplicator>> m_replicators;
+    };
+
+    BENCHMARK_DEFINE_F(ServerEntityDeltaCacheBenchmark, GenerateUpdatesWithoutCache)(benchmark::State& state)
+    {
+        GenerateUpdatesForConnections(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(ServerEntityDeltaCacheBenchmark, GenerateUpdatesWithCache)(benchmark::State& state)
+    {
+        GenerateUpdatesForConnections(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(ServerEntityDeltaCacheBenchmark, GenerateUpdatesWithoutCache)
+        ->RangeMultiplier(4)->Range(1, ServerEntityDeltaCacheBenchmark::MaxConnections)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ServerEntityDeltaCacheBenchmark, GenerateUpdatesWithCache)
+        ->RangeMultiplier(4)->Range(1, ServerEntityDeltaCacheBenchmark::MaxConnections)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityDeltaCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityDeltaCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static ReplicationRecord MakeRecord(NetEntityRole role, uint32_t dirtyBit)
+        {
+            ReplicationRecord record(role);
+            record.m_authorityToClient.AddBits(8);
+            record.m_authorityToClient.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        static AzNetworking::PacketEncodingBuffer MakeData(uint8_t value)
+        {
+            AzNetworking::PacketEncodingBuffer data;
+            const uint8_t bytes[] = { value, value, value };
+            data.CopyValues(bytes, sizeof(bytes));
+            return data;
+        }
+
+        const NetEntityId TestNetEntityId = NetEntityId{ 7 };
+    };
+
+    TEST_F(EntityDeltaCacheTests, InactiveCacheNeverHits)
+    {
+        EntityDeltaCache cache;
+        const ReplicationRecord record = MakeRecord(NetEntityRole::Client, 1);
+        cache.Store(TestNetEntityId, record, MakeData(1));
+
+        AzNetworking::PacketEncodingBuffer outData;
+        EXPECT_FALSE(cache.IsActive());
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, record, outData));
+
+        cache.BeginTick(false);
+        cache.Store(TestNetEntityId, record, MakeData(1));
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, record, outData));
+        cache.EndTick();
+    }
+
+    TEST_F(EntityDeltaCacheTests, MatchingRecordsShareDelta)
+    {
+        EntityDeltaCache cache;
+        cache.BeginTick(true);
+
+        const ReplicationRecord record = MakeRecord(NetEntityRole::Client, 1);
+        AzNetworking::PacketEncodingBuffer outData;
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, record, outData));
+        cache.Store(TestNetEntityId, record, MakeData(1));
+
+        // Consumed bits don't affect the serialized delta
+        ReplicationRecord consumedRecord = record;
+        consumedRecord.ConsumeAuthorityToClientBits(4);
+        EXPECT_TRUE(cache.TryGet(TestNetEntityId, consumedRecord, outData));
+        EXPECT_EQ(outData, MakeData(1));
+
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, MakeRecord(NetEntityRole::Client, 2), outData));
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, MakeRecord(NetEntityRole::Autonomous, 1), outData));
+        EXPECT_FALSE(cache.TryGet(NetEntityId{ 8 }, record, outData));
+
+        EXPECT_EQ(cache.GetHitCount(), 1);
+        EXPECT_EQ(cache.GetMissCount(), 4);
+        cache.EndTick();
+    }
+
+    TEST_F(EntityDeltaCacheTests, DeltasExpireAtNextTick)
+    {
+        EntityDeltaCache cache;
+        const ReplicationRecord record = MakeRecord(NetEntityRole::Client, 1);
+        AzNetworking::PacketEncodingBuffer outData;
+
+        cache.BeginTick(true);
+        cache.Store(TestNetEntityId, record, MakeData(1));
+        cache.EndTick();
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, record, outData));
+
+        cache.BeginTick(true);
+        EXPECT_FALSE(cache.TryGet(TestNetEntityId, record, outData));
+        cache.Store(TestNetEntityId, record, MakeData(2));
+        EXPECT_TRUE(cache.TryGet(TestNetEntityId, record, outData));
+        EXPECT_EQ(outData, MakeData(2));
+        cache.EndTick();
+    }
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Multiplayer/ReplicationWindows/EntityInterestGrid.h>
+#include <ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <AzCore/Component/TransformBus.h>
+
+namespace Multiplayer
+{
+    class EntityInterestGridTests
+        : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            // Use the grid shared with the replication windows
+            m_grid = &GetMultiplayer()->GetEntityInterestGrid();
+        }
+
+        void TearDown() override
+        {
+            m_entityInfos.clear();
+            NetworkEntityTests::TearDown();
+        }
+
+        AZ::Entity* CreateEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+        {
+            const AZ::u64 entityId = static_cast<AZ::u64>(netEntityId) + 1;
+            EntityInfo& entityInfo = *m_entityInfos.emplace_back(
+                AZStd::make_unique<EntityInfo>(entityId, "entity", netEntityId, EntityInfo::Role::None));
+            entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
+            entityInfo.m_entity->CreateComponent<NetBindComponent>();
+            SetupEntity(entityInfo.m_entity, netEntityId, NetEntityRole::Authority);
+            entityInfo.m_entity->Activate();
+            entityInfo.m_entity->GetTransform()->SetWorldTranslation(position);
+            return entityInfo.m_entity.get();
+        }
+
+        const EntityInterestGrid::Cell* FindCell(int32_t cellX, int32_t cellY) const
+        {
+            return m_grid->FindCell(EntityInterestGrid::GetCellKey(cellX, cellY));
+        }
+
+        void UpdateGrid()
+        {
+            m_grid->Update(*m_networkEntityManager->GetNetworkEntityTracker(), CellSize);
+        }
+
+        static constexpr float CellSize = 10.0f;
+
+        EntityInterestGrid* m_grid = nullptr;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+    };
+
+    class ServerToClientReplicationWindowInterestGridTests
+        : public EntityInterestGridTests
+    {
+    public:
+        void SetUp() override
+        {
+            EntityInterestGridTests::SetUp();
+            m_controlledEntity = CreateEntity(NetEntityId{ 100 }, AZ::Vector3::CreateZero());
+            m_window = AZStd::make_unique<ServerToClientReplicationWindow>(
+                NetworkEntityHandle(m_controlledEntity, m_networkEntityManager->GetNetworkEntityTracker()), m_mockConnection.get());
+        }
+
+        void TearDown() override
+        {
+            m_window.reset();
+            EntityInterestGridTests::TearDown();
+        }
+
+        bool IsReplicated(AZ::Entity* entity) const
+        {
+            const ReplicationSet& replicationSet = m_window->GetReplicationSet();
+            return replicationSet.find(ConstNetworkEntityHandle(entity, m_networkEntityManager->GetNetworkEntityTracker()))
+                != replicationSet.end();
+        }
+
+        AZ::Entity* m_controlledEntity = nullptr;
+        AZStd::unique_ptr<ServerToClientReplicationWindow> m_window;
+    };
+
+    TEST_F(EntityInterestGridTests, CellKeyRoundTripsNegativeCoordinates)
+    {
+        int32_t cellX = 0;
+        int32_t cellY = 0;
+        EntityInterestGrid::GetCellCoordinates(EntityInterestGrid::GetCellKey(-3, 7), cellX, cellY);
+        EXPECT_EQ(cellX, -3);
+        EXPECT_EQ(cellY, 7);
+    }
+
+    TEST_F(EntityInterestGridTests, EntitiesAreBucketedByPosition)
+    {
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 100.0f));
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(-5.0f, 25.0f, 0.0f));
+        EXPECT_EQ(m_grid->GetUpdateTick(), 0);
+
+        UpdateGrid();
+        EXPECT_EQ(m_grid->GetUpdateTick(), 1);
+        EXPECT_EQ(m_grid->GetEntityCount(), 2);
+
+        const EntityInterestGrid::Cell* cell = FindCell(0, 0);
+        ASSERT_NE(cell, nullptr);
+        ASSERT_EQ(cell->m_entities.size(), 1);
+        EXPECT_EQ(cell->m_entities[0], NetEntityId{ 1 });
+
+        cell = FindCell(-1, 2);
+        ASSERT_NE(cell, nullptr);
+        ASSERT_EQ(cell->m_entities.size(), 1);
+        EXPECT_EQ(cell->m_entities[0], NetEntityId{ 2 });
+
+        const EntityInterestGrid::EntityRecord* record = m_grid->FindEntity(NetEntityId{ 1 });
+        ASSERT_NE(record, nullptr);
+        EXPECT_TRUE(record->m_position.IsClose(AZ::Vector3(5.0f, 5.0f, 100.0f)));
+
+        const EntityInterestGrid::CellRect cellRect = m_grid->GetCellRect(AZ::Vector3(5.0f, 5.0f, 0.0f), 20.0f);
+        EXPECT_EQ(cellRect.m_minX, -2);
+        EXPECT_EQ(cellRect.m_maxX, 2);
+        EXPECT_TRUE(cellRect.Contains(-1, 2));
+        EXPECT_FALSE(cellRect.Contains(3, 0));
+    }
+
+    TEST_F(EntityInterestGridTests, OnlyCellsAnEntityMovesBetweenAreStamped)
+    {
+        AZ::Entity* movingEntity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(55.0f, 5.0f, 0.0f));
+        UpdateGrid();
+
+        // Moving within a cell only updates the cached position
+        movingEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(6.0f, 5.0f, 0.0f));
+        UpdateGrid();
+        EXPECT_EQ(FindCell(0, 0)->m_changedTick, 1);
+        EXPECT_TRUE(m_grid->FindEntity(NetEntityId{ 1 })->m_position.IsClose(AZ::Vector3(6.0f, 5.0f, 0.0f)));
+
+        movingEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(15.0f, 5.0f, 0.0f));
+        UpdateGrid();
+        EXPECT_TRUE(FindCell(0, 0)->m_entities.empty());
+        EXPECT_EQ(FindCell(0, 0)->m_changedTick, 3);
+        ASSERT_EQ(FindCell(1, 0)->m_entities.size(), 1);
+        EXPECT_EQ(FindCell(1, 0)->m_changedTick, 3);
+        EXPECT_EQ(FindCell(5, 0)->m_changedTick, 1);
+    }
+
+    TEST_F(EntityInterestGridTests, DeactivatedEntitiesAreSwept)
+    {
+        AZ::Entity* entity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        UpdateGrid();
+        EXPECT_EQ(m_grid->GetEntityCount(), 1);
+
+        entity->Deactivate();
+        UpdateGrid();
+        EXPECT_EQ(m_grid->GetEntityCount(), 0);
+        EXPECT_EQ(m_grid->FindEntity(NetEntityId{ 1 }), nullptr);
+        ASSERT_NE(FindCell(0, 0), nullptr);
+        EXPECT_TRUE(FindCell(0, 0)->m_entities.empty());
+        EXPECT_EQ(FindCell(0, 0)->m_changedTick, 2);
+
+        entity->Activate();
+    }
+
+    TEST_F(EntityInterestGridTests, ChangingCellSizeRebuildsGrid)
+    {
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(15.0f, 5.0f, 0.0f));
+        UpdateGrid();
+        UpdateGrid();
+        EXPECT_EQ(m_grid->GetUpdateTick(), 2);
+
+        m_grid->Update(*m_networkEntityManager->GetNetworkEntityTracker(), 100.0f);
+        EXPECT_EQ(m_grid->GetUpdateTick(), 1);
+        EXPECT_EQ(m_grid->GetCellSize(), 100.0f);
+        EXPECT_EQ(FindCell(1, 0), nullptr);
+        ASSERT_NE(FindCell(0, 0), nullptr);
+        EXPECT_EQ(FindCell(0, 0)->m_entities.size(), 1);
+    }
+
+    TEST_F(EntityInterestGridTests, EmptyCellsArePruned)
+    {
+        AZ::Entity* entity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        UpdateGrid();
+
+        entity->GetTransform()->SetWorldTranslation(AZ::Vector3(15.0f, 5.0f, 0.0f));
+        UpdateGrid();
+        ASSERT_NE(FindCell(0, 0), nullptr);
+        EXPECT_TRUE(FindCell(0, 0)->m_entities.empty());
+
+        for (uint32_t tick = 0; tick < 128; ++tick)
+        {
+            UpdateGrid();
+        }
+        EXPECT_EQ(FindCell(0, 0), nullptr);
+        ASSERT_NE(FindCell(1, 0), nullptr);
+        EXPECT_EQ(FindCell(1, 0)->m_entities.size(), 1);
+    }
+
+    TEST_F(EntityInterestGridTests, ClearingChangesTheGeneration)
+    {
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        UpdateGrid();
+        const uint32_t generation = m_grid->GetGeneration();
+
+        UpdateGrid();
+        EXPECT_EQ(m_grid->GetGeneration(), generation);
+
+        m_grid->Update(*m_networkEntityManager->GetNetworkEntityTracker(), 100.0f);
+        EXPECT_NE(m_grid->GetGeneration(), generation);
+    }
+
+    TEST_F(ServerToClientReplicationWindowInterestGridTests, GathersEntitiesWithinAwarenessRadius)
+    {
+        AZ::Entity* nearEntity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(50.0f, 0.0f, 0.0f));
+        AZ::Entity* farEntity = CreateEntity(NetEntityId{ 2 }, AZ::Vector3(2000.0f, 0.0f, 0.0f));
+        UpdateGrid();
+        m_window->UpdateWindow();
+        EXPECT_TRUE(IsReplicated(m_controlledEntity));
+        EXPECT_TRUE(IsReplicated(nearEntity));
+        EXPECT_FALSE(IsReplicated(farEntity));
+
+        // Only the cells the entities moved between changed, the window picks up both moves
+        farEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(100.0f, 0.0f, 0.0f));
+        nearEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(3000.0f, 0.0f, 0.0f));
+        UpdateGrid();
+        m_window->UpdateWindow();
+        EXPECT_FALSE(IsReplicated(nearEntity));
+        EXPECT_TRUE(IsReplicated(farEntity));
+
+        // Moving within an unchanged cell keeps the entity
+        farEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(101.0f, 0.0f, 0.0f));
+        UpdateGrid();
+        m_window->UpdateWindow();
+        EXPECT_TRUE(IsReplicated(farEntity));
+    }
+
+    TEST_F(ServerToClientReplicationWindowInterestGridTests, GathersEntitiesOfPrunedAndRecreatedCells)
+    {
+        AZ::Entity* entity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(50.0f, 0.0f, 0.0f));
+        UpdateGrid();
+        m_window->UpdateWindow();
+        EXPECT_TRUE(IsReplicated(entity));
+
+        // The entity leaves long enough for its cell to be pruned, then comes back while the window isn't updated
+        entity->GetTransform()->SetWorldTranslation(AZ::Vector3(3000.0f, 0.0f, 0.0f));
+        for (uint32_t tick = 0; tick < 128; ++tick)
+        {
+            UpdateGrid();
+        }
+        EXPECT_EQ(FindCell(5, 0), nullptr);
+        entity->GetTransform()->SetWorldTranslation(AZ::Vector3(50.0f, 0.0f, 0.0f));
+        UpdateGrid();
+        m_window->UpdateWindow();
+        EXPECT_TRUE(IsReplicated(entity));
+    }
+
+    TEST_F(ServerToClientReplicationWindowInterestGridTests, GridRebuiltBetweenWindowUpdatesResetsCandidates)
+    {
+        AZ::Entity* entity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(50.0f, 0.0f, 0.0f));
+        for (uint32_t tick = 0; tick < 3; ++tick)
+        {
+            UpdateGrid();
+        }
+        m_window->UpdateWindow();
+        EXPECT_TRUE(IsReplicated(entity));
+
+        // After the rebuild the grid tick passes the window's tick again, but the cell the entity moved to is stamped with an
+        // older tick than the one the window last saw
+        entity->GetTransform()->SetWorldTranslation(AZ::Vector3(70.0f, 0.0f, 0.0f));
+        m_grid->Clear();
+        for (uint32_t tick = 0; tick < 5; ++tick)
+        {
+            UpdateGrid();
+        }
+        m_window->UpdateWindow();
+        EXPECT_TRUE(IsReplicated(entity));
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityReplicationSchedulerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        // Inverse squared distance, matching the priorities generated by the server to client replication window
+        static float WindowPriority(float distance)
+        {
+            return 1.0f / (distance * distance);
+        }
+
+        const NetEntityId NearEntityId = NetEntityId{ 1 };
+        const NetEntityId FarEntityId = NetEntityId{ 2 };
+    };
+
+    TEST_F(EntityReplicationSchedulerTests, UnlimitedWithoutBudget)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.BeginSend(AZ::TimeMs{ 0 }, 0, AZ::TimeMs{ 100 });
+        EXPECT_FALSE(scheduler.IsBudgetLimited());
+
+        scheduler.OnEntitySent(NearEntityId, 1000);
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 0);
+        EXPECT_EQ(scheduler.GetEstimatedUpdateSize(NearEntityId), 1000);
+        EXPECT_EQ(scheduler.GetEstimatedUpdateSize(FarEntityId), EntityReplicationScheduler::DefaultEstimatedUpdateSize);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, BudgetRefillsOverTimeUpToBurst)
+    {
+        EntityReplicationScheduler scheduler;
+
+        // 10000 bytes per second with 100ms of burst
+        scheduler.BeginSend(AZ::TimeMs{ 1000 }, 10000, AZ::TimeMs{ 100 });
+        EXPECT_TRUE(scheduler.IsBudgetLimited());
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 1000);
+
+        scheduler.OnEntitySent(NearEntityId, 1500);
+        EXPECT_EQ(scheduler.GetAvailableBytes(), -500);
+
+        // Overspending is paid back before anything else can be sent
+        scheduler.BeginSend(AZ::TimeMs{ 1050 }, 10000, AZ::TimeMs{ 100 });
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 0);
+
+        // Unused budget doesn't grow beyond the burst size
+        scheduler.BeginSend(AZ::TimeMs{ 2050 }, 10000, AZ::TimeMs{ 100 });
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 1000);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, NearEntitiesAccumulateFaster)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.SetReferenceDistance(10.0f);
+        scheduler.SetMinDistanceFactor(0.01f);
+        scheduler.SetWindowPriority(NearEntityId, WindowPriority(5.0f));
+        scheduler.SetWindowPriority(FarEntityId, WindowPriority(100.0f));
+
+        EXPECT_FLOAT_EQ(scheduler.AccumulatePriority(NearEntityId, 1.0f), 1.0f);
+        EXPECT_FLOAT_EQ(scheduler.AccumulatePriority(FarEntityId, 1.0f), 0.01f);
+
+        // Type priority scales the accumulation rate
+        EXPECT_FLOAT_EQ(scheduler.AccumulatePriority(FarEntityId, 2.0f), 0.03f);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, StarvedEntitiesEventuallyOutrankNearEntities)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.SetReferenceDistance(10.0f);
+        scheduler.SetMinDistanceFactor(0.25f);
+        scheduler.SetWindowPriority(NearEntityId, WindowPriority(1.0f));
+        scheduler.SetWindowPriority(FarEntityId, WindowPriority(1000.0f));
+
+        // Only one entity fits each send, the near entity is sent whenever it has the highest priority
+        uint32_t farSendCount = 0;
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            const float nearPriority = scheduler.AccumulatePriority(NearEntityId, 1.0f);
+            const float farPriority = scheduler.AccumulatePriority(FarEntityId, 1.0f);
+            if (farPriority > nearPriority)
+            {
+                scheduler.OnEntitySent(FarEntityId, 100);
+                ++farSendCount;
+            }
+            else
+            {
+                scheduler.OnEntitySent(NearEntityId, 100);
+            }
+        }
+
+        EXPECT_GT(farSendCount, 0);
+        EXPECT_LT(farSendCount, 10);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, SelectProxiesInPriorityOrderUpToSendCount)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.BeginSend(AZ::TimeMs{ 0 }, 0, AZ::TimeMs{ 100 });
+
+        EntityReplicationScheduler::ProxyCandidateList candidates = {
+            { NetEntityId{ 1 }, 1.0f }, { NetEntityId{ 2 }, 3.0f }, { NetEntityId{ 3 }, 2.0f } };
+        EXPECT_EQ(scheduler.SelectProxies(candidates, 0, 2), 2);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 3 });
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, SelectProxiesStopsAtFirstCandidateThatDoesntFit)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.OnEntitySent(NetEntityId{ 2 }, 600);
+        scheduler.BeginSend(AZ::TimeMs{ 0 }, 10000, AZ::TimeMs{ 100 });
+
+        // 1000 bytes available, the second candidate doesn't fit after the first so the budget is saved up for it
+        EntityReplicationScheduler::ProxyCandidateList candidates = {
+            { NetEntityId{ 1 }, 3.0f }, { NetEntityId{ 2 }, 2.0f }, { NetEntityId{ 3 }, 1.0f } };
+        EXPECT_EQ(scheduler.SelectProxies(candidates, 600, 10), 1);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 1 });
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, SelectProxiesAdmitsHighestPriorityWhenBudgetIsFull)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.BeginSend(AZ::TimeMs{ 0 }, 10000, AZ::TimeMs{ 100 });
+
+        // Autonomous updates already use up the whole budget, waiting for more budget won't help
+        EntityReplicationScheduler::ProxyCandidateList candidates = { { NetEntityId{ 1 }, 1.0f }, { NetEntityId{ 2 }, 2.0f } };
+        EXPECT_EQ(scheduler.SelectProxies(candidates, 2000, 10), 1);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 2 });
+
+        // While the budget is refilling the proxy has to wait
+        scheduler.OnEntitySent(NetEntityId{ 2 }, 500);
+        scheduler.BeginSend(AZ::TimeMs{ 10 }, 10000, AZ::TimeMs{ 100 });
+        EXPECT_EQ(scheduler.SelectProxies(candidates, 2000, 10), 0);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, UpdateLargerThanBurstDoesNotStarveOthers)
+    {
+        EntityReplicationScheduler scheduler;
+        const NetEntityId largeEntityId = NetEntityId{ 1 };
+        const NetEntityId smallEntityId = NetEntityId{ 2 };
+
+        // 10000 bytes per second with 100ms of burst can never fit the 5000 byte update of the large entity
+        scheduler.OnEntitySent(largeEntityId, 5000);
+        AZ::TimeMs currentTimeMs = AZ::TimeMs{ 0 };
+        uint32_t largeSendCount = 0;
+        uint32_t smallSendCount = 0;
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            scheduler.BeginSend(currentTimeMs, 10000, AZ::TimeMs{ 100 });
+            EntityReplicationScheduler::ProxyCandidateList candidates = {
+                { largeEntityId, scheduler.AccumulatePriority(largeEntityId, 2.0f) },
+                { smallEntityId, scheduler.AccumulatePriority(smallEntityId, 1.0f) } };
+
+            const uint32_t selectedCount = scheduler.SelectProxies(candidates, 0, 10);
+            for (uint32_t index = 0; index < selectedCount; ++index)
+            {
+                const NetEntityId sentEntityId = candidates[index].m_netEntityId;
+                scheduler.OnEntitySent(sentEntityId, (sentEntityId == largeEntityId) ? 5000 : 100);
+                (sentEntityId == largeEntityId) ? ++largeSendCount : ++smallSendCount;
+            }
+            currentTimeMs += AZ::TimeMs{ 33 };
+        }
+
+        EXPECT_GT(largeSendCount, 0);
+        EXPECT_GT(smallSendCount, 0);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, RemoveEntityResetsState)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.AccumulatePriority(NearEntityId, 1.0f);
+        scheduler.OnEntitySent(NearEntityId, 42);
+        scheduler.AccumulatePriority(NearEntityId, 1.0f);
+
+        scheduler.RemoveEntity(NearEntityId);
+        EXPECT_EQ(scheduler.GetEstimatedUpdateSize(NearEntityId), EntityReplicationScheduler::DefaultEstimatedUpdateSize);
+        EXPECT_FLOAT_EQ(scheduler.AccumulatePriority(NearEntityId, 1.0f), 1.0f);
+    }
+}
@@ -12,6 +12,7 @@
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <AzTest/AzTest.h>
 #include <Multiplayer/Components/MultiplayerComponent.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
 
 namespace Multiplayer
 {
@@ -71,4 +72,27 @@ namespace Multiplayer
         EXPECT_EQ(valueMap.size(), NumTestEntriesPlusSize);
     }
 
+    TEST_F(MultiplayerComponentTests, FindNetComponentIdReturnsRegisteredComponents)
+    {
+        MultiplayerComponentRegistry registry;
+        EXPECT_EQ(registry.FindNetComponentId(AZ::Name("FirstComponent")), InvalidNetComponentId);
+
+        MultiplayerComponentRegistry::ComponentData firstComponentData;
+        firstComponentData.m_componentName = AZ::Name("FirstComponent");
+        const NetComponentId firstNetComponentId = registry.RegisterMultiplayerComponent(firstComponentData);
+
+        // Components excluded from the version check can still be found
+        MultiplayerComponentRegistry::ComponentData secondComponentData;
+        secondComponentData.m_componentName = AZ::Name("SecondComponent");
+        secondComponentData.m_includeInVersionCheck = false;
+        const NetComponentId secondNetComponentId = registry.RegisterMultiplayerComponent(secondComponentData);
+
+        EXPECT_EQ(registry.FindNetComponentId(AZ::Name("FirstComponent")), firstNetComponentId);
+        EXPECT_EQ(registry.FindNetComponentId(AZ::Name("SecondComponent")), secondNetComponentId);
+        EXPECT_EQ(registry.FindNetComponentId(AZ::Name("UnknownComponent")), InvalidNetComponentId);
+
+        registry.Reset();
+        EXPECT_EQ(registry.FindNetComponentId(AZ::Name("FirstComponent")), InvalidNetComponentId);
+    }
+
 } // namespace Multiplayer
@@ -579,4 +579,31 @@ namespace Multiplayer
         connection.SetUserData(&connectionUserData);
         EXPECT_FALSE(m_mpComponent->IsHandshakeComplete(&connection));
     }
+
+    TEST_F(MultiplayerSystemTests, TestFrameTimePercentiles)
+    {
+        MultiplayerStats stats;
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(0.5f), AZ::Time::ZeroTimeUs);
+
+        // Recorded out of order, percentiles are calculated over the sorted samples
+        for (int64_t frameTime = 100; frameTime >= 1; --frameTime)
+        {
+            stats.RecordFrameTime(AZ::TimeUs{ frameTime * 10 });
+        }
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(0.0f), AZ::TimeUs{ 10 });
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(0.5f), AZ::TimeUs{ 510 });
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(0.99f), AZ::TimeUs{ 990 });
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(1.0f), AZ::TimeUs{ 1000 });
+
+        // Out of range percentiles are clamped
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(-1.0f), AZ::TimeUs{ 10 });
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(2.0f), AZ::TimeUs{ 1000 });
+
+        // Only the most recent samples are kept
+        for (uint32_t i = 0; i < MultiplayerStats::FrameTimeSamples; ++i)
+        {
+            stats.RecordFrameTime(AZ::TimeUs{ 5 });
+        }
+        EXPECT_EQ(stats.CalculateFrameTimePercentile(1.0f), AZ::TimeUs{ 5 });
+    }
 } // namespace Multiplayer
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
+
+namespace Multiplayer
+{
+    //! Network time that can be rewound, the default benchmark network time is fixed at frame 0.
+    class RewindBenchmarkNetworkTime : public BenchmarkNetworkTime
+    {
+    public:
+        bool IsTimeRewound() const override
+        {
+            return m_hostFrameId != m_unalteredFrameId;
+        }
+
+        HostFrameId GetHostFrameId() const override
+        {
+            return m_hostFrameId;
+        }
+
+        HostFrameId GetUnalteredHostFrameId() const override
+        {
+            return m_unalteredFrameId;
+        }
+
+        float GetHostBlendFactor() const override
+        {
+            return m_blendFactor;
+        }
+
+        void AlterTime(HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
+        {
+            m_hostFrameId = frameId;
+            m_blendFactor = blendFactor;
+        }
+
+        void SetUnalteredFrameId(HostFrameId frameId)
+        {
+            m_unalteredFrameId = frameId;
+            m_hostFrameId = frameId;
+            m_blendFactor = DefaultBlendFactor;
+        }
+
+        HostFrameId m_hostFrameId = HostFrameId{ 0 };
+        HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
+        float m_blendFactor = DefaultBlendFactor;
+    };
+
+    /*
+     * Many entities, each with the hit volumes of an articulated character, and a full rewind history.
+     * Measures the cost of a single hit-scan shot: rewinding the hit volumes of every entity in the rewind volume and restoring them.
+     */
+    class RewindHistoryBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr int64_t MaxEntities = 1000;
+        static constexpr uint32_t VolumesPerEntity = 16;
+        static constexpr uint32_t RewindFrames = 10;
+        static constexpr float RewindBlendFactor = 0.5f;
+
+        using RewindableTransform = RewindableObject<AZ::Transform, RewindHistorySize>;
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            AZ::Interface<INetworkTime>::Unregister(m_NetworkTime.get());
+            AZ::Interface<INetworkTime>::Register(&m_rewindNetworkTime);
+
+            m_rewindableTransforms.resize(MaxEntities * VolumesPerEntity);
+            m_volumeRanges.resize(MaxEntities);
+            for (RewindVolumeRange& range : m_volumeRanges)
+            {
+                range = m_store.AllocateVolumes(VolumesPerEntity);
+            }
+
+            // Record a full history for every volume
+            for (uint32_t frame = 0; frame < RewindHistorySize; ++frame)
+            {
+                m_rewindNetworkTime.SetUnalteredFrameId(HostFrameId{ frame });
+                for (uint32_t entity = 0; entity < MaxEntities; ++entity)
+                {
+                    for (uint32_t volume = 0; volume < VolumesPerEntity; ++volume)
+                    {
+                        const AZ::Transform transform = AZ::Transform::CreateTranslation(
+                            AZ::Vector3(aznumeric_cast<float>(entity), aznumeric_cast<float>(volume), aznumeric_cast<float>(frame)));
+                        m_rewindableTransforms[entity * VolumesPerEntity + volume] = transform;
+                        m_store.SetTransform(m_volumeRanges[entity], volume, HostFrameId{ frame }, transform);
+                    }
+                }
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_rewindableTransforms = {};
+            for (RewindVolumeRange& range : m_volumeRanges)
+            {
+                m_store.FreeVolumes(range);
+            }
+            m_volumeRanges = {};
+
+            AZ::Interface<INetworkTime>::Unregister(&m_rewindNetworkTime);
+            AZ::Interface<INetworkTime>::Register(m_NetworkTime.get());
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        // Mirrors how hit volumes were synced when each volume kept its own RewindableObject history
+        AZ::Vector3 SyncRewindableTransforms(int64_t entityCount)
+        {
+            AZ::Vector3 result = AZ::Vector3::CreateZero();
+            const float blendFactor = m_rewindNetworkTime.GetHostBlendFactor();
+            for (int64_t index = 0; index < entityCount * VolumesPerEntity; ++index)
+            {
+                const RewindableTransform& rewindable = m_rewindableTransforms[index];
+                AZ::Vector3 translation = rewindable.Get().GetTranslation();
+                if (blendFactor < 1.0f)
+                {
+                    translation = rewindable.GetPrevious().GetTranslation().Lerp(translation, blendFactor);
+                }
+                result += translation;
+            }
+            return result;
+        }
+
+        AZ::Vector3 SyncStoreTransforms(int64_t entityCount)
+        {
+            AZ::Vector3 result = AZ::Vector3::CreateZero();
+            for (int64_t entity = 0; entity < entityCount; ++entity)
+            {
+                m_store.GetTransforms(m_volumeRanges[entity], m_rewindNetworkTime.GetHostFrameId(), m_rewindNetworkTime.GetHostBlendFactor(), m_transforms);
+                for (const AZ::Transform& transform : m_transforms)
+                {
+                    result += transform.GetTranslation();
+                }
+            }
+            return result;
+        }
+
+        template <typename SYNC_FUNCTION>
+        void RewindShots(benchmark::State& state, const SYNC_FUNCTION& syncFunction)
+        {
+            const int64_t entityCount = state.range(0);
+            const HostFrameId currentFrameId = HostFrameId{ RewindHistorySize - 1 };
+            m_rewindNetworkTime.SetUnalteredFrameId(currentFrameId);
+            for ([[maybe_unused]] auto value : state)
+            {
+                // Rewind all entities to the frame the shooter saw, then restore them
+                m_rewindNetworkTime.AlterTime(currentFrameId - HostFrameId{ RewindFrames }, AZ::Time::ZeroTimeMs, RewindBlendFactor, AzNetworking::InvalidConnectionId);
+                benchmark::DoNotOptimize(syncFunction(entityCount));
+                m_rewindNetworkTime.SetUnalteredFrameId(currentFrameId);
+                benchmark::DoNotOptimize(syncFunction(entityCount));
+            }
+
+            // Items are shots, so the reported rate reflects the rewind cost per shot for the given number of entities
+            state.SetItemsProcessed(state.iterations());
+        }
+
+        RewindBenchmarkNetworkTime m_rewindNetworkTime;
+        AZStd::vector<RewindableTransform> m_rewindableTransforms;
+        RewindHistoryStore m_store;
+        AZStd::vector<RewindVolumeRange> m_volumeRanges;
+        AZStd::vector<AZ::Transform> m_transforms;
+    };
+
+    BENCHMARK_DEFINE_F(RewindHistoryBenchmark, RewindShotRewindableObjects)(benchmark::State& state)
+    {
+        RewindShots(state, [this](int64_t entityCount) { return SyncRewindableTransforms(entityCount); });
+    }
+
+    BENCHMARK_DEFINE_F(RewindHistoryBenchmark, RewindShotHistoryStore)(benchmark::State& state)
+    {
+        RewindShots(state, [this](int64_t entityCount) { return SyncStoreTransforms(entityCount); });
+    }
+
+    BENCHMARK_REGISTER_F(RewindHistoryBenchmark, RewindShotRewindableObjects)
+        ->Arg(10)->Arg(100)->Arg(RewindHistoryBenchmark::MaxEntities)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(RewindHistoryBenchmark, RewindShotHistoryStore)
+        ->Arg(10)->Arg(100)->Arg(RewindHistoryBenchmark::MaxEntities)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
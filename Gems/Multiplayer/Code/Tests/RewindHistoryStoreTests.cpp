@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/RewindHistoryStore.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class RewindHistoryStoreTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZ::Transform CreateTransform(float x)
+        {
+            return AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(x * 0.01f), AZ::Vector3(x, 0.0f, 0.0f));
+        }
+
+        float GetTranslationX(const Multiplayer::RewindVolumeRange& range, uint32_t volumeIndex, uint32_t frameId, float blendFactor = 1.0f)
+        {
+            m_store.GetTransforms(range, Multiplayer::HostFrameId{ frameId }, blendFactor, m_transforms);
+            return m_transforms[volumeIndex].GetTranslation().GetX();
+        }
+
+        AZ::LoggerSystemComponent m_loggerComponent;
+        Multiplayer::RewindHistoryStore m_store;
+        AZStd::vector<AZ::Transform> m_transforms;
+    };
+
+    TEST_F(RewindHistoryStoreTests, AllocatedRangesAreReusedAndCoalesced)
+    {
+        Multiplayer::RewindVolumeRange first = m_store.AllocateVolumes(4);
+        Multiplayer::RewindVolumeRange second = m_store.AllocateVolumes(4);
+        Multiplayer::RewindVolumeRange third = m_store.AllocateVolumes(4);
+        EXPECT_EQ(first.m_start, 0);
+        EXPECT_EQ(second.m_start, 4);
+        EXPECT_EQ(third.m_start, 8);
+        EXPECT_EQ(m_store.GetAllocatedVolumeCount(), 12);
+
+        m_store.FreeVolumes(first);
+        m_store.FreeVolumes(second);
+        EXPECT_EQ(first.m_count, 0);
+        EXPECT_EQ(m_store.GetAllocatedVolumeCount(), 4);
+
+        // The two freed neighbouring ranges should be merged into a single range large enough for this allocation
+        const Multiplayer::RewindVolumeRange reused = m_store.AllocateVolumes(8);
+        EXPECT_EQ(reused.m_start, 0);
+        EXPECT_EQ(m_store.GetCapacity(), 12);
+
+        const Multiplayer::RewindVolumeRange empty = m_store.AllocateVolumes(0);
+        EXPECT_EQ(empty.m_count, 0);
+    }
+
+    TEST_F(RewindHistoryStoreTests, RewindsToRecordedFrames)
+    {
+        const Multiplayer::RewindVolumeRange range = m_store.AllocateVolumes(2);
+        for (uint32_t frame = 100; frame < 150; ++frame)
+        {
+            m_store.SetTransform(range, 0, Multiplayer::HostFrameId{ frame }, CreateTransform(aznumeric_cast<float>(frame)));
+            m_store.SetTransform(range, 1, Multiplayer::HostFrameId{ frame }, CreateTransform(-aznumeric_cast<float>(frame)));
+        }
+
+        for (uint32_t frame = 100; frame < 150; ++frame)
+        {
+            EXPECT_FLOAT_EQ(GetTranslationX(range, 0, frame), aznumeric_cast<float>(frame));
+            EXPECT_FLOAT_EQ(GetTranslationX(range, 1, frame), -aznumeric_cast<float>(frame));
+        }
+
+        // Frames newer than the latest write return the latest value
+        EXPECT_FLOAT_EQ(GetTranslationX(range, 0, 200), 149.0f);
+
+        // Blending interpolates from the preceding frame
+        EXPECT_FLOAT_EQ(GetTranslationX(range, 0, 120, 0.25f), 119.25f);
+    }
+
+    TEST_F(RewindHistoryStoreTests, SkippedFramesRepeatPreviousValue)
+    {
+        const Multiplayer::RewindVolumeRange range = m_store.AllocateVolumes(1);
+        m_store.SetTransform(range, 0, Multiplayer::HostFrameId{ 10 }, CreateTransform(1.0f));
+        m_store.SetTransform(range, 0, Multiplayer::HostFrameId{ 15 }, CreateTransform(2.0f));
+
+        for (uint32_t frame = 10; frame < 15; ++frame)
+        {
+            EXPECT_FLOAT_EQ(GetTranslationX(range, 0, frame), 1.0f);
+        }
+        EXPECT_FLOAT_EQ(GetTranslationX(range, 0, 15), 2.0f);
+
+        // Writes older than the latest value are ignored
+        m_store.SetTransform(range, 0, Multiplayer::HostFrameId{ 12 }, CreateTransform(3.0f));
+        EXPECT_FLOAT_EQ(GetTranslationX(range, 0, 12), 1.0f);
+    }
+
+    TEST_F(RewindHistoryStoreTests, OldRequestsClampToOldestFrame)
+    {
+        const Multiplayer::RewindVolumeRange range = m_store.AllocateVolumes(1);
+        const uint32_t lastFrame = Multiplayer::RewindHistorySize * 3;
+        for (uint32_t frame = 0; frame <= lastFrame; ++frame)
+        {
+            m_store.SetTransform(range, 0, Multiplayer::HostFrameId{ frame }, CreateTransform(aznumeric_cast<float>(frame)));
+        }
+
+        const float oldestFrame = aznumeric_cast<float>(lastFrame - Multiplayer::RewindHistorySize + 1);
+        EXPECT_FLOAT_EQ(GetTranslationX(range, 0, lastFrame - Multiplayer::RewindHistorySize + 1), oldestFrame);
+        EXPECT_FLOAT_EQ(GetTranslationX(range, 0, 0), oldestFrame);
+    }
+
+    TEST_F(RewindHistoryStoreTests, FreedVolumesLoseHistory)
+    {
+        Multiplayer::RewindVolumeRange range = m_store.AllocateVolumes(1);
+        m_store.SetTransform(range, 0, Multiplayer::HostFrameId{ 5 }, CreateTransform(7.0f));
+        m_store.FreeVolumes(range);
+
+        const Multiplayer::RewindVolumeRange reused = m_store.AllocateVolumes(1);
+        m_store.GetTransforms(reused, Multiplayer::HostFrameId{ 5 }, 1.0f, m_transforms);
+        EXPECT_TRUE(m_transforms[0].IsClose(AZ::Transform::CreateIdentity()));
+    }
+}
@@ -33,7 +33,10 @@ set(FILES
     Include/Multiplayer/NetworkEntity/NetworkEntityHandle.inl
     Include/Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h
     Include/Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/EntityDeltaCache.h
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicationScheduler.h
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h
     Include/Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.inl
     Include/Multiplayer/ConnectionData/IConnectionData.h
@@ -55,6 +58,8 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/NetworkTime/RewindHistoryStore.h
+    Include/Multiplayer/ReplicationWindows/EntityInterestGrid.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Include/Multiplayer/Session/IMatchmakingRequests.h
     Include/Multiplayer/Session/ISessionHandlingRequests.h
@@ -82,12 +87,17 @@ set(FILES
     Source/NetworkEntity/NetworkEntityTracker.h
     Source/NetworkEntity/NetworkEntityTracker.inl
     Source/NetworkEntity/NetworkEntityUpdateMessage.cpp
+    Source/NetworkEntity/EntityReplication/EntityDeltaCache.cpp
+    Source/NetworkEntity/EntityReplication/EntityBaselineHistory.cpp
+    Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.cpp
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
     Source/NetworkInput/NetworkInput.cpp
     Source/NetworkInput/NetworkInputArray.cpp
     Source/NetworkInput/NetworkInputChild.cpp
     Source/NetworkInput/NetworkInputHistory.cpp
     Source/NetworkInput/NetworkInputMigrationVector.cpp
+    Source/NetworkTime/RewindHistoryStore.cpp
+    Source/ReplicationWindows/EntityInterestGrid.cpp
     Source/Session/MatchmakingRequests.cpp
     Source/Session/SessionRequests.cpp
     Source/Session/SessionConfig.cpp
@@ -32,6 +32,8 @@ set(FILES
     Source/AutoGen/NetworkTransformComponent.AutoComponent.xml
     Source/AutoGen/NetworkHierarchyChildComponent.AutoComponent.xml
     Source/AutoGen/NetworkHierarchyRootComponent.AutoComponent.xml
+    Source/BotClients/MultiplayerBotClients.cpp
+    Source/BotClients/MultiplayerBotClients.h
     Source/Components/LocalPredictionPlayerInputComponent.cpp
     Source/Components/NetworkHierarchyChildComponent.cpp
     Source/Components/NetworkHierarchyRootComponent.cpp
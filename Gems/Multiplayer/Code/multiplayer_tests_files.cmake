@@ -14,6 +14,11 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
+    Tests/EntityDeltaCacheBenchmarks.cpp
+    Tests/EntityBaselineHistoryTests.cpp
+    Tests/EntityDeltaCacheTests.cpp
+    Tests/EntityInterestGridTests.cpp
+    Tests/EntityReplicationSchedulerTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
@@ -32,6 +37,8 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/RewindHistoryStoreBenchmarks.cpp
+    Tests/RewindHistoryStoreTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
     Tests/TestMultiplayerComponent.h